@@ -0,0 +1,269 @@
+#include "BlobFile.hpp"
+
+#include <zlib.h>
+
+#include <algorithm>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+
+BlobFile::BlobFile(std::string const &filename) : file(filename) {
+	auto fail = [&](std::string const &what) {
+		throw std::runtime_error("Invalid blob '" + filename + "': " + what);
+	};
+
+	bool toc1 = (file.size >= 8 && std::memcmp(file.data, "toc1", 4) == 0);
+	if (toc1 || (file.size >= 8 && std::memcmp(file.data, "toc0", 4) == 0)) {
+		size_t entry_size = (toc1 ? sizeof(Entry1) : sizeof(Entry));
+		uint32_t count = 0;
+		std::memcpy(&count, file.data + 4, 4);
+		if (count > (file.size - 8) / entry_size) fail("table of contents runs past the end of the file.");
+		uint64_t toc_end = 8 + uint64_t(count) * entry_size;
+
+		chunks.reserve(count);
+		for (uint32_t i = 0; i < count; ++i) {
+			chunks.emplace_back();
+			Chunk &chunk = chunks.back();
+			if (toc1) {
+				Entry1 entry;
+				std::memcpy(&entry, file.data + 8 + i * entry_size, sizeof(Entry1));
+				chunk.type = std::string(entry.type, 4);
+				chunk.offset = entry.offset;
+				chunk.size = entry.size;
+				chunk.raw_size = entry.raw_size;
+				chunk.compressed = (entry.compression == Deflated);
+				chunk.checksum = entry.checksum;
+				if (entry.compression != Stored && entry.compression != Deflated) {
+					fail("chunk '" + chunk.type + "' is compressed in a way this version doesn't know.");
+				}
+				if (!chunk.compressed && chunk.raw_size != chunk.size) {
+					fail("chunk '" + chunk.type + "' isn't compressed, but has two different sizes.");
+				}
+			} else {
+				Entry entry;
+				std::memcpy(&entry, file.data + 8 + i * entry_size, sizeof(Entry));
+				chunk.type = std::string(entry.type, 4);
+				chunk.offset = entry.offset;
+				chunk.size = chunk.raw_size = entry.size;
+				chunk.checksum = entry.checksum;
+			}
+			chunk.has_checksum = true;
+			if (chunk.offset < toc_end || chunk.offset > file.size || chunk.size > file.size - chunk.offset) {
+				fail("chunk '" + chunk.type + "' isn't inside the file.");
+			}
+		}
+	} else {
+		//old blobs are just chunks back to back, each with a header:
+		sequential = true;
+		struct ChunkHeader {
+			char magic[4];
+			uint32_t size;
+		};
+		static_assert(sizeof(ChunkHeader) == 8, "header is packed");
+		uint64_t at = 0;
+		while (at < file.size) {
+			if (file.size - at < sizeof(ChunkHeader)) {
+				std::cerr << "WARNING: trailing data in '" << filename << "'." << std::endl;
+				break;
+			}
+			ChunkHeader header;
+			std::memcpy(&header, file.data + at, sizeof(header));
+			at += sizeof(ChunkHeader);
+			if (header.size > file.size - at) fail("chunk '" + std::string(header.magic, 4) + "' runs past the end of the file.");
+			chunks.emplace_back();
+			chunks.back().type = std::string(header.magic, 4);
+			chunks.back().offset = at;
+			chunks.back().size = chunks.back().raw_size = header.size;
+			at += header.size;
+		}
+	}
+
+	for (uint32_t i = 0; i < chunks.size(); ++i) {
+		for (uint32_t j = 0; j < i; ++j) {
+			if (chunks[i].type == chunks[j].type) fail("more than one '" + chunks[i].type + "' chunk.");
+		}
+	}
+}
+
+BlobFile::Chunk const *BlobFile::find(std::string const &type) const {
+	for (Chunk const &chunk : chunks) {
+		if (chunk.type == type) return &chunk;
+	}
+	return nullptr;
+}
+
+BlobFile::Chunk const &BlobFile::use(std::string const &type) const {
+	Chunk const *chunk = find(type);
+	if (!chunk) {
+		throw std::runtime_error("Blob '" + file.filename + "' has no '" + type + "' chunk.");
+	}
+	if (chunk->has_checksum && !chunk->checked) {
+		if (crc32(file.data + chunk->offset, size_t(chunk->size)) != chunk->checksum) {
+			throw std::runtime_error("Chunk '" + type + "' in blob '" + file.filename + "' is damaged (its checksum doesn't match).");
+		}
+		chunk->checked = true;
+	}
+	return *chunk;
+}
+
+void BlobFile::prefetch(Chunk const &chunk) const {
+	file.prefetch(size_t(chunk.offset), size_t(chunk.size));
+}
+
+BlobFile::Reader::Reader(BlobFile const &blob_, std::string const &type) : blob(blob_), chunk(blob_.use(type)) {
+	if (chunk.compressed) {
+		stream = new z_stream(); //(zeroed, so zlib uses its own allocator)
+		if (inflateInit(stream) != Z_OK) {
+			delete stream;
+			throw std::runtime_error("Failed to start inflating chunk '" + chunk.type + "' in blob '" + blob.file.filename + "'.");
+		}
+	}
+}
+
+BlobFile::Reader::~Reader() {
+	if (stream) {
+		inflateEnd(stream);
+		delete stream;
+		stream = nullptr;
+	}
+}
+
+void BlobFile::Reader::read(void *data_, size_t size) {
+	if (size > chunk.raw_size - done) {
+		throw std::runtime_error("Tried to read past the end of chunk '" + chunk.type + "' in blob '" + blob.file.filename + "'.");
+	}
+	uint8_t const *in = blob.file.data + chunk.offset;
+	uint8_t *data = reinterpret_cast< uint8_t * >(data_);
+	if (!chunk.compressed) {
+		std::memcpy(data, in + done, size);
+		done += size;
+		return;
+	}
+
+	auto damaged = [&]() {
+		throw std::runtime_error("Chunk '" + chunk.type + "' in blob '" + blob.file.filename + "' is damaged (it doesn't inflate to its size).");
+	};
+	//(once the last byte is out, inflate once more, to check the stream really ends there)
+	bool last = (done + size == chunk.raw_size);
+	while (true) {
+		//(zlib counts in 32 bits, so input and output are handed over at most 1GB at a time)
+		if (stream->avail_in == 0 && fed < chunk.size) {
+			stream->next_in = const_cast< Bytef * >(in + fed);
+			stream->avail_in = uInt(std::min< uint64_t >(chunk.size - fed, 1U << 30));
+			fed += stream->avail_in;
+		}
+		uInt want = uInt(std::min< size_t >(size, 1U << 30));
+		stream->next_out = data;
+		stream->avail_out = want;
+		int ret = inflate(stream, Z_NO_FLUSH);
+		size_t produced = want - stream->avail_out;
+		data += produced;
+		size -= produced;
+		done += produced;
+
+		if (ret == Z_STREAM_END) {
+			if (size > 0 || done != chunk.raw_size) damaged();
+			return;
+		}
+		if (ret == Z_BUF_ERROR) {
+			//(no progress: either out of input, which is refilled above if there's any left, or too much output)
+			if (stream->avail_in == 0 && fed < chunk.size) continue;
+			damaged();
+		}
+		if (ret != Z_OK) damaged();
+		if (size == 0 && !last) return;
+	}
+}
+
+void BlobFile::write(std::string const &filename, std::vector< Output > const &chunks) {
+	//deflate the chunks that ask for it (keeping the result only if it's smaller):
+	std::vector< std::vector< uint8_t > > deflated(chunks.size());
+	bool any_compressed = false;
+	for (uint32_t i = 0; i < chunks.size(); ++i) {
+		Output const &chunk = chunks[i];
+		if (!chunk.compress || chunk.data.empty()) continue;
+		uLongf size = compressBound(uLong(chunk.data.size()));
+		deflated[i].resize(size);
+		if (compress2(deflated[i].data(), &size, chunk.data.data(), uLong(chunk.data.size()), Z_BEST_COMPRESSION) != Z_OK) {
+			throw std::runtime_error("Failed to deflate chunk '" + chunk.type + "'.");
+		}
+		deflated[i].resize(size);
+		if (deflated[i].size() >= chunk.data.size()) deflated[i].clear();
+		else any_compressed = true;
+	}
+
+	//table of contents (only blobs with compressed chunks need the longer entries), then each chunk at its alignment:
+	size_t entry_size = (any_compressed ? sizeof(Entry1) : sizeof(Entry));
+	std::vector< uint8_t > header(8 + chunks.size() * entry_size, 0);
+	std::memcpy(header.data(), (any_compressed ? "toc1" : "toc0"), 4);
+	uint32_t count = uint32_t(chunks.size());
+	std::memcpy(header.data() + 4, &count, 4);
+
+	uint64_t at = header.size();
+	std::vector< uint64_t > offsets;
+	std::vector< std::vector< uint8_t > const * > stored;
+	for (uint32_t i = 0; i < chunks.size(); ++i) {
+		Output const &chunk = chunks[i];
+		if (chunk.type.size() != 4) throw std::runtime_error("Chunk type '" + chunk.type + "' isn't four characters.");
+		if (chunk.alignment == 0 || chunk.alignment % 16 != 0) throw std::runtime_error("Chunk '" + chunk.type + "' has an alignment that isn't a multiple of 16.");
+		at = (at + chunk.alignment - 1) / chunk.alignment * chunk.alignment;
+		offsets.emplace_back(at);
+		stored.emplace_back(deflated[i].empty() ? &chunk.data : &deflated[i]);
+
+		if (any_compressed) {
+			Entry1 entry;
+			std::memcpy(entry.type, chunk.type.data(), 4);
+			entry.checksum = crc32(stored.back()->data(), stored.back()->size());
+			entry.compression = (deflated[i].empty() ? Stored : Deflated);
+			entry.reserved = 0;
+			entry.offset = at;
+			entry.size = stored.back()->size();
+			entry.raw_size = chunk.data.size();
+			std::memcpy(header.data() + 8 + i * entry_size, &entry, sizeof(Entry1));
+		} else {
+			Entry entry;
+			std::memcpy(entry.type, chunk.type.data(), 4);
+			entry.checksum = crc32(chunk.data.data(), chunk.data.size());
+			entry.offset = at;
+			entry.size = chunk.data.size();
+			std::memcpy(header.data() + 8 + i * entry_size, &entry, sizeof(Entry));
+		}
+		at += stored.back()->size();
+	}
+
+	std::ofstream out(filename, std::ios::binary);
+	out.write(reinterpret_cast< char const * >(header.data()), header.size());
+	uint64_t written = header.size();
+	static char const zeros[4096] = { 0 };
+	for (uint32_t i = 0; i < chunks.size(); ++i) {
+		while (written < offsets[i]) {
+			uint64_t pad = std::min< uint64_t >(sizeof(zeros), offsets[i] - written);
+			out.write(zeros, pad);
+			written += pad;
+		}
+		out.write(reinterpret_cast< char const * >(stored[i]->data()), stored[i]->size());
+		written += stored[i]->size();
+	}
+	out.close();
+	if (!out) throw std::runtime_error("Failed to write blob '" + filename + "'.");
+}
+
+uint32_t BlobFile::crc32(uint8_t const *data, size_t size) {
+	//(reflected polynomial 0xedb88320, one table lookup per byte)
+	static uint32_t const *table = []() {
+		static uint32_t t[256];
+		for (uint32_t i = 0; i < 256; ++i) {
+			uint32_t c = i;
+			for (uint32_t k = 0; k < 8; ++k) {
+				c = (c & 1 ? 0xedb88320U ^ (c >> 1) : c >> 1);
+			}
+			t[i] = c;
+		}
+		return t;
+	}();
+	uint32_t crc = 0xffffffffU;
+	for (size_t i = 0; i < size; ++i) {
+		crc = table[(crc ^ data[i]) & 0xff] ^ (crc >> 8);
+	}
+	return crc ^ 0xffffffffU;
+}
@@ -0,0 +1,130 @@
+#pragma once
+
+#include "MappedFile.hpp"
+
+#include <cstdint>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+//BlobFile is a container of typed chunks (e.g., "dat0" vertex data, "str0" names, "idx0" a mesh index)
+// with a table of contents at the front, so loaders can go straight to the chunks they need:
+//
+//  "toc0" magic, uint32_t chunk count
+//  one Entry per chunk: type, CRC-32 of its data, offset (from the start of the file), size
+//  chunk data, each starting at a multiple of 16 bytes
+//
+//Blobs with compressed chunks have "toc1" and an Entry1 per chunk instead, which also says how the
+// chunk is stored (as is, or zlib-deflated) and its size once inflated. Compressed chunks can't be
+// used in place; they're inflated a block at a time with a Reader, straight to wherever they're
+// going (e.g., a mapped OpenGL buffer), so there's never a full-size copy on the CPU.
+//
+//The file is mapped (see MappedFile), so pages are only read from disk as chunks are used; chunks
+// nobody asks for (unknown types, or mesh sets that aren't needed) cost nothing beyond their entry.
+//A chunk's checksum is checked the first time it is used.
+//Blobs from before the table of contents (chunks back to back, each with an 8-byte type + size
+// header) can still be opened; their chunks just don't have checksums.
+struct BlobFile {
+	//throws if the file can't be mapped or its table of contents doesn't make sense:
+	BlobFile(std::string const &filename);
+
+	MappedFile file;
+
+	//table of contents, in the order chunks appear:
+	struct Entry {
+		char type[4];
+		uint32_t checksum; //CRC-32 (the same one as zlib's crc32) of the chunk's data
+		uint64_t offset;
+		uint64_t size;
+	};
+	static_assert(sizeof(Entry) == 24, "Entry should be packed.");
+	struct Entry1 {
+		char type[4];
+		uint32_t checksum; //CRC-32 of the chunk's data as stored (i.e., compressed)
+		uint32_t compression; //Stored or Deflated
+		uint32_t reserved; //(zero)
+		uint64_t offset;
+		uint64_t size; //(as stored)
+		uint64_t raw_size; //(once inflated)
+	};
+	static_assert(sizeof(Entry1) == 40, "Entry1 should be packed.");
+	enum Compression : uint32_t {
+		Stored = 0,
+		Deflated = 1, //zlib stream
+	};
+	struct Chunk {
+		std::string type;
+		uint64_t offset = 0;
+		uint64_t size = 0; //(as stored)
+		uint64_t raw_size = 0; //(once inflated; the same as 'size' if it isn't compressed)
+		bool compressed = false;
+		uint32_t checksum = 0;
+		bool has_checksum = false; //(chunks in old sequential blobs don't have one)
+		mutable bool checked = false; //(set once the checksum has been checked)
+	};
+	std::vector< Chunk > chunks;
+	bool sequential = false; //true if the blob predates the table of contents
+
+	//the chunk of a given type, or nullptr if there isn't one:
+	Chunk const *find(std::string const &type) const;
+
+	//the data of the chunk of a given type, used in place (valid as long as the BlobFile is) as
+	// '*count' elements of type T; throws if there is no such chunk, its checksum doesn't match,
+	// it's compressed, or it isn't a whole number of suitably-aligned elements:
+	template< typename T >
+	T const *get(std::string const &type, size_t *count) const {
+		Chunk const &chunk = use(type);
+		if (chunk.compressed) {
+			throw std::runtime_error("Chunk '" + type + "' in '" + file.filename + "' is compressed, so it can't be used in place.");
+		}
+		if (chunk.size % sizeof(T) != 0) {
+			throw std::runtime_error("Size of chunk '" + type + "' in '" + file.filename + "' not divisible by element size.");
+		}
+		//(mappings are page-aligned, so this is really a check on where the chunk is in the file)
+		if (reinterpret_cast< uintptr_t >(file.data + chunk.offset) % alignof(T) != 0) {
+			throw std::runtime_error("Chunk '" + type + "' in '" + file.filename + "' isn't aligned for its element type, so it can't be used in place.");
+		}
+		*count = size_t(chunk.size / sizeof(T));
+		return reinterpret_cast< T const * >(file.data + chunk.offset);
+	}
+
+	//the chunk of a given type, with its checksum checked; throws if it's missing or damaged:
+	Chunk const &use(std::string const &type) const;
+	//start reading a chunk's pages in from disk (call just before it's used in full, e.g. uploaded):
+	void prefetch(Chunk const &chunk) const;
+
+	//reads a chunk's data (inflating it, if it's compressed) in order, as many bytes at a time as asked for:
+	struct Reader {
+		//throws if there is no such chunk or its checksum doesn't match:
+		Reader(BlobFile const &blob, std::string const &type);
+		~Reader();
+		Reader(Reader const &) = delete;
+		Reader &operator=(Reader const &) = delete;
+
+		BlobFile const &blob;
+		Chunk const &chunk;
+		uint64_t done = 0; //bytes read so far (of chunk.raw_size)
+
+		//writes the chunk's next 'size' bytes to 'data'; throws if there aren't that many, or the data is damaged:
+		void read(void *data, size_t size);
+
+		struct z_stream_s *stream = nullptr; //(zlib's inflate state, for compressed chunks)
+		uint64_t fed = 0; //(bytes of the compressed chunk handed to zlib so far)
+	};
+
+	//------- writing -------
+
+	//a chunk for write():
+	struct Output {
+		std::string type; //(four characters)
+		std::vector< uint8_t > data;
+		uint32_t alignment = 16; //chunk starts at a multiple of this (itself a multiple of 16)
+		bool compress = false; //deflate it (if that makes it smaller)
+	};
+	//writes a blob (with a table of contents -- "toc1" if any chunk ended up compressed, "toc0" otherwise)
+	// holding 'chunks', in order; throws on error:
+	static void write(std::string const &filename, std::vector< Output > const &chunks);
+
+	//CRC-32 (as in zlib, PNG, and python's zlib.crc32) of 'size' bytes:
+	static uint32_t crc32(uint8_t const *data, size_t size);
+};
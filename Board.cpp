@@ -0,0 +1,333 @@
+#include "Board.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+#include <stdexcept>
+#include <string>
+
+void BoardMeshes::lookup(MeshBlob const &blob) {
+	struct Wanted {
+		char const *name;
+		uint32_t id;
+		Mesh *mesh;
+		Mesh *lod;
+	};
+	//(the ids are hashed at compile time)
+	constexpr uint32_t Wall = mesh_id("Wall");
+	constexpr uint32_t Floor = mesh_id("Floor");
+	constexpr uint32_t Player = mesh_id("Player");
+	constexpr uint32_t Goop = mesh_id("Goop");
+	constexpr uint32_t Checkpoint = mesh_id("Checkpoint");
+	constexpr uint32_t CheckpointCollected = mesh_id("CheckpointCollected");
+	constexpr uint32_t Goal = mesh_id("Goal");
+	constexpr uint32_t Score = mesh_id("Score");
+	constexpr uint32_t Instructions = mesh_id("Instructions");
+	Wanted const wanted[] = {
+		{ "Wall", Wall, &wall, &lod.wall },
+		{ "Floor", Floor, &floor, &lod.floor },
+		{ "Player", Player, &player, &lod.player },
+		{ "Goop", Goop, &goop, &lod.goop },
+		{ "Checkpoint", Checkpoint, &checkpoint, &lod.checkpoint },
+		{ "CheckpointCollected", CheckpointCollected, &checkpoint_collected, &lod.checkpoint_collected },
+		{ "Goal", Goal, &goal, &lod.goal },
+		{ "Score", Score, &score, nullptr },
+		{ "Instructions", Instructions, &instructions, nullptr },
+	};
+
+	//check everything is there first, so one error lists every missing mesh:
+	std::string missing;
+	for (Wanted const &w : wanted) {
+		if (!blob.find(w.id)) missing += std::string(missing.empty() ? "" : ", ") + "'" + w.name + "'";
+	}
+	if (!missing.empty()) {
+		throw std::runtime_error("Meshes " + missing + " do not appear in the mesh blob.");
+	}
+
+	tile_min = glm::vec3(std::numeric_limits< float >::infinity());
+	tile_max = glm::vec3(-std::numeric_limits< float >::infinity());
+	for (Wanted const &w : wanted) {
+		MeshBlob::Entry const *entry = blob.find(w.id);
+		*w.mesh = entry->mesh;
+		if (w.lod) {
+			MeshBlob::Entry const *lod_entry = blob.find(mesh_id(".lod", w.id));
+			*w.lod = (lod_entry ? lod_entry->mesh : *w.mesh);
+			//(meshes with low-detail versions are the tiles)
+			tile_min = glm::min(tile_min, entry->min);
+			tile_max = glm::max(tile_max, entry->max);
+		}
+	}
+}
+
+Mesh const &BoardMeshes::low_detail(Mesh const *mesh) const {
+	if (mesh == &wall) return lod.wall;
+	if (mesh == &floor) return lod.floor;
+	if (mesh == &player) return lod.player;
+	if (mesh == &goop) return lod.goop;
+	if (mesh == &checkpoint) return lod.checkpoint;
+	if (mesh == &checkpoint_collected) return lod.checkpoint_collected;
+	if (mesh == &goal) return lod.goal;
+	return *mesh;
+}
+
+Board::Board(BoardMeshes const *meshes_, glm::uvec2 size_) : meshes(meshes_), size(size_) {
+	assert(meshes);
+	assert(size.x >= 3 && size.y >= 3);
+	board_meshes.resize(size.x * size.y, nullptr);
+	goal_meshes.resize(size.x * size.y, nullptr);
+}
+
+//weird shear transform that will be applied during projection for artistic reasons:
+glm::mat4 const Board::shear = glm::mat4(
+	1.0f, 0.0f, 0.0f, 0.0f,
+	-0.07f, 0.9f, 0.0f, 0.0f,
+	 0.0f, 0.2f, 1.0f, 0.0f,
+	 0.0f, 0.0f, 0.0f, 1.0f
+);
+
+glm::mat4 Board::world_to_clip(glm::uvec2 drawable_size) const {
+	float aspect = float(drawable_size.x) / float(drawable_size.y);
+
+	//figure out bounding box of board when transformed by shear:
+	glm::vec2 board_min = glm::vec2(std::numeric_limits< float >::infinity());
+	glm::vec2 board_max = glm::vec2(-std::numeric_limits< float >::infinity());
+	for (float cx : { 0.5f, size.x - 0.5f }) {
+		for (float cy : { 0.5f, size.y - 0.5f }) {
+			for (float cz : { 0.0f, 1.0f }) {
+				glm::vec2 pt = glm::vec2(shear * glm::vec4(cx, cy, cz, 1.0f));
+				board_min = glm::min(board_min, pt);
+				board_max = glm::max(board_max, pt);
+			}
+		}
+	}
+
+	//want scale such that [board_min,board_max] * scale fits in [-aspect,aspect]x[-1.0,1.0] screen box:
+	float scale = glm::min(
+		2.0f * aspect / float(board_max.x - board_min.x),
+		2.0f / float(board_max.y - board_min.y)
+	);
+
+	//center of board will be placed at center of screen:
+	glm::vec2 center = 0.5f * (board_max + board_min);
+
+	//NOTE: glm matrices are specified in column-major order
+	return glm::mat4(
+		scale / aspect, 0.0f, 0.0f, 0.0f,
+		0.0f, scale, 0.0f, 0.0f,
+		0.0f, 0.0f,-0.1f, 0.0f, //<-- by scaling z by -0.1f we get usable z range of 10 (near) to -10 (far)
+		-(scale / aspect) * center.x, -scale * center.y, 0.0f, 1.0f
+	) * shear ;
+}
+
+void Board::get_instances(std::vector< MeshInstance > *instances) const {
+	get_instances(instances, glm::vec2(player));
+}
+
+void Board::get_instances(std::vector< MeshInstance > *_instances, glm::vec2 const &player_at) const {
+	assert(_instances);
+	auto &instances = *_instances;
+
+	for (uint32_t y = 0; y < size.y; ++y) {
+		for (uint32_t x = 0; x < size.x; ++x) {
+			instances.emplace_back(board_meshes[y*size.x+x],
+				glm::mat4(
+					1.0f, 0.0f, 0.0f, 0.0f,
+					0.0f, 1.0f, 0.0f, 0.0f,
+					0.0f, 0.0f, 1.0f, 0.0f,
+					x+0.5f, y+0.5f, 0.0f, 1.0f
+				)
+			);
+			if (goal_meshes[y*size.x+x]) {
+				instances.emplace_back(goal_meshes[y*size.x+x],
+					glm::mat4(
+						1.0f, 0.0f, 0.0f, 0.0f,
+						0.0f, 1.0f, 0.0f, 0.0f,
+						0.0f, 0.0f, 1.0f, 0.0f,
+						x+0.5f, y+0.5f, 0.0f, 1.0f
+					)
+				);
+			}
+		}
+	}
+	instances.emplace_back(&meshes->player,
+		glm::mat4(
+			1.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 1.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			player_at.x+0.5f, player_at.y+0.5f, 0.0f, 1.0f
+		)
+	);
+
+
+	//score on left edge of board:
+	for (uint32_t c = 0; c < checkpoints; ++c) {
+		float s = 0.25f;
+		glm::vec3 at = glm::vec3(
+			0.5f + (float(c % 4) - 2.0f + 0.5f) * (0.9f * s),
+			1.0f + ((c / 4) + 0.6f) * (0.9f * s),
+			1.0f
+		);
+		instances.emplace_back(&meshes->checkpoint,
+			glm::mat4(
+				s, 0.0f, 0.0f, 0.0f,
+				0.0f, s, 0.0f, 0.0f,
+				0.0f, 0.0f, s, 0.0f,
+				at.x, at.y, at.z, 1.0f
+			)
+		);
+	}
+
+	//some text labels + instructions:
+	instances.emplace_back(&meshes->score,
+		glm::mat4(
+			1.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 1.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			0.5f, 0.5f, 1.0f, 1.0f
+		)
+	);
+	instances.emplace_back(&meshes->instructions,
+		glm::mat4(
+			1.0f, 0.0f, 0.0f, 0.0f,
+			0.0f, 1.0f, 0.0f, 0.0f,
+			0.0f, 0.0f, 1.0f, 0.0f,
+			size.x-0.5f, size.y-0.5f, 1.0f, 1.0f
+		)
+	);
+}
+
+void Board::create_board() {
+	//the game (and the offline renderers) all share the same sequence of boards:
+	static std::mt19937 mt(0xbead1234);
+	create_board(mt);
+}
+
+void Board::create_board(std::mt19937 &mt) {
+	//can't currently be winning on a just-made board:
+	won = false;
+
+	//remove everything:
+	board_meshes.assign(size.x * size.y, &meshes->wall);
+	for (uint32_t x = 1; x + 1 < size.x; ++x) {
+		for (uint32_t y = 1; y + 1 < size.y; ++y) {
+			board_meshes[y*size.x + x] = &meshes->floor;
+		}
+	}
+	goal_meshes.assign(size.x * size.y, nullptr);
+
+	auto random_board_position = [&,this](){
+		return glm::uvec2(
+			mt() % (size.x-2) + 1,
+			mt() % (size.y-2) + 1
+		);
+	};
+
+	{ //place some random walls:
+		uint32_t walls = (mt() % 8) + 2;
+		for (uint32_t w = 0; w < walls; ++w) {
+			//note: may end up placing walls atop other walls, but that's fine
+			glm::uvec2 pos = random_board_position();
+			if (pos == player) continue; //shouldn't place walls on player, though.
+			board_meshes[pos.y*size.x+pos.x] = &meshes->wall;
+		}
+	}
+
+	{ //place some random goops:
+		uint32_t goops = (mt() % 4);
+		for (uint32_t g = 0; g < goops; ++g) {
+			glm::uvec2 pos = random_board_position();
+			if (board_meshes[pos.y*size.x+pos.x] != &meshes->wall) {
+				goal_meshes[pos.y*size.x+pos.x] = &meshes->goop;
+			}
+		}
+	}
+
+	//try to generate several goals:
+	uint32_t goals = 0;
+	glm::uvec2 prev_goal = player;
+	while (goals <= 2) {
+		//run some random walks to check where player is likely to end up starting at previous goal:
+		std::vector< uint32_t > board_counts(size.x * size.y, 0);
+		for (uint32_t iter = 0; iter < 100; ++iter) {
+			glm::vec2 at = prev_goal;
+			for (uint32_t step = 0; step < 20; ++step) {
+				static const glm::ivec2 directions[4] = {
+					glm::ivec2(-1,0), glm::ivec2(1,0),
+					glm::ivec2(0,-1), glm::ivec2(0,1)
+				};
+				glm::vec2 d = directions[mt() % 4];
+				while (board_meshes[(at.y+d.y)*size.x+(at.x+d.x)] != &meshes->wall) {
+					at += d;
+					if (goal_meshes[at.y*size.x+at.x] == &meshes->goop) break;
+				}
+				board_counts[at.y*size.x+at.x] += 1;
+			}
+		}
+		//make a list of possible checkpoint cells based on likelihoods:
+		std::vector< glm::uvec2 > possible_cells;
+		for (uint32_t y = 0; y < size.y; ++y) {
+			for (uint32_t x = 0; x < size.x; ++x) {
+				if (x == player.x && y == player.y) continue; //don't place checkpoint at player
+				if (goal_meshes[y*size.x+x] != nullptr) continue; //don't overlap goals
+				if (board_counts[y*size.x+x] > 0) {
+					possible_cells.emplace_back(x,y);
+				}
+			}
+		}
+		//ran out of possible goal locations:
+		if (possible_cells.empty()) break;
+
+		//now sort list based on counts (smaller counts == harder):
+		std::stable_sort(possible_cells.begin(), possible_cells.end(), [&](glm::uvec2 a, glm::uvec2 b) {
+			return board_counts[a.y*size.x+a.x] < board_counts[b.y*size.x+b.x];
+		});
+
+		//pick one for the goal:
+		//limit to picking cells in the highest 25% of difficulty:
+		uint32_t limit = std::max< uint32_t >(1, possible_cells.size() / 4);
+		//extend limit to all cells with the same count:
+		while (limit + 1 < possible_cells.size() && board_counts[possible_cells[limit].y*size.x+possible_cells[limit].x] == board_counts[possible_cells[limit+1].y*size.x+possible_cells[limit+1].x]) ++limit;
+		glm::uvec2 g = possible_cells[mt() % limit];
+
+		assert(goal_meshes[g.y*size.x+g.x] == nullptr);
+		goal_meshes[g.y*size.x+g.x] = &meshes->checkpoint;
+		++goals;
+		prev_goal = g;
+	}
+
+	if (goals == 0) {
+		//failed to generate a board with at least one goal, so retry:
+		create_board(mt);
+		return;
+	}
+
+	//turn the last goal into the main goal:
+	goal_meshes[prev_goal.y*size.x+prev_goal.x] = &meshes->goal;
+
+}
+
+glm::uvec2 Board::slide_destination(int32_t dx, int32_t dy) const {
+	//step player until it is on goop or next tile is a wall
+	glm::uvec2 at = player;
+	assert(at.x >= 1 && at.x + 1 < size.x);
+	assert(at.y >= 1 && at.y + 1 < size.y);
+	while (board_meshes[(at.y+dy)*size.x+(at.x+dx)] != &meshes->wall) {
+		at.x += dx;
+		at.y += dy;
+		//did the player step onto goop?
+		if (goal_meshes[at.y*size.x+at.x] == &meshes->goop) break;
+	}
+	return at;
+}
+
+void Board::move_player(int32_t dx, int32_t dy) {
+	player = slide_destination(dx, dy);
+
+	//did the player gather a checkpoint?
+	if (goal_meshes[player.y*size.x+player.x] == &meshes->checkpoint) {
+		goal_meshes[player.y*size.x+player.x] = &meshes->checkpoint_collected;
+		checkpoints += 1;
+	}
+
+	won = (goal_meshes[player.y*size.x+player.x] == &meshes->goal);
+}
@@ -0,0 +1,90 @@
+#pragma once
+
+#include "MeshBlob.hpp"
+
+#include <glm/glm.hpp>
+
+#include <random>
+#include <vector>
+
+//The meshes used to draw (and, for walls/goals, to represent) a board:
+struct BoardMeshes {
+	//look up every board mesh by name; throws if any are missing
+	// (low-detail versions are used if the blob has them, see MeshBlob::add_low_detail_meshes):
+	void lookup(MeshBlob const &blob);
+
+	Mesh wall;
+	Mesh floor;
+	Mesh player;
+	Mesh goop;
+	Mesh checkpoint;
+	Mesh checkpoint_collected;
+	Mesh goal;
+	Mesh score;
+	Mesh instructions;
+
+	//low-detail versions of the tile meshes (the full meshes if the blob didn't have any):
+	struct {
+		Mesh wall;
+		Mesh floor;
+		Mesh player;
+		Mesh goop;
+		Mesh checkpoint;
+		Mesh checkpoint_collected;
+		Mesh goal;
+	} lod;
+	//the low-detail version of one of the meshes above:
+	Mesh const &low_detail(Mesh const *mesh) const;
+
+	//bounds of every tile mesh (wall through goal), around the tile's center:
+	glm::vec3 tile_min = glm::vec3(-0.5f, -0.5f, 0.0f);
+	glm::vec3 tile_max = glm::vec3(0.5f, 0.5f, 1.0f);
+};
+
+//sun/sky (well, directional+hemispherical) lighting used when drawing boards:
+struct BoardLighting {
+	glm::vec3 sun_direction = glm::normalize(glm::vec3(-0.2f, 0.2f, 1.0f));
+	glm::vec3 sun_color = glm::vec3(0.81f, 0.81f, 0.76f);
+	glm::vec3 sky_direction = glm::vec3(0.0f, 1.0f, 0.0f);
+	glm::vec3 sky_color = glm::vec3(0.2f, 0.2f, 0.3f);
+};
+
+//A mesh along with where to draw it:
+struct MeshInstance {
+	MeshInstance(Mesh const *mesh_, glm::mat4 const &object_to_world_) : mesh(mesh_), object_to_world(object_to_world_) { }
+	Mesh const *mesh;
+	glm::mat4 object_to_world;
+};
+
+//The 'Board' struct holds the state of one puzzle and the rules for playing it.
+// It doesn't touch OpenGL, so it is shared by the game and the offline renderers.
+struct Board {
+	//note: 'meshes' must outlive the board; the board starts out empty, so call create_board():
+	Board(BoardMeshes const *meshes, glm::uvec2 size = glm::uvec2(6,6));
+
+	BoardMeshes const *meshes;
+
+	glm::uvec2 size;
+	std::vector< Mesh const * > board_meshes; //wall, floor
+	std::vector< Mesh const * > goal_meshes; //checkpoint, goal, goop
+	glm::uvec2 player = glm::uvec2(1,1);
+	uint32_t checkpoints = 10;
+	bool won = false;
+
+	void create_board(); //create a new, random board solvable from current player position
+	void create_board(std::mt19937 &mt); //same, but drawing from a specific random number generator
+
+	void move_player(int32_t dx, int32_t dy); //slide player in a given direction
+	glm::uvec2 slide_destination(int32_t dx, int32_t dy) const; //where move_player(dx,dy) would leave the player
+
+	//the (artistic) shear applied to boards before projection:
+	static glm::mat4 const shear;
+
+	//transformation that fits the board into a drawable of the given size:
+	glm::mat4 world_to_clip(glm::uvec2 drawable_size) const;
+
+	//append every mesh needed to draw the board (tiles, player, score, labels):
+	void get_instances(std::vector< MeshInstance > *instances) const;
+	//same, but with the player drawn at 'player_at' (e.g., partway through a slide):
+	void get_instances(std::vector< MeshInstance > *instances, glm::vec2 const &player_at) const;
+};
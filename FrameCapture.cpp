@@ -0,0 +1,232 @@
+#include "FrameCapture.hpp"
+
+#include "save_png.hpp" //helper for writing .png files
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+#include <cerrno>
+#include <cstring>
+
+#include <algorithm>
+#include <iostream>
+#include <stdexcept>
+
+constexpr uint32_t FrameCapture::ReadbackCount;
+constexpr uint32_t FrameCapture::MaxQueuedFrames;
+
+FrameCapture::FrameCapture(Format format_, std::string const &path_, uint32_t fps_) : format(format_), path(path_), fps(fps_) {
+	if (format == PNGSequence) {
+		#if defined(_WIN32)
+		int made = _mkdir(path.c_str());
+		#else
+		int made = mkdir(path.c_str(), 0755);
+		#endif
+		if (made != 0 && errno != EEXIST) {
+			throw std::runtime_error("Failed to create capture directory '" + path + "'.");
+		}
+	} else if (format == Y4M) {
+		y4m = fopen(path.c_str(), "wb");
+		if (!y4m) {
+			throw std::runtime_error("Failed to open '" + path + "' for writing.");
+		}
+	}
+
+	GLuint pbos[ReadbackCount];
+	glGenBuffers(ReadbackCount, pbos);
+	for (uint32_t i = 0; i < ReadbackCount; ++i) {
+		readbacks[i].pbo = pbos[i];
+	}
+
+	worker = std::thread(&FrameCapture::work, this);
+
+	GL_ERRORS();
+}
+
+FrameCapture::~FrameCapture() {
+	//get every in-flight read to the worker:
+	collect(true);
+
+	{ //let the worker finish the queue and exit:
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+	}
+	cv.notify_all();
+	worker.join();
+
+	for (Readback &readback : readbacks) {
+		gl_state_DeleteBuffers(1, &readback.pbo);
+		readback.pbo = 0;
+	}
+
+	if (y4m) {
+		fclose(y4m);
+		y4m = nullptr;
+	}
+
+	std::cout << "Captured " << frames_captured << " frames to '" << path << "' (" << frames_dropped << " dropped)." << std::endl;
+
+	GL_ERRORS();
+}
+
+void FrameCapture::capture(glm::uvec2 drawable_size) {
+	//hand any reads that have finished over to the worker:
+	collect(false);
+
+	Readback &readback = readbacks[next_readback];
+	if (readback.fence) {
+		//the oldest read still hasn't finished; skip this frame rather than wait for it:
+		++frames_dropped;
+		++next_index;
+		return;
+	}
+	next_readback = (next_readback + 1) % ReadbackCount;
+
+	readback.size = drawable_size;
+	readback.index = next_index++;
+
+	//start an asynchronous read of the back buffer into the pixel pack buffer:
+	GLsizeiptr bytes = readback.size.x * readback.size.y * sizeof(glm::u8vec4);
+	gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+	glBufferData(GL_PIXEL_PACK_BUFFER, bytes, NULL, GL_STREAM_READ); //(orphans the last frame's storage)
+	glReadBuffer(GL_BACK);
+	glReadPixels(0, 0, readback.size.x, readback.size.y, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+	gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+	readback.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+}
+
+void FrameCapture::collect(bool wait) {
+	//reads finish in the order they were started, so check from the oldest:
+	for (uint32_t i = 0; i < ReadbackCount; ++i) {
+		Readback &readback = readbacks[(next_readback + i) % ReadbackCount];
+		if (!readback.fence) continue;
+
+		GLenum status = glClientWaitSync(readback.fence, GL_SYNC_FLUSH_COMMANDS_BIT, wait ? GLuint64(1000000000) : 0);
+		if (status == GL_TIMEOUT_EXPIRED && !wait) break;
+		glDeleteSync(readback.fence);
+		readback.fence = 0;
+		if (status == GL_TIMEOUT_EXPIRED || status == GL_WAIT_FAILED) {
+			//(when waiting, give up on reads that take over a second)
+			++frames_dropped;
+			continue;
+		}
+
+		//grab recycled storage for the frame, if the worker isn't too far behind:
+		Frame frame;
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			if (queue.size() >= MaxQueuedFrames) {
+				++frames_dropped;
+				continue;
+			}
+			if (!free_frames.empty()) {
+				frame = std::move(free_frames.back());
+				free_frames.pop_back();
+			}
+		}
+		frame.size = readback.size;
+		frame.index = readback.index;
+		frame.pixels.resize(frame.size.x * frame.size.y);
+
+		GLsizeiptr bytes = frame.size.x * frame.size.y * sizeof(glm::u8vec4);
+		gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, readback.pbo);
+		void const *data = glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, bytes, GL_MAP_READ_BIT);
+		if (data) {
+			std::memcpy(frame.pixels.data(), data, bytes);
+			glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+		}
+		gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+		if (!data) {
+			++frames_dropped;
+			continue;
+		}
+
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			queue.emplace_back(std::move(frame));
+		}
+		cv.notify_one();
+		++frames_captured;
+	}
+}
+
+void FrameCapture::work() {
+	while (true) {
+		Frame frame;
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			cv.wait(lock, [this](){ return quit || !queue.empty(); });
+			if (queue.empty()) break; //(only happens when quitting)
+			frame = std::move(queue.front());
+			queue.pop_front();
+		}
+
+		if (format == PNGSequence) {
+			//the window's alpha channel isn't meaningful, so write opaque images:
+			for (auto &px : frame.pixels) {
+				px.a = 0xff;
+			}
+			char name[32];
+			snprintf(name, sizeof(name), "/%06u.png", frame.index);
+			try {
+				save_png(path + name, frame.size, frame.pixels.data(), LowerLeftOrigin);
+			} catch (std::exception &e) {
+				std::cerr << "WARNING: failed to write captured frame: " << e.what() << std::endl;
+			}
+		} else if (format == Y4M) {
+			//the stream's size is fixed by its first frame:
+			if (y4m_size == glm::uvec2(0)) {
+				y4m_size = frame.size;
+				fprintf(y4m, "YUV4MPEG2 W%u H%u F%u:1 Ip A1:1 C420jpeg\n", y4m_size.x, y4m_size.y, fps);
+			}
+			if (frame.size != y4m_size) {
+				std::cerr << "WARNING: skipping captured frame " << frame.index << " because the window was resized." << std::endl;
+			} else {
+				//convert to full-range BT.601 YUV, with chroma averaged over 2x2 blocks:
+				glm::uvec2 chroma_size = (y4m_size + glm::uvec2(1)) / 2U;
+				yuv.resize(y4m_size.x * y4m_size.y + 2 * chroma_size.x * chroma_size.y);
+				uint8_t *Y = &yuv[0];
+				uint8_t *U = Y + y4m_size.x * y4m_size.y;
+				uint8_t *V = U + chroma_size.x * chroma_size.y;
+				auto clamp_byte = [](float f) -> uint8_t {
+					return uint8_t(std::min(255.0f, std::max(0.0f, f + 0.5f)));
+				};
+				for (uint32_t y = 0; y < y4m_size.y; ++y) {
+					//frames are stored bottom-to-top, y4m is top-to-bottom:
+					glm::u8vec4 const *row = &frame.pixels[(y4m_size.y - 1 - y) * y4m_size.x];
+					for (uint32_t x = 0; x < y4m_size.x; ++x) {
+						Y[y * y4m_size.x + x] = clamp_byte(0.299f * row[x].r + 0.587f * row[x].g + 0.114f * row[x].b);
+					}
+				}
+				for (uint32_t cy = 0; cy < chroma_size.y; ++cy) {
+					for (uint32_t cx = 0; cx < chroma_size.x; ++cx) {
+						glm::vec3 sum = glm::vec3(0.0f);
+						float count = 0.0f;
+						for (uint32_t y = 2 * cy; y < std::min(2 * cy + 2, y4m_size.y); ++y) {
+							for (uint32_t x = 2 * cx; x < std::min(2 * cx + 2, y4m_size.x); ++x) {
+								glm::u8vec4 const &px = frame.pixels[(y4m_size.y - 1 - y) * y4m_size.x + x];
+								sum += glm::vec3(px.r, px.g, px.b);
+								count += 1.0f;
+							}
+						}
+						glm::vec3 rgb = sum / count;
+						U[cy * chroma_size.x + cx] = clamp_byte(128.0f - 0.168736f * rgb.r - 0.331264f * rgb.g + 0.5f * rgb.b);
+						V[cy * chroma_size.x + cx] = clamp_byte(128.0f + 0.5f * rgb.r - 0.418688f * rgb.g - 0.081312f * rgb.b);
+					}
+				}
+				fputs("FRAME\n", y4m);
+				fwrite(yuv.data(), 1, yuv.size(), y4m);
+			}
+		}
+
+		{ //recycle the frame's storage:
+			std::unique_lock< std::mutex > lock(mutex);
+			free_frames.emplace_back(std::move(frame));
+		}
+	}
+}
@@ -0,0 +1,79 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <condition_variable>
+#include <cstdio>
+#include <deque>
+#include <mutex>
+#include <string>
+#include <thread>
+#include <vector>
+
+//FrameCapture records the frames drawn by the main loop without stalling it:
+// each frame is read back into one of a ring of pixel pack buffers, a fence marks
+// when that read has finished, and a worker thread writes finished frames out
+// as a numbered .png sequence or as a raw (YUV 4:2:0) .y4m video stream.
+//If the GPU or the worker falls behind, frames are dropped (and counted) rather than waited for.
+struct FrameCapture {
+	enum Format {
+		PNGSequence, //'path' is a directory; frames are written as 'path/NNNNNN.png'
+		Y4M, //'path' is a file
+	};
+
+	//creates GL objects, so must be called with the context current; throws on failure:
+	FrameCapture(Format format, std::string const &path, uint32_t fps = 60);
+	//finishes writing every captured frame (this part does wait):
+	~FrameCapture();
+
+	//call after drawing a frame, before swapping; reads from the back buffer:
+	void capture(glm::uvec2 drawable_size);
+
+	Format format;
+	std::string path;
+	uint32_t fps;
+
+	uint32_t frames_captured = 0; //frames handed to the worker
+	uint32_t frames_dropped = 0; //frames skipped because the GPU or worker was still busy
+
+	//------- internals -------
+
+	//a frame being read back into a pixel pack buffer:
+	struct Readback {
+		GLuint pbo = 0;
+		GLsync fence = 0; //non-zero while a read is in flight
+		glm::uvec2 size = glm::uvec2(0);
+		uint32_t index = 0;
+	};
+	static constexpr uint32_t ReadbackCount = 4;
+	Readback readbacks[ReadbackCount];
+	uint32_t next_readback = 0;
+	uint32_t next_index = 0;
+
+	//map finished reads and hand them to the worker; if 'wait' is set, block until every read finishes:
+	void collect(bool wait);
+
+	//a frame waiting for (or being written by) the worker:
+	struct Frame {
+		glm::uvec2 size = glm::uvec2(0);
+		uint32_t index = 0;
+		std::vector< glm::u8vec4 > pixels; //rows bottom-to-top
+	};
+	static constexpr uint32_t MaxQueuedFrames = 8;
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::deque< Frame > queue; //frames waiting to be written
+	std::vector< Frame > free_frames; //recycled frame storage
+	bool quit = false;
+	std::thread worker;
+
+	void work(); //worker thread main function
+
+	//y4m output state (only touched by the worker):
+	FILE *y4m = nullptr;
+	glm::uvec2 y4m_size = glm::uvec2(0);
+	std::vector< uint8_t > yuv;
+};
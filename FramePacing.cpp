@@ -0,0 +1,176 @@
+#include "FramePacing.hpp"
+
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+
+#include <SDL.h>
+
+#include <algorithm>
+#include <iostream>
+#include <thread>
+
+constexpr uint32_t FramePacing::FrameCount;
+constexpr uint32_t FramePacing::CostHistory;
+constexpr float FramePacing::SafetyMargin;
+
+FramePacing::FramePacing(bool just_in_time_, bool measure_, float refresh_rate_) : just_in_time(just_in_time_), measure(measure_), refresh_rate(refresh_rate_) {
+	frame_start = Clock::now();
+	latencies.reserve(1 << 16);
+}
+
+FramePacing::~FramePacing() {
+	for (Frame &frame : frames) {
+		if (frame.fence) {
+			glDeleteSync(frame.fence);
+			frame.fence = 0;
+		}
+	}
+	GL_ERRORS();
+}
+
+void FramePacing::wait_for_input() {
+	if (just_in_time && has_last_swap) {
+		//leave time for the slowest recent frame (plus a little slack) before the next vsync:
+		float cost = *std::max_element(costs, costs + CostHistory);
+		float period = 1.0f / refresh_rate;
+		float sleep = std::min(period, period - cost - SafetyMargin);
+		Clock::time_point deadline = last_swap + std::chrono::duration_cast< Clock::duration >(std::chrono::duration< float >(sleep));
+
+		Clock::time_point before = Clock::now();
+		Clock::time_point now = before;
+		while (now < deadline) {
+			//(sleep by waiting on frames still in flight, which times them exactly; otherwise just sleep)
+			if (!retire(deadline - now)) {
+				std::this_thread::sleep_until(deadline);
+			}
+			now = Clock::now();
+		}
+		seconds_slept += std::chrono::duration< float >(now - before).count();
+	} else {
+		retire(Clock::duration(0));
+	}
+
+	frame_start = Clock::now();
+	has_input = false;
+}
+
+void FramePacing::input(uint32_t timestamp) {
+	//SDL stamps events (in ms) when they are queued, which can be well before they are handled:
+	uint32_t age = SDL_GetTicks() - timestamp;
+	Clock::time_point at = Clock::now() - std::chrono::milliseconds(std::min(age, 1000U));
+	if (!has_input || at < earliest_input) {
+		earliest_input = at;
+		has_input = true;
+	}
+}
+
+void FramePacing::drawn() {
+	Frame &frame = frames[next_frame];
+	if (frame.fence) {
+		//(very far behind: the frame FrameCount frames ago is still in flight)
+		while (retire(std::chrono::seconds(1)) && frame.fence) { }
+		if (frame.fence) {
+			glDeleteSync(frame.fence);
+			frame.fence = 0;
+		}
+	}
+	next_frame = (next_frame + 1) % FrameCount;
+
+	frame.has_input = has_input;
+	frame.input = earliest_input;
+	frame.start = frame_start;
+	frame.is_swapped = false;
+	frame.done = false;
+	frame.fence = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+
+	//wait for the GPU to finish the frame, so its completion time is exact:
+	// when measuring, however long that takes; when pacing, only until the next vsync
+	// (the swap would block until then anyway, so this costs nothing when the frame is on time)
+	Clock::duration timeout = std::chrono::seconds(1);
+	if (!measure) {
+		Clock::time_point vsync = last_swap + std::chrono::duration_cast< Clock::duration >(std::chrono::duration< float >(1.0f / refresh_rate));
+		timeout = std::max(Clock::duration(0), vsync - Clock::now());
+	}
+	while (frame.fence && retire(timeout)) {
+		if (!measure) break;
+	}
+}
+
+void FramePacing::swapped() {
+	last_swap = Clock::now();
+	has_last_swap = true;
+
+	Frame &frame = frames[(next_frame + FrameCount - 1) % FrameCount];
+	frame.swapped = last_swap;
+	frame.is_swapped = true;
+	if (frame.done) record(frame);
+
+	retire(Clock::duration(0));
+}
+
+bool FramePacing::retire(Clock::duration timeout) {
+	//frames finish in the order they were drawn, so check from the oldest:
+	for (uint32_t i = 0; i < FrameCount; ++i) {
+		Frame &frame = frames[(next_frame + i) % FrameCount];
+		if (!frame.fence) continue;
+
+		GLuint64 ns = GLuint64(std::chrono::duration_cast< std::chrono::nanoseconds >(timeout).count());
+		GLenum status = glClientWaitSync(frame.fence, GL_SYNC_FLUSH_COMMANDS_BIT, ns);
+		if (status == GL_TIMEOUT_EXPIRED) return true;
+		Clock::time_point now = Clock::now();
+		glDeleteSync(frame.fence);
+		frame.fence = 0;
+		//the frame finished no later than now -- exactly now if the fence was signaled while waiting,
+		// and close enough if it is still before the swap; after the swap, all that is known is that
+		// it finished before the swap returned:
+		frame.done_at = now;
+		frame.timed = (status == GL_CONDITION_SATISFIED || !frame.is_swapped);
+		if (!frame.timed) frame.done_at = std::min(now, frame.swapped);
+		frame.done = true;
+		if (frame.is_swapped) record(frame);
+
+		timeout = Clock::duration(0); //(later frames are only checked, not waited for)
+	}
+	return false;
+}
+
+void FramePacing::record(Frame &frame) {
+	//only exactly-timed frames are a good guide to how long frames take:
+	if (frame.timed) {
+		costs[next_cost] = std::chrono::duration< float >(frame.done_at - frame.start).count();
+		next_cost = (next_cost + 1) % CostHistory;
+	}
+
+	//the frame can be shown once the GPU has finished it and the swap has returned:
+	if (frame.has_input) {
+		Clock::time_point shown = std::max(frame.done_at, frame.swapped);
+		latencies.emplace_back(std::chrono::duration< float, std::milli >(shown - frame.input).count());
+	}
+	++frames_timed;
+
+	frame.done = false;
+	frame.has_input = false;
+}
+
+void FramePacing::report(std::ostream &out) const {
+	out << "Frame pacing: " << frames_timed << " frames timed";
+	if (just_in_time) {
+		out << ", slept " << seconds_slept << "s waiting to sample input";
+	}
+	out << "." << std::endl;
+
+	if (latencies.empty()) {
+		out << "  (no input-to-display latencies recorded)" << std::endl;
+		return;
+	}
+	std::vector< float > sorted = latencies;
+	std::sort(sorted.begin(), sorted.end());
+	auto percentile = [&sorted](float p) {
+		size_t i = std::min(sorted.size() - 1, size_t(p / 100.0f * sorted.size()));
+		return sorted[i];
+	};
+	out << "  input-to-display latency over " << sorted.size() << " frames (ms):"
+		<< " p50 " << percentile(50.0f)
+		<< ", p90 " << percentile(90.0f)
+		<< ", p99 " << percentile(99.0f)
+		<< ", max " << sorted.back() << std::endl;
+}
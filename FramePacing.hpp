@@ -0,0 +1,83 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <chrono>
+#include <iosfwd>
+#include <vector>
+
+//FramePacing times each frame from the input that caused it to the moment it can be on screen:
+// - input events are stamped with the time SDL queued them,
+// - a fence placed after drawing tells when the GPU has finished the frame, and
+// - the frame counts as displayed once both the GPU and SDL_GL_SwapWindow are done with it.
+//It can also schedule frames "just in time": rather than sampling input right after the
+// last swap (and then waiting most of a refresh for vsync), it sleeps until just enough
+// time is left before the next vsync to update and draw, so the input that goes into a
+// frame is as fresh as possible.
+struct FramePacing {
+	typedef std::chrono::steady_clock Clock;
+
+	//creates GL objects, so must be called with the context current:
+	// 'just_in_time' enables the sleep before sampling input; 'measure' waits for each frame's
+	// fence before swapping, which gives exact GPU completion times (at the cost of CPU/GPU overlap)
+	FramePacing(bool just_in_time, bool measure, float refresh_rate = 60.0f);
+	~FramePacing();
+
+	bool just_in_time;
+	bool measure;
+	float refresh_rate; //display refreshes per second (vsync interval is 1 / refresh_rate)
+
+	//call before handling events; sleeps (if just_in_time) until it is time to start the next frame:
+	void wait_for_input();
+	//call for each event that changes the next frame ('timestamp' is the SDL event timestamp, in ms):
+	void input(uint32_t timestamp);
+	//call after drawing, before swapping:
+	void drawn();
+	//call after SDL_GL_SwapWindow returns:
+	void swapped();
+
+	//writes input-to-display latency percentiles (and pacing stats) to 'out':
+	void report(std::ostream &out) const;
+
+	//------- internals -------
+
+	//a frame that has been drawn but may still be in flight on the GPU:
+	struct Frame {
+		GLsync fence = 0; //non-zero until the GPU is known to have finished the frame
+		bool has_input = false; //did an input event go into this frame?
+		Clock::time_point input; //earliest input that went into the frame
+		Clock::time_point start; //when the frame started sampling input
+		Clock::time_point swapped; //when SDL_GL_SwapWindow returned
+		bool is_swapped = false;
+		Clock::time_point done_at; //when the GPU finished the frame
+		bool done = false; //(true once done_at is known, until the frame is recorded)
+		bool timed = false; //was done_at seen as it happened (rather than found after the fact)?
+	};
+	static constexpr uint32_t FrameCount = 4;
+	Frame frames[FrameCount];
+	uint32_t next_frame = 0;
+
+	//the frame currently being built:
+	Clock::time_point frame_start;
+	bool has_input = false;
+	Clock::time_point earliest_input;
+
+	Clock::time_point last_swap;
+	bool has_last_swap = false;
+
+	//check in-flight fences, waiting up to 'timeout' for the oldest one; returns true if any are still in flight:
+	bool retire(Clock::duration timeout);
+	//add a finished + swapped frame to the stats:
+	void record(Frame &frame);
+
+	//recent start-to-done frame times (seconds), used to decide how long to sleep:
+	static constexpr uint32_t CostHistory = 32;
+	float costs[CostHistory] = { 0.0f };
+	uint32_t next_cost = 0;
+	static constexpr float SafetyMargin = 0.002f; //seconds of slack left before vsync
+
+	//stats:
+	std::vector< float > latencies; //input-to-display (ms), one per frame with input
+	uint32_t frames_timed = 0;
+	float seconds_slept = 0.0f;
+};
@@ -11,4 +11,15 @@
 #else
 #define GL_GLEXT_PROTOTYPES 1
 #include "glcorearb.h"
+//when built with GL_COUNTERS ('jam -sGL_COUNTERS=1'), every GL call goes through a counting wrapper:
+#ifdef GL_COUNTERS
+#include "gl_counters.hpp"
+#endif
+//when built with GL_RECORD ('jam -sGL_RECORD=1'), every GL call can be recorded to a file (see gl_record.hpp):
+#ifdef GL_RECORD
+#ifdef GL_COUNTERS
+#error "GL_COUNTERS and GL_RECORD both redirect every GL call; build with one or the other."
+#endif
+#include "gl_record_calls.hpp"
+#endif
 #endif
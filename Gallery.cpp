@@ -0,0 +1,291 @@
+#include "Gallery.hpp"
+
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+#include "Profiler.hpp" //for marking build vs. submit time
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <limits>
+
+constexpr uint32_t Gallery::Seed;
+constexpr float Gallery::CellWidth;
+constexpr float Gallery::CellHeight;
+constexpr uint32_t Gallery::RowMargin;
+constexpr float Gallery::LowDetailPixels;
+
+Gallery::Gallery(BoardMeshes const *meshes_, InstancedShading *shading_) : meshes(meshes_), shading(shading_) {
+	assert(meshes);
+	assert(shading);
+
+	glGenBuffers(1, &instances_vbo);
+
+	GL_ERRORS();
+}
+
+Gallery::~Gallery() {
+	gl_state_DeleteBuffers(1, &instances_vbo);
+	instances_vbo = -1U;
+
+	GL_ERRORS();
+}
+
+float Gallery::visible_rows(glm::uvec2 drawable_size) const {
+	float aspect = float(drawable_size.x) / float(drawable_size.y);
+	return (columns * CellWidth / aspect) / CellHeight;
+}
+
+glm::mat4 Gallery::world_to_clip(glm::uvec2 drawable_size) const {
+	//columns fill the width of the screen; rows run downward from y = 0:
+	float width = columns * CellWidth;
+	float height = visible_rows(drawable_size) * CellHeight;
+	float top = -scroll * CellHeight;
+
+	//NOTE: glm matrices are specified in column-major order
+	return glm::mat4(
+		2.0f / width, 0.0f, 0.0f, 0.0f,
+		0.0f, 2.0f / height, 0.0f, 0.0f,
+		0.0f, 0.0f,-0.1f, 0.0f, //<-- same depth range as Board::world_to_clip
+		-1.0f, 1.0f - 2.0f * top / height, 0.0f, 1.0f
+	);
+}
+
+std::mt19937 Gallery::row_mt(uint32_t row) const {
+	std::seed_seq seed{ Seed, row };
+	return std::mt19937(seed);
+}
+
+void Gallery::scroll_by(float rows) {
+	scroll = std::max(0.0f, scroll + rows);
+}
+
+void Gallery::set_columns(uint32_t columns_) {
+	columns_ = std::max(1U, std::min(64U, columns_));
+	if (columns_ == columns) return;
+	columns = columns_;
+	//(every board moves, and rows hold different numbers of them, so start over)
+	boards.clear();
+	players.clear();
+	rows_begin = rows_end = 0;
+	dirty = true;
+}
+
+void Gallery::build_instances(uint32_t begin, uint32_t end) {
+	//keep the boards (and their players, wherever they've wandered) in rows still in [begin,end), generate the rest,
+	// and drop the ones that scrolled out:
+	assert(boards.size() == (rows_end - rows_begin) * columns);
+	std::vector< Board > next_boards;
+	next_boards.reserve((end - begin) * columns);
+	SlideAnimations next_players;
+	for (uint32_t row = begin; row < end; ++row) {
+		if (rows_begin <= row && row < rows_end) {
+			for (uint32_t col = 0; col < columns; ++col) {
+				uint32_t i = (row - rows_begin) * columns + col;
+				next_boards.emplace_back(std::move(boards[i]));
+				next_players.add(players, i);
+			}
+		} else {
+			std::mt19937 mt = row_mt(row);
+			for (uint32_t col = 0; col < columns; ++col) {
+				next_boards.emplace_back(meshes);
+				next_boards.back().create_board(mt);
+				next_players.add(glm::vec2(next_boards.back().player));
+			}
+		}
+	}
+	boards = std::move(next_boards);
+	players = std::move(next_players);
+	rows_begin = begin;
+	rows_end = end;
+
+	//meshes that appear on boards (other than the player); every one gets a batch:
+	Mesh const *kinds[] = {
+		&meshes->wall, &meshes->floor,
+		&meshes->goop, &meshes->checkpoint, &meshes->checkpoint_collected, &meshes->goal,
+	};
+	uint32_t const kind_count = sizeof(kinds) / sizeof(kinds[0]);
+	scratch.resize(kind_count);
+	for (auto &bucket : scratch) {
+		bucket.clear();
+	}
+	scratch_row_starts.resize(kind_count);
+	for (auto &starts : scratch_row_starts) {
+		starts.clear();
+	}
+	auto start_row = [&]() {
+		for (uint32_t k = 0; k < kind_count; ++k) {
+			scratch_row_starts[k].emplace_back(GLsizei(scratch[k].size()));
+		}
+	};
+	auto add = [&](Mesh const *mesh, glm::vec4 const &instance) {
+		for (uint32_t k = 0; k < kind_count; ++k) {
+			if (kinds[k] == mesh) {
+				scratch[k].emplace_back(instance);
+				return;
+			}
+		}
+		assert(0 && "board uses a mesh the gallery doesn't batch");
+	};
+
+	glm::mat3 shear = glm::mat3(Board::shear);
+
+	placements.clear();
+	for (uint32_t row = begin; row < end; ++row) {
+		start_row();
+		for (uint32_t col = 0; col < columns; ++col) {
+			Board const &board = boards[(row - begin) * columns + col];
+
+			//fit the (sheared) board into its cell:
+			glm::vec2 board_min = glm::vec2(std::numeric_limits< float >::infinity());
+			glm::vec2 board_max = glm::vec2(-std::numeric_limits< float >::infinity());
+			for (float cx : { 0.0f, float(board.size.x) }) {
+				for (float cy : { 0.0f, float(board.size.y) }) {
+					for (float cz : { 0.0f, 1.0f }) {
+						glm::vec2 pt = glm::vec2(shear * glm::vec3(cx, cy, cz));
+						board_min = glm::min(board_min, pt);
+						board_max = glm::max(board_max, pt);
+					}
+				}
+			}
+			float scale = std::min(
+				(CellWidth - 0.5f) / (board_max.x - board_min.x),
+				(CellHeight - 0.5f) / (board_max.y - board_min.y)
+			);
+			glm::vec2 cell_center = glm::vec2((col + 0.5f) * CellWidth, -(row + 0.5f) * CellHeight);
+			glm::vec3 offset = glm::vec3(cell_center - scale * 0.5f * (board_min + board_max), 0.0f);
+			placements.emplace_back(offset, scale);
+
+			auto place = [&](Mesh const *mesh, glm::vec3 const &at) {
+				add(mesh, glm::vec4(offset + scale * (shear * at), scale));
+			};
+			for (uint32_t y = 0; y < board.size.y; ++y) {
+				for (uint32_t x = 0; x < board.size.x; ++x) {
+					glm::vec3 at = glm::vec3(x + 0.5f, y + 0.5f, 0.0f);
+					place(board.board_meshes[y*board.size.x+x], at);
+					if (board.goal_meshes[y*board.size.x+x]) {
+						place(board.goal_meshes[y*board.size.x+x], at);
+					}
+				}
+			}
+		}
+	}
+	start_row(); //(marks the end of the last row)
+
+	//pack the buckets end-to-end, so each mesh is a contiguous range of instances:
+	instance_data.clear();
+	batches.clear();
+	for (uint32_t k = 0; k < kind_count; ++k) {
+		if (scratch[k].empty()) continue;
+		batches.emplace_back();
+		batches.back().mesh = kinds[k];
+		batches.back().first_instance = GLsizei(instance_data.size());
+		batches.back().instance_count = GLsizei(scratch[k].size());
+		batches.back().row_starts = scratch_row_starts[k];
+		instance_data.insert(instance_data.end(), scratch[k].begin(), scratch[k].end());
+	}
+
+	//(Tier45 copies the on-screen rows to its ring each frame instead)
+	if (shading->tier == InstancedShading::Tier45) {
+		dirty = false;
+		return;
+	}
+
+	//stream to the GPU; re-specifying the storage (orphaning) means this never waits on a draw still using the old data:
+	GLsizeiptr bytes = instance_data.size() * sizeof(glm::vec4);
+	instances_vbo_size = std::max(instances_vbo_size, bytes);
+	gl_state_BindBuffer(GL_ARRAY_BUFFER, instances_vbo);
+	glBufferData(GL_ARRAY_BUFFER, instances_vbo_size, NULL, GL_STREAM_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, bytes, instance_data.data());
+
+	dirty = false;
+}
+
+void Gallery::tick(float dt) {
+	//every so often, send each resting player off in a random direction:
+	static const glm::ivec2 directions[4] = {
+		glm::ivec2(-1,0), glm::ivec2(1,0),
+		glm::ivec2(0,-1), glm::ivec2(0,1)
+	};
+	for (uint32_t i = 0; i < players.size(); ++i) {
+		if (players.sliding(i) || wander_mt() % 128 != 0) continue;
+		Board &board = boards[i];
+		glm::ivec2 d = directions[wander_mt() % 4];
+		//(these boards are just for show, so checkpoints aren't collected)
+		board.player = board.slide_destination(d.x, d.y);
+		players.slide_to(i, glm::vec2(board.player));
+	}
+	players.tick(dt);
+}
+
+void Gallery::draw(glm::uvec2 drawable_size, float alpha) {
+	//rows on screen:
+	uint32_t first = uint32_t(std::floor(scroll));
+	uint32_t last = uint32_t(std::ceil(scroll + visible_rows(drawable_size)));
+
+	//make sure every row on screen is in the instance buffer:
+	if (dirty || first < rows_begin || last > rows_end) {
+		build_instances(first > RowMargin ? first - RowMargin : 0, last + RowMargin);
+	}
+
+	//on-screen size of a tile decides whether to use the low-detail meshes:
+	drew_low_detail = (float(drawable_size.x) / (columns * CellWidth) < LowDetailPixels);
+
+	{ //place the players on screen (at their in-between-ticks positions):
+		glm::mat3 shear = glm::mat3(Board::shear);
+		player_data.clear();
+		for (uint32_t i = first * columns; i < last * columns; ++i) {
+			glm::vec4 const &placement = placements[i - rows_begin * columns];
+			glm::vec2 at = players.at(i - rows_begin * columns, alpha) + 0.5f;
+			player_data.emplace_back(glm::vec3(placement) + placement.w * (shear * glm::vec3(at, 0.0f)), placement.w);
+		}
+	}
+
+	Profiler::mark(Profiler::Submit);
+
+	shading->begin(world_to_clip(drawable_size));
+
+	instances_drawn = 0;
+	if (shading->tier == InstancedShading::Tier45) {
+		//queue the on-screen rows of each mesh type's range and the players; end() draws them all at once:
+		for (Batch const &batch : batches) {
+			GLsizei begin = batch.row_starts[first - rows_begin];
+			GLsizei end = batch.row_starts[last - rows_begin];
+			if (begin == end) continue;
+			shading->queue(drew_low_detail ? meshes->low_detail(batch.mesh) : *batch.mesh, &instance_data[batch.first_instance + begin], end - begin);
+			instances_drawn += end - begin;
+		}
+		if (!player_data.empty()) {
+			shading->queue(drew_low_detail ? meshes->lod.player : meshes->player, player_data.data(), GLsizei(player_data.size()));
+			instances_drawn += uint32_t(player_data.size());
+		}
+		shading->end();
+		GL_ERRORS();
+		return;
+	}
+
+	//one draw per mesh type, each reading just the on-screen rows of its range of the instance buffer:
+	gl_state_BindBuffer(GL_ARRAY_BUFFER, instances_vbo);
+	for (Batch const &batch : batches) {
+		GLsizei begin = batch.row_starts[first - rows_begin];
+		GLsizei end = batch.row_starts[last - rows_begin];
+		if (begin == end) continue;
+		shading->draw(drew_low_detail ? meshes->low_detail(batch.mesh) : *batch.mesh, batch.first_instance + begin, end - begin);
+		instances_drawn += end - begin;
+	}
+
+	{ //stream the players:
+		players_stream.begin_frame();
+		if (!player_data.empty()) {
+			StreamBuffer::Allocation players = players_stream.write(player_data.data(), player_data.size() * sizeof(glm::vec4), sizeof(glm::vec4));
+			gl_state_BindBuffer(GL_ARRAY_BUFFER, players.buffer);
+			shading->draw(drew_low_detail ? meshes->lod.player : meshes->player, GLsizei(players.offset / sizeof(glm::vec4)), GLsizei(player_data.size()));
+			instances_drawn += uint32_t(player_data.size());
+		}
+		players_stream.end_frame();
+	}
+
+	shading->end();
+
+	GL_ERRORS();
+}
@@ -0,0 +1,108 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Board.hpp"
+#include "InstancedShading.hpp"
+#include "SlideAnimations.hpp"
+#include "StreamBuffer.hpp"
+
+#include <glm/glm.hpp>
+
+#include <random>
+#include <vector>
+
+//The 'Gallery' is a browse mode that lays out a scrolling grid of generated boards.
+// Every tile of every visible board is an instance (offset + scale) in one instance
+// buffer, and all boards are drawn with one instanced draw per mesh type, so the cost
+// of a frame barely depends on how many boards are on screen.
+//The instance buffer is only rebuilt when scrolling brings new rows into view.
+struct Gallery {
+	//creates OpenGL resources; 'meshes' and 'shading' must outlive the gallery:
+	Gallery(BoardMeshes const *meshes, InstancedShading *shading);
+	~Gallery();
+
+	BoardMeshes const *meshes;
+	InstancedShading *shading; //(not const: Tier45 queues instances into its ring)
+
+	//------- layout -------
+
+	uint32_t columns = 16; //boards per row
+	float scroll = 0.0f; //distance (in rows) from the top of the gallery to the top of the screen
+
+	//boards are generated as they scroll into view, and only the ones in the instance buffer's rows
+	// (see rows_begin/rows_end) are kept, so boards[(row - rows_begin) * columns + col] is at (row, col):
+	std::vector< Board > boards;
+	//each row's boards come from their own generator (so the game's sequence isn't disturbed), seeded
+	// with the row's index, so a row that scrolls away and back is generated the same:
+	static constexpr uint32_t Seed = 0x9a11e41;
+	std::mt19937 row_mt(uint32_t row) const;
+
+	//every board's player wanders around its board on its own (players[i] belongs to boards[i]):
+	SlideAnimations players;
+	std::mt19937 wander_mt = std::mt19937(0x3a4de2);
+	void tick(float dt); //advance the wandering players by one fixed timestep
+
+	//each board is drawn in a cell this many (board-tile-sized) units across:
+	static constexpr float CellWidth = 7.0f;
+	static constexpr float CellHeight = 6.5f;
+	//rows generated (and kept in the instance buffer) beyond the edges of the screen, so small scrolls don't rebuild:
+	static constexpr uint32_t RowMargin = 2;
+
+	//transformation from (sheared) gallery space to clip space:
+	glm::mat4 world_to_clip(glm::uvec2 drawable_size) const;
+	//number of rows (fractional) that fit on screen:
+	float visible_rows(glm::uvec2 drawable_size) const;
+
+	void scroll_by(float rows);
+	void set_columns(uint32_t columns);
+
+	//'alpha' is how far (in [0,1]) the frame is between the last two ticks:
+	void draw(glm::uvec2 drawable_size, float alpha);
+
+	//------- instance data -------
+
+	//per-instance attribute: xyz is the (already sheared) location of the mesh origin, w its scale:
+	std::vector< glm::vec4 > instance_data;
+
+	//one instanced draw per mesh type:
+	struct Batch {
+		Mesh const *mesh = nullptr;
+		GLsizei first_instance = 0;
+		GLsizei instance_count = 0;
+		//instances are stored row-by-row, so the rows actually on screen are one contiguous range:
+		// row r's instances start at first_instance + row_starts[r - rows_begin]
+		std::vector< GLsizei > row_starts; //(one entry per row in the buffer, plus one for the end)
+	};
+	std::vector< Batch > batches;
+
+	//range of rows currently in the instance buffer (rebuilt when the visible rows leave it):
+	uint32_t rows_begin = 0;
+	uint32_t rows_end = 0;
+	bool dirty = true;
+
+	//generate (or keep) the boards in rows [begin,end), then refill instance_data + batches with them and upload:
+	void build_instances(uint32_t begin, uint32_t end);
+
+	//where each board in the instance buffer's rows is drawn (offset.xyz, scale), indexed like 'boards':
+	std::vector< glm::vec4 > placements;
+
+	//players move every frame, so they are streamed separately:
+	std::vector< glm::vec4 > player_data; //(reused every frame)
+
+	//scratch space for sorting instances by mesh:
+	std::vector< std::vector< glm::vec4 > > scratch;
+	std::vector< std::vector< GLsizei > > scratch_row_starts;
+
+	//tiles smaller than this (in pixels) are drawn with low-detail meshes:
+	static constexpr float LowDetailPixels = 8.0f;
+
+	//drawing stats from the last frame:
+	uint32_t instances_drawn = 0;
+	bool drew_low_detail = false;
+
+	//------- opengl resources -------
+
+	GLuint instances_vbo = -1U; //per-instance data, streamed as the gallery scrolls
+	GLsizeiptr instances_vbo_size = 0; //allocated size (bytes)
+	StreamBuffer players_stream{ "gallery players", 16 << 10 }; //player instances, streamed every frame (Tier33)
+};
@@ -1,257 +1,288 @@
 #include "Game.hpp"
 
 #include "gl_errors.hpp" //helper for dumpping OpenGL error messages
-#include "read_chunk.hpp" //helper for reading a vector of structures from a file
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
 #include "data_path.hpp" //helper to get paths relative to executable
+#include "Profiler.hpp" //for marking build vs. submit time
 
 #include <glm/gtc/type_ptr.hpp>
 
 #include <iostream>
 #include <fstream>
-#include <map>
 #include <cstddef>
-#include <random>
 #include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <string>
 
-//helper defined later; throws if shader compilation fails:
-static GLuint compile_shader(GLenum type, std::string const &source);
+constexpr float Game::Tick;
 
-Game::Game() {
-	{ //create an opengl program to perform sun/sky (well, directional+hemispherical) lighting:
-		GLuint vertex_shader = compile_shader(GL_VERTEX_SHADER,
-			"#version 330\n"
-			"uniform mat4 object_to_clip;\n"
-			"uniform mat4x3 object_to_light;\n"
-			"uniform mat3 normal_to_light;\n"
-			"layout(location=0) in vec4 Position;\n" //note: layout keyword used to make sure that the location-0 attribute is always bound to something
-			"in vec3 Normal;\n"
-			"in vec4 Color;\n"
-			"out vec3 position;\n"
-			"out vec3 normal;\n"
-			"out vec4 color;\n"
-			"void main() {\n"
-			"	gl_Position = object_to_clip * Position;\n"
-			"	position = object_to_light * Position;\n"
-			"	normal = normal_to_light * Normal;\n"
-			"	color = Color;\n"
-			"}\n"
-		);
-
-		GLuint fragment_shader = compile_shader(GL_FRAGMENT_SHADER,
-			"#version 330\n"
-			"uniform vec3 sun_direction;\n"
-			"uniform vec3 sun_color;\n"
-			"uniform vec3 sky_direction;\n"
-			"uniform vec3 sky_color;\n"
-			"in vec3 position;\n"
-			"in vec3 normal;\n"
-			"in vec4 color;\n"
-			"out vec4 fragColor;\n"
-			"void main() {\n"
-			"	vec3 total_light = vec3(0.0, 0.0, 0.0);\n"
-			"	vec3 n = normalize(normal);\n"
-			"	{ //sky (hemisphere) light:\n"
-			"		vec3 l = sky_direction;\n"
-			"		float nl = 0.5 + 0.5 * dot(n,l);\n"
-			"		total_light += nl * sky_color;\n"
-			"	}\n"
-			"	{ //sun (directional) light:\n"
-			"		vec3 l = sun_direction;\n"
-			"		float nl = max(0.0, dot(n,l));\n"
-			"		total_light += nl * sun_color;\n"
-			"	}\n"
-			"	fragColor = vec4(color.rgb * total_light, color.a);\n"
-			"}\n"
-		);
-
-		simple_shading.program = glCreateProgram();
-		glAttachShader(simple_shading.program, vertex_shader);
-		glAttachShader(simple_shading.program, fragment_shader);
-		//shaders are reference counted so this makes sure they are freed after program is deleted:
-		glDeleteShader(vertex_shader);
-		glDeleteShader(fragment_shader);
-
-		//link the shader program and throw errors if linking fails:
-		glLinkProgram(simple_shading.program);
-		GLint link_status = GL_FALSE;
-		glGetProgramiv(simple_shading.program, GL_LINK_STATUS, &link_status);
-		if (link_status != GL_TRUE) {
-			std::cerr << "Failed to link shader program." << std::endl;
-			GLint info_log_length = 0;
-			glGetProgramiv(simple_shading.program, GL_INFO_LOG_LENGTH, &info_log_length);
-			std::vector< GLchar > info_log(info_log_length, 0);
-			GLsizei length = 0;
-			glGetProgramInfoLog(simple_shading.program, GLsizei(info_log.size()), &length, &info_log[0]);
-			std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
-			throw std::runtime_error("failed to link program");
-		}
-	}
-
-	{ //read back uniform and attribute locations from the shader program:
-		simple_shading.object_to_clip_mat4 = glGetUniformLocation(simple_shading.program, "object_to_clip");
-		simple_shading.object_to_light_mat4x3 = glGetUniformLocation(simple_shading.program, "object_to_light");
-		simple_shading.normal_to_light_mat3 = glGetUniformLocation(simple_shading.program, "normal_to_light");
-
-		simple_shading.sun_direction_vec3 = glGetUniformLocation(simple_shading.program, "sun_direction");
-		simple_shading.sun_color_vec3 = glGetUniformLocation(simple_shading.program, "sun_color");
-		simple_shading.sky_direction_vec3 = glGetUniformLocation(simple_shading.program, "sky_direction");
-		simple_shading.sky_color_vec3 = glGetUniformLocation(simple_shading.program, "sky_color");
-
-		simple_shading.Position_vec4 = glGetAttribLocation(simple_shading.program, "Position");
-		simple_shading.Normal_vec3 = glGetAttribLocation(simple_shading.program, "Normal");
-		simple_shading.Color_vec4 = glGetAttribLocation(simple_shading.program, "Color");
+//copy 'bytes' of vertex or index data to the start of the buffer bound to 'target': straight from 'data' if it's
+// in memory, otherwise inflated from blob chunk 'type' a block at a time, straight into the (mapped) buffer:
+static void upload_mesh_data(GLenum target, void const *data, GLsizeiptr bytes, BlobFile const &file, char const *type) {
+	if (data) {
+		glBufferSubData(target, 0, bytes, data);
+		return;
 	}
-
-	struct Vertex {
-		glm::vec3 Position;
-		glm::vec3 Normal;
-		glm::u8vec4 Color;
-	};
-	static_assert(sizeof(Vertex) == 28, "Vertex should be packed.");
-
-	{ //load mesh data from a binary blob:
-		std::ifstream blob(data_path("meshes.blob"), std::ios::binary);
-		//The blob will be made up of three chunks:
-		// the first chunk will be vertex data (interleaved position/normal/color)
-		// the second chunk will be characters
-		// the third chunk will be an index, mapping a name (range of characters) to a mesh (range of vertex data)
-
-		//read vertex data:
-		std::vector< Vertex > vertices;
-		read_chunk(blob, "dat0", &vertices);
-
-		//read character data (for names):
-		std::vector< char > names;
-		read_chunk(blob, "str0", &names);
-
-		//read index:
-		struct IndexEntry {
-			uint32_t name_begin;
-			uint32_t name_end;
-			uint32_t vertex_begin;
-			uint32_t vertex_end;
-		};
-		static_assert(sizeof(IndexEntry) == 16, "IndexEntry should be packed.");
-
-		std::vector< IndexEntry > index_entries;
-		read_chunk(blob, "idx0", &index_entries);
-
-		if (blob.peek() != EOF) {
-			std::cerr << "WARNING: trailing data in meshes file." << std::endl;
+	constexpr GLsizeiptr Block = 64 << 10;
+	BlobFile::Reader reader(file, type);
+	for (GLsizeiptr at = 0; at < bytes; at += Block) {
+		GLsizeiptr size = std::min(Block, bytes - at);
+		//(the buffer was just created, so nothing the GPU is doing can be using it)
+		void *to = glMapBufferRange(target, at, size, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		if (!to) throw std::runtime_error(std::string("Failed to map a buffer to inflate '") + type + "' into.");
+		try {
+			reader.read(to, size_t(size));
+		} catch (...) {
+			glUnmapBuffer(target);
+			throw;
 		}
-
-		//upload vertex data to the graphics card:
-		glGenBuffers(1, &meshes_vbo);
-		glBindBuffer(GL_ARRAY_BUFFER, meshes_vbo);
-		glBufferData(GL_ARRAY_BUFFER, sizeof(Vertex) * vertices.size(), vertices.data(), GL_STATIC_DRAW);
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
-
-		//create map to store index entries:
-		std::map< std::string, Mesh > index;
-		for (IndexEntry const &e : index_entries) {
-			if (e.name_begin > e.name_end || e.name_end > names.size()) {
-				throw std::runtime_error("invalid name indices in index.");
-			}
-			if (e.vertex_begin > e.vertex_end || e.vertex_end > vertices.size()) {
-				throw std::runtime_error("invalid vertex indices in index.");
-			}
-			Mesh mesh;
-			mesh.first = e.vertex_begin;
-			mesh.count = e.vertex_end - e.vertex_begin;
-			auto ret = index.insert(std::make_pair(
-				std::string(names.begin() + e.name_begin, names.begin() + e.name_end),
-				mesh));
-			if (!ret.second) {
-				throw std::runtime_error("duplicate name in index.");
-			}
+		if (glUnmapBuffer(target) != GL_TRUE) {
+			throw std::runtime_error(std::string("Buffer lost its contents while '") + type + "' was inflated into it.");
 		}
+	}
+}
 
-		//look up into index map to extract meshes:
-		auto lookup = [&index](std::string const &name) -> Mesh {
-			auto f = index.find(name);
-			if (f == index.end()) {
-				throw std::runtime_error("Mesh named '" + name + "' does not appear in index.");
-			}
-			return f->second;
-		};
-		wall_mesh = lookup("Wall");
-		floor_mesh = lookup("Floor");
-		player_mesh = lookup("Player");
-		goop_mesh = lookup("Goop");
-		checkpoint_mesh = lookup("Checkpoint");
-		checkpoint_collected_mesh = lookup("CheckpointCollected");
-		goal_mesh = lookup("Goal");
-		score_mesh = lookup("Score");
-		instructions_mesh = lookup("Instructions");
+Game::Game() {
+	//start compiling shader programs (from dist/shaders/) so the driver can work on them while the meshes load:
+	uint32_t simple_shading_files = shaders.load("simple_shading.vert", "simple_shading.frag");
+	uint32_t instanced_shading_files = shaders.load("instanced_shading.vert", "instanced_shading.frag");
+
+	{ //load mesh data from a binary blob (mapped into memory, not read):
+		MeshBlob blob(data_path("meshes.blob"));
+		//(the gallery and marathon draw tiny tiles with flat stand-ins)
+		blob.add_low_detail_meshes();
+
+		//upload vertex and index data to the graphics card, straight from the mapping (or inflated into the buffer), each followed by the added ones:
+		GLsizeiptr blob_bytes = sizeof(MeshBlob::Vertex) * blob.vertex_count;
+		GLsizeiptr added_bytes = sizeof(MeshBlob::Vertex) * blob.added_vertices.size();
+		glGenBuffers(1, &meshes_vbo);
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, meshes_vbo);
+		glBufferData(GL_ARRAY_BUFFER, blob_bytes + added_bytes, NULL, GL_STATIC_DRAW);
+		upload_mesh_data(GL_ARRAY_BUFFER, blob.vertices, blob_bytes, blob.file, "vtx1");
+		if (added_bytes) glBufferSubData(GL_ARRAY_BUFFER, blob_bytes, added_bytes, blob.added_vertices.data());
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, 0);
+
+		//(the index buffer is bound through GL_COPY_WRITE_BUFFER, since GL_ELEMENT_ARRAY_BUFFER is vertex array state)
+		blob_bytes = sizeof(MeshBlob::Index) * blob.index_count;
+		added_bytes = sizeof(MeshBlob::Index) * blob.added_indices.size();
+		glGenBuffers(1, &meshes_ibo);
+		gl_state_BindBuffer(GL_COPY_WRITE_BUFFER, meshes_ibo);
+		glBufferData(GL_COPY_WRITE_BUFFER, blob_bytes + added_bytes, NULL, GL_STATIC_DRAW);
+		upload_mesh_data(GL_COPY_WRITE_BUFFER, blob.indices, blob_bytes, blob.file, "ind1");
+		if (added_bytes) glBufferSubData(GL_COPY_WRITE_BUFFER, blob_bytes, added_bytes, blob.added_indices.data());
+		gl_state_BindBuffer(GL_COPY_WRITE_BUFFER, 0);
+
+		//look up into index to extract meshes:
+		meshes.lookup(blob);
+	} //(the blob is unmapped here)
+
+	{ //program to perform sun/sky (well, directional+hemispherical) lighting:
+		use_simple_shading(shaders.finish(simple_shading_files, [this](GLuint program) {
+			return use_simple_shading(program);
+		}));
 	}
 
 	{ //create vertex array object to hold the map from the mesh vertex buffer to shader program attributes:
 		glGenVertexArrays(1, &meshes_for_simple_shading_vao);
-		glBindVertexArray(meshes_for_simple_shading_vao);
-		glBindBuffer(GL_ARRAY_BUFFER, meshes_vbo);
+		gl_state_BindVertexArray(meshes_for_simple_shading_vao);
+		gl_state_BindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshes_ibo);
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, meshes_vbo);
 		//note that I'm specifying a 3-vector for a 4-vector attribute here, and this is okay to do:
-		glVertexAttribPointer(simple_shading.Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Position));
+		glVertexAttribPointer(simple_shading.Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(MeshBlob::Vertex), (GLbyte *)0 + offsetof(MeshBlob::Vertex, Position));
 		glEnableVertexAttribArray(simple_shading.Position_vec4);
 		if (simple_shading.Normal_vec3 != -1U) {
-			glVertexAttribPointer(simple_shading.Normal_vec3, 3, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Normal));
+			//(packed normals have to be given four components; the shader ignores the fourth)
+			glVertexAttribPointer(simple_shading.Normal_vec3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(MeshBlob::Vertex), (GLbyte *)0 + offsetof(MeshBlob::Vertex, Normal));
 			glEnableVertexAttribArray(simple_shading.Normal_vec3);
 		}
 		if (simple_shading.Color_vec4 != -1U) {
-			glVertexAttribPointer(simple_shading.Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Color));
+			glVertexAttribPointer(simple_shading.Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(MeshBlob::Vertex), (GLbyte *)0 + offsetof(MeshBlob::Vertex, Color));
 			glEnableVertexAttribArray(simple_shading.Color_vec4);
 		}
-		glBindBuffer(GL_ARRAY_BUFFER, 0);
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, 0);
 	}
 
+	//instanced drawing uses the same mesh buffers:
+	instanced_shading.reset(new InstancedShading(shaders.finish(instanced_shading_files, [this](GLuint program) {
+		return instanced_shading->use_program(program);
+	}), meshes_vbo, meshes_ibo));
+	gallery.reset(new Gallery(&meshes, instanced_shading.get()));
+	marathon.reset(new Marathon(&meshes, instanced_shading.get()));
+	versus.reset(new Versus(&meshes, instanced_shading.get()));
+
 	GL_ERRORS();
 
 	//----------------
 	//set up game board with meshes and rolls:
-	board_meshes.resize(board_size.x * board_size.y, nullptr);
-	create_board();
+	board.create_board();
+	player_slide.add(glm::vec2(board.player));
 }
 
 Game::~Game() {
-	glDeleteVertexArrays(1, &meshes_for_simple_shading_vao);
+	versus.reset();
+	marathon.reset();
+	gallery.reset();
+	instanced_shading.reset();
+
+	gl_state_DeleteVertexArrays(1, &meshes_for_simple_shading_vao);
 	meshes_for_simple_shading_vao = -1U;
 
-	glDeleteBuffers(1, &meshes_vbo);
+	gl_state_DeleteBuffers(1, &meshes_vbo);
 	meshes_vbo = -1U;
 
-	glDeleteProgram(simple_shading.program);
+	gl_state_DeleteBuffers(1, &meshes_ibo);
+	meshes_ibo = -1U;
+
+	gl_state_DeleteProgram(simple_shading.program);
 	simple_shading.program = -1U;
 
 	GL_ERRORS();
 }
 
+bool Game::use_simple_shading(GLuint program) {
+	GLuint Position = glGetAttribLocation(program, "Position");
+	GLuint Normal = glGetAttribLocation(program, "Normal");
+	GLuint Color = glGetAttribLocation(program, "Color");
+	if (meshes_for_simple_shading_vao != -1U) {
+		//the vertex array was built for the first program, so the attributes a new one uses must be where they were:
+		// (ones it doesn't use -- e.g., optimized out while experimenting -- don't matter)
+		auto moved = [](GLuint now, GLuint before) { return now != -1U && now != before; };
+		if (moved(Position, simple_shading.Position_vec4) || moved(Normal, simple_shading.Normal_vec3) || moved(Color, simple_shading.Color_vec4)) {
+			std::cerr << "simple_shading: new program's attribute locations don't match the vertex array; keeping the old program." << std::endl;
+			return false;
+		}
+	} else {
+		simple_shading.Position_vec4 = Position;
+		simple_shading.Normal_vec3 = Normal;
+		simple_shading.Color_vec4 = Color;
+	}
+
+	if (simple_shading.program != -1U) gl_state_DeleteProgram(simple_shading.program);
+	simple_shading.program = program;
+
+	//read back uniform locations from the shader program:
+	simple_shading.object_to_clip_mat4 = glGetUniformLocation(simple_shading.program, "object_to_clip");
+	simple_shading.object_to_light_mat4x3 = glGetUniformLocation(simple_shading.program, "object_to_light");
+	simple_shading.normal_to_light_mat3 = glGetUniformLocation(simple_shading.program, "normal_to_light");
+
+	simple_shading.sun_direction_vec3 = glGetUniformLocation(simple_shading.program, "sun_direction");
+	simple_shading.sun_color_vec3 = glGetUniformLocation(simple_shading.program, "sun_color");
+	simple_shading.sky_direction_vec3 = glGetUniformLocation(simple_shading.program, "sky_direction");
+	simple_shading.sky_color_vec3 = glGetUniformLocation(simple_shading.program, "sky_color");
+
+	return true;
+}
+
 bool Game::handle_event(SDL_Event const &evt, glm::uvec2 window_size) {
 	//ignore any keys that are the result of automatic key repeat:
 	if (evt.type == SDL_KEYDOWN && evt.key.repeat) {
 		return false;
 	}
+	//TAB switches to/from browsing the gallery, M to/from the marathon, V to/from versus:
+	if (evt.type == SDL_KEYDOWN && evt.key.keysym.scancode == SDL_SCANCODE_TAB) {
+		mode = (mode == GalleryMode ? PlayMode : GalleryMode);
+		return true;
+	}
+	if (evt.type == SDL_KEYDOWN && evt.key.keysym.scancode == SDL_SCANCODE_M) {
+		mode = (mode == MarathonMode ? PlayMode : MarathonMode);
+		return true;
+	}
+	if (evt.type == SDL_KEYDOWN && evt.key.keysym.scancode == SDL_SCANCODE_V) {
+		mode = (mode == VersusMode ? PlayMode : VersusMode);
+		return true;
+	}
+	if (mode == VersusMode) {
+		if (evt.type == SDL_KEYDOWN) {
+			return versus->handle_key(evt.key.keysym.scancode);
+		}
+		return false;
+	}
+	if (mode == MarathonMode) {
+		if (evt.type == SDL_KEYDOWN) {
+			if (evt.key.keysym.scancode == SDL_SCANCODE_LEFT) {
+				marathon->move_player(-1, 0);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_RIGHT) {
+				marathon->move_player( 1, 0);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_UP) {
+				marathon->move_player( 0, 1);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
+				marathon->move_player( 0,-1);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_MINUS) {
+				marathon->zoom(1.5f);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_EQUALS) {
+				marathon->zoom(1.0f / 1.5f);
+				return true;
+			}
+		} else if (evt.type == SDL_MOUSEWHEEL) {
+			marathon->zoom(std::pow(1.1f, -float(evt.wheel.y)));
+			return true;
+		}
+		return false;
+	}
+	if (mode == GalleryMode) {
+		//scroll with the mouse wheel, arrows, or page up/down; zoom (change columns) with -/=:
+		float page = gallery->visible_rows(window_size);
+		if (evt.type == SDL_MOUSEWHEEL) {
+			gallery->scroll_by(-0.5f * evt.wheel.y);
+			return true;
+		} else if (evt.type == SDL_KEYDOWN) {
+			if (evt.key.keysym.scancode == SDL_SCANCODE_UP) {
+				gallery->scroll_by(-1.0f);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
+				gallery->scroll_by(1.0f);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_PAGEUP) {
+				gallery->scroll_by(-page);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_PAGEDOWN) {
+				gallery->scroll_by(page);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_HOME) {
+				gallery->scroll = 0.0f;
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_MINUS) {
+				gallery->set_columns(gallery->columns * 2);
+				return true;
+			} else if (evt.key.keysym.scancode == SDL_SCANCODE_EQUALS) {
+				gallery->set_columns(gallery->columns / 2);
+				return true;
+			}
+		}
+		return false;
+	}
 	//move player on L/R/U/D press:
 	if (evt.type == SDL_KEYDOWN && evt.key.repeat == 0) {
+		//(moves are queued, and play out in tick())
 		if (evt.key.keysym.scancode == SDL_SCANCODE_LEFT) {
-			move_player(-1, 0);
+			queued_moves.push(glm::ivec2(-1, 0));
 			return true;
 		} else if (evt.key.keysym.scancode == SDL_SCANCODE_RIGHT) {
-			move_player( 1, 0);
+			queued_moves.push(glm::ivec2( 1, 0));
 			return true;
 		} else if (evt.key.keysym.scancode == SDL_SCANCODE_UP) {
-			move_player( 0, 1);
+			queued_moves.push(glm::ivec2( 0, 1));
 			return true;
 		} else if (evt.key.keysym.scancode == SDL_SCANCODE_DOWN) {
-			move_player( 0,-1);
+			queued_moves.push(glm::ivec2( 0,-1));
 			return true;
 		} else if (evt.key.keysym.scancode == SDL_SCANCODE_BACKSPACE) {
 			//backspace: give up
-			if (checkpoints > 0) checkpoints -= 1;
-			create_board();
+			stop_sliding();
+			if (board.checkpoints > 0) board.checkpoints -= 1;
+			board.create_board();
 			return true;
 		} else if (evt.key.keysym.scancode == SDL_SCANCODE_SPACE) {
 			//space (on goal): next level
-			if (won) {
-				create_board();
+			stop_sliding();
+			if (board.won) {
+				board.create_board();
 			}
 			return true;
 		}
@@ -260,305 +291,128 @@ bool Game::handle_event(SDL_Event const &evt, glm::uvec2 window_size) {
 }
 
 void Game::update(float elapsed) {
+	//run as many fixed-size ticks as have elapsed:
+	tick_accumulator += elapsed;
+	while (tick_accumulator >= Tick) {
+		tick();
+		tick_accumulator -= Tick;
+	}
+
+	if (mode == MarathonMode) {
+		marathon->update();
+	}
 }
 
-void Game::draw(glm::uvec2 drawable_size) {
-	//Set up a transformation matrix to fit the board in the window:
-	glm::mat4 world_to_clip;
-	{
-		float aspect = float(drawable_size.x) / float(drawable_size.y);
-
-		//weird shear transform that will be applied during projection for artistic reasons:
-		glm::mat4 shear = glm::mat4(
-			1.0f, 0.0f, 0.0f, 0.0f,
-			-0.07f, 0.9f, 0.0f, 0.0f,
-			 0.0f, 0.2f, 1.0f, 0.0f,
-			 0.0f, 0.0f, 0.0f, 1.0f
-		);
-
-		//figure out bounding box of board when transformed by shear:
-		glm::vec2 board_min = glm::vec2(std::numeric_limits< float >::infinity());
-		glm::vec2 board_max = glm::vec2(-std::numeric_limits< float >::infinity());
-		for (float cx : { 0.5f, board_size.x - 0.5f }) {
-			for (float cy : { 0.5f, board_size.y - 0.5f }) {
-				for (float cz : { 0.0f, 1.0f }) {
-					glm::vec2 pt = glm::vec2(shear * glm::vec4(cx, cy, cz, 1.0f));
-					board_min = glm::min(board_min, pt);
-					board_max = glm::max(board_max, pt);
-				}
-			}
+void Game::tick() {
+	if (mode == GalleryMode) {
+		gallery->tick(Tick);
+	} else if (mode == MarathonMode) {
+		marathon->tick(Tick);
+	} else if (mode == VersusMode) {
+		versus->tick(Tick);
+	} else if (mode == PlayMode) {
+		//slide faster when more moves are waiting:
+		float hurry = (queued_moves.empty() ? 1.0f : 2.0f);
+		player_slide.hurry[0] = hurry;
+		player_slide.tick(Tick);
+
+		//apply the move once the player arrives:
+		if (sliding_move != glm::ivec2(0) && !player_slide.sliding(0)) {
+			board.move_player(sliding_move.x, sliding_move.y);
+			sliding_move = glm::ivec2(0);
+		}
+
+		//start the next queued move:
+		glm::ivec2 move;
+		while (sliding_move == glm::ivec2(0) && queued_moves.pop(&move)) {
+			glm::uvec2 to = board.slide_destination(move.x, move.y);
+			if (to == board.player) continue; //(already against a wall)
+			sliding_move = move;
+			player_slide.slide_to(0, glm::vec2(to), hurry);
 		}
+	}
+}
+
+bool Game::animating() const {
+	if (shaders.reloading()) return true; //(so update() gets called until the new program is ready)
+	if (mode == GalleryMode) {
+		return true; //(the gallery's players are always wandering)
+	} else if (mode == MarathonMode) {
+		return marathon->animating();
+	} else if (mode == VersusMode) {
+		return versus->animating();
+	} else {
+		return sliding_move != glm::ivec2(0) || !queued_moves.empty() || player_slide.moving(0);
+	}
+}
 
-		//want scale such that [board_min,board_max] * scale fits in [-aspect,aspect]x[-1.0,1.0] screen box:
-		float scale = glm::min(
-			2.0f * aspect / float(board_max.x - board_min.x),
-			2.0f / float(board_max.y - board_min.y)
-		);
-
-		//center of board will be placed at center of screen:
-		glm::vec2 center = 0.5f * (board_max + board_min);
-
-		//NOTE: glm matrices are specified in column-major order
-		world_to_clip = glm::mat4(
-			scale / aspect, 0.0f, 0.0f, 0.0f,
-			0.0f, scale, 0.0f, 0.0f,
-			0.0f, 0.0f,-0.1f, 0.0f, //<-- by scaling z by -0.1f we get usable z range of 10 (near) to -10 (far)
-			-(scale / aspect) * center.x, -scale * center.y, 0.0f, 1.0f
-		) * shear ;
+void Game::stop_sliding() {
+	if (sliding_move != glm::ivec2(0)) {
+		board.move_player(sliding_move.x, sliding_move.y);
+		sliding_move = glm::ivec2(0);
 	}
+	queued_moves.clear();
+	player_slide.snap_to(0, glm::vec2(board.player));
+}
+
+void Game::draw(glm::uvec2 drawable_size) {
+	//how far between the last two simulation ticks this frame is:
+	float alpha = tick_accumulator / Tick;
+
+	if (mode == GalleryMode) {
+		gallery->draw(drawable_size, alpha);
+		return;
+	} else if (mode == MarathonMode) {
+		marathon->draw(drawable_size, alpha);
+		return;
+	} else if (mode == VersusMode) {
+		versus->draw(drawable_size, alpha);
+		return;
+	}
+
+	//collect everything on the board:
+	instances.clear();
+	board.get_instances(&instances, player_slide.at(0, alpha));
+
+	Profiler::mark(Profiler::Submit);
+
+	//Set up a transformation matrix to fit the board in the window:
+	glm::mat4 world_to_clip = board.world_to_clip(drawable_size);
 
 	//set up graphics pipeline to use data from the meshes and the simple shading program:
-	glBindVertexArray(meshes_for_simple_shading_vao);
-	glUseProgram(simple_shading.program);
+	gl_state_BindVertexArray(meshes_for_simple_shading_vao);
+	gl_state_UseProgram(simple_shading.program);
 
-	glUniform3fv(simple_shading.sun_color_vec3, 1, glm::value_ptr(glm::vec3(0.81f, 0.81f, 0.76f)));
-	glUniform3fv(simple_shading.sun_direction_vec3, 1, glm::value_ptr(glm::normalize(glm::vec3(-0.2f, 0.2f, 1.0f))));
-	glUniform3fv(simple_shading.sky_color_vec3, 1, glm::value_ptr(glm::vec3(0.2f, 0.2f, 0.3f)));
-	glUniform3fv(simple_shading.sky_direction_vec3, 1, glm::value_ptr(glm::vec3(0.0f, 1.0f, 0.0f)));
+	BoardLighting lighting;
+	gl_state_Uniform3fv(simple_shading.sun_color_vec3, 1, glm::value_ptr(lighting.sun_color));
+	gl_state_Uniform3fv(simple_shading.sun_direction_vec3, 1, glm::value_ptr(lighting.sun_direction));
+	gl_state_Uniform3fv(simple_shading.sky_color_vec3, 1, glm::value_ptr(lighting.sky_color));
+	gl_state_Uniform3fv(simple_shading.sky_direction_vec3, 1, glm::value_ptr(lighting.sky_direction));
 
 	//helper function to draw a given mesh with a given transformation:
 	auto draw_mesh = [&](Mesh const &mesh, glm::mat4 const &object_to_world) {
 		//set up the matrix uniforms:
 		if (simple_shading.object_to_clip_mat4 != -1U) {
 			glm::mat4 object_to_clip = world_to_clip * object_to_world;
-			glUniformMatrix4fv(simple_shading.object_to_clip_mat4, 1, GL_FALSE, glm::value_ptr(object_to_clip));
+			gl_state_UniformMatrix4fv(simple_shading.object_to_clip_mat4, 1, GL_FALSE, glm::value_ptr(object_to_clip));
 		}
 		if (simple_shading.object_to_light_mat4x3 != -1U) {
-			glUniformMatrix4x3fv(simple_shading.object_to_light_mat4x3, 1, GL_FALSE, glm::value_ptr(object_to_world));
+			gl_state_UniformMatrix4x3fv(simple_shading.object_to_light_mat4x3, 1, GL_FALSE, glm::value_ptr(object_to_world));
 		}
 		if (simple_shading.normal_to_light_mat3 != -1U) {
 			//NOTE: if there isn't any non-uniform scaling in the object_to_world matrix, then the inverse transpose is the matrix itself, and computing it wastes some CPU time:
 			glm::mat3 normal_to_world = glm::inverse(glm::transpose(glm::mat3(object_to_world)));
-			glUniformMatrix3fv(simple_shading.normal_to_light_mat3, 1, GL_FALSE, glm::value_ptr(normal_to_world));
+			gl_state_UniformMatrix3fv(simple_shading.normal_to_light_mat3, 1, GL_FALSE, glm::value_ptr(normal_to_world));
 		}
 
 		//draw the mesh:
-		glDrawArrays(GL_TRIANGLES, mesh.first, mesh.count);
+		glDrawElementsBaseVertex(GL_TRIANGLES, mesh.count, MeshBlob::IndexType, (GLbyte *)0 + mesh.first * sizeof(MeshBlob::Index), mesh.base_vertex);
 	};
 
-	for (uint32_t y = 0; y < board_size.y; ++y) {
-		for (uint32_t x = 0; x < board_size.x; ++x) {
-			draw_mesh(*board_meshes[y*board_size.x+x],
-				glm::mat4(
-					1.0f, 0.0f, 0.0f, 0.0f,
-					0.0f, 1.0f, 0.0f, 0.0f,
-					0.0f, 0.0f, 1.0f, 0.0f,
-					x+0.5f, y+0.5f, 0.0f, 1.0f
-				)
-			);
-			if (goal_meshes[y*board_size.x+x]) {
-				draw_mesh(*goal_meshes[y*board_size.x+x],
-					glm::mat4(
-						1.0f, 0.0f, 0.0f, 0.0f,
-						0.0f, 1.0f, 0.0f, 0.0f,
-						0.0f, 0.0f, 1.0f, 0.0f,
-						x+0.5f, y+0.5f, 0.0f, 1.0f
-					)
-				);
-			}
-		}
+	//draw everything on the board:
+	for (MeshInstance const &instance : instances) {
+		draw_mesh(*instance.mesh, instance.object_to_world);
 	}
-	draw_mesh(player_mesh,
-		glm::mat4(
-			1.0f, 0.0f, 0.0f, 0.0f,
-			0.0f, 1.0f, 0.0f, 0.0f,
-			0.0f, 0.0f, 1.0f, 0.0f,
-			player.x+0.5f, player.y+0.5f, 0.0f, 1.0f
-		)
-	);
-
-
-	//draw score on left edge of board:
-	for (uint32_t c = 0; c < checkpoints; ++c) {
-		float s = 0.25f;
-		glm::vec3 at = glm::vec3(
-			0.5f + (float(c % 4) - 2.0f + 0.5f) * (0.9f * s),
-			1.0f + ((c / 4) + 0.6f) * (0.9f * s),
-			1.0f
-		);
-		draw_mesh(checkpoint_mesh,
-			glm::mat4(
-				s, 0.0f, 0.0f, 0.0f,
-				0.0f, s, 0.0f, 0.0f,
-				0.0f, 0.0f, s, 0.0f,
-				at.x, at.y, at.z, 1.0f
-			)
-		);
-	}
-
-	//some text labels + instructions:
-	draw_mesh(score_mesh,
-		glm::mat4(
-			1.0f, 0.0f, 0.0f, 0.0f,
-			0.0f, 1.0f, 0.0f, 0.0f,
-			0.0f, 0.0f, 1.0f, 0.0f,
-			0.5f, 0.5f, 1.0f, 1.0f
-		)
-	);
-	draw_mesh(instructions_mesh,
-		glm::mat4(
-			1.0f, 0.0f, 0.0f, 0.0f,
-			0.0f, 1.0f, 0.0f, 0.0f,
-			0.0f, 0.0f, 1.0f, 0.0f,
-			board_size.x-0.5f, board_size.y-0.5f, 1.0f, 1.0f
-		)
-	);
-
-
-
-	glUseProgram(0);
 
 	GL_ERRORS();
 }
-
-
-
-//create and return an OpenGL vertex shader from source:
-static GLuint compile_shader(GLenum type, std::string const &source) {
-	GLuint shader = glCreateShader(type);
-	GLchar const *str = source.c_str();
-	GLint length = GLint(source.size());
-	glShaderSource(shader, 1, &str, &length);
-	glCompileShader(shader);
-	GLint compile_status = GL_FALSE;
-	glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
-	if (compile_status != GL_TRUE) {
-		std::cerr << "Failed to compile shader." << std::endl;
-		GLint info_log_length = 0;
-		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &info_log_length);
-		std::vector< GLchar > info_log(info_log_length, 0);
-		GLsizei length = 0;
-		glGetShaderInfoLog(shader, GLsizei(info_log.size()), &length, &info_log[0]);
-		std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
-		glDeleteShader(shader);
-		throw std::runtime_error("Failed to compile shader.");
-	}
-	return shader;
-}
-
-
-void Game::create_board() {
-	static std::mt19937 mt(0xbead1234);
-
-	//can't currently be winning on a just-made board:
-	won = false;
-
-	//remove everything:
-	board_meshes.assign(board_size.x * board_size.y, &wall_mesh);
-	for (uint32_t x = 1; x + 1 < board_size.x; ++x) {
-		for (uint32_t y = 1; y + 1 < board_size.y; ++y) {
-			board_meshes[y*board_size.x + x] = &floor_mesh;
-		}
-	}
-	goal_meshes.assign(board_size.x * board_size.y, nullptr);
-
-	auto random_board_position = [&,this](){
-		return glm::uvec2(
-			mt() % (board_size.x-2) + 1,
-			mt() % (board_size.y-2) + 1
-		);
-	};
-
-	{ //place some random walls:
-		uint32_t walls = (mt() % 8) + 2;
-		for (uint32_t w = 0; w < walls; ++w) {
-			//note: may end up placing walls atop other walls, but that's fine
-			glm::uvec2 pos = random_board_position();
-			if (pos == player) continue; //shouldn't place walls on player, though.
-			board_meshes[pos.y*board_size.x+pos.x] = &wall_mesh;
-		}
-	}
-
-	{ //place some random goops:
-		uint32_t goops = (mt() % 4);
-		for (uint32_t g = 0; g < goops; ++g) {
-			glm::uvec2 pos = random_board_position();
-			if (board_meshes[pos.y*board_size.x+pos.x] != &wall_mesh) {
-				goal_meshes[pos.y*board_size.x+pos.x] = &goop_mesh;
-			}
-		}
-	}
-
-	//try to generate several goals:
-	uint32_t goals = 0;
-	glm::uvec2 prev_goal = player;
-	while (goals <= 2) {
-		//run some random walks to check where player is likely to end up starting at previous goal:
-		std::vector< uint32_t > board_counts(board_size.x * board_size.y, 0);
-		for (uint32_t iter = 0; iter < 100; ++iter) {
-			glm::vec2 at = prev_goal;
-			for (uint32_t step = 0; step < 20; ++step) {
-				static const glm::ivec2 directions[4] = {
-					glm::ivec2(-1,0), glm::ivec2(1,0),
-					glm::ivec2(0,-1), glm::ivec2(0,1)
-				};
-				glm::vec2 d = directions[mt() % 4];
-				while (board_meshes[(at.y+d.y)*board_size.x+(at.x+d.x)] != &wall_mesh) {
-					at += d;
-					if (goal_meshes[at.y*board_size.x+at.x] == &goop_mesh) break;
-				}
-				board_counts[at.y*board_size.x+at.x] += 1;
-			}
-		}
-		//make a list of possible checkpoint cells based on likelihoods:
-		std::vector< glm::uvec2 > possible_cells;
-		for (uint32_t y = 0; y < board_size.y; ++y) {
-			for (uint32_t x = 0; x < board_size.x; ++x) {
-				if (x == player.x && y == player.y) continue; //don't place checkpoint at player
-				if (goal_meshes[y*board_size.x+x] != nullptr) continue; //don't overlap goals
-				if (board_counts[y*board_size.x+x] > 0) {
-					possible_cells.emplace_back(x,y);
-				}
-			}
-		}
-		//ran out of possible goal locations:
-		if (possible_cells.empty()) break;
-
-		//now sort list based on counts (smaller counts == harder):
-		std::stable_sort(possible_cells.begin(), possible_cells.end(), [&](glm::uvec2 a, glm::uvec2 b) {
-			return board_counts[a.y*board_size.x+a.x] < board_counts[b.y*board_size.x+b.x];
-		});
-
-		//pick one for the goal:
-		//limit to picking cells in the highest 25% of difficulty:
-		uint32_t limit = std::max< uint32_t >(1, possible_cells.size() / 4);
-		//extend limit to all cells with the same count:
-		while (limit + 1 < possible_cells.size() && board_counts[possible_cells[limit].y*board_size.x+possible_cells[limit].x] == board_counts[possible_cells[limit+1].y*board_size.x+possible_cells[limit+1].x]) ++limit;
-		glm::uvec2 g = possible_cells[mt() % limit];
-
-		assert(goal_meshes[g.y*board_size.x+g.x] == nullptr);
-		goal_meshes[g.y*board_size.x+g.x] = &checkpoint_mesh;
-		++goals;
-		prev_goal = g;
-	}
-
-	if (goals == 0) {
-		//failed to generate a board with at least one goal, so retry:
-		create_board();
-		return;
-	}
-
-	//turn the last goal into the main goal:
-	goal_meshes[prev_goal.y*board_size.x+prev_goal.x] = &goal_mesh;
-
-}
-
-void Game::move_player(int32_t dx, int32_t dy) {
-	//step player until it is on goop or next tile is a wall
-	assert(player.x >= 1 && player.x + 1 < board_size.x);
-	assert(player.y >= 1 && player.y + 1 < board_size.y);
-	while (board_meshes[(player.y+dy)*board_size.x+(player.x+dx)] != &wall_mesh) {
-		player.x += dx;
-		player.y += dy;
-		//did the player step onto goop?
-		if (goal_meshes[player.y*board_size.x+player.x] == &goop_mesh) break;
-	}
-
-	//did the player gather a checkpoint?
-	if (goal_meshes[player.y*board_size.x+player.x] == &checkpoint_mesh) {
-		goal_meshes[player.y*board_size.x+player.x] = &checkpoint_collected_mesh;
-		checkpoints += 1;
-	}
-
-	won = (goal_meshes[player.y*board_size.x+player.x] == &goal_mesh);
-}
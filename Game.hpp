@@ -1,11 +1,19 @@
 #pragma once
 
 #include "GL.hpp"
+#include "Board.hpp"
+#include "InstancedShading.hpp"
+#include "Gallery.hpp"
+#include "Marathon.hpp"
+#include "Versus.hpp"
+#include "SlideAnimations.hpp"
+#include "ShaderFiles.hpp"
 
 #include <SDL.h>
 #include <glm/glm.hpp>
 #include <glm/gtc/quaternion.hpp>
 
+#include <memory>
 #include <vector>
 
 // The 'Game' struct holds all of the game-relevant state,
@@ -23,13 +31,22 @@ struct Game {
 	bool handle_event(SDL_Event const &evt, glm::uvec2 window_size);
 
 	//update is called at the start of a new frame, after events are handled:
+	// (it advances the simulation in fixed-size ticks; see below)
 	void update(float elapsed);
 
 	//draw is called after update:
 	void draw(glm::uvec2 drawable_size);
 
+	//animating returns 'true' if the next frame could look different even without any new events:
+	// (when it is 'false', the main loop can wait for input instead of redrawing)
+	bool animating() const;
+
 	//------- opengl resources -------
 
+	//shader programs are compiled from files in dist/shaders/, and recompiled when those change:
+	// (the main loop calls shaders.update() every frame)
+	ShaderFiles shaders;
+
 	//shader program that draws lit objects with vertex colors:
 	struct {
 		GLuint program = -1U; //program object
@@ -48,39 +65,51 @@ struct Game {
 		GLuint Normal_vec3 = -1U;
 		GLuint Color_vec4 = -1U;
 	} simple_shading;
+	//switch simple_shading to a (reloaded) program, re-querying locations and deleting the old one;
+	// returns false (and leaves everything as it was) if its attribute locations don't match the vertex array:
+	bool use_simple_shading(GLuint program);
 
-	//mesh data, stored in a vertex buffer:
+	//mesh data, stored in a vertex buffer and an index buffer:
 	GLuint meshes_vbo = -1U; //vertex buffer holding mesh data
+	GLuint meshes_ibo = -1U; //index buffer holding mesh triangles
 
-	//The location of each mesh in the meshes vertex buffer:
-	struct Mesh {
-		GLint first = 0;
-		GLsizei count = 0;
-	};
+	//The location of each board mesh in the meshes index buffer:
+	BoardMeshes meshes;
 
-	Mesh wall_mesh;
-	Mesh floor_mesh;
-	Mesh player_mesh;
-	Mesh goop_mesh;
-	Mesh checkpoint_mesh;
-	Mesh checkpoint_collected_mesh;
-	Mesh goal_mesh;
-	Mesh score_mesh;
-	Mesh instructions_mesh;
+	GLuint meshes_for_simple_shading_vao = -1U; //vertex array object that describes how to connect the meshes_vbo (and meshes_ibo) to the simple_shading_program
 
-	GLuint meshes_for_simple_shading_vao = -1U; //vertex array object that describes how to connect the meshes_vbo to the simple_shading_program
+	//program (+ vertex array object) for drawing many instanced meshes at once:
+	std::unique_ptr< InstancedShading > instanced_shading;
 
 	//------- game state -------
 
-	glm::uvec2 board_size = glm::uvec2(6,6);
-	std::vector< Mesh const * > board_meshes; //wall, floor
-	std::vector< Mesh const * > goal_meshes; //checkpoint, goal, goop
-	glm::uvec2 player = glm::uvec2(1,1);
-	uint32_t checkpoints = 10;
-	bool won = false;
+	Board board = Board(&meshes);
+
+	//scratch space used to collect the board's meshes every draw:
+	std::vector< MeshInstance > instances;
+
+	//------- simulation -------
+
+	//the simulation advances in fixed ticks, no matter the frame rate; drawing interpolates between the last two:
+	static constexpr float Tick = 1.0f / 120.0f;
+	float tick_accumulator = 0.0f; //time not yet simulated (less than one Tick after update)
+	void tick(); //advance the current mode by one Tick
 
-	void create_board(); //create a new, random board solvable from current player position
+	//the player's slide is animated, and the move is applied to the board when the player arrives:
+	SlideAnimations player_slide; //(one object: the player)
+	glm::ivec2 sliding_move = glm::ivec2(0); //move being animated (zero if none)
+	MoveQueue queued_moves; //moves entered during a slide
+	void stop_sliding(); //finish any slide immediately and forget queued moves (e.g., before a new board)
 
-	void move_player(int32_t dx, int32_t dy); //slide player in a given direction
+	//what the arrow keys control and what gets drawn:
+	enum Mode {
+		PlayMode, //one board at a time
+		GalleryMode, //a grid of many generated boards (toggled with TAB)
+		MarathonMode, //one endless board (toggled with M)
+		VersusMode, //two to four players racing in split-screen (toggled with V)
+	} mode = PlayMode;
 
+	std::unique_ptr< Gallery > gallery;
+	std::unique_ptr< Marathon > marathon;
+	std::unique_ptr< Versus > versus;
 };
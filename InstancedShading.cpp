@@ -0,0 +1,255 @@
+#include "InstancedShading.hpp"
+
+#include "Board.hpp" //for Board::shear and BoardLighting
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+#include "gl_extensions.hpp" //helpers to check what the context supports
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <cassert>
+#include <cstddef>
+#include <cstring>
+#include <iostream>
+
+//Tier45's entry points aren't loaded by the Windows shims, and GL_COUNTERS/GL_RECORD builds only
+// wrap GL 3.3 calls (so they would miss the Tier45 ones):
+#if !defined(_WIN32) && !defined(GL_COUNTERS) && !defined(GL_RECORD)
+#define TIER45
+#endif
+
+bool InstancedShading::allow_tier45 = true;
+
+char const *InstancedShading::tier_name(Tier tier) {
+	if (tier == Tier45) return "GL 4.5 (persistent buffers + multi-draw-indirect)";
+	else return "GL 3.3";
+}
+
+InstancedShading::InstancedShading(GLuint program_, GLuint meshes_vbo, GLuint meshes_ibo) {
+	use_program(program_);
+
+	#ifdef TIER45
+	if (allow_tier45 && (gl_version_at_least(4, 5) || (
+		   gl_has_extension("GL_ARB_direct_state_access")
+		&& gl_has_extension("GL_ARB_buffer_storage")
+		&& gl_has_extension("GL_ARB_multi_draw_indirect")
+		&& gl_has_extension("GL_ARB_base_instance")
+	))) {
+		tier = Tier45;
+	}
+	#endif
+	std::cout << "InstancedShading: using the " << tier_name(tier) << " path." << std::endl;
+
+	if (tier == Tier45) {
+		#ifdef TIER45
+		//vertex array object, set up without binding anything (direct state access):
+		// binding 0 is per-vertex data from meshes_vbo, binding 1 per-instance data from the ring
+		glCreateVertexArrays(1, &vao);
+		glVertexArrayElementBuffer(vao, meshes_ibo);
+		glVertexArrayVertexBuffer(vao, 0, meshes_vbo, 0, sizeof(MeshBlob::Vertex));
+		glVertexArrayBindingDivisor(vao, 1, 1);
+		auto attrib = [this](GLuint location, GLint size, GLenum type, GLboolean normalized, size_t offset, GLuint binding) {
+			if (location == -1U) return;
+			glVertexArrayAttribFormat(vao, location, size, type, normalized, GLuint(offset));
+			glVertexArrayAttribBinding(vao, location, binding);
+			glEnableVertexArrayAttrib(vao, location);
+		};
+		attrib(Position_vec4, 3, GL_FLOAT, GL_FALSE, offsetof(MeshBlob::Vertex, Position), 0);
+		attrib(Normal_vec3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, offsetof(MeshBlob::Vertex, Normal), 0);
+		attrib(Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, offsetof(MeshBlob::Vertex, Color), 0);
+		attrib(Instance_vec4, 4, GL_FLOAT, GL_FALSE, 0, 1);
+
+		//(these grow if a frame needs more)
+		instance_stream.reset(new StreamBuffer("instances", (1 << 16) * sizeof(glm::vec4)));
+		command_stream.reset(new StreamBuffer("draw commands", (1 << 10) * sizeof(DrawCommand)));
+		#endif
+	} else { //vertex array object: per-vertex data from meshes_vbo, per-instance data from whatever buffer is bound in draw():
+		glGenVertexArrays(1, &vao);
+		gl_state_BindVertexArray(vao);
+		gl_state_BindBuffer(GL_ELEMENT_ARRAY_BUFFER, meshes_ibo);
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, meshes_vbo);
+		glVertexAttribPointer(Position_vec4, 3, GL_FLOAT, GL_FALSE, sizeof(MeshBlob::Vertex), (GLbyte *)0 + offsetof(MeshBlob::Vertex, Position));
+		glEnableVertexAttribArray(Position_vec4);
+		if (Normal_vec3 != -1U) {
+			glVertexAttribPointer(Normal_vec3, 4, GL_INT_2_10_10_10_REV, GL_TRUE, sizeof(MeshBlob::Vertex), (GLbyte *)0 + offsetof(MeshBlob::Vertex, Normal));
+			glEnableVertexAttribArray(Normal_vec3);
+		}
+		if (Color_vec4 != -1U) {
+			glVertexAttribPointer(Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(MeshBlob::Vertex), (GLbyte *)0 + offsetof(MeshBlob::Vertex, Color));
+			glEnableVertexAttribArray(Color_vec4);
+		}
+		//the instance attribute's pointer is set in draw():
+		glEnableVertexAttribArray(Instance_vec4);
+		glVertexAttribDivisor(Instance_vec4, 1);
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, 0);
+		gl_state_BindVertexArray(0);
+	}
+
+	GL_ERRORS();
+}
+
+bool InstancedShading::use_program(GLuint program_) {
+	GLuint Position = glGetAttribLocation(program_, "Position");
+	GLuint Normal = glGetAttribLocation(program_, "Normal");
+	GLuint Color = glGetAttribLocation(program_, "Color");
+	GLuint Instance = glGetAttribLocation(program_, "Instance");
+	if (vao != -1U) {
+		//the vertex array was built for the first program, so the attributes a new one uses must be where they were:
+		auto moved = [](GLuint now, GLuint before) { return now != -1U && now != before; };
+		if (moved(Position, Position_vec4) || moved(Normal, Normal_vec3) || moved(Color, Color_vec4) || moved(Instance, Instance_vec4)) {
+			std::cerr << "InstancedShading: new program's attribute locations don't match the vertex array; keeping the old program." << std::endl;
+			return false;
+		}
+	} else {
+		Position_vec4 = Position;
+		Normal_vec3 = Normal;
+		Color_vec4 = Color;
+		Instance_vec4 = Instance;
+	}
+
+	if (program != -1U) gl_state_DeleteProgram(program);
+	program = program_;
+
+	world_to_clip_mat4 = glGetUniformLocation(program, "world_to_clip");
+	shear_mat3 = glGetUniformLocation(program, "shear");
+	offset_vec3 = glGetUniformLocation(program, "offset");
+	sun_direction_vec3 = glGetUniformLocation(program, "sun_direction");
+	sun_color_vec3 = glGetUniformLocation(program, "sun_color");
+	sky_direction_vec3 = glGetUniformLocation(program, "sky_direction");
+	sky_color_vec3 = glGetUniformLocation(program, "sky_color");
+
+	return true;
+}
+
+InstancedShading::~InstancedShading() {
+	instance_stream.reset();
+	command_stream.reset();
+
+	gl_state_DeleteVertexArrays(1, &vao);
+	vao = -1U;
+
+	gl_state_DeleteProgram(program);
+	program = -1U;
+
+	GL_ERRORS();
+}
+
+void InstancedShading::begin(glm::mat4 const &world_to_clip) {
+	if (tier == Tier45) {
+		instance_stream->begin_frame();
+		command_stream->begin_frame();
+		commands_queued = 0;
+		multi_draws = 0;
+		commands_drawn = 0;
+	}
+
+	gl_state_BindVertexArray(vao);
+	gl_state_UseProgram(program);
+
+	set_world_to_clip(world_to_clip);
+	glm::mat3 shear = glm::mat3(Board::shear);
+	gl_state_UniformMatrix3fv(shear_mat3, 1, GL_FALSE, glm::value_ptr(shear));
+	set_offset(glm::vec3(0.0f));
+
+	BoardLighting lighting;
+	gl_state_Uniform3fv(sun_color_vec3, 1, glm::value_ptr(lighting.sun_color));
+	gl_state_Uniform3fv(sun_direction_vec3, 1, glm::value_ptr(lighting.sun_direction));
+	gl_state_Uniform3fv(sky_color_vec3, 1, glm::value_ptr(lighting.sky_color));
+	gl_state_Uniform3fv(sky_direction_vec3, 1, glm::value_ptr(lighting.sky_direction));
+}
+
+void InstancedShading::set_world_to_clip(glm::mat4 const &world_to_clip) {
+	if (tier == Tier45) submit();
+	gl_state_UniformMatrix4fv(world_to_clip_mat4, 1, GL_FALSE, glm::value_ptr(world_to_clip));
+}
+
+void InstancedShading::set_offset(glm::vec3 const &offset) const {
+	gl_state_Uniform3fv(offset_vec3, 1, glm::value_ptr(offset));
+}
+
+void InstancedShading::draw(Mesh const &mesh, GLsizei first_instance, GLsizei instance_count) const {
+	glVertexAttribPointer(Instance_vec4, 4, GL_FLOAT, GL_FALSE, sizeof(glm::vec4), (GLbyte *)0 + first_instance * sizeof(glm::vec4));
+	glDrawElementsInstancedBaseVertex(GL_TRIANGLES, mesh.count, MeshBlob::IndexType, (GLbyte *)0 + mesh.first * sizeof(MeshBlob::Index), instance_count, mesh.base_vertex);
+}
+
+void InstancedShading::queue(Mesh const &mesh, glm::vec4 const *instances, GLsizei count, glm::vec3 const &offset) {
+	assert(tier == Tier45);
+	if (count <= 0) return;
+
+	GLsizeiptr bytes = count * sizeof(glm::vec4);
+	if (!instance_stream->fits(bytes, sizeof(glm::vec4)) || !command_stream->fits(sizeof(DrawCommand), sizeof(DrawCommand))) {
+		//a stream is about to grow (into a new buffer), so draw what's queued from the current ones first:
+		submit();
+	}
+
+	StreamBuffer::Allocation to = instance_stream->map(bytes, sizeof(glm::vec4));
+	glm::vec4 *data = reinterpret_cast< glm::vec4 * >(to.data);
+	if (offset == glm::vec3(0.0f)) {
+		std::memcpy(data, instances, bytes);
+	} else {
+		//(the offset is applied here, instead of with a uniform, so every draw in the frame can share one call)
+		for (GLsizei i = 0; i < count; ++i) {
+			data[i] = glm::vec4(glm::vec3(instances[i]) + offset, instances[i].w);
+		}
+	}
+	instance_stream->unmap();
+	if (to.buffer != instance_stream_bound) {
+		#ifdef TIER45
+		glVertexArrayVertexBuffer(vao, 1, to.buffer, 0, sizeof(glm::vec4));
+		#endif
+		instance_stream_bound = to.buffer;
+	}
+
+	StreamBuffer::Allocation at = command_stream->map(sizeof(DrawCommand), sizeof(DrawCommand));
+	DrawCommand &command = *reinterpret_cast< DrawCommand * >(at.data);
+	command.count = GLuint(mesh.count);
+	command.instance_count = GLuint(count);
+	command.first_index = GLuint(mesh.first);
+	command.base_vertex = mesh.base_vertex;
+	command.base_instance = GLuint(to.offset / sizeof(glm::vec4));
+	command_stream->unmap();
+
+	if (commands_queued == 0) {
+		commands_buffer = at.buffer;
+		commands_offset = at.offset;
+	}
+	assert(at.buffer == commands_buffer && at.offset == commands_offset + GLintptr(commands_queued * sizeof(DrawCommand)));
+	commands_queued += 1;
+}
+
+void InstancedShading::draw_indirect(GLuint instances, GLuint commands, GLsizei command_count) {
+	assert(tier == Tier45);
+	#ifdef TIER45
+	if (command_count <= 0) return;
+	//(queued commands read from the ring, so they have to be drawn before the binding moves)
+	submit();
+	if (instances != instance_stream_bound) {
+		glVertexArrayVertexBuffer(vao, 1, instances, 0, sizeof(glm::vec4));
+		instance_stream_bound = instances;
+	}
+	gl_state_BindBuffer(GL_DRAW_INDIRECT_BUFFER, commands);
+	glMultiDrawElementsIndirect(GL_TRIANGLES, MeshBlob::IndexType, (GLbyte *)0, command_count, 0);
+	multi_draws += 1;
+	commands_drawn += uint32_t(command_count);
+	#endif
+}
+
+void InstancedShading::submit() {
+	#ifdef TIER45
+	if (commands_queued == 0) return;
+	gl_state_BindBuffer(GL_DRAW_INDIRECT_BUFFER, commands_buffer);
+	glMultiDrawElementsIndirect(GL_TRIANGLES, MeshBlob::IndexType, (GLbyte *)0 + commands_offset, GLsizei(commands_queued), 0);
+	multi_draws += 1;
+	commands_drawn += commands_queued;
+	commands_queued = 0;
+	#endif
+}
+
+void InstancedShading::end() {
+	if (tier == Tier45) {
+		submit();
+		instance_stream->end_frame();
+		command_stream->end_frame();
+	}
+	//(nothing to unbind: the program and vertex array are left in place, so the next begin() doesn't rebind them)
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "GL.hpp"
+#include "MeshBlob.hpp"
+#include "StreamBuffer.hpp"
+
+#include <glm/glm.hpp>
+
+#include <memory>
+
+//InstancedShading draws many copies of board meshes with the same sun/sky lighting
+// as Game's simple_shading, but with per-instance placement instead of per-draw matrices:
+// each instance is a vec4 whose xyz is where the (sheared) mesh origin goes and w is a uniform scale.
+//It is shared by every mode that draws lots of boards (gallery, marathon, versus).
+//
+//It has two tiers, picked when it is created:
+// - Tier33 (any GL 3.3 context): modes keep instances in their own buffers and draw() each range.
+// - Tier45 (GL 4.5, or the DSA + buffer storage + multi-draw-indirect + base instance extensions):
+//   modes queue() instance ranges instead; those are copied into a (persistently-mapped) StreamBuffer
+//   (no glBufferData/glBufferSubData, and no driver copies) along with an indirect draw command
+//   each, and end() draws the whole frame with one glMultiDrawElementsIndirect.
+struct InstancedShading {
+	//creates OpenGL resources; draws meshes from 'meshes_vbo' (laid out as MeshBlob::Vertex) and 'meshes_ibo'
+	// (MeshBlob::Index) with 'program' (compiled from shaders/instanced_shading.*, which it takes ownership of):
+	InstancedShading(GLuint program, GLuint meshes_vbo, GLuint meshes_ibo);
+	~InstancedShading();
+
+	//switch to a (reloaded) program, re-querying locations and deleting the old one; returns false
+	// (and leaves everything as it was) if its attribute locations don't match the vertex array:
+	bool use_program(GLuint program);
+
+	enum Tier {
+		Tier33,
+		Tier45,
+	} tier = Tier33;
+	static char const *tier_name(Tier tier);
+	//set to false (e.g., by 'main --gl33') before creating an InstancedShading to always use Tier33:
+	static bool allow_tier45;
+
+	//bind program + vertex array and set per-frame uniforms (offset starts at zero):
+	void begin(glm::mat4 const &world_to_clip);
+
+	//change the transformation partway through a frame (e.g., for the next viewport of a split screen):
+	// (Tier45: draws what's queued first, since it was meant for the old transformation)
+	void set_world_to_clip(glm::mat4 const &world_to_clip);
+
+	//--- Tier33 ---
+
+	//offset added to every instance position in the following draws:
+	void set_offset(glm::vec3 const &offset) const;
+
+	//draw instances [first_instance, first_instance+count) of the buffer bound to GL_ARRAY_BUFFER:
+	void draw(Mesh const &mesh, GLsizei first_instance, GLsizei instance_count) const;
+
+	//--- Tier45 ---
+
+	//copy 'count' instances (moved by 'offset') to draw with 'mesh' when the frame is submitted:
+	void queue(Mesh const &mesh, glm::vec4 const *instances, GLsizei count, glm::vec3 const &offset = glm::vec3(0.0f));
+
+	//draw 'command_count' DrawCommands from buffer 'commands', reading instances from buffer 'instances'
+	// (for data that doesn't change every frame, so it needn't be copied to the ring; draws what's queued first):
+	void draw_indirect(GLuint instances, GLuint commands, GLsizei command_count);
+
+	//---
+
+	//finish drawing (Tier45: submits everything queued since begin()):
+	// (bindings are left for gl_state to skip re-setting next time)
+	void end();
+
+	//------- opengl resources -------
+
+	GLuint program = -1U;
+
+	//uniform locations:
+	GLuint world_to_clip_mat4 = -1U;
+	GLuint shear_mat3 = -1U;
+	GLuint offset_vec3 = -1U;
+	GLuint sun_direction_vec3 = -1U;
+	GLuint sun_color_vec3 = -1U;
+	GLuint sky_direction_vec3 = -1U;
+	GLuint sky_color_vec3 = -1U;
+
+	//attribute locations:
+	GLuint Position_vec4 = -1U;
+	GLuint Normal_vec3 = -1U;
+	GLuint Color_vec4 = -1U;
+	GLuint Instance_vec4 = -1U;
+
+	GLuint vao = -1U; //meshes_vbo + meshes_ibo -> program (Tier33: the instance attribute is pointed at a buffer in draw(); Tier45: at instance_stream)
+
+	//------- Tier45 internals -------
+
+	//one draw, in the layout glMultiDrawElementsIndirect reads:
+	struct DrawCommand {
+		GLuint count;
+		GLuint instance_count;
+		GLuint first_index;
+		GLint base_vertex;
+		GLuint base_instance;
+	};
+	static_assert(sizeof(DrawCommand) == 5 * sizeof(GLuint), "DrawCommand is tightly packed");
+
+	//per-frame instances and draw commands (created with the Tier45 vertex array):
+	std::unique_ptr< StreamBuffer > instance_stream;
+	std::unique_ptr< StreamBuffer > command_stream;
+	GLuint instance_stream_bound = 0; //buffer the vertex array's instance binding points at
+
+	//commands queued since the last submit(), which are contiguous in command_stream:
+	GLuint commands_buffer = 0;
+	GLintptr commands_offset = 0;
+	uint32_t commands_queued = 0;
+
+	//stats for the last frame:
+	uint32_t multi_draws = 0; //glMultiDrawElementsIndirect calls
+	uint32_t commands_drawn = 0;
+
+	//draw queued commands that haven't been drawn yet:
+	void submit();
+};
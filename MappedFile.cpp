@@ -0,0 +1,76 @@
+#include "MappedFile.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+
+#if defined(_WIN32)
+#include <windows.h>
+#else
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+MappedFile::MappedFile(std::string const &filename_) : filename(filename_) {
+	#if defined(_WIN32)
+	HANDLE handle = CreateFileA(filename.c_str(), GENERIC_READ, FILE_SHARE_READ, NULL, OPEN_EXISTING, FILE_FLAG_SEQUENTIAL_SCAN, NULL);
+	if (handle == INVALID_HANDLE_VALUE) {
+		throw std::runtime_error("Failed to open '" + filename + "'.");
+	}
+	file = handle;
+	LARGE_INTEGER file_size;
+	if (!GetFileSizeEx(handle, &file_size) || file_size.QuadPart == 0) {
+		CloseHandle(handle);
+		throw std::runtime_error("Failed to map '" + filename + "' (it is empty, or its size can't be read).");
+	}
+	size = size_t(file_size.QuadPart);
+	mapping = CreateFileMappingA(handle, NULL, PAGE_READONLY, 0, 0, NULL);
+	if (mapping) data = reinterpret_cast< uint8_t const * >(MapViewOfFile(mapping, FILE_MAP_READ, 0, 0, 0));
+	if (!data) {
+		if (mapping) CloseHandle(mapping);
+		CloseHandle(handle);
+		throw std::runtime_error("Failed to map '" + filename + "'.");
+	}
+	#else
+	int fd = open(filename.c_str(), O_RDONLY | O_CLOEXEC);
+	if (fd == -1) {
+		throw std::runtime_error("Failed to open '" + filename + "'.");
+	}
+	struct stat info;
+	if (fstat(fd, &info) != 0 || info.st_size == 0) {
+		close(fd);
+		throw std::runtime_error("Failed to map '" + filename + "' (it is empty, or its size can't be read).");
+	}
+	size = size_t(info.st_size);
+	void *at = mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+	close(fd); //(the mapping keeps the file open)
+	if (at == MAP_FAILED) {
+		throw std::runtime_error("Failed to map '" + filename + "'.");
+	}
+	data = reinterpret_cast< uint8_t const * >(at);
+	#endif
+}
+
+void MappedFile::prefetch(size_t offset, size_t bytes) const {
+	if (offset >= size || bytes == 0) return;
+	bytes = std::min(bytes, size - offset);
+	#if defined(_WIN32)
+	(void)offset; (void)bytes; //(pages are just faulted in as they're touched)
+	#else
+	//(madvise wants a page-aligned start, and the mapping itself is page-aligned)
+	size_t page = size_t(sysconf(_SC_PAGESIZE));
+	size_t begin = offset / page * page;
+	madvise(const_cast< uint8_t * >(data) + begin, offset + bytes - begin, MADV_WILLNEED);
+	#endif
+}
+
+MappedFile::~MappedFile() {
+	#if defined(_WIN32)
+	UnmapViewOfFile(data);
+	CloseHandle(mapping);
+	CloseHandle(file);
+	#else
+	munmap(const_cast< uint8_t * >(data), size);
+	#endif
+}
@@ -0,0 +1,32 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//MappedFile maps a whole file read-only into memory (mmap, or MapViewOfFile on Windows), so its
+// contents can be used -- e.g., handed straight to glBufferData -- without being read into a buffer first.
+//The pages are only read from disk (or the page cache) as they are touched, and the mapping is
+// released when the MappedFile is destroyed, so nothing pointing into it may outlive it.
+struct MappedFile {
+	//throws on error (including an empty file, which can't be mapped):
+	MappedFile(std::string const &filename);
+	~MappedFile();
+	MappedFile(MappedFile const &) = delete;
+	MappedFile &operator=(MappedFile const &) = delete;
+
+	std::string filename; //(for error messages)
+	uint8_t const *data = nullptr; //(page-aligned)
+	size_t size = 0;
+
+	//hint that bytes [offset, offset + bytes) are about to be read, so the OS can start reading
+	// them in ahead of the faults (does nothing on Windows):
+	void prefetch(size_t offset, size_t bytes) const;
+
+	//------- internals -------
+
+	#if defined(_WIN32)
+	void *file = nullptr; //HANDLE
+	void *mapping = nullptr; //HANDLE
+	#endif
+};
@@ -0,0 +1,580 @@
+#include "Marathon.hpp"
+
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+#include "frustum.hpp" //helper for visibility tests
+#include "Profiler.hpp" //for marking build vs. submit time
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <functional>
+
+constexpr int32_t Marathon::ChunkSize;
+constexpr uint32_t Marathon::MaxSlideChunks;
+constexpr uint32_t Marathon::MaxChunks;
+constexpr uint32_t Marathon::MaxInstancesPerChunk;
+constexpr float Marathon::LowDetailPixels;
+
+Marathon::Marathon(BoardMeshes const *meshes_, InstancedShading *shading_, uint32_t seed_) : meshes(meshes_), shading(shading_), seed(seed_) {
+	assert(meshes);
+	assert(shading);
+
+	player_slide.add(glm::vec2(player));
+
+	//leave one hardware thread for the main loop:
+	uint32_t count = std::max(1U, std::min(4U, std::thread::hardware_concurrency()));
+	if (count > 1) count -= 1;
+	for (uint32_t i = 0; i < count; ++i) {
+		workers.emplace_back(&Marathon::work, this);
+	}
+
+	GL_ERRORS();
+}
+
+Marathon::~Marathon() {
+	{ //stop workers:
+		std::unique_lock< std::mutex > lock(mutex);
+		quit = true;
+		jobs.clear();
+	}
+	cv.notify_all();
+	for (auto &worker : workers) {
+		worker.join();
+	}
+
+	for (auto &kv : chunks) {
+		if (kv.second->vbo != -1U) free_vbos.emplace_back(kv.second->vbo);
+	}
+	chunks.clear();
+	for (GLuint vbo : free_vbos) {
+		gl_state_DeleteBuffers(1, &vbo);
+	}
+	free_vbos.clear();
+
+	GL_ERRORS();
+}
+
+//------- world layout -------
+
+uint64_t Marathon::chunk_key(glm::ivec2 coord) {
+	return (uint64_t(uint32_t(coord.x)) << 32) | uint64_t(uint32_t(coord.y));
+}
+
+glm::ivec2 Marathon::chunk_of(glm::ivec2 tile) {
+	//(division that rounds toward negative infinity)
+	auto floor_div = [](int32_t a) {
+		return (a >= 0 ? a : a - (ChunkSize - 1)) / ChunkSize;
+	};
+	return glm::ivec2(floor_div(tile.x), floor_div(tile.y));
+}
+
+//small integer hash (so the world is the same on every platform, unlike std:: distributions):
+static uint32_t hash(uint32_t seed, int32_t x, int32_t y, uint32_t salt) {
+	uint32_t h = seed ^ (salt * 0x9e3779b9U);
+	for (uint32_t v : { uint32_t(x), uint32_t(y) }) {
+		h ^= v + 0x7f4a7c15U + (h << 6) + (h >> 2);
+		h ^= h >> 16;
+		h *= 0x7feb352dU;
+		h ^= h >> 15;
+		h *= 0x846ca68bU;
+		h ^= h >> 16;
+	}
+	return h;
+}
+
+bool Marathon::is_open(uint32_t seed, glm::ivec2 coord) {
+	//about a third of chunks are open fields (the start chunk never is):
+	return (coord != glm::ivec2(0,0)) && (hash(seed, coord.x, coord.y, 0) % 100 < 35);
+}
+
+void Marathon::generate_layout(uint32_t seed, glm::ivec2 coord, Layout *_layout) {
+	assert(_layout);
+	auto &layout = *_layout;
+
+	layout.open = is_open(seed, coord);
+
+	for (int32_t i = 0; i < ChunkSize; ++i) {
+		layout.wall_rows[i] = layout.wall_cols[i] = 0;
+		layout.goop_rows[i] = layout.goop_cols[i] = 0;
+	}
+
+	for (int32_t y = 0; y < ChunkSize; ++y) {
+		for (int32_t x = 0; x < ChunkSize; ++x) {
+			glm::ivec2 tile = coord * ChunkSize + glm::ivec2(x,y);
+			Item &item = layout.items[y * ChunkSize + x];
+			item = Empty;
+
+			//keep the area around the starting tile clear:
+			if (std::abs(tile.x) <= 1 && std::abs(tile.y) <= 1) continue;
+
+			uint32_t h = hash(seed, tile.x, tile.y, 1) % 1000;
+			if (layout.open) {
+				//open fields only have the occasional checkpoint:
+				if (h < 6) item = Checkpoint;
+			} else if (h < 130) {
+				layout.wall_rows[y] |= (1 << x);
+				layout.wall_cols[x] |= (1 << y);
+			} else if (h < 160) {
+				item = Goop;
+				layout.goop_rows[y] |= (1 << x);
+				layout.goop_cols[x] |= (1 << y);
+			} else if (h < 175) {
+				item = Checkpoint;
+			}
+		}
+	}
+}
+
+glm::ivec2 Marathon::slide(glm::ivec2 from, glm::ivec2 dir) {
+	assert(std::abs(dir.x) + std::abs(dir.y) == 1);
+	//work along one axis:
+	uint32_t axis = (dir.x != 0 ? 0 : 1);
+	int32_t step = dir[axis];
+
+	Layout scratch; //layout of a chunk that isn't resident (computed, used, and forgotten)
+
+	glm::ivec2 at = from;
+	bool first = true;
+	for (uint32_t crossed = 0; crossed < MaxSlideChunks; ++crossed) {
+		glm::ivec2 coord = chunk_of(at);
+		glm::ivec2 local = at - coord * ChunkSize;
+
+		Layout const *layout = nullptr;
+		if (Chunk *chunk = find_chunk(coord)) {
+			layout = &chunk->layout;
+		} else {
+			//open fields can be skipped without generating anything:
+			if (!is_open(seed, coord)) {
+				generate_layout(seed, coord, &scratch);
+				layout = &scratch;
+			}
+		}
+
+		int32_t p = local[axis];
+		if (layout && !layout->open) {
+			uint32_t walls = (axis == 0 ? layout->wall_rows[local.y] : layout->wall_cols[local.x]);
+			uint32_t goops = (axis == 0 ? layout->goop_rows[local.y] : layout->goop_cols[local.x]);
+
+			//only consider tiles ahead of the player (including 'p' itself when entering a new chunk):
+			uint32_t ahead;
+			if (step > 0) {
+				ahead = 0xffffU & ~((1U << (first ? p + 1 : p)) - 1U);
+			} else {
+				ahead = (first ? (1U << p) - 1U : (2U << p) - 1U);
+			}
+			walls &= ahead;
+			goops &= ahead;
+
+			//nearest set bit in the direction of travel:
+			auto nearest = [step](uint32_t bits) -> int32_t {
+				if (bits == 0) return -1;
+				int32_t i = (step > 0 ? 0 : ChunkSize - 1);
+				while (!(bits & (1U << i))) i += step;
+				return i;
+			};
+			int32_t wall = nearest(walls);
+			int32_t goop = nearest(goops);
+
+			//stop just before a wall or on goop, whichever comes first:
+			bool stopped = false;
+			int32_t stop = 0;
+			if (wall != -1) {
+				stopped = true;
+				stop = wall - step;
+			}
+			if (goop != -1 && (!stopped || (goop - stop) * step <= 0)) {
+				stopped = true;
+				stop = goop;
+			}
+			if (stopped) {
+				//(stop may be just outside this chunk if the wall was its first tile)
+				at[axis] = coord[axis] * ChunkSize + stop;
+				return at;
+			}
+		}
+
+		//nothing in the way in this chunk; continue to the first tile of the next one:
+		at[axis] = coord[axis] * ChunkSize + (step > 0 ? ChunkSize : -1);
+		first = false;
+	}
+
+	//(very long run of open fields) stop at the edge of the last chunk examined:
+	at[axis] -= step;
+	return at;
+}
+
+void Marathon::move_player(int32_t dx, int32_t dy) {
+	queued_moves.push(glm::ivec2(dx, dy));
+}
+
+void Marathon::tick(float dt) {
+	//slide faster when more moves are waiting:
+	float hurry = (queued_moves.empty() ? 1.0f : 2.0f);
+	player_slide.hurry[0] = hurry;
+	player_slide.tick(dt);
+
+	if (sliding && !player_slide.sliding(0)) {
+		sliding = false;
+		collect_checkpoint();
+	}
+
+	//start the next queued move:
+	glm::ivec2 dir;
+	while (!sliding && queued_moves.pop(&dir)) {
+		glm::ivec2 to = slide(player, dir);
+		last_direction = dir;
+		if (to == player) continue; //(already against a wall)
+		player = to;
+		sliding = true;
+		player_slide.slide_to(0, glm::vec2(player), hurry);
+	}
+
+	//ease camera toward the (animated) player:
+	camera_previous = camera;
+	glm::vec2 target = player_slide.current[0] + 0.5f;
+	camera += (target - camera) * (1.0f - std::exp(-6.0f * dt));
+	if (glm::length(target - camera) < 0.001f) camera = target;
+}
+
+void Marathon::collect_checkpoint() {
+	glm::ivec2 coord = chunk_of(player);
+	glm::ivec2 local = player - coord * ChunkSize;
+	uint64_t tile_key = chunk_key(player);
+	if (collected.count(tile_key)) return;
+
+	Chunk *chunk = find_chunk(coord);
+	Layout scratch;
+	Layout const *layout = chunk ? &chunk->layout : nullptr;
+	if (!layout) {
+		generate_layout(seed, coord, &scratch);
+		layout = &scratch;
+	}
+	if (layout->items[local.y * ChunkSize + local.x] == Checkpoint) {
+		collected.insert(tile_key);
+		checkpoints += 1;
+		if (chunk) {
+			//rebuild the chunk's instances to show the collected checkpoint:
+			chunk->layout.items[local.y * ChunkSize + local.x] = Collected;
+			build_instances(*meshes, chunk);
+			upload(chunk);
+		}
+	}
+}
+
+//------- chunk cache -------
+
+void Marathon::build_instances(BoardMeshes const &meshes, Chunk *_chunk) {
+	assert(_chunk);
+	auto &chunk = *_chunk;
+	Layout const &layout = chunk.layout;
+
+	chunk.instance_data.clear();
+	chunk.batches.clear();
+
+	glm::mat3 shear = glm::mat3(Board::shear);
+
+	//one pass per mesh, so each mesh ends up as a contiguous range:
+	auto add_batch = [&](Mesh const *mesh, std::function< bool(int32_t x, int32_t y) > const &has) {
+		Chunk::Batch batch;
+		batch.mesh = mesh;
+		batch.first_instance = GLsizei(chunk.instance_data.size());
+		for (int32_t y = 0; y < ChunkSize; ++y) {
+			for (int32_t x = 0; x < ChunkSize; ++x) {
+				if (has(x,y)) {
+					chunk.instance_data.emplace_back(shear * glm::vec3(x + 0.5f, y + 0.5f, 0.0f), 1.0f);
+				}
+			}
+		}
+		batch.instance_count = GLsizei(chunk.instance_data.size()) - batch.first_instance;
+		if (batch.instance_count) chunk.batches.emplace_back(batch);
+	};
+	auto is_wall = [&](int32_t x, int32_t y) { return (layout.wall_rows[y] & (1 << x)) != 0; };
+	auto is_item = [&](Item item) {
+		return [&layout,item](int32_t x, int32_t y) { return layout.items[y * ChunkSize + x] == item; };
+	};
+
+	add_batch(&meshes.wall, is_wall);
+	add_batch(&meshes.floor, [&](int32_t x, int32_t y) { return !is_wall(x,y); });
+	add_batch(&meshes.goop, is_item(Goop));
+	add_batch(&meshes.checkpoint, is_item(Checkpoint));
+	add_batch(&meshes.checkpoint_collected, is_item(Collected));
+
+	assert(chunk.instance_data.size() <= MaxInstancesPerChunk);
+}
+
+Marathon::Chunk *Marathon::find_chunk(glm::ivec2 coord) {
+	auto f = chunks.find(chunk_key(coord));
+	if (f == chunks.end()) return nullptr;
+	return f->second.get();
+}
+
+void Marathon::upload(Chunk *chunk) {
+	assert(chunk);
+	if (shading->tier == InstancedShading::Tier45) return; //(instances are copied to the ring as they are drawn)
+	if (chunk->vbo == -1U) {
+		if (!free_vbos.empty()) {
+			chunk->vbo = free_vbos.back();
+			free_vbos.pop_back();
+		} else {
+			glGenBuffers(1, &chunk->vbo);
+		}
+	}
+	gl_state_BindBuffer(GL_ARRAY_BUFFER, chunk->vbo);
+	//(re-)specify full-size storage (orphaning any copy a pending draw still uses), then fill:
+	glBufferData(GL_ARRAY_BUFFER, MaxInstancesPerChunk * sizeof(glm::vec4), NULL, GL_DYNAMIC_DRAW);
+	glBufferSubData(GL_ARRAY_BUFFER, 0, chunk->instance_data.size() * sizeof(glm::vec4), chunk->instance_data.data());
+}
+
+void Marathon::receive_chunks() {
+	std::vector< std::unique_ptr< Chunk > > arrived;
+	{
+		std::unique_lock< std::mutex > lock(mutex);
+		arrived.swap(finished);
+	}
+
+	for (auto &chunk : arrived) {
+		uint64_t key = chunk_key(chunk->coord);
+		requested.erase(key);
+		if (chunks.count(key)) continue; //(shouldn't happen, but harmless)
+
+		//apply checkpoints collected since the layout was generated:
+		bool changed = false;
+		for (int32_t y = 0; y < ChunkSize; ++y) {
+			for (int32_t x = 0; x < ChunkSize; ++x) {
+				Item &item = chunk->layout.items[y * ChunkSize + x];
+				if (item == Checkpoint && collected.count(chunk_key(chunk->coord * ChunkSize + glm::ivec2(x,y)))) {
+					item = Collected;
+					changed = true;
+				}
+			}
+		}
+		if (changed) build_instances(*meshes, chunk.get());
+
+		upload(chunk.get());
+		lru.emplace_front(key);
+		chunk->lru = lru.begin();
+		chunks.emplace(key, std::move(chunk));
+	}
+
+	GL_ERRORS();
+}
+
+void Marathon::request_chunks() {
+	//chunks that could be on screen, plus a border:
+	float aspect = float(last_drawable_size.x) / float(last_drawable_size.y);
+	glm::vec2 radius = glm::vec2(0.5f * view_height * aspect + 2.0f, 0.5f * view_height / 0.9f + 2.0f);
+	radius.x += 0.07f * radius.y; //(account for shear)
+
+	//every chunk wanted (cached or not), closest first:
+	std::vector< std::pair< float, glm::ivec2 > > visible, ahead;
+	std::unordered_set< uint64_t > seen;
+	auto want = [&](glm::vec2 center, glm::vec2 extent, std::vector< std::pair< float, glm::ivec2 > > *list) {
+		glm::ivec2 lo = chunk_of(glm::ivec2(glm::floor(center - extent)));
+		glm::ivec2 hi = chunk_of(glm::ivec2(glm::floor(center + extent)));
+		for (int32_t cy = lo.y - 1; cy <= hi.y + 1; ++cy) {
+			for (int32_t cx = lo.x - 1; cx <= hi.x + 1; ++cx) {
+				glm::ivec2 coord = glm::ivec2(cx, cy);
+				if (!seen.insert(chunk_key(coord)).second) continue;
+				glm::vec2 mid = (glm::vec2(coord) + 0.5f) * float(ChunkSize);
+				list->emplace_back(glm::length(mid - center), coord);
+			}
+		}
+		std::stable_sort(list->begin(), list->end(), [](std::pair< float, glm::ivec2 > const &a, std::pair< float, glm::ivec2 > const &b) {
+			return a.first < b.first;
+		});
+	};
+	//what's visible comes first, then what's ahead of the player's last slide, for as much of the cache as is left
+	// (wanting more than fits would just evict look-ahead chunks as they arrive, and request them again, forever):
+	want(camera, radius, &visible);
+	want(glm::vec2(player) + glm::vec2(last_direction) * (2.0f * ChunkSize), radius, &ahead);
+	if (visible.size() < MaxChunks) {
+		visible.insert(visible.end(), ahead.begin(), ahead.begin() + std::min(ahead.size(), MaxChunks - visible.size()));
+	}
+
+	//keep wanted chunks that are already cached at the front of the LRU list (farthest first, so the closest
+	// ends up at the very front), and request the rest:
+	std::vector< std::pair< float, glm::ivec2 > > wanted;
+	for (auto w = visible.rbegin(); w != visible.rend(); ++w) {
+		uint64_t key = chunk_key(w->second);
+		auto f = chunks.find(key);
+		if (f != chunks.end()) {
+			f->second->last_wanted = frame;
+			lru.splice(lru.begin(), lru, f->second->lru);
+		} else if (!requested.count(key)) {
+			wanted.emplace_back(*w);
+		}
+	}
+	std::reverse(wanted.begin(), wanted.end());
+
+	{ //replace jobs that haven't started yet with the new list:
+		std::unique_lock< std::mutex > lock(mutex);
+		for (glm::ivec2 const &coord : jobs) {
+			requested.erase(chunk_key(coord));
+		}
+		jobs.clear();
+		for (auto const &w : wanted) {
+			uint64_t key = chunk_key(w.second);
+			if (requested.insert(key).second) {
+				jobs.emplace_back(w.second);
+			}
+		}
+	}
+	cv.notify_all();
+}
+
+void Marathon::evict_chunks() {
+	//evict least-recently-used chunks, but never one drawn or wanted this frame:
+	while (chunks.size() > MaxChunks) {
+		auto f = chunks.find(lru.back());
+		assert(f != chunks.end());
+		if (f->second->last_drawn == frame || f->second->last_wanted == frame) break;
+		if (f->second->vbo != -1U) free_vbos.emplace_back(f->second->vbo);
+		lru.pop_back();
+		chunks.erase(f);
+	}
+}
+
+void Marathon::work() {
+	while (true) {
+		glm::ivec2 coord;
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			cv.wait(lock, [this](){ return quit || !jobs.empty(); });
+			if (quit) break;
+			coord = jobs.front();
+			jobs.pop_front();
+		}
+
+		std::unique_ptr< Chunk > chunk(new Chunk);
+		chunk->coord = coord;
+		generate_layout(seed, coord, &chunk->layout);
+		build_instances(*meshes, chunk.get());
+
+		{
+			std::unique_lock< std::mutex > lock(mutex);
+			finished.emplace_back(std::move(chunk));
+		}
+	}
+}
+
+//------- per-frame -------
+
+void Marathon::update() {
+	receive_chunks();
+	request_chunks();
+	evict_chunks();
+}
+
+bool Marathon::animating() const {
+	return sliding || !queued_moves.empty() || player_slide.moving(0)
+		|| camera_previous != camera
+		|| !requested.empty(); //(finished chunks need to be uploaded and drawn)
+}
+
+void Marathon::zoom(float factor) {
+	view_height = std::max(6.0f, std::min(160.0f, view_height * factor));
+}
+
+glm::mat4 Marathon::world_to_clip(glm::uvec2 drawable_size) const {
+	float aspect = float(drawable_size.x) / float(drawable_size.y);
+	float scale = 2.0f / view_height;
+	return glm::mat4(
+		scale / aspect, 0.0f, 0.0f, 0.0f,
+		0.0f, scale, 0.0f, 0.0f,
+		0.0f, 0.0f,-0.1f, 0.0f, //<-- same depth range as Board::world_to_clip
+		0.0f, 0.0f, 0.0f, 1.0f
+	);
+}
+
+void Marathon::draw(glm::uvec2 drawable_size, float alpha) {
+	last_drawable_size = drawable_size;
+	++frame;
+
+	glm::mat3 shear = glm::mat3(Board::shear);
+	//everything is drawn relative to the camera, so positions stay small far from the origin:
+	glm::vec2 camera_at = glm::mix(camera_previous, camera, alpha);
+	auto camera_offset = [&](glm::vec2 const &world) {
+		return shear * glm::vec3(world - camera_at, 0.0f);
+	};
+
+	//(chunks were built ahead of time, on the workers; from here on, drawing is culling and submitting)
+	Profiler::mark(Profiler::Submit);
+
+	glm::mat4 clip = world_to_clip(drawable_size);
+	shading->begin(clip);
+
+	//on-screen size of a tile decides whether to use the low-detail meshes:
+	drew_low_detail = (float(drawable_size.y) / view_height < LowDetailPixels);
+	auto mesh_for = [&](Mesh const *mesh) -> Mesh const & {
+		return (drew_low_detail ? meshes->low_detail(mesh) : *mesh);
+	};
+
+	{ //draw resident chunks whose bounding boxes are in the view frustum:
+		chunks_drawn = 0;
+		chunks_culled = 0;
+
+		//(a generous range of candidates; the frustum test does the real work)
+		float aspect = float(drawable_size.x) / float(drawable_size.y);
+		glm::vec2 radius = glm::vec2(0.5f * view_height * aspect, 0.5f * view_height / 0.9f) + float(ChunkSize);
+		radius.x += 0.07f * radius.y;
+		glm::ivec2 lo = chunk_of(glm::ivec2(glm::floor(camera_at - radius)));
+		glm::ivec2 hi = chunk_of(glm::ivec2(glm::floor(camera_at + radius)));
+		//chunk's box: tiles are centered on half-integers, so it's the tile bounds around the first and last tile's centers:
+		glm::vec3 box_min = glm::vec3(0.5f, 0.5f, 0.0f) + meshes->tile_min;
+		glm::vec3 box_max = glm::vec3(ChunkSize - 0.5f, ChunkSize - 0.5f, 0.0f) + meshes->tile_max;
+		for (int32_t cy = lo.y; cy <= hi.y; ++cy) {
+			for (int32_t cx = lo.x; cx <= hi.x; ++cx) {
+				Chunk *chunk = find_chunk(glm::ivec2(cx, cy));
+				if (!chunk) continue; //(not built yet)
+
+				glm::vec3 offset = camera_offset(glm::vec2(chunk->coord * ChunkSize));
+
+				//chunk's box (in chunk-local, unsheared coordinates) -> clip space:
+				glm::mat4 chunk_to_clip = glm::mat4(1.0f);
+				chunk_to_clip[3] = glm::vec4(offset, 1.0f);
+				chunk_to_clip = clip * chunk_to_clip * Board::shear;
+				if (!box_in_frustum(chunk_to_clip, box_min, box_max)) {
+					++chunks_culled;
+					continue;
+				}
+				++chunks_drawn;
+
+				chunk->last_drawn = frame;
+				lru.splice(lru.begin(), lru, chunk->lru);
+
+				if (shading->tier == InstancedShading::Tier45) {
+					for (Chunk::Batch const &batch : chunk->batches) {
+						shading->queue(mesh_for(batch.mesh), &chunk->instance_data[batch.first_instance], batch.instance_count, offset);
+					}
+					continue;
+				}
+				shading->set_offset(offset);
+				gl_state_BindBuffer(GL_ARRAY_BUFFER, chunk->vbo);
+				for (Chunk::Batch const &batch : chunk->batches) {
+					shading->draw(mesh_for(batch.mesh), batch.first_instance, batch.instance_count);
+				}
+			}
+		}
+	}
+
+	{ //draw the player:
+		glm::vec4 instance = glm::vec4(0.0f, 0.0f, 0.0f, 1.0f);
+		if (shading->tier == InstancedShading::Tier45) {
+			shading->queue(mesh_for(&meshes->player), &instance, 1, camera_offset(player_slide.at(0, alpha) + 0.5f));
+			shading->end();
+			GL_ERRORS();
+			return;
+		}
+		player_stream.begin_frame();
+		StreamBuffer::Allocation at = player_stream.write(&instance, sizeof(instance), sizeof(instance));
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, at.buffer);
+		shading->set_offset(camera_offset(player_slide.at(0, alpha) + 0.5f));
+		shading->draw(mesh_for(&meshes->player), GLsizei(at.offset / sizeof(instance)), 1);
+		player_stream.end_frame();
+	}
+
+	shading->end();
+
+	GL_ERRORS();
+}
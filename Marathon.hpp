@@ -0,0 +1,169 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Board.hpp"
+#include "InstancedShading.hpp"
+#include "SlideAnimations.hpp"
+#include "StreamBuffer.hpp"
+
+#include <glm/glm.hpp>
+
+#include <condition_variable>
+#include <deque>
+#include <list>
+#include <memory>
+#include <mutex>
+#include <thread>
+#include <unordered_map>
+#include <unordered_set>
+#include <vector>
+
+//The 'Marathon' is an endless board: an unbounded procedural world made of ChunkSize x ChunkSize chunks.
+// - A chunk's layout (walls, goop, checkpoints) is a pure function of the world seed and the chunk's
+//   coordinates, so any part of the world can be queried without having been generated first.
+// - Chunks near the camera (and ahead of the direction the player last slid) are built on worker
+//   threads, uploaded to instance buffers, and kept in an LRU cache; evicted chunks give their
+//   buffers back to a free list for reuse.
+// - Slides are resolved a chunk at a time using per-row/per-column wall bitmasks, and "open field"
+//   chunks (no walls at all) are skipped without looking at their tiles, so a slide can cross many
+//   chunks without building any of them.
+struct Marathon {
+	//creates OpenGL resources and starts worker threads; 'meshes' and 'shading' must outlive the marathon:
+	Marathon(BoardMeshes const *meshes, InstancedShading *shading, uint32_t seed = 0x6a3e1ffe);
+	~Marathon();
+
+	BoardMeshes const *meshes;
+	InstancedShading *shading; //(not const: Tier45 queues instances into its ring)
+	uint32_t seed;
+
+	//------- game state -------
+
+	glm::ivec2 player = glm::ivec2(0,0); //(tile coordinates; the world is unbounded in every direction)
+	glm::ivec2 last_direction = glm::ivec2(1,0); //direction of the most recent slide (used to decide what to build next)
+	uint32_t checkpoints = 0; //checkpoints collected so far
+
+	//the player's slide is animated; 'player' is already the destination while it plays out:
+	SlideAnimations player_slide; //(one object: the player)
+	bool sliding = false;
+	MoveQueue queued_moves; //moves entered during a slide
+
+	glm::vec2 camera = glm::vec2(0.5f, 0.5f); //world position at the center of the screen; follows the player
+	glm::vec2 camera_previous = camera; //camera as of the previous tick (for interpolation)
+	float view_height = 14.0f; //tiles visible from top to bottom of the screen
+	void zoom(float factor); //scale view_height by 'factor' (within limits)
+
+	void move_player(int32_t dx, int32_t dy); //queue a slide in a given direction
+	void tick(float dt); //advance the slide + camera by one fixed timestep
+	void update(); //collect finished chunks, request new ones (anything time-based happens in tick)
+	bool animating() const; //true if the player or camera is moving or chunks are still being built
+	//'alpha' is how far (in [0,1]) the frame is between the last two ticks:
+	void draw(glm::uvec2 drawable_size, float alpha);
+
+	void collect_checkpoint(); //collect a checkpoint at the player's position, if there is one
+
+	glm::mat4 world_to_clip(glm::uvec2 drawable_size) const; //(camera-relative; chunks are placed with InstancedShading::set_offset)
+
+	//------- world layout -------
+
+	static constexpr int32_t ChunkSize = 16; //(walls are stored as one uint16_t bitmask per row and per column)
+
+	enum Item : uint8_t {
+		Empty = 0,
+		Goop, //stops a slide
+		Checkpoint, //collected when a slide stops on it
+		Collected,
+	};
+
+	//everything needed to play a chunk (and nothing needed to draw it):
+	struct Layout {
+		bool open = false; //true if the chunk has no walls or goop (slides pass straight through)
+		uint16_t wall_rows[ChunkSize]; //bit x of wall_rows[y] is set if (x,y) is a wall
+		uint16_t wall_cols[ChunkSize]; //bit y of wall_cols[x] is set if (x,y) is a wall
+		uint16_t goop_rows[ChunkSize];
+		uint16_t goop_cols[ChunkSize];
+		Item items[ChunkSize * ChunkSize]; //indexed by y * ChunkSize + x
+	};
+	//whether a chunk is an open field, without computing the rest of its layout:
+	static bool is_open(uint32_t seed, glm::ivec2 coord);
+	//computes a chunk's layout from the seed (pure; safe to call from any thread):
+	static void generate_layout(uint32_t seed, glm::ivec2 coord, Layout *layout);
+
+	//where a slide from 'from' in direction 'dir' stops (doesn't need any chunks to be built):
+	glm::ivec2 slide(glm::ivec2 from, glm::ivec2 dir);
+	//give up on slides that cross this many chunks (only possible in a long run of open fields):
+	static constexpr uint32_t MaxSlideChunks = 256;
+
+	//------- chunk cache -------
+
+	struct Chunk {
+		glm::ivec2 coord = glm::ivec2(0);
+		Layout layout;
+
+		//instances (offsets relative to the chunk's lower-left corner), grouped by mesh:
+		std::vector< glm::vec4 > instance_data;
+		struct Batch {
+			Mesh const *mesh = nullptr;
+			GLsizei first_instance = 0;
+			GLsizei instance_count = 0;
+		};
+		std::vector< Batch > batches;
+
+		GLuint vbo = -1U; //instance buffer (assigned on the main thread; stays -1U with Tier45, which copies instance_data to its ring)
+		uint32_t last_drawn = 0; //frame number of last draw (chunks drawn this frame aren't evicted)
+		uint32_t last_wanted = 0; //frame number of last request_chunks() that wanted it (nor are chunks wanted this frame)
+		std::list< uint64_t >::iterator lru; //position in 'lru'
+	};
+	//fills chunk->instance_data and chunk->batches from chunk->layout (pure; safe to call from any thread):
+	static void build_instances(BoardMeshes const &meshes, Chunk *chunk);
+
+	static uint64_t chunk_key(glm::ivec2 coord);
+	static glm::ivec2 chunk_of(glm::ivec2 tile);
+
+	//chunks that have been built and uploaded:
+	std::unordered_map< uint64_t, std::unique_ptr< Chunk > > chunks;
+	std::list< uint64_t > lru; //most recently used at the front
+	//(enough for the most zoomed-out view of a 16:9 window, plus look-ahead; wider windows keep every visible chunk and
+	// get less look-ahead -- see request_chunks):
+	static constexpr uint32_t MaxChunks = 512;
+
+	//every chunk instance buffer has room for the largest possible chunk, so buffers can be recycled freely:
+	static constexpr uint32_t MaxInstancesPerChunk = 2 * ChunkSize * ChunkSize;
+	std::vector< GLuint > free_vbos;
+
+	uint32_t frame = 0;
+
+	//tiles smaller than this (in pixels) are drawn with low-detail meshes:
+	static constexpr float LowDetailPixels = 8.0f;
+
+	//drawing stats from the last frame:
+	uint32_t chunks_drawn = 0;
+	uint32_t chunks_culled = 0; //resident chunks near the view that were outside the frustum
+	bool drew_low_detail = false;
+	glm::uvec2 last_drawable_size = glm::uvec2(16, 9); //(used to decide which chunks are visible in update)
+
+	//checkpoints collected anywhere in the world (by tile), so evicted chunks come back correctly:
+	std::unordered_set< uint64_t > collected;
+
+	Chunk *find_chunk(glm::ivec2 coord); //resident chunk, or nullptr
+	void receive_chunks(); //upload chunks the workers have finished
+	void request_chunks(); //queue chunks that will soon be needed, nearest-to-need first
+	void upload(Chunk *chunk);
+	void evict_chunks();
+
+	//------- worker threads -------
+
+	std::mutex mutex;
+	std::condition_variable cv;
+	std::deque< glm::ivec2 > jobs; //chunks waiting to be built (in priority order)
+	std::vector< std::unique_ptr< Chunk > > finished; //chunks built, waiting to be uploaded
+	bool quit = false;
+	std::vector< std::thread > workers;
+
+	std::unordered_set< uint64_t > requested; //chunks queued or being built (main thread only)
+
+	void work(); //worker thread main function
+
+	//------- opengl resources -------
+
+	StreamBuffer player_stream{ "marathon player", 256 }; //single instance for the player, streamed every frame (Tier33)
+};
@@ -0,0 +1,333 @@
+#include "MeshBlob.hpp"
+
+#include <algorithm>
+#include <cassert>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <limits>
+#include <stdexcept>
+
+constexpr GLenum MeshBlob::IndexType;
+
+MeshBlob::MeshBlob(std::string const &filename) : file(filename) {
+	//An optimized blob (see optimize_meshes.cpp) has (at least) four chunks, which can be in any order:
+	// "vtx1" is vertex data (Vertex, welded so triangles share them)
+	// "ind1" is index data (Index, counting from each mesh's first vertex)
+	// "str0" is characters
+	// "idx1" is an index, mapping a name (range of characters) to a mesh (ranges of index and vertex data) and its bounds
+	//A triangle soup blob (see export-meshes.py) has "dat0" vertex data (three per triangle, with float normals)
+	// instead of "vtx1" + "ind1", and "idx0", an index mapping a name to a range of vertex data, instead of "idx1".
+	//Either may also have an "ids0" table (see MeshBlob.hpp).
+
+	//character data (for names):
+	size_t names_size = 0;
+	char const *names = file.get< char >("str0", &names_size);
+	auto name_of = [&](uint32_t begin, uint32_t end) {
+		if (begin > end || end > names_size) {
+			throw std::runtime_error("invalid name indices in index.");
+		}
+		return std::string(names + begin, names + end);
+	};
+	auto add_entry = [&](std::string const &name, Mesh const &mesh, glm::vec3 const &min, glm::vec3 const &max) {
+		entries.emplace_back();
+		entries.back().id = mesh_id(name.data(), name.data() + name.size());
+		entries.back().name = name;
+		entries.back().mesh = mesh;
+		entries.back().min = min;
+		entries.back().max = max;
+		entries.back().low_detail = (name.size() >= 4 && name.compare(name.size() - 4, 4, ".lod") == 0);
+	};
+
+	if (file.find("idx1")) {
+		//vertex and index data, used in place (unless it's compressed, in which case it's left for the user to stream out):
+		auto counted = [&](char const *type, size_t size, char const *what) {
+			BlobFile::Chunk const *chunk = file.find(type);
+			if (!chunk) throw std::runtime_error("Blob '" + filename + "' has no '" + type + "' chunk.");
+			if (chunk->raw_size % size != 0) throw std::runtime_error("Size of chunk '" + std::string(type) + "' not divisible by element size.");
+			if (chunk->raw_size / size > std::numeric_limits< uint32_t >::max()) throw std::runtime_error(std::string("too many ") + what + " in meshes file.");
+			return uint32_t(chunk->raw_size / size);
+		};
+		vertex_count = counted("vtx1", sizeof(Vertex), "vertices");
+		index_count = counted("ind1", sizeof(Index), "indices");
+		//both are about to be read in full (checksummed, then uploaded), so start reading them in
+		// (only these -- metadata chunks are tiny, and chunks nobody uses are never read):
+		file.prefetch(*file.find("vtx1"));
+		file.prefetch(*file.find("ind1"));
+		size_t count = 0;
+		if (!file.find("vtx1")->compressed) vertices = file.get< Vertex >("vtx1", &count);
+		if (!file.find("ind1")->compressed) indices = file.get< Index >("ind1", &count);
+
+		//list meshes from the index:
+		// (the indices themselves aren't checked against the vertex ranges: optimize_meshes wrote them, and the checksum says they're as it wrote them)
+		size_t entry_count = 0;
+		OptimizedEntry const *index = file.get< OptimizedEntry >("idx1", &entry_count);
+		for (OptimizedEntry const *e = index; e != index + entry_count; ++e) {
+			if (e->index_begin > e->index_end || e->index_end > index_count || (e->index_end - e->index_begin) % 3 != 0) {
+				throw std::runtime_error("invalid index indices in index.");
+			}
+			if (e->vertex_begin > e->vertex_end || e->vertex_end > vertex_count || e->vertex_end - e->vertex_begin > 65536) {
+				throw std::runtime_error("invalid vertex indices in index.");
+			}
+			Mesh mesh;
+			mesh.first = GLint(e->index_begin);
+			mesh.count = GLsizei(e->index_end - e->index_begin);
+			mesh.base_vertex = GLint(e->vertex_begin);
+			add_entry(name_of(e->name_begin, e->name_end), mesh, e->min, e->max);
+		}
+	} else {
+		//triangle soup vertex data:
+		struct SoupVertex {
+			glm::vec3 Position;
+			glm::vec3 Normal;
+			glm::u8vec4 Color;
+		};
+		static_assert(sizeof(SoupVertex) == 28, "SoupVertex should be packed.");
+		size_t count = 0;
+		SoupVertex const *soup = file.get< SoupVertex >("dat0", &count);
+		if (count > std::numeric_limits< uint32_t >::max()) {
+			throw std::runtime_error("too many vertices in meshes file.");
+		}
+
+		//index:
+		struct IndexEntry {
+			uint32_t name_begin;
+			uint32_t name_end;
+			uint32_t vertex_begin;
+			uint32_t vertex_end;
+		};
+		static_assert(sizeof(IndexEntry) == 16, "IndexEntry should be packed.");
+
+		//(in old sequential blobs the index follows the names, so it usually isn't aligned; its entries are copied out one at a time)
+		size_t index_size = 0;
+		char const *index_data = file.get< char >("idx0", &index_size);
+		if (index_size % sizeof(IndexEntry) != 0) {
+			throw std::runtime_error("Size of chunk not divisible by element size");
+		}
+
+		//convert the vertices, and give each mesh indices that just count through its vertices:
+		converted = true;
+		converted_vertices.reserve(count);
+		for (SoupVertex const *v = soup; v != soup + count; ++v) {
+			converted_vertices.emplace_back();
+			converted_vertices.back().Position = v->Position;
+			converted_vertices.back().Normal = pack_normal(v->Normal);
+			converted_vertices.back().Color = v->Color;
+		}
+		for (char const *at = index_data; at != index_data + index_size; at += sizeof(IndexEntry)) {
+			IndexEntry e;
+			std::memcpy(&e, at, sizeof(e));
+			std::string name = name_of(e.name_begin, e.name_end);
+			if (e.vertex_begin > e.vertex_end || e.vertex_end > count) {
+				throw std::runtime_error("invalid vertex indices in index.");
+			}
+			if (e.vertex_end - e.vertex_begin > 65536) {
+				throw std::runtime_error("mesh '" + name + "' has too many vertices for 16-bit indices (optimize_meshes would weld them).");
+			}
+			Mesh mesh;
+			mesh.first = GLint(converted_indices.size());
+			mesh.count = GLsizei(e.vertex_end - e.vertex_begin);
+			mesh.base_vertex = GLint(e.vertex_begin);
+			glm::vec3 min = glm::vec3(std::numeric_limits< float >::infinity());
+			glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+			for (uint32_t i = 0; i < uint32_t(mesh.count); ++i) {
+				converted_indices.emplace_back(Index(i));
+				min = glm::min(min, soup[e.vertex_begin + i].Position);
+				max = glm::max(max, soup[e.vertex_begin + i].Position);
+			}
+			if (mesh.count == 0) min = max = glm::vec3(0.0f);
+			add_entry(name, mesh, min, max);
+		}
+		vertices = converted_vertices.data();
+		vertex_count = uint32_t(converted_vertices.size());
+		indices = converted_indices.data();
+		index_count = uint32_t(converted_indices.size());
+
+		std::cerr << "NOTE: '" << filename << "' is triangle soup, so it was converted as it loaded; run it through optimize_meshes (see README.md) to weld, reorder, and convert it ahead of time." << std::endl;
+	}
+
+	if (file.find("ids0")) {
+		//use the blob's table, after checking it has every mesh in the index (and nothing else) in the right slot:
+		size_t words = 0;
+		uint32_t const *ids = file.get< uint32_t >("ids0", &words);
+		if (words < 2 || ids[0] < 1 || ids[0] > 24 || words != 2 + (size_t(4) << ids[0])) {
+			throw std::runtime_error("invalid mesh id table.");
+		}
+		table_bits = ids[0];
+		table_multiplier = ids[1];
+		table.assign(size_t(1) << table_bits, Slot());
+		size_t used = 0;
+		for (size_t i = 0; i < table.size(); ++i) {
+			table[i].id = ids[2 + 4 * i];
+			used += (ids[2 + 4 * i + 1] ? 1 : 0);
+		}
+		bool matches = (used == entries.size());
+		for (uint32_t e = 0; e < entries.size() && matches; ++e) {
+			uint32_t i = uint32_t(entries[e].id * table_multiplier) >> (32 - table_bits);
+			if (!ids[2 + 4 * i + 1] || table[i].id != entries[e].id || table[i].entry != -1U) matches = false;
+			table[i].entry = e;
+		}
+		if (!matches) {
+			throw std::runtime_error("mesh id table doesn't match the index (duplicate names, or a stale table).");
+		}
+	} else {
+		build_table();
+	}
+}
+
+MeshBlob::Entry const *MeshBlob::find(uint32_t id) const {
+	if (table.empty()) return nullptr;
+	Slot const &slot = table[uint32_t(id * table_multiplier) >> (32 - table_bits)];
+	if (slot.entry == -1U || slot.id != id) return nullptr;
+	return &entries[slot.entry];
+}
+
+void MeshBlob::decompress() {
+	if (!vertices) {
+		converted_vertices.resize(vertex_count);
+		BlobFile::Reader reader(file, "vtx1");
+		reader.read(converted_vertices.data(), converted_vertices.size() * sizeof(Vertex));
+		vertices = converted_vertices.data();
+	}
+	if (!indices) {
+		converted_indices.resize(index_count);
+		BlobFile::Reader reader(file, "ind1");
+		reader.read(converted_indices.data(), converted_indices.size() * sizeof(Index));
+		indices = converted_indices.data();
+	}
+}
+
+MeshBlob::Vertex const &MeshBlob::vertex(Mesh const &mesh, uint32_t index) const {
+	assert(vertices && indices); //(call decompress() first if the blob is compressed)
+	uint32_t at = uint32_t(mesh.first) + index;
+	uint32_t v = uint32_t(mesh.base_vertex) + (at < index_count ? indices[at] : added_indices[at - index_count]);
+	return (v < vertex_count ? vertices[v] : added_vertices[v - vertex_count]);
+}
+
+uint32_t MeshBlob::pack_normal(glm::vec3 const &normal) {
+	auto pack = [](float f) {
+		return uint32_t(int32_t(std::round(std::max(-1.0f, std::min(1.0f, f)) * 511.0f))) & 0x3ffU;
+	};
+	return pack(normal.x) | (pack(normal.y) << 10) | (pack(normal.z) << 20);
+}
+
+glm::vec3 MeshBlob::unpack_normal(uint32_t normal) {
+	auto unpack = [](uint32_t bits) {
+		//(sign-extend the low ten bits)
+		return std::max(-1.0f, float(int32_t(bits << 22) >> 22) / 511.0f);
+	};
+	return glm::vec3(unpack(normal), unpack(normal >> 10), unpack(normal >> 20));
+}
+
+void MeshBlob::build_table() {
+	//ids must be unique for any table to work:
+	std::vector< uint32_t > ids;
+	for (Entry const &entry : entries) {
+		ids.emplace_back(entry.id);
+	}
+	std::sort(ids.begin(), ids.end());
+	if (std::adjacent_find(ids.begin(), ids.end()) != ids.end()) {
+		throw std::runtime_error("duplicate name in index (or two names with the same id).");
+	}
+
+	//at least twice as many slots as meshes; try a bunch of (odd) multipliers, then more slots:
+	table_bits = 1;
+	while ((size_t(1) << table_bits) < 2 * entries.size()) ++table_bits;
+	for (; table_bits <= 24; ++table_bits) {
+		table.assign(size_t(1) << table_bits, Slot());
+		for (uint32_t attempt = 0; attempt < 1000; ++attempt) {
+			table_multiplier = 0x9e3779b1U + 2U * attempt;
+			bool collided = false;
+			for (uint32_t e = 0; e < entries.size(); ++e) {
+				Slot &slot = table[uint32_t(entries[e].id * table_multiplier) >> (32 - table_bits)];
+				if (slot.entry != -1U) {
+					collided = true;
+					break;
+				}
+				slot.id = entries[e].id;
+				slot.entry = e;
+			}
+			if (!collided) return;
+			table.assign(table.size(), Slot());
+		}
+	}
+	throw std::runtime_error("couldn't build a mesh id table.");
+}
+
+void MeshBlob::add_low_detail_meshes() {
+	size_t count = entries.size();
+	for (size_t e = 0; e < count; ++e) {
+		if (entries[e].low_detail) continue;
+		uint32_t lod_id = mesh_id(".lod", entries[e].id); //(== mesh_id("<name>.lod"))
+		if (find(lod_id)) continue;
+		Mesh const mesh = entries[e].mesh;
+		if (mesh.count < 3) continue;
+		decompress(); //(does nothing unless the blob's vertices or indices are compressed)
+
+		//bounds + area-weighted average colors of top- and front-facing triangles:
+		glm::vec3 min = glm::vec3(std::numeric_limits< float >::infinity());
+		glm::vec3 max = glm::vec3(-std::numeric_limits< float >::infinity());
+		glm::vec4 top_color = glm::vec4(0.0f), front_color = glm::vec4(0.0f);
+		float top_area = 0.0f, front_area = 0.0f;
+		for (GLsizei i = 0; i + 2 < mesh.count; i += 3) {
+			Vertex const *tri[3] = { &vertex(mesh, i), &vertex(mesh, i+1), &vertex(mesh, i+2) };
+			glm::vec3 cross = glm::cross(tri[1]->Position - tri[0]->Position, tri[2]->Position - tri[0]->Position);
+			float area = 0.5f * glm::length(cross);
+			glm::vec4 color = (glm::vec4(tri[0]->Color) + glm::vec4(tri[1]->Color) + glm::vec4(tri[2]->Color)) / 3.0f;
+			glm::vec3 normal = unpack_normal(tri[0]->Normal) + unpack_normal(tri[1]->Normal) + unpack_normal(tri[2]->Normal);
+			if (normal.z > 0.5f * glm::length(normal)) {
+				top_color += area * color;
+				top_area += area;
+			} else if (-normal.y > 0.5f * glm::length(normal)) {
+				front_color += area * color;
+				front_area += area;
+			}
+			for (uint32_t c = 0; c < 3; ++c) {
+				min = glm::min(min, tri[c]->Position);
+				max = glm::max(max, tri[c]->Position);
+			}
+		}
+
+		Mesh lod;
+		lod.first = GLint(index_count + added_indices.size());
+		lod.base_vertex = GLint(vertex_count + added_vertices.size());
+		glm::vec3 lod_min = glm::vec3(std::numeric_limits< float >::infinity());
+		glm::vec3 lod_max = glm::vec3(-std::numeric_limits< float >::infinity());
+
+		auto quad = [&](glm::vec3 const &a, glm::vec3 const &b, glm::vec3 const &c, glm::vec3 const &d, glm::vec3 const &normal, glm::vec4 const &color) {
+			//(corners in counter-clockwise order)
+			glm::u8vec4 c8 = glm::u8vec4(glm::clamp(color + 0.5f, glm::vec4(0.0f), glm::vec4(255.0f)));
+			Index base = Index(vertex_count + added_vertices.size() - lod.base_vertex);
+			for (glm::vec3 const &p : { a, b, c, d }) {
+				added_vertices.emplace_back();
+				added_vertices.back().Position = p;
+				added_vertices.back().Normal = pack_normal(normal);
+				added_vertices.back().Color = c8;
+				lod_min = glm::min(lod_min, p);
+				lod_max = glm::max(lod_max, p);
+			}
+			for (Index i : { 0, 1, 2, 0, 2, 3 }) {
+				added_indices.emplace_back(Index(base + i));
+			}
+		};
+		if (top_area > 0.0f) {
+			quad(glm::vec3(min.x, min.y, max.z), glm::vec3(max.x, min.y, max.z), glm::vec3(max.x, max.y, max.z), glm::vec3(min.x, max.y, max.z),
+				glm::vec3(0.0f, 0.0f, 1.0f), top_color / top_area);
+		}
+		if (front_area > 0.0f && max.z - min.z > 0.1f) {
+			quad(glm::vec3(min.x, min.y, min.z), glm::vec3(max.x, min.y, min.z), glm::vec3(max.x, min.y, max.z), glm::vec3(min.x, min.y, max.z),
+				glm::vec3(0.0f,-1.0f, 0.0f), front_color / front_area);
+		}
+
+		lod.count = GLsizei(index_count + added_indices.size()) - lod.first;
+		if (lod.count == 0) lod_min = lod_max = glm::vec3(0.0f);
+		entries.emplace_back();
+		entries.back().id = lod_id;
+		entries.back().name = entries[e].name + ".lod";
+		entries.back().mesh = lod;
+		entries.back().min = lod_min;
+		entries.back().max = lod_max;
+		entries.back().low_detail = true;
+	}
+	if (entries.size() != count) build_table();
+}
@@ -0,0 +1,119 @@
+#pragma once
+
+#include "GL.hpp"
+#include "BlobFile.hpp"
+#include "mesh_id.hpp"
+
+#include <glm/glm.hpp>
+
+#include <string>
+#include <vector>
+
+//The location of a mesh in the meshes index buffer (its indices count from base_vertex in the vertex buffer):
+struct Mesh {
+	GLint first = 0; //first index
+	GLsizei count = 0; //number of indices (three per triangle)
+	GLint base_vertex = 0;
+};
+
+//MeshBlob reads the vertex data, index data, and mesh index from a blob file
+// (it doesn't touch OpenGL, so it can also be used by the software renderer).
+//There are two kinds of blob:
+// - optimized ones, written by optimize_meshes: welded vertices ("vtx1") in the format below, 16-bit
+//   indices ("ind1"), and a mesh index with bounds ("idx1"); these are used straight from the mapping
+//   (so upload them, then let the MeshBlob go, which releases the mapping).
+//   Their vertex and index data may be compressed (see BlobFile), in which case 'vertices' and 'indices' are null:
+//   stream it straight to the GPU with a BlobFile::Reader, or decompress() it if it's needed on the CPU.
+// - triangle soup, written by export-meshes.py (or older): vertices with float normals ("dat0"), three
+//   per triangle, and a mesh index ("idx0"); these are converted (into 'converted_vertices' and
+//   'converted_indices') when loaded.
+struct MeshBlob {
+	//throws on error:
+	MeshBlob(std::string const &filename);
+	MeshBlob(MeshBlob const &) = delete;
+	MeshBlob &operator=(MeshBlob const &) = delete;
+
+	//interleaved vertex format used for drawing (and stored in optimized blobs):
+	struct Vertex {
+		glm::vec3 Position;
+		uint32_t Normal; //packed as GL_INT_2_10_10_10_REV (see pack_normal)
+		glm::u8vec4 Color;
+	};
+	static_assert(sizeof(Vertex) == 20, "Vertex should be packed.");
+
+	//normal <-> three signed, normalized 10-bit values (w is zero):
+	static uint32_t pack_normal(glm::vec3 const &normal);
+	static glm::vec3 unpack_normal(uint32_t normal);
+
+	//indices are relative to a mesh's base_vertex, so meshes can have up to 65536 vertices each:
+	typedef uint16_t Index;
+	static constexpr GLenum IndexType = GL_UNSIGNED_SHORT;
+
+	BlobFile file;
+
+	//the blob's vertices and indices (these point into 'file', or, for triangle soup or decompressed data,
+	// into the converted copies; they're null if the data is compressed):
+	Vertex const *vertices = nullptr;
+	uint32_t vertex_count = 0;
+	Index const *indices = nullptr;
+	uint32_t index_count = 0;
+	std::vector< Vertex > converted_vertices;
+	std::vector< Index > converted_indices;
+	bool converted = false; //(true if the blob was triangle soup)
+
+	//inflate compressed vertex and index data into 'converted_vertices' and 'converted_indices'
+	// (for reading meshes on the CPU; does nothing if they're already in memory):
+	void decompress();
+
+	//vertices and indices made by add_low_detail_meshes, numbered after the blob's:
+	std::vector< Vertex > added_vertices;
+	std::vector< Index > added_indices;
+
+	//every mesh, in index order, followed by any added ones:
+	struct Entry {
+		uint32_t id = 0; //mesh_id(name) (see mesh_id.hpp)
+		std::string name; //(for tools and error messages)
+		Mesh mesh;
+		glm::vec3 min = glm::vec3(0.0f), max = glm::vec3(0.0f); //bounds of its vertices
+		bool low_detail = false; //(named "<name>.lod", e.g., made by add_low_detail_meshes)
+	};
+	std::vector< Entry > entries;
+
+	//one mesh in an optimized blob's "idx1" chunk (names are ranges of "str0"):
+	struct OptimizedEntry {
+		uint32_t name_begin, name_end;
+		uint32_t index_begin, index_end;
+		uint32_t vertex_begin, vertex_end; //(vertex_begin is the mesh's base_vertex)
+		glm::vec3 min, max;
+	};
+	static_assert(sizeof(OptimizedEntry) == 48, "OptimizedEntry should be packed.");
+
+	//the mesh with a given id -- e.g., find(mesh_id("Wall")) -- or nullptr if there isn't one
+	// (one multiply and one compare; doesn't allocate):
+	Entry const *find(uint32_t id) const;
+
+	//vertex 'index' of a mesh (for reading meshes on the CPU, so the data can't be compressed):
+	Vertex const &vertex(Mesh const &mesh, uint32_t index) const;
+
+	//perfect hash table from id to entry: a mesh with id 'id' is in the slot (id * multiplier) >> (32 - bits)
+	// -- each slot holds at most one -- or isn't in the blob at all.
+	//The blob's "ids0" chunk (which export-meshes.py and optimize_meshes write after the index) is the same
+	// table, with each slot's mesh range: bits, multiplier, then 2^bits slots of (id, used, first, count).
+	struct Slot {
+		uint32_t id = 0;
+		uint32_t entry = -1U; //(-1U if the slot is empty)
+	};
+	uint32_t table_bits = 0;
+	uint32_t table_multiplier = 0;
+	std::vector< Slot > table;
+	//(re)build 'table' from 'entries', searching for a multiplier that gives every mesh its own slot
+	// (used when the blob is too old to have an "ids0" chunk, and after meshes are added);
+	// throws if two meshes have the same id:
+	void build_table();
+
+	//adds a flat, low-detail version of every mesh that doesn't have one (named "<name>.lod") to 'added_vertices' and 'added_indices':
+	// a quad over the mesh's footprint (at its top) colored like its upward-facing triangles,
+	// plus, for tall meshes, a quad for its front (-y) face colored like its front-facing triangles.
+	//Meant for drawing tiles that are only a few pixels across.
+	void add_low_detail_meshes();
+};
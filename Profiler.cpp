@@ -0,0 +1,534 @@
+#include "Profiler.hpp"
+
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+#include "compile_program.hpp" //helper to compile opengl shader programs
+
+#include <glm/gtc/type_ptr.hpp>
+
+#include <algorithm>
+#include <cassert>
+#include <cstddef>
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+constexpr uint32_t Profiler::History;
+constexpr uint32_t Profiler::QueryCount;
+
+Profiler *Profiler::active = nullptr;
+
+char const *Profiler::phase_name(Phase phase) {
+	switch (phase) {
+		case Wait: return "wait";
+		case Events: return "events";
+		case Update: return "update";
+		case Build: return "build";
+		case Submit: return "submit";
+		case Swap: return "swap";
+		default: return "?";
+	}
+}
+
+//bar colors for each phase in the overlay:
+static glm::u8vec4 const PhaseColors[Profiler::PhaseCount] = {
+	glm::u8vec4(0x44, 0x44, 0x44, 0x80), //wait
+	glm::u8vec4(0xee, 0xcc, 0x22, 0xff), //events
+	glm::u8vec4(0x33, 0xbb, 0x55, 0xff), //update
+	glm::u8vec4(0x33, 0x99, 0xee, 0xff), //build
+	glm::u8vec4(0xcc, 0x55, 0xdd, 0xff), //submit
+	glm::u8vec4(0x88, 0x88, 0x88, 0xc0), //swap
+};
+static glm::u8vec4 const GPUColor = glm::u8vec4(0xff, 0x44, 0x33, 0xff);
+static glm::u8vec4 const TextColor = glm::u8vec4(0xff, 0xff, 0xff, 0xff);
+
+float Profiler::Frame::cpu_ms() const {
+	return phase_ms[Events] + phase_ms[Update] + phase_ms[Build] + phase_ms[Submit];
+}
+
+float Profiler::Frame::total_ms() const {
+	float total = 0.0f;
+	for (float ms : phase_ms) {
+		total += ms;
+	}
+	return total;
+}
+
+Profiler::Profiler(std::string const &log_path) {
+	assert(!active && "only one profiler at a time");
+
+	if (log_path != "") {
+		log.open(log_path);
+		if (!log) {
+			throw std::runtime_error("Failed to open '" + log_path + "' for writing.");
+		}
+		log << "frame";
+		for (uint32_t p = 0; p < PhaseCount; ++p) {
+			log << ',' << phase_name(Phase(p)) << "_ms";
+		}
+		log << ",gpu_ms,state_changes,state_elided,stream_bytes,render_scale";
+		#ifdef GL_COUNTERS
+		log << ",gl_calls,draws,vertices,buffer_bytes,uniform_bytes";
+		#endif
+		log << "\n";
+	}
+
+	GLuint ids[QueryCount];
+	glGenQueries(QueryCount, ids);
+	for (uint32_t i = 0; i < QueryCount; ++i) {
+		queries[i].id = ids[i];
+	}
+
+	program = compile_program(
+		//vertex shader:
+		"#version 330\n"
+		"uniform vec4 pixels_to_clip;\n" //xy: scale, zw: offset
+		"in vec2 Position;\n"
+		"in vec4 Color;\n"
+		"out vec4 color;\n"
+		"void main() {\n"
+		"	gl_Position = vec4(Position * pixels_to_clip.xy + pixels_to_clip.zw, 0.0, 1.0);\n"
+		"	color = Color;\n"
+		"}\n"
+		,
+		//fragment shader:
+		"#version 330\n"
+		"in vec4 color;\n"
+		"out vec4 fragColor;\n"
+		"void main() {\n"
+		"	fragColor = color;\n"
+		"}\n"
+	);
+	pixels_to_clip_vec4 = glGetUniformLocation(program, "pixels_to_clip");
+	Position_vec2 = glGetAttribLocation(program, "Position");
+	Color_vec4 = glGetAttribLocation(program, "Color");
+
+	//(the attribute pointers are set in draw_overlay, once the stream has a buffer)
+	glGenVertexArrays(1, &vao);
+	gl_state_BindVertexArray(vao);
+	glEnableVertexAttribArray(Position_vec2);
+	glEnableVertexAttribArray(Color_vec4);
+	gl_state_BindVertexArray(0);
+
+	GL_ERRORS();
+
+	#ifdef GL_COUNTERS
+	//(start counting from here)
+	std::memset(&gl_counters, 0, sizeof(gl_counters));
+	last_calls.assign(GLCounterCount, 0);
+	total_calls.assign(GLCounterCount, 0);
+	#endif
+
+	state_changes_before = gl_state.stats.total_calls();
+	state_elided_before = gl_state.stats.total_elided();
+	stream_bytes_before = StreamBuffer::total_bytes;
+
+	phase_start = Clock::now();
+	active = this;
+}
+
+Profiler::~Profiler() {
+	if (active == this) active = nullptr;
+
+	//log whatever is left in the history (waiting a moment for outstanding GPU results):
+	if (log) {
+		glFinish();
+		collect_queries();
+		for (uint32_t i = (frames > History ? frames - History : 0); i < frames; ++i) {
+			log_frame(history[i % History]);
+		}
+	}
+
+	report(std::cout);
+
+	for (Query &query : queries) {
+		glDeleteQueries(1, &query.id);
+		query.id = 0;
+	}
+
+	gl_state_DeleteVertexArrays(1, &vao);
+	vao = -1U;
+
+	gl_state_DeleteProgram(program);
+	program = -1U;
+
+	GL_ERRORS();
+}
+
+void Profiler::enter(Phase phase_) {
+	Clock::time_point now = Clock::now();
+	current.phase_ms[phase] += std::chrono::duration< float, std::milli >(now - phase_start).count();
+	phase_start = now;
+	phase = phase_;
+	if (phase == Swap) drawn = true;
+}
+
+void Profiler::begin_frame() {
+	enter(Wait);
+
+	if (drawn) {
+		//frame leaving the history gets logged:
+		Frame &slot = history[frames % History];
+		if (log && frames >= History) {
+			log_frame(slot);
+		}
+		#ifdef GL_COUNTERS
+		take_gl_counters(&current);
+		#endif
+		current.state_changes = gl_state.stats.total_calls() - state_changes_before;
+		current.state_elided = gl_state.stats.total_elided() - state_elided_before;
+		state_changes_before = gl_state.stats.total_calls();
+		state_elided_before = gl_state.stats.total_elided();
+		current.stream_bytes = StreamBuffer::total_bytes - stream_bytes_before;
+		stream_bytes_before = StreamBuffer::total_bytes;
+		slot = current;
+		slot.index = frames;
+		slot.gpu_ms = -1.0f;
+		++frames;
+
+		current = Frame();
+		drawn = false;
+	}
+
+	collect_queries();
+}
+
+void Profiler::begin_gpu() {
+	Query &query = queries[next_query];
+	if (query.pending) {
+		//every query is still waiting on the GPU; rather than wait, don't time this frame:
+		++gpu_skipped;
+		return;
+	}
+	query.frame = frames;
+	query.pending = true;
+	next_query = (next_query + 1) % QueryCount;
+	glBeginQuery(GL_TIME_ELAPSED, query.id);
+	in_query = true;
+}
+
+void Profiler::end_gpu() {
+	if (!in_query) return;
+	glEndQuery(GL_TIME_ELAPSED);
+	in_query = false;
+}
+
+void Profiler::collect_queries() {
+	//results become available in the order queries were issued, so check from the oldest:
+	for (uint32_t i = 0; i < QueryCount; ++i) {
+		Query &query = queries[(next_query + i) % QueryCount];
+		if (!query.pending) continue;
+
+		GLuint available = GL_FALSE;
+		glGetQueryObjectuiv(query.id, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) break;
+
+		GLuint64 ns = 0;
+		glGetQueryObjectui64v(query.id, GL_QUERY_RESULT, &ns);
+		query.pending = false;
+
+		//(results for frames that have already left the history are dropped, as are absurd ones -- llvmpipe's first query can report thousands of seconds)
+		if (ns > GLuint64(10) * 1000000000) continue;
+		if (query.frame < frames && frames - query.frame <= History) {
+			history[query.frame % History].gpu_ms = float(ns) / 1.0e6f;
+		}
+	}
+}
+
+#ifdef GL_COUNTERS
+void Profiler::take_gl_counters(Frame *frame_) {
+	assert(frame_);
+	auto &frame = *frame_;
+	frame.gl_calls = 0;
+	for (uint32_t i = 0; i < GLCounterCount; ++i) {
+		frame.gl_calls += gl_counters.calls[i];
+		last_calls[i] = gl_counters.calls[i];
+		total_calls[i] += gl_counters.calls[i];
+	}
+	frame.draws = gl_counters.draws;
+	frame.vertices = gl_counters.vertices;
+	frame.buffer_bytes = gl_counters.buffer_bytes;
+	frame.uniform_bytes = gl_counters.uniform_bytes;
+	std::memset(&gl_counters, 0, sizeof(gl_counters));
+}
+
+std::vector< std::string > Profiler::top_calls(std::vector< uint64_t > const &calls, uint32_t count) {
+	std::vector< uint32_t > order;
+	for (uint32_t i = 0; i < calls.size(); ++i) {
+		if (calls[i]) order.emplace_back(i);
+	}
+	count = std::min(count, uint32_t(order.size()));
+	std::partial_sort(order.begin(), order.begin() + count, order.end(), [&calls](uint32_t a, uint32_t b) {
+		return calls[a] > calls[b];
+	});
+	std::vector< std::string > top;
+	for (uint32_t i = 0; i < count; ++i) {
+		top.emplace_back(std::string(GLCounterNames[order[i]]) + " " + std::to_string(calls[order[i]]));
+	}
+	return top;
+}
+#endif
+
+void Profiler::log_frame(Frame const &frame) {
+	log << frame.index;
+	for (float ms : frame.phase_ms) {
+		log << ',' << ms;
+	}
+	log << ',';
+	if (frame.gpu_ms >= 0.0f) log << frame.gpu_ms;
+	log << ',' << frame.state_changes << ',' << frame.state_elided << ',' << frame.stream_bytes << ',';
+	if (frame.render_scale >= 0.0f) log << frame.render_scale;
+	#ifdef GL_COUNTERS
+	log << ',' << frame.gl_calls << ',' << frame.draws << ',' << frame.vertices << ',' << frame.buffer_bytes << ',' << frame.uniform_bytes;
+	#endif
+	log << '\n';
+}
+
+template< typename F >
+float Profiler::percentile(float p, F const &get) const {
+	std::vector< float > &values = percentile_values;
+	values.clear();
+	for (uint32_t i = (frames > History ? frames - History : 0); i < frames; ++i) {
+		float value = get(history[i % History]);
+		if (value >= 0.0f) values.emplace_back(value);
+	}
+	if (values.empty()) return -1.0f;
+	size_t n = std::min(values.size() - 1, size_t(p / 100.0f * values.size()));
+	std::nth_element(values.begin(), values.begin() + n, values.end());
+	return values[n];
+}
+
+void Profiler::report(std::ostream &out) const {
+	auto cpu = [](Frame const &f) { return f.cpu_ms(); };
+	auto gpu = [](Frame const &f) { return f.gpu_ms; };
+	auto total = [](Frame const &f) { return f.total_ms(); };
+	out << "Profiler: " << frames << " frames (" << gpu_skipped << " not timed on the GPU); last " << std::min(frames, History) << " frames, p50/p95 ms:\n";
+	out << "  cpu " << percentile(50.0f, cpu) << " / " << percentile(95.0f, cpu) << '\n';
+	out << "  gpu " << percentile(50.0f, gpu) << " / " << percentile(95.0f, gpu) << '\n';
+	out << "  frame " << percentile(50.0f, total) << " / " << percentile(95.0f, total) << '\n';
+	for (uint32_t p = 0; p < PhaseCount; ++p) {
+		auto phase = [p](Frame const &f) { return f.phase_ms[p]; };
+		out << "    " << phase_name(Phase(p)) << ' ' << percentile(50.0f, phase) << " / " << percentile(95.0f, phase) << '\n';
+	}
+	auto state_changes = [](Frame const &f) { return float(f.state_changes); };
+	auto state_elided = [](Frame const &f) { return float(f.state_elided); };
+	out << "  state changes per frame p50 " << percentile(50.0f, state_changes) << ", skipped p50 " << percentile(50.0f, state_elided) << '\n';
+	auto stream_bytes = [](Frame const &f) { return float(f.stream_bytes); };
+	out << "  streamed bytes per frame p50 " << percentile(50.0f, stream_bytes) << ", p95 " << percentile(95.0f, stream_bytes) << '\n';
+	auto render_scale = [](Frame const &f) { return f.render_scale; };
+	if (percentile(50.0f, render_scale) >= 0.0f) {
+		out << "  render scale p50 " << percentile(50.0f, render_scale) << ", p5 " << percentile(5.0f, render_scale) << '\n';
+	}
+	#ifdef GL_COUNTERS
+	auto calls = [](Frame const &f) { return float(f.gl_calls); };
+	auto draws = [](Frame const &f) { return float(f.draws); };
+	out << "  gl calls per frame p50 " << percentile(50.0f, calls) << ", draws p50 " << percentile(50.0f, draws) << "; most called over every frame:\n";
+	for (std::string const &top : top_calls(total_calls, 10)) {
+		out << "    " << top << '\n';
+	}
+	#endif
+	out.flush();
+}
+
+//------- overlay -------
+
+void Profiler::rect(glm::vec2 const &min, glm::vec2 const &max, glm::u8vec4 const &color) {
+	overlay.emplace_back(glm::vec2(min.x, min.y), color);
+	overlay.emplace_back(glm::vec2(max.x, min.y), color);
+	overlay.emplace_back(glm::vec2(max.x, max.y), color);
+	overlay.emplace_back(glm::vec2(min.x, min.y), color);
+	overlay.emplace_back(glm::vec2(max.x, max.y), color);
+	overlay.emplace_back(glm::vec2(min.x, max.y), color);
+}
+
+//rows of a 3x5 glyph, top to bottom ('1' = lit):
+static char const *glyph(char c) {
+	switch (c) {
+		case '0': return "111" "101" "101" "101" "111";
+		case '1': return "010" "110" "010" "010" "111";
+		case '2': return "111" "001" "111" "100" "111";
+		case '3': return "111" "001" "111" "001" "111";
+		case '4': return "101" "101" "111" "001" "001";
+		case '5': return "111" "100" "111" "001" "111";
+		case '6': return "111" "100" "111" "101" "111";
+		case '7': return "111" "001" "001" "010" "010";
+		case '8': return "111" "101" "111" "101" "111";
+		case '9': return "111" "101" "111" "001" "111";
+		case 'A': return "010" "101" "111" "101" "101";
+		case 'B': return "110" "101" "110" "101" "110";
+		case 'C': return "011" "100" "100" "100" "011";
+		case 'D': return "110" "101" "101" "101" "110";
+		case 'E': return "111" "100" "110" "100" "111";
+		case 'F': return "111" "100" "110" "100" "100";
+		case 'G': return "011" "100" "101" "101" "011";
+		case 'H': return "101" "101" "111" "101" "101";
+		case 'I': return "111" "010" "010" "010" "111";
+		case 'J': return "001" "001" "001" "101" "010";
+		case 'K': return "101" "101" "110" "101" "101";
+		case 'L': return "100" "100" "100" "100" "111";
+		case 'M': return "101" "111" "111" "101" "101";
+		case 'N': return "110" "101" "101" "101" "101";
+		case 'O': return "010" "101" "101" "101" "010";
+		case 'P': return "110" "101" "110" "100" "100";
+		case 'Q': return "010" "101" "101" "110" "011";
+		case 'R': return "110" "101" "110" "101" "101";
+		case 'S': return "011" "100" "010" "001" "110";
+		case 'T': return "111" "010" "010" "010" "010";
+		case 'U': return "101" "101" "101" "101" "111";
+		case 'V': return "101" "101" "101" "101" "010";
+		case 'W': return "101" "101" "111" "111" "101";
+		case 'X': return "101" "101" "010" "101" "101";
+		case 'Y': return "101" "101" "010" "010" "010";
+		case 'Z': return "111" "001" "010" "100" "111";
+		case '.': return "000" "000" "000" "000" "010";
+		case ':': return "000" "010" "000" "010" "000";
+		case '/': return "001" "001" "010" "100" "100";
+		case '-': return "000" "000" "111" "000" "000";
+		case '%': return "101" "001" "010" "100" "101";
+		default: return "000" "000" "000" "000" "000";
+	}
+}
+
+float Profiler::text(glm::vec2 const &at, std::string const &str, glm::u8vec4 const &color, float scale) {
+	glm::vec2 pen = at;
+	for (char c : str) {
+		if (c >= 'a' && c <= 'z') c = c - 'a' + 'A';
+		char const *rows = glyph(c);
+		for (uint32_t y = 0; y < 5; ++y) {
+			for (uint32_t x = 0; x < 3; ++x) {
+				if (rows[y * 3 + x] != '1') continue;
+				glm::vec2 px = pen + scale * glm::vec2(float(x), float(4 - y));
+				rect(px, px + glm::vec2(scale), color);
+			}
+		}
+		pen.x += 4.0f * scale;
+	}
+	return pen.x;
+}
+
+void Profiler::draw_overlay(glm::uvec2 drawable_size) {
+	if (!show_overlay) return;
+
+	overlay.clear();
+
+	float const Margin = 10.0f;
+	float const BarWidth = 2.0f;
+	float const GraphHeight = 120.0f;
+	float const LineHeight = 14.0f;
+	uint32_t const bars = std::min(History, uint32_t(std::max(0.0f, (drawable_size.x - 2.0f * Margin) / BarWidth)));
+	#ifdef GL_COUNTERS
+	float const TextLines = 7.0f;
+	#else
+	float const TextLines = 5.0f;
+	#endif
+
+	//graph: stacked per-phase bars for recent frames (oldest on the left), scaled so the top is two frame budgets:
+	glm::vec2 origin = glm::vec2(Margin, Margin);
+	float ms_to_pixels = GraphHeight / (2.0f * budget_ms);
+	rect(origin - glm::vec2(4.0f), origin + glm::vec2(bars * BarWidth, GraphHeight + 6.0f + TextLines * LineHeight), glm::u8vec4(0x00, 0x00, 0x00, 0xa0)); //(behind graph + text)
+	uint32_t first = (frames > bars ? frames - bars : 0);
+	for (uint32_t i = first; i < frames; ++i) {
+		Frame const &frame = history[i % History];
+		float x = origin.x + (i - first) * BarWidth;
+		float y = origin.y;
+		for (uint32_t p = Events; p <= Swap; ++p) { //(wait isn't stacked: idle frames would swamp the graph)
+			float h = std::min(frame.phase_ms[p] * ms_to_pixels, origin.y + GraphHeight - y);
+			if (h <= 0.0f) continue;
+			rect(glm::vec2(x, y), glm::vec2(x + BarWidth, y + h), PhaseColors[p]);
+			y += h;
+		}
+		if (frame.gpu_ms >= 0.0f) {
+			float gy = origin.y + std::min(frame.gpu_ms * ms_to_pixels, GraphHeight);
+			rect(glm::vec2(x, gy - 1.0f), glm::vec2(x + BarWidth, gy + 1.0f), GPUColor);
+		}
+	}
+	//budget line:
+	rect(glm::vec2(origin.x, origin.y + budget_ms * ms_to_pixels), glm::vec2(origin.x + bars * BarWidth, origin.y + budget_ms * ms_to_pixels + 1.0f), glm::u8vec4(0xff, 0xff, 0xff, 0x60));
+
+	//text, above the graph:
+	auto fmt = [](float ms) {
+		if (ms < 0.0f) return std::string("-");
+		char buf[16];
+		snprintf(buf, sizeof(buf), "%.2f", ms);
+		return std::string(buf);
+	};
+	auto cpu = [](Frame const &f) { return f.cpu_ms(); };
+	auto gpu = [](Frame const &f) { return f.gpu_ms; };
+	auto total = [](Frame const &f) { return f.total_ms(); };
+	auto swap = [](Frame const &f) { return f.phase_ms[Swap]; };
+	float cpu_50 = percentile(50.0f, cpu), gpu_50 = percentile(50.0f, gpu), total_50 = percentile(50.0f, total);
+
+	//what is limiting the frame rate? (a rough guess from the medians)
+	std::string bound = "-";
+	if (total_50 >= 0.0f) {
+		if (gpu_50 > cpu_50 && gpu_50 > 0.75f * total_50) bound = "GPU";
+		else if (cpu_50 >= gpu_50 && cpu_50 > 0.75f * total_50) bound = "CPU";
+		else if (percentile(50.0f, swap) > 0.25f * total_50) bound = "VSYNC";
+		else bound = "IDLE";
+	}
+
+	glm::vec2 line = origin + glm::vec2(0.0f, GraphHeight + 6.0f);
+	float x = text(line, "LEGEND ", TextColor);
+	for (uint32_t p = Events; p <= Swap; ++p) {
+		x = text(glm::vec2(x, line.y), std::string(phase_name(Phase(p))) + " ", PhaseColors[p]);
+	}
+	text(glm::vec2(x, line.y), "GPU", GPUColor);
+	line.y += LineHeight;
+	text(line, "GPU   P50 " + fmt(gpu_50) + " P95 " + fmt(percentile(95.0f, gpu)) + " MS", GPUColor);
+	line.y += LineHeight;
+	text(line, "CPU   P50 " + fmt(cpu_50) + " P95 " + fmt(percentile(95.0f, cpu)) + " MS", TextColor);
+	line.y += LineHeight;
+	text(line, "FRAME P50 " + fmt(total_50) + " P95 " + fmt(percentile(95.0f, total)) + " MS  BOUND: " + bound, TextColor);
+	if (frames > 0) {
+		Frame const &last = history[(frames - 1) % History];
+		line.y += LineHeight;
+		text(line, "STATE CHANGES " + std::to_string(last.state_changes) + " SKIPPED " + std::to_string(last.state_elided), TextColor);
+		if (last.render_scale >= 0.0f) {
+			line.y += LineHeight;
+			text(line, "RENDER SCALE " + fmt(last.render_scale) + "  P50 " + fmt(percentile(50.0f, [](Frame const &f) { return f.render_scale; })), TextColor);
+		}
+	}
+	//streams, with the most any frame has used (to size them by):
+	auto kb = [](GLsizeiptr bytes) { return std::to_string((bytes + 1023) / 1024) + "KB"; };
+	for (StreamBuffer const *stream : StreamBuffer::live) {
+		if (stream->frames == 0) continue;
+		line.y += LineHeight;
+		text(line, "STREAM " + stream->name + " " + kb(stream->last_frame_bytes) + " HIGH " + kb(stream->high_water) + " OF " + kb(stream->frame_size), TextColor);
+	}
+	#ifdef GL_COUNTERS
+	if (frames > 0) {
+		Frame const &last = history[(frames - 1) % History];
+		line.y += LineHeight;
+		text(line, "GL CALLS " + std::to_string(last.gl_calls) + " DRAWS " + std::to_string(last.draws) + " VERTS " + std::to_string(last.vertices)
+			+ " BUF " + std::to_string(last.buffer_bytes / 1024) + "KB UNI " + std::to_string(last.uniform_bytes / 1024) + "KB", TextColor);
+		std::string top = "TOP";
+		for (std::string const &call : top_calls(last_calls, 3)) {
+			top += "  " + call;
+		}
+		line.y += LineHeight;
+		text(line, top, TextColor);
+	}
+	#endif
+
+	//upload (aligned to whole vertices, so the draw can start at the allocation) + draw:
+	overlay_stream.begin_frame();
+	StreamBuffer::Allocation vertices = overlay_stream.write(overlay.data(), overlay.size() * sizeof(Vertex), sizeof(Vertex));
+
+	gl_state_BindVertexArray(vao);
+	if (vertices.buffer != vao_buffer) {
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, vertices.buffer);
+		glVertexAttribPointer(Position_vec2, 2, GL_FLOAT, GL_FALSE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Position));
+		glVertexAttribPointer(Color_vec4, 4, GL_UNSIGNED_BYTE, GL_TRUE, sizeof(Vertex), (GLbyte *)0 + offsetof(Vertex, Color));
+		vao_buffer = vertices.buffer;
+	}
+
+	gl_state_Disable(GL_DEPTH_TEST);
+	gl_state_UseProgram(program);
+	gl_state_Uniform4f(pixels_to_clip_vec4, 2.0f / drawable_size.x, 2.0f / drawable_size.y, -1.0f, -1.0f);
+	glDrawArrays(GL_TRIANGLES, GLint(vertices.offset / sizeof(Vertex)), GLsizei(overlay.size()));
+	gl_state_Enable(GL_DEPTH_TEST);
+	overlay_stream.end_frame();
+
+	GL_ERRORS();
+}
@@ -0,0 +1,153 @@
+#pragma once
+
+#include "GL.hpp"
+#include "StreamBuffer.hpp"
+
+#include <glm/glm.hpp>
+
+#include <chrono>
+#include <fstream>
+#include <string>
+#include <vector>
+
+//Profiler times each frame in CPU phases (the main loop and draw code call Profiler::mark
+// when they move from one phase to the next) and times the GPU's share of each frame with
+// GL_TIME_ELAPSED queries. Queries are kept in a ring and only read once their results are
+// available, so profiling never stalls the pipeline.
+//It keeps the last History frames for an on-screen overlay (stacked per-phase bars, GPU time,
+// percentiles, and a guess at what is limiting the frame rate), and can log every frame to a .csv file.
+//It also shows how many state changes the gl_state cache skipped each frame, and how much each
+// StreamBuffer used (with its high-water mark, for sizing it), and the render scale (see RenderScale).
+//When built with GL_COUNTERS, it also reports GL calls, uploads, and draws per frame (see gl_counters.hpp).
+struct Profiler {
+	enum Phase : uint32_t {
+		Wait, //waiting for events (idle) or for a just-in-time frame start
+		Events, //handling events
+		Update, //advancing the game
+		Build, //preparing data to draw (instance lists, buffer contents)
+		Submit, //issuing GL commands
+		Swap, //in SDL_GL_SwapWindow (waiting on vsync, or on the GPU catching up)
+		PhaseCount
+	};
+	static char const *phase_name(Phase phase);
+
+	//creates GL objects, so must be called with the context current; if 'log_path' is non-empty,
+	// frames are logged there (throws if it can't be opened):
+	Profiler(std::string const &log_path = "");
+	~Profiler();
+
+	//the profiler (if any) that Profiler::mark reports to:
+	static Profiler *active;
+	//switch the active profiler to 'phase' (does nothing when not profiling):
+	static void mark(Phase phase) {
+		if (active) active->enter(phase);
+	}
+
+	//call at the top of the main loop; finishes the previous frame (if it was drawn) and enters Wait:
+	void begin_frame();
+	void enter(Phase phase);
+
+	//bracket the frame's GL work (skipped, and counted, if every query is still in flight):
+	void begin_gpu();
+	void end_gpu();
+
+	//call each frame that is drawn with a RenderScale, with the scale it was drawn at:
+	void set_render_scale(float scale) { current.render_scale = scale; }
+
+	bool show_overlay = true;
+	float budget_ms = 1000.0f / 60.0f; //frame time the graph is scaled to (the vsync interval)
+	void draw_overlay(glm::uvec2 drawable_size);
+
+	//percentiles are printed to stdout when the profiler is destroyed:
+	void report(std::ostream &out) const;
+
+	//------- internals -------
+
+	typedef std::chrono::steady_clock Clock;
+
+	struct Frame {
+		uint32_t index = 0;
+		float phase_ms[PhaseCount] = { 0.0f };
+		float gpu_ms = -1.0f; //(negative if not timed yet, or not timed at all)
+		//GL work (only counted when built with GL_COUNTERS; includes the previous frame's overlay):
+		uint64_t gl_calls = 0;
+		uint64_t draws = 0;
+		uint64_t vertices = 0;
+		uint64_t buffer_bytes = 0;
+		uint64_t uniform_bytes = 0;
+		//state changes made through gl_state, and how many of those it skipped:
+		uint64_t state_changes = 0;
+		uint64_t state_elided = 0;
+		//bytes allocated from StreamBuffers:
+		uint64_t stream_bytes = 0;
+		//fraction of the drawable size the frame was drawn at (negative if not scaling):
+		float render_scale = -1.0f;
+		float cpu_ms() const; //events + update + build + submit
+		float total_ms() const; //every phase
+	};
+
+	static constexpr uint32_t History = 240;
+	Frame history[History]; //frame i is history[i % History]
+	uint32_t frames = 0; //frames finished so far
+
+	//the frame in progress:
+	Frame current;
+	Phase phase = Wait;
+	Clock::time_point phase_start;
+	bool drawn = false; //did the frame get as far as Swap? (frames that weren't drawn are folded into the next one)
+
+	//GL_TIME_ELAPSED queries; results come back in order a frame or more later:
+	struct Query {
+		GLuint id = 0;
+		uint32_t frame = 0;
+		bool pending = false;
+	};
+	static constexpr uint32_t QueryCount = 8;
+	Query queries[QueryCount];
+	uint32_t next_query = 0;
+	bool in_query = false;
+	uint32_t gpu_skipped = 0; //frames not timed on the GPU because every query was busy
+	void collect_queries(); //read back any available results (never waits)
+
+	//gl_state's totals as of the start of the frame:
+	uint64_t state_changes_before = 0;
+	uint64_t state_elided_before = 0;
+	//StreamBuffer's total as of the start of the frame:
+	uint64_t stream_bytes_before = 0;
+
+	#ifdef GL_COUNTERS
+	std::vector< uint64_t > last_calls; //per-entry-point calls in the last finished frame
+	std::vector< uint64_t > total_calls; //per-entry-point calls in every finished frame
+	void take_gl_counters(Frame *frame); //move the GL counts since the last frame into 'frame' and reset them
+	//most-called entry points (as "name count" strings) in 'calls':
+	static std::vector< std::string > top_calls(std::vector< uint64_t > const &calls, uint32_t count);
+	#endif
+
+	std::ofstream log;
+	void log_frame(Frame const &frame);
+
+	//percentile 'p' (in [0,100]) of 'get' over the frames in history:
+	template< typename F >
+	float percentile(float p, F const &get) const;
+	mutable std::vector< float > percentile_values; //(scratch space for percentile(), reused)
+
+	//overlay drawing:
+	struct Vertex {
+		Vertex(glm::vec2 const &Position_, glm::u8vec4 const &Color_) : Position(Position_), Color(Color_) { }
+		glm::vec2 Position; //(pixels, from the lower left)
+		glm::u8vec4 Color;
+	};
+	static_assert(sizeof(Vertex) == 12, "Vertex is packed");
+	std::vector< Vertex > overlay; //(reused every frame)
+	void rect(glm::vec2 const &min, glm::vec2 const &max, glm::u8vec4 const &color);
+	//3x5 pixel block capitals, 'scale' pixels per font pixel; returns the x after the last character:
+	float text(glm::vec2 const &at, std::string const &str, glm::u8vec4 const &color, float scale = 2.0f);
+
+	GLuint program = -1U;
+	GLuint pixels_to_clip_vec4 = -1U; //xy scale, zw offset
+	GLuint Position_vec2 = -1U;
+	GLuint Color_vec4 = -1U;
+	GLuint vao = -1U; //(attributes are pointed at overlay_stream's buffer when it changes)
+	GLuint vao_buffer = 0;
+	StreamBuffer overlay_stream{ "profiler overlay", 256 << 10 }; //(a full overlay is about 160KB)
+};
@@ -0,0 +1,147 @@
+#include "RenderScale.hpp"
+
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+
+#include <algorithm>
+#include <cmath>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+constexpr uint32_t RenderScale::TimingCount;
+
+RenderScale::RenderScale(float floor_, float target_ms_) : floor(std::max(0.1f, std::min(1.0f, floor_))), target_ms(target_ms_) {
+	for (Timing &timing : timings) {
+		glGenQueries(1, &timing.start);
+		glGenQueries(1, &timing.end);
+	}
+	GL_ERRORS();
+}
+
+RenderScale::~RenderScale() {
+	for (Timing &timing : timings) {
+		glDeleteQueries(1, &timing.start);
+		glDeleteQueries(1, &timing.end);
+		timing.start = timing.end = 0;
+	}
+	if (framebuffer != 0) {
+		glDeleteFramebuffers(1, &framebuffer);
+		glDeleteRenderbuffers(1, &color);
+		glDeleteRenderbuffers(1, &depth_stencil);
+		framebuffer = color = depth_stencil = 0;
+	}
+	GL_ERRORS();
+}
+
+void RenderScale::allocate(glm::uvec2 size) {
+	if (framebuffer == 0) {
+		glGenFramebuffers(1, &framebuffer);
+		glGenRenderbuffers(1, &color);
+		glGenRenderbuffers(1, &depth_stencil);
+	}
+	//(same formats as the window's framebuffer, see main.cpp)
+	glBindRenderbuffer(GL_RENDERBUFFER, color);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size.x, size.y);
+	glBindRenderbuffer(GL_RENDERBUFFER, depth_stencil);
+	glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, size.x, size.y);
+	glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+	glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color);
+	glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth_stencil);
+	GLenum status = glCheckFramebufferStatus(GL_FRAMEBUFFER);
+	glBindFramebuffer(GL_FRAMEBUFFER, 0);
+	if (status != GL_FRAMEBUFFER_COMPLETE) {
+		throw std::runtime_error("RenderScale's framebuffer is incomplete (status " + std::to_string(status) + ").");
+	}
+
+	allocated = size;
+	GL_ERRORS();
+}
+
+glm::uvec2 RenderScale::begin(glm::uvec2 drawable_size) {
+	collect_timings();
+
+	render_size = glm::uvec2(glm::max(glm::vec2(1.0f), glm::round(glm::vec2(drawable_size) * scale)));
+	render_size = glm::min(render_size, drawable_size);
+
+	++frames;
+	scale_sum += scale;
+	lowest = std::min(lowest, scale);
+
+	if (render_size != drawable_size) {
+		if (allocated != drawable_size) allocate(drawable_size);
+		glBindFramebuffer(GL_FRAMEBUFFER, framebuffer);
+		glViewport(0, 0, render_size.x, render_size.y);
+		++frames_scaled;
+	}
+
+	//(if every query is still waiting on the GPU, this frame just isn't timed)
+	Timing &timing = timings[next_timing];
+	if (!timing.pending) {
+		glQueryCounter(timing.start, GL_TIMESTAMP);
+		timing.scale = scale;
+		in_timing = true;
+	}
+
+	return render_size;
+}
+
+void RenderScale::end(glm::uvec2 drawable_size) {
+	if (render_size != drawable_size) {
+		//upscale to the window (every pixel is covered, so it needn't be cleared):
+		glBindFramebuffer(GL_READ_FRAMEBUFFER, framebuffer);
+		glBindFramebuffer(GL_DRAW_FRAMEBUFFER, 0);
+		glBlitFramebuffer(
+			0, 0, render_size.x, render_size.y,
+			0, 0, drawable_size.x, drawable_size.y,
+			GL_COLOR_BUFFER_BIT, GL_LINEAR
+		);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glViewport(0, 0, drawable_size.x, drawable_size.y);
+	}
+
+	if (in_timing) {
+		Timing &timing = timings[next_timing];
+		glQueryCounter(timing.end, GL_TIMESTAMP);
+		timing.pending = true;
+		next_timing = (next_timing + 1) % TimingCount;
+		in_timing = false;
+	}
+}
+
+void RenderScale::collect_timings() {
+	//results become available in the order queries were issued, so check from the oldest:
+	for (uint32_t i = 0; i < TimingCount; ++i) {
+		Timing &timing = timings[(next_timing + i) % TimingCount];
+		if (!timing.pending) continue;
+
+		GLuint available = GL_FALSE;
+		glGetQueryObjectuiv(timing.end, GL_QUERY_RESULT_AVAILABLE, &available);
+		if (!available) break;
+
+		GLuint64 start = 0, end = 0;
+		glGetQueryObjectui64v(timing.start, GL_QUERY_RESULT, &start);
+		glGetQueryObjectui64v(timing.end, GL_QUERY_RESULT, &end);
+		timing.pending = false;
+
+		//(drop absurd results, like the ones llvmpipe's first queries can report)
+		if (end <= start || end - start > GLuint64(1000000000)) continue;
+		last_gpu_ms = float(end - start) / 1.0e6f;
+
+		//the scale that would have hit the target, if all the frame's GPU time went with the pixel count:
+		float ideal = timing.scale * std::sqrt(target_ms / last_gpu_ms);
+		//move part of the way there (results are a few frames old and noisy), backing off faster than recovering,
+		// and never far on one result (a single hitch shouldn't halve the resolution):
+		float step = (ideal < scale ? 0.5f : 0.2f) * (ideal - scale);
+		step = std::max(-0.125f, std::min(0.125f, step));
+		//(in 1/64ths, so small wobbles in GPU time don't change the size of every frame)
+		float next = std::round((scale + step) * 64.0f) / 64.0f;
+		scale = std::max(floor, std::min(1.0f, next));
+	}
+}
+
+void RenderScale::report(std::ostream &out) const {
+	out << "Render scale: mean " << (frames ? scale_sum / frames : 1.0f) << ", lowest " << lowest << " (floor " << floor << "); "
+		<< frames_scaled << " of " << frames << " frames drawn below full size, aiming for " << target_ms << " ms of GPU time." << std::endl;
+}
@@ -0,0 +1,66 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <iosfwd>
+
+//RenderScale draws frames into an offscreen framebuffer at a fraction of the drawable size and
+// upscales them (with a linear-filtered blit) to the window, picking the fraction from how long
+// the GPU took on recent frames so frames keep to a target time; high-DPI displays, where the
+// drawable has several times the window's pixels, are the main beneficiary.
+// - GPU time comes from GL_TIMESTAMP queries around the frame (not GL_TIME_ELAPSED, so they
+//   don't collide with the profiler's), kept in a ring and read once available (never waiting).
+// - Fragment work goes with the pixel count (scale squared), so each result suggests a scale;
+//   the scale moves part of the way there, and never below 'floor' or above 1.
+// - The framebuffer is allocated at the full drawable size, and frames are drawn into its lower-left
+//   corner, so changing the scale doesn't allocate anything. At scale 1, frames go straight to the window.
+struct RenderScale {
+	//creates GL objects, so must be called with the context current:
+	RenderScale(float floor, float target_ms);
+	~RenderScale();
+
+	float floor; //smallest scale allowed (a fraction of the drawable size on each axis)
+	float target_ms; //GPU time per frame to aim for
+	float scale = 1.0f; //current scale
+
+	//call before clearing; binds the framebuffer to draw into (and its viewport), returns the size to draw at:
+	glm::uvec2 begin(glm::uvec2 drawable_size);
+	//call after drawing; upscales to the window (and restores the viewport to 'drawable_size'):
+	void end(glm::uvec2 drawable_size);
+
+	//writes scale stats to 'out':
+	void report(std::ostream &out) const;
+
+	//------- internals -------
+
+	glm::uvec2 render_size = glm::uvec2(0); //size of the frame being drawn (between begin and end)
+
+	//offscreen framebuffer (allocated at the drawable size, re-allocated when that changes):
+	GLuint framebuffer = 0;
+	GLuint color = 0; //renderbuffer
+	GLuint depth_stencil = 0; //renderbuffer
+	glm::uvec2 allocated = glm::uvec2(0);
+	void allocate(glm::uvec2 size);
+
+	//GPU timestamps at the start and end of each frame:
+	struct Timing {
+		GLuint start = 0;
+		GLuint end = 0;
+		float scale = 1.0f; //scale the frame was drawn at
+		bool pending = false;
+	};
+	static constexpr uint32_t TimingCount = 8;
+	Timing timings[TimingCount];
+	uint32_t next_timing = 0;
+	bool in_timing = false;
+	void collect_timings(); //read back any available results (never waits) and adjust the scale
+
+	//stats:
+	uint32_t frames = 0;
+	uint32_t frames_scaled = 0; //frames drawn below scale 1
+	float scale_sum = 0.0f; //(for the mean)
+	float lowest = 1.0f;
+	float last_gpu_ms = -1.0f;
+};
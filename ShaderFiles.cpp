@@ -0,0 +1,130 @@
+#include "ShaderFiles.hpp"
+
+#include "data_path.hpp" //helper to get paths relative to executable
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+
+#if defined(__linux__)
+#include <sys/inotify.h>
+#include <unistd.h>
+#include <cerrno>
+#endif
+
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <stdexcept>
+
+ShaderFiles::ShaderFiles() {
+	#if defined(__linux__)
+	//watch the whole directory, since editors often save by writing a new file and renaming it over the old one:
+	inotify = inotify_init1(IN_NONBLOCK | IN_CLOEXEC);
+	if (inotify != -1) {
+		std::string dir = data_path("shaders");
+		if (inotify_add_watch(inotify, dir.c_str(), IN_CLOSE_WRITE | IN_MOVED_TO | IN_CREATE) == -1) {
+			std::cerr << "NOTE: can't watch '" << dir << "' for changes, so shaders won't reload." << std::endl;
+			close(inotify);
+			inotify = -1;
+		}
+	}
+	#endif
+}
+
+ShaderFiles::~ShaderFiles() {
+	for (auto &program : programs) {
+		if (program.pending.program == 0) continue;
+		try {
+			glDeleteProgram(finish_program(program.pending));
+		} catch (std::exception &) {
+			//(a reload that failed anyway)
+		}
+	}
+	#if defined(__linux__)
+	if (inotify != -1) close(inotify);
+	#endif
+}
+
+std::string ShaderFiles::read(std::string const &name) {
+	std::string path = data_path("shaders/" + name);
+	std::ifstream file(path, std::ios::binary);
+	if (!file) throw std::runtime_error("Failed to read shader '" + path + "'.");
+	return std::string(std::istreambuf_iterator< char >(file), std::istreambuf_iterator< char >());
+}
+
+uint32_t ShaderFiles::load(std::string const &vertex, std::string const &fragment) {
+	std::string vertex_source = read(vertex);
+	std::string fragment_source = read(fragment);
+	programs.emplace_back();
+	Program &program = programs.back();
+	program.vertex = vertex;
+	program.fragment = fragment;
+	program.pending = start_program(vertex_source, fragment_source);
+	return uint32_t(programs.size() - 1);
+}
+
+GLuint ShaderFiles::finish(uint32_t index, Reloaded const &reloaded) {
+	Program &program = programs.at(index);
+	program.reloaded = reloaded;
+	return finish_program(program.pending);
+}
+
+bool ShaderFiles::update() {
+	#if defined(__linux__)
+	if (inotify != -1) {
+		//mark programs whose files changed:
+		alignas(inotify_event) char buffer[4096];
+		while (true) {
+			ssize_t got = ::read(inotify, buffer, sizeof(buffer));
+			if (got <= 0) break; //(EAGAIN: no more events)
+			for (char *at = buffer; at < buffer + got; /* later */) {
+				inotify_event const *event = reinterpret_cast< inotify_event const * >(at);
+				at += sizeof(inotify_event) + event->len;
+				if (event->len == 0) continue;
+				std::string name = event->name;
+				for (auto &program : programs) {
+					if (program.reloaded && (name == program.vertex || name == program.fragment)) {
+						program.changed = true;
+					}
+				}
+			}
+		}
+	}
+	#endif
+
+	bool replaced = false;
+	for (auto &program : programs) {
+		//start compiling changed programs (one compile at a time per program; later changes wait for it):
+		if (program.changed && program.pending.program == 0) {
+			program.changed = false;
+			try {
+				program.pending = start_program(read(program.vertex), read(program.fragment));
+			} catch (std::exception &e) {
+				std::cerr << "Failed to reload " << program.vertex << " + " << program.fragment << ": " << e.what() << std::endl;
+			}
+		}
+
+		//hand over the ones that are done:
+		if (program.pending.program != 0 && program_ready(program.pending)) {
+			GLuint reloaded = 0;
+			try {
+				reloaded = finish_program(program.pending);
+			} catch (std::exception &e) {
+				std::cerr << "Failed to reload " << program.vertex << " + " << program.fragment << " (still using the old program): " << e.what() << std::endl;
+				continue;
+			}
+			if (program.reloaded(reloaded)) {
+				std::cout << "Reloaded " << program.vertex << " + " << program.fragment << "." << std::endl;
+				replaced = true;
+			} else {
+				gl_state_DeleteProgram(reloaded);
+			}
+		}
+	}
+	return replaced;
+}
+
+bool ShaderFiles::reloading() const {
+	for (auto const &program : programs) {
+		if (program.changed || program.pending.program != 0) return true;
+	}
+	return false;
+}
@@ -0,0 +1,51 @@
+#pragma once
+
+#include "GL.hpp"
+#include "compile_program.hpp"
+
+#include <cstdint>
+#include <functional>
+#include <string>
+#include <vector>
+
+//ShaderFiles compiles shader programs from source files in data_path("shaders/") and (on Linux)
+// watches those files with inotify, so an edited shader is recompiled while the game runs.
+//A reloaded program only replaces the old one once it has compiled and linked; if that fails,
+// the errors are printed and the old program keeps drawing. With GL_KHR_parallel_shader_compile
+// the compile happens in the background over the next few frames; without it, in one frame.
+struct ShaderFiles {
+	ShaderFiles();
+	~ShaderFiles();
+
+	//called with each successfully reloaded program; should re-query its uniform (and attribute)
+	// locations and return true to take it (deleting the old one), or false to reject it:
+	typedef std::function< bool(GLuint program) > Reloaded;
+
+	//start compiling "shaders/<vertex>" + "shaders/<fragment>" (throws if a file can't be read);
+	// returns an index for finish(). Starting every program before finishing any lets them compile together:
+	uint32_t load(std::string const &vertex, std::string const &fragment);
+
+	//wait for a program from load() and return it (throws, like compile_program, if it fails);
+	// after this, changes to its files call 'reloaded' with the new program:
+	GLuint finish(uint32_t index, Reloaded const &reloaded);
+
+	//call once per frame: starts recompiling programs whose files changed, and hands over the ones
+	// that are ready; returns true if a program was replaced (so the frame should be redrawn):
+	bool update();
+
+	//true while a reload is compiling (so the main loop keeps calling update()):
+	bool reloading() const;
+
+	//------- internals -------
+	struct Program {
+		std::string vertex, fragment; //file names (in "shaders/")
+		Reloaded reloaded; //(empty until finish())
+		bool changed = false; //a file changed since the current compile started
+		PendingProgram pending; //(pending.program != 0 while compiling)
+	};
+	std::vector< Program > programs;
+
+	int inotify = -1; //(-1 if not watching)
+
+	static std::string read(std::string const &name);
+};
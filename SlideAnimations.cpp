@@ -0,0 +1,83 @@
+#include "SlideAnimations.hpp"
+
+#include <algorithm>
+#include <cassert>
+
+constexpr float SlideAnimations::Acceleration;
+constexpr float SlideAnimations::MaxSpeed;
+constexpr uint32_t MoveQueue::Capacity;
+
+uint32_t SlideAnimations::add(glm::vec2 const &at) {
+	previous.emplace_back(at);
+	current.emplace_back(at);
+	target.emplace_back(at);
+	speed.emplace_back(0.0f);
+	hurry.emplace_back(1.0f);
+	return uint32_t(current.size() - 1);
+}
+
+uint32_t SlideAnimations::add(SlideAnimations const &from, uint32_t i) {
+	assert(i < from.current.size());
+	previous.emplace_back(from.previous[i]);
+	current.emplace_back(from.current[i]);
+	target.emplace_back(from.target[i]);
+	speed.emplace_back(from.speed[i]);
+	hurry.emplace_back(from.hurry[i]);
+	return uint32_t(current.size() - 1);
+}
+
+void SlideAnimations::clear() {
+	previous.clear();
+	current.clear();
+	target.clear();
+	speed.clear();
+	hurry.clear();
+}
+
+void SlideAnimations::slide_to(uint32_t i, glm::vec2 const &to, float hurry_) {
+	assert(i < current.size());
+	target[i] = to;
+	hurry[i] = hurry_;
+}
+
+void SlideAnimations::snap_to(uint32_t i, glm::vec2 const &at) {
+	assert(i < current.size());
+	previous[i] = current[i] = target[i] = at;
+	speed[i] = 0.0f;
+}
+
+void SlideAnimations::tick(float dt) {
+	uint32_t count = uint32_t(current.size());
+	for (uint32_t i = 0; i < count; ++i) {
+		previous[i] = current[i];
+		if (current[i] == target[i]) continue;
+
+		speed[i] = std::min(MaxSpeed * hurry[i], speed[i] + Acceleration * hurry[i] * dt);
+		float step = speed[i] * dt;
+
+		glm::vec2 to_target = target[i] - current[i];
+		float distance = glm::length(to_target);
+		if (distance <= step) {
+			current[i] = target[i];
+			speed[i] = 0.0f;
+		} else {
+			current[i] += to_target * (step / distance);
+		}
+	}
+}
+
+bool MoveQueue::push(glm::ivec2 const &move) {
+	if (count == Capacity) return false;
+	moves[(first + count) % Capacity] = move;
+	++count;
+	return true;
+}
+
+bool MoveQueue::pop(glm::ivec2 *move) {
+	assert(move);
+	if (count == 0) return false;
+	*move = moves[first];
+	first = (first + 1) % Capacity;
+	--count;
+	return true;
+}
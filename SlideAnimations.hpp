@@ -0,0 +1,59 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+//SlideAnimations moves many objects (players, mostly) toward target positions on a fixed-timestep clock.
+// Objects speed up as they slide (like a robot getting going) and stop dead on arrival.
+//Positions are kept for the previous and current tick, so drawing can interpolate between them;
+// state is stored as parallel arrays and nothing is allocated after objects are added.
+struct SlideAnimations {
+	//tiles/second^2 and tiles/second:
+	static constexpr float Acceleration = 80.0f;
+	static constexpr float MaxSpeed = 24.0f;
+
+	//add an object resting at 'at'; returns its index:
+	uint32_t add(glm::vec2 const &at);
+	//add a copy of object 'i' of 'from' (mid-slide or not); returns its index:
+	uint32_t add(SlideAnimations const &from, uint32_t i);
+	void clear();
+	uint32_t size() const { return uint32_t(current.size()); }
+
+	//start sliding toward 'to'; 'hurry' scales the acceleration and top speed (used to catch up with queued input):
+	void slide_to(uint32_t i, glm::vec2 const &to, float hurry = 1.0f);
+	//stop (without interpolating) at 'at':
+	void snap_to(uint32_t i, glm::vec2 const &at);
+
+	bool sliding(uint32_t i) const { return current[i] != target[i]; }
+	//sliding, or just arrived (so its drawn position still depends on alpha):
+	bool moving(uint32_t i) const { return sliding(i) || previous[i] != current[i]; }
+
+	//advance every object by one fixed timestep:
+	void tick(float dt);
+
+	//position between the last two ticks ('alpha' in [0,1] is how far through the current tick we are):
+	glm::vec2 at(uint32_t i, float alpha) const { return glm::mix(previous[i], current[i], alpha); }
+
+	std::vector< glm::vec2 > previous; //position as of the previous tick
+	std::vector< glm::vec2 > current; //position as of the latest tick
+	std::vector< glm::vec2 > target;
+	std::vector< float > speed;
+	std::vector< float > hurry;
+};
+
+//MoveQueue holds slide directions entered while a slide is still animating.
+// It is small and fixed-size: once it is full, new moves are ignored, so the
+// player never has to wait through a long backlog of stale input.
+struct MoveQueue {
+	static constexpr uint32_t Capacity = 2;
+
+	bool push(glm::ivec2 const &move); //returns false (and drops 'move') if the queue is full
+	bool pop(glm::ivec2 *move); //returns false if the queue is empty
+	void clear() { count = 0; }
+	bool empty() const { return count == 0; }
+
+	glm::ivec2 moves[Capacity];
+	uint32_t first = 0;
+	uint32_t count = 0;
+};
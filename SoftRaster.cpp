@@ -0,0 +1,270 @@
+#include "SoftRaster.hpp"
+
+#include <algorithm>
+#include <atomic>
+#include <cassert>
+#include <cmath>
+#include <thread>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#include <emmintrin.h>
+#define SOFT_RASTER_SSE2 1
+#endif
+
+constexpr uint32_t SoftRaster::TileSize;
+
+//run fn(0) ... fn(count-1) on up to 'threads' threads:
+template< typename F >
+static void parallel_for(uint32_t threads, uint32_t count, F const &fn) {
+	std::atomic< uint32_t > next(0);
+	auto work = [&]() {
+		for (uint32_t i = next++; i < count; i = next++) {
+			fn(i);
+		}
+	};
+	std::vector< std::thread > pool;
+	for (uint32_t t = 1; t < std::min(threads, count); ++t) {
+		pool.emplace_back(work);
+	}
+	work();
+	for (auto &thread : pool) {
+		thread.join();
+	}
+}
+
+//a triangle after vertex processing, ready to be rasterized:
+struct SetupTriangle {
+	bool visible = false;
+
+	//edge functions e[i](x,y) = a[i] * x + b[i] * y + c[i], positive inside.
+	// e[i] is the edge opposite vertex i, so e[i] / area is vertex i's barycentric weight.
+	float a[3], b[3], c[3];
+	bool inclusive[3]; //is a pixel center exactly on the edge inside? (makes shared edges draw once)
+	float inv_area;
+
+	//pixel bounds (inclusive), already clamped to the framebuffer:
+	int32_t min_x, min_y, max_x, max_y;
+
+	//window-space depth, and attributes pre-divided by clip w for perspective-correct interpolation:
+	float z[3];
+	float inv_w[3];
+	glm::vec3 normal_w[3];
+	glm::vec4 color_w[3];
+};
+
+SoftRaster::SoftRaster(glm::uvec2 size_, uint32_t threads_) : size(size_), threads(threads_) {
+	if (threads == 0) {
+		threads = std::max(1U, std::thread::hardware_concurrency());
+	}
+	color.resize(size.x * size.y);
+	depth.resize(size.x * size.y);
+}
+
+//float to 8-bit unsigned normalized, the way OpenGL converts for an RGBA8 framebuffer:
+static inline uint8_t to_unorm8(float f) {
+	return uint8_t(std::floor(std::min(1.0f, std::max(0.0f, f)) * 255.0f + 0.5f));
+}
+
+void SoftRaster::clear(glm::vec4 const &clear_color) {
+	glm::u8vec4 c(to_unorm8(clear_color.r), to_unorm8(clear_color.g), to_unorm8(clear_color.b), to_unorm8(clear_color.a));
+	std::fill(color.begin(), color.end(), c);
+	std::fill(depth.begin(), depth.end(), 1.0f);
+}
+
+void SoftRaster::draw(
+	MeshBlob const &blob,
+	std::vector< MeshInstance > const &instances,
+	glm::mat4 const &world_to_clip,
+	BoardLighting const &lighting) {
+
+	//------ vertex processing + triangle setup ------
+
+	//triangles are numbered consecutively through all the instances:
+	std::vector< uint32_t > instance_first(instances.size() + 1, 0);
+	for (uint32_t i = 0; i < instances.size(); ++i) {
+		Mesh const &mesh = *instances[i].mesh;
+		assert(mesh.first >= 0 && uint32_t(mesh.first + mesh.count) <= blob.index_count + blob.added_indices.size());
+		instance_first[i+1] = instance_first[i] + mesh.count / 3;
+	}
+	std::vector< SetupTriangle > triangles(instance_first.back());
+
+	parallel_for(threads, uint32_t(instances.size()), [&](uint32_t i) {
+		MeshInstance const &instance = instances[i];
+		//same matrices that Game::draw uploads as uniforms:
+		glm::mat4 object_to_clip = world_to_clip * instance.object_to_world;
+		glm::mat3 normal_to_light = glm::inverse(glm::transpose(glm::mat3(instance.object_to_world)));
+
+		for (uint32_t t = instance_first[i]; t < instance_first[i+1]; ++t) {
+			SetupTriangle &tri = triangles[t];
+			uint32_t first = (t - instance_first[i]) * 3;
+			MeshBlob::Vertex const *v[3] = { &blob.vertex(*instance.mesh, first), &blob.vertex(*instance.mesh, first + 1), &blob.vertex(*instance.mesh, first + 2) };
+
+			glm::vec4 clip[3];
+			for (uint32_t k = 0; k < 3; ++k) {
+				clip[k] = object_to_clip * glm::vec4(v[k]->Position, 1.0f);
+			}
+
+			//no near-plane clipping, so skip triangles that reach behind the eye:
+			if (clip[0].w <= 0.0f || clip[1].w <= 0.0f || clip[2].w <= 0.0f) continue;
+
+			//trivially reject triangles entirely outside one of the clip planes:
+			bool outside = false;
+			for (uint32_t axis = 0; axis < 3 && !outside; ++axis) {
+				outside = (clip[0][axis] > clip[0].w && clip[1][axis] > clip[1].w && clip[2][axis] > clip[2].w)
+				       || (clip[0][axis] < -clip[0].w && clip[1][axis] < -clip[1].w && clip[2][axis] < -clip[2].w);
+			}
+			if (outside) continue;
+
+			//viewport transform (pixel centers at half-integers, y up):
+			glm::vec2 win[3];
+			for (uint32_t k = 0; k < 3; ++k) {
+				tri.inv_w[k] = 1.0f / clip[k].w;
+				win[k].x = (clip[k].x * tri.inv_w[k] * 0.5f + 0.5f) * size.x;
+				win[k].y = (clip[k].y * tri.inv_w[k] * 0.5f + 0.5f) * size.y;
+				tri.z[k] = clip[k].z * tri.inv_w[k] * 0.5f + 0.5f;
+			}
+
+			float area = (win[1].x - win[0].x) * (win[2].y - win[0].y) - (win[1].y - win[0].y) * (win[2].x - win[0].x);
+			if (area == 0.0f) continue;
+			//no face culling in the GL path, so flip clockwise triangles around:
+			float flip = (area < 0.0f ? -1.0f : 1.0f);
+			tri.inv_area = 1.0f / (area * flip);
+
+			for (uint32_t k = 0; k < 3; ++k) {
+				glm::vec2 const &p = win[(k+1)%3];
+				glm::vec2 const &q = win[(k+2)%3];
+				tri.a[k] = -(q.y - p.y) * flip;
+				tri.b[k] = (q.x - p.x) * flip;
+				tri.c[k] = -(tri.a[k] * p.x + tri.b[k] * p.y);
+				tri.inclusive[k] = (tri.a[k] > 0.0f || (tri.a[k] == 0.0f && tri.b[k] > 0.0f));
+			}
+
+			glm::vec2 lo = glm::min(win[0], glm::min(win[1], win[2]));
+			glm::vec2 hi = glm::max(win[0], glm::max(win[1], win[2]));
+			tri.min_x = std::max(0, int32_t(std::floor(lo.x)));
+			tri.min_y = std::max(0, int32_t(std::floor(lo.y)));
+			tri.max_x = std::min(int32_t(size.x) - 1, int32_t(std::ceil(hi.x)));
+			tri.max_y = std::min(int32_t(size.y) - 1, int32_t(std::ceil(hi.y)));
+			if (tri.min_x > tri.max_x || tri.min_y > tri.max_y) continue;
+
+			for (uint32_t k = 0; k < 3; ++k) {
+				tri.normal_w[k] = (normal_to_light * MeshBlob::unpack_normal(v[k]->Normal)) * tri.inv_w[k];
+				tri.color_w[k] = glm::vec4(v[k]->Color) / 255.0f * tri.inv_w[k];
+			}
+
+			tri.visible = true;
+		}
+	});
+
+	//------ binning ------
+
+	glm::uvec2 tiles = (size + glm::uvec2(TileSize - 1)) / TileSize;
+	std::vector< std::vector< uint32_t > > bins(tiles.x * tiles.y);
+	for (uint32_t t = 0; t < triangles.size(); ++t) {
+		SetupTriangle const &tri = triangles[t];
+		if (!tri.visible) continue;
+		for (uint32_t ty = tri.min_y / TileSize; ty <= tri.max_y / TileSize; ++ty) {
+			for (uint32_t tx = tri.min_x / TileSize; tx <= tri.max_x / TileSize; ++tx) {
+				bins[ty * tiles.x + tx].emplace_back(t);
+			}
+		}
+	}
+
+	//------ rasterization ------
+
+	//shade + depth test + blend one pixel; e[] are the edge function values at its center:
+	auto fragment = [&](SetupTriangle const &tri, uint32_t px, uint32_t py, float const e[3]) {
+		float l[3] = { e[0] * tri.inv_area, e[1] * tri.inv_area, e[2] * tri.inv_area };
+
+		float z = l[0] * tri.z[0] + l[1] * tri.z[1] + l[2] * tri.z[2];
+		if (z < 0.0f || z > 1.0f) return; //(stands in for near/far clipping)
+		float &d = depth[py * size.x + px];
+		if (!(z < d)) return;
+		d = z;
+
+		float w = 1.0f / (l[0] * tri.inv_w[0] + l[1] * tri.inv_w[1] + l[2] * tri.inv_w[2]);
+		glm::vec3 normal = (l[0] * tri.normal_w[0] + l[1] * tri.normal_w[1] + l[2] * tri.normal_w[2]) * w;
+		glm::vec4 color_in = (l[0] * tri.color_w[0] + l[1] * tri.color_w[1] + l[2] * tri.color_w[2]) * w;
+
+		//same lighting as the 'simple_shading' fragment shader:
+		glm::vec3 total_light = glm::vec3(0.0f);
+		glm::vec3 n = glm::normalize(normal);
+		{ //sky (hemisphere) light:
+			float nl = 0.5f + 0.5f * glm::dot(n, lighting.sky_direction);
+			total_light += nl * lighting.sky_color;
+		}
+		{ //sun (directional) light:
+			float nl = std::max(0.0f, glm::dot(n, lighting.sun_direction));
+			total_light += nl * lighting.sun_color;
+		}
+		glm::vec4 src = glm::clamp(glm::vec4(glm::vec3(color_in) * total_light, color_in.a), 0.0f, 1.0f);
+
+		//glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA):
+		glm::u8vec4 &dst = color[py * size.x + px];
+		glm::vec4 blended = src * src.a + glm::vec4(dst) / 255.0f * (1.0f - src.a);
+		dst = glm::u8vec4(to_unorm8(blended.r), to_unorm8(blended.g), to_unorm8(blended.b), to_unorm8(blended.a));
+	};
+
+	parallel_for(threads, tiles.x * tiles.y, [&](uint32_t tile) {
+		int32_t tile_x0 = int32_t((tile % tiles.x) * TileSize);
+		int32_t tile_y0 = int32_t((tile / tiles.x) * TileSize);
+		int32_t tile_x1 = std::min(tile_x0 + int32_t(TileSize), int32_t(size.x)) - 1;
+		int32_t tile_y1 = std::min(tile_y0 + int32_t(TileSize), int32_t(size.y)) - 1;
+
+		//each tile is only touched by one thread, and sees its triangles in draw order:
+		for (uint32_t t : bins[tile]) {
+			SetupTriangle const &tri = triangles[t];
+			int32_t x0 = std::max(tri.min_x, tile_x0);
+			int32_t x1 = std::min(tri.max_x, tile_x1);
+			int32_t y0 = std::max(tri.min_y, tile_y0);
+			int32_t y1 = std::min(tri.max_y, tile_y1);
+
+			for (int32_t y = y0; y <= y1; ++y) {
+				float cy = y + 0.5f;
+				#ifdef SOFT_RASTER_SSE2
+				//evaluate all three edge functions at four pixel centers at once:
+				__m128 a[3], row[3];
+				for (uint32_t k = 0; k < 3; ++k) {
+					a[k] = _mm_set1_ps(tri.a[k]);
+					row[k] = _mm_set1_ps(tri.b[k] * cy + tri.c[k]);
+				}
+				__m128 const lane = _mm_set_ps(3.5f, 2.5f, 1.5f, 0.5f);
+				__m128 const zero = _mm_setzero_ps();
+				for (int32_t x = x0; x <= x1; x += 4) {
+					__m128 cx = _mm_add_ps(_mm_set1_ps(float(x)), lane);
+					__m128 e[3];
+					__m128 inside = _mm_castsi128_ps(_mm_set1_epi32(-1));
+					for (uint32_t k = 0; k < 3; ++k) {
+						e[k] = _mm_add_ps(_mm_mul_ps(a[k], cx), row[k]);
+						inside = _mm_and_ps(inside, tri.inclusive[k] ? _mm_cmpge_ps(e[k], zero) : _mm_cmpgt_ps(e[k], zero));
+					}
+					int mask = _mm_movemask_ps(inside);
+					if (x1 - x < 3) mask &= (1 << (x1 - x + 1)) - 1;
+					if (mask == 0) continue;
+
+					alignas(16) float ev[3][4];
+					for (uint32_t k = 0; k < 3; ++k) {
+						_mm_store_ps(ev[k], e[k]);
+					}
+					for (uint32_t i = 0; i < 4; ++i) {
+						if (!(mask & (1 << i))) continue;
+						float pe[3] = { ev[0][i], ev[1][i], ev[2][i] };
+						fragment(tri, x + i, y, pe);
+					}
+				}
+				#else
+				for (int32_t x = x0; x <= x1; ++x) {
+					float cx = x + 0.5f;
+					float e[3];
+					bool inside = true;
+					for (uint32_t k = 0; k < 3; ++k) {
+						e[k] = tri.a[k] * cx + (tri.b[k] * cy + tri.c[k]); //(same order of operations as the SSE2 path)
+						inside = inside && (tri.inclusive[k] ? e[k] >= 0.0f : e[k] > 0.0f);
+					}
+					if (inside) fragment(tri, x, y, e);
+				}
+				#endif
+			}
+		}
+	});
+}
@@ -0,0 +1,40 @@
+#pragma once
+
+#include "Board.hpp"
+#include "MeshBlob.hpp"
+
+#include <glm/glm.hpp>
+
+#include <vector>
+
+//SoftRaster is a CPU-only stand-in for the 'simple_shading' OpenGL path in Game.cpp.
+// It draws the same meshes with the same sun/sky lighting, depth test, and blending,
+// so board images can be made on machines with no OpenGL implementation at all.
+//The image is split into tiles, which are rasterized in parallel by 'threads' threads.
+struct SoftRaster {
+	//threads == 0 means "one per hardware thread":
+	SoftRaster(glm::uvec2 size, uint32_t threads = 0);
+
+	glm::uvec2 size;
+	uint32_t threads;
+
+	//framebuffer; rows are stored bottom-to-top, like glReadPixels returns them:
+	std::vector< glm::u8vec4 > color;
+	std::vector< float > depth;
+
+	//like glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT):
+	void clear(glm::vec4 const &clear_color);
+
+	//draw instances (in order) with the state main.cpp sets up for Game::draw:
+	// depth test (GL_LESS) and blending (GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA)
+	// (meshes are read from 'blob', including any added meshes)
+	void draw(
+		MeshBlob const &blob,
+		std::vector< MeshInstance > const &instances,
+		glm::mat4 const &world_to_clip,
+		BoardLighting const &lighting
+	);
+
+	//triangles are binned into square tiles of this many pixels on a side:
+	static constexpr uint32_t TileSize = 64;
+};
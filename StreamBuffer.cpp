@@ -0,0 +1,180 @@
+#include "StreamBuffer.hpp"
+
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+#include "gl_extensions.hpp" //helpers to check what the context supports
+
+#include <algorithm>
+#include <cassert>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+
+//persistent mapping isn't loaded by the Windows shims, and GL_COUNTERS/GL_RECORD builds only
+// wrap GL 3.3 calls (and couldn't see writes to a persistent mapping anyway):
+#if !defined(_WIN32) && !defined(GL_COUNTERS) && !defined(GL_RECORD)
+#define PERSISTENT
+#endif
+
+bool StreamBuffer::allow_persistent = true;
+std::vector< StreamBuffer * > StreamBuffer::live;
+uint64_t StreamBuffer::total_bytes = 0;
+constexpr uint32_t StreamBuffer::Frames;
+
+StreamBuffer::StreamBuffer(std::string const &name_, GLsizeiptr frame_size_) : name(name_), frame_size(frame_size_) {
+	#ifdef PERSISTENT
+	if (allow_persistent && (gl_version_at_least(4, 4) || gl_has_extension("GL_ARB_buffer_storage"))) {
+		mode = Persistent;
+	}
+	#endif
+	live.emplace_back(this);
+}
+
+StreamBuffer::~StreamBuffer() {
+	if (high_water > 0) {
+		std::cout << "StreamBuffer '" << name << "': high-water " << high_water << " bytes per frame (region "
+			<< frame_size << " bytes; grew " << grows << " times; waited on the GPU in " << stalls << " of " << frames << " frames)." << std::endl;
+	}
+	delete_storage();
+	live.erase(std::remove(live.begin(), live.end(), this), live.end());
+}
+
+void StreamBuffer::begin_frame() {
+	assert(!mapped);
+	frame = (frame + 1) % Frames;
+	used = 0;
+	frame_bytes = 0;
+
+	if (fences[frame]) {
+		if (glClientWaitSync(fences[frame], 0, 0) == GL_TIMEOUT_EXPIRED) {
+			//(the GPU is more than Frames - 1 frames behind)
+			++stalls;
+			while (glClientWaitSync(fences[frame], GL_SYNC_FLUSH_COMMANDS_BIT, 1000000000) == GL_TIMEOUT_EXPIRED) { }
+		}
+		glDeleteSync(fences[frame]);
+		fences[frame] = nullptr;
+	}
+}
+
+void StreamBuffer::end_frame() {
+	assert(!mapped);
+	if (used > 0) {
+		if (fences[frame]) glDeleteSync(fences[frame]);
+		fences[frame] = glFenceSync(GL_SYNC_GPU_COMMANDS_COMPLETE, 0);
+	}
+	last_frame_bytes = frame_bytes;
+	high_water = std::max(high_water, frame_bytes);
+	++frames;
+}
+
+GLsizeiptr StreamBuffer::aligned_used(GLsizeiptr alignment) const {
+	//(offsets are aligned in the whole buffer, not just within the region)
+	GLsizeiptr base = frame * frame_size;
+	return (base + used + alignment - 1) / alignment * alignment - base;
+}
+
+bool StreamBuffer::fits(GLsizeiptr bytes, GLsizeiptr alignment) const {
+	return buffer != 0 && aligned_used(alignment) + bytes <= frame_size;
+}
+
+StreamBuffer::Allocation StreamBuffer::map(GLsizeiptr bytes, GLsizeiptr alignment) {
+	assert(bytes > 0 && alignment > 0);
+	assert(!mapped);
+
+	if (!fits(bytes, alignment)) {
+		GLsizeiptr want = bytes + alignment;
+		if (buffer != 0) {
+			want = std::max(2 * frame_size, want);
+			++grows;
+			std::cerr << "NOTE: stream buffer '" << name << "' ran out of its " << frame_size << " bytes for this frame; growing to " << want << " bytes per frame." << std::endl;
+		} else {
+			want = std::max(frame_size, want);
+		}
+		create_storage(want);
+	}
+
+	GLsizeiptr start = aligned_used(alignment);
+	frame_bytes += start + bytes - used;
+	total_bytes += uint64_t(start + bytes - used);
+	used = start + bytes;
+
+	Allocation allocation;
+	allocation.buffer = buffer;
+	allocation.offset = frame * frame_size + start;
+	if (mode == Persistent) {
+		allocation.data = persistent_data + allocation.offset;
+	} else {
+		//the fences already guarantee the GPU is done with this range, so the driver needn't check:
+		gl_state_BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		allocation.data = glMapBufferRange(GL_COPY_WRITE_BUFFER, allocation.offset, bytes, GL_MAP_WRITE_BIT | GL_MAP_INVALIDATE_RANGE_BIT | GL_MAP_UNSYNCHRONIZED_BIT);
+		if (!allocation.data) throw std::runtime_error("Failed to map stream buffer '" + name + "'.");
+		mapped = true;
+	}
+	return allocation;
+}
+
+void StreamBuffer::unmap() {
+	if (!mapped) return;
+	gl_state_BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+	glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+	mapped = false;
+}
+
+StreamBuffer::Allocation StreamBuffer::write(void const *data, GLsizeiptr bytes, GLsizeiptr alignment) {
+	Allocation allocation = map(bytes, alignment);
+	std::memcpy(allocation.data, data, bytes);
+	unmap();
+	return allocation;
+}
+
+void StreamBuffer::create_storage(GLsizeiptr frame_size_) {
+	assert(!mapped);
+	//every region starts 256-byte aligned (enough for any uniform buffer offset alignment):
+	frame_size = (frame_size_ + 255) / 256 * 256;
+
+	//(the old storage lives on until the GPU is done with it, so its fences aren't needed)
+	for (GLsync &fence : fences) {
+		if (fence) glDeleteSync(fence);
+		fence = nullptr;
+	}
+	frame = 0;
+	used = 0;
+
+	GLsizeiptr size = Frames * frame_size;
+	if (mode == Persistent) {
+		#ifdef PERSISTENT
+		//(immutable storage can't be re-specified, so a bigger buffer is a new buffer)
+		delete_storage();
+		glGenBuffers(1, &buffer);
+		gl_state_BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		GLbitfield flags = GL_MAP_WRITE_BIT | GL_MAP_PERSISTENT_BIT | GL_MAP_COHERENT_BIT;
+		glBufferStorage(GL_COPY_WRITE_BUFFER, size, nullptr, flags);
+		persistent_data = reinterpret_cast< uint8_t * >(glMapBufferRange(GL_COPY_WRITE_BUFFER, 0, size, flags));
+		if (!persistent_data) throw std::runtime_error("Failed to map stream buffer '" + name + "'.");
+		#endif
+	} else {
+		if (buffer == 0) glGenBuffers(1, &buffer);
+		gl_state_BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+		//(re-specifying the storage orphans the old one, so draws still reading it are unaffected)
+		glBufferData(GL_COPY_WRITE_BUFFER, size, nullptr, GL_STREAM_DRAW);
+	}
+
+	GL_ERRORS();
+}
+
+void StreamBuffer::delete_storage() {
+	for (GLsync &fence : fences) {
+		if (fence) glDeleteSync(fence);
+		fence = nullptr;
+	}
+	if (buffer != 0) {
+		if (persistent_data || mapped) {
+			gl_state_BindBuffer(GL_COPY_WRITE_BUFFER, buffer);
+			glUnmapBuffer(GL_COPY_WRITE_BUFFER);
+		}
+		gl_state_DeleteBuffers(1, &buffer);
+		buffer = 0;
+	}
+	persistent_data = nullptr;
+	mapped = false;
+}
@@ -0,0 +1,88 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <cstdint>
+#include <string>
+#include <vector>
+
+//StreamBuffer hands out space for data that is rewritten every frame (instances, vertices, uniform
+// blocks) from one buffer split into a region per frame in flight, so writing never waits on a draw
+// that still reads last frame's data, and never asks the driver to copy or re-allocate anything.
+//A frame's region is only reused once a fence set at the end of that frame has passed (with three
+// regions, that has almost always happened already).
+//There are two modes, picked when it is created:
+// - Persistent (GL 4.4 or GL_ARB_buffer_storage): the buffer stays mapped; allocations are just pointers.
+// - Unsynchronized (GL 3.3): each allocation is mapped with GL_MAP_UNSYNCHRONIZED_BIT (the fences
+//   stand in for the driver's synchronization) and must be unmapped before it is drawn.
+//If a frame needs more than a region, the buffer grows (3.3: by orphaning its storage; persistent:
+// by moving to a new buffer, so check Allocation::buffer) and a NOTE says so. Each stream keeps
+// a per-frame high-water mark, reported by the profiler and when the stream is destroyed.
+struct StreamBuffer {
+	//'name' is for reports; 'frame_size' is the starting size (bytes) of each frame's region:
+	// (storage is only created once something is allocated)
+	StreamBuffer(std::string const &name, GLsizeiptr frame_size);
+	~StreamBuffer();
+	StreamBuffer(StreamBuffer const &) = delete;
+	StreamBuffer &operator=(StreamBuffer const &) = delete;
+
+	enum Mode {
+		Unsynchronized,
+		Persistent,
+	} mode = Unsynchronized;
+	//set to false (e.g., by 'main --gl33') before creating StreamBuffers to always use Unsynchronized:
+	static bool allow_persistent;
+
+	//move to the next frame's region (waiting, if the GPU is still reading it):
+	void begin_frame();
+	//fence the frame's region and update the stats:
+	void end_frame();
+
+	struct Allocation {
+		GLuint buffer = 0;
+		GLintptr offset = 0; //(a multiple of the requested alignment)
+		void *data = nullptr; //write here, then unmap() before drawing
+	};
+	//reserve 'bytes' in this frame's region, growing the buffer if they don't fit (which starts a new
+	// region: already-issued draws are fine, but earlier allocations not yet drawn are lost, so
+	// check fits() first if draws are batched); 'alignment' needn't be a power of two:
+	Allocation map(GLsizeiptr bytes, GLsizeiptr alignment = 16);
+	void unmap(); //(Persistent: does nothing)
+	//map + copy + unmap:
+	Allocation write(void const *data, GLsizeiptr bytes, GLsizeiptr alignment = 16);
+
+	//would map(bytes, alignment) fit without growing?
+	bool fits(GLsizeiptr bytes, GLsizeiptr alignment = 16) const;
+
+	//------- stats -------
+
+	std::string name;
+	GLsizeiptr frame_bytes = 0; //allocated so far this frame (including alignment padding)
+	GLsizeiptr last_frame_bytes = 0;
+	GLsizeiptr high_water = 0; //most bytes allocated in one frame
+	uint32_t frames = 0; //frames ended
+	uint32_t stalls = 0; //times begin_frame() had to wait for the GPU
+	uint32_t grows = 0;
+
+	//every live stream (for the profiler), and bytes allocated by all of them, ever:
+	static std::vector< StreamBuffer * > live;
+	static uint64_t total_bytes;
+
+	//------- internals -------
+
+	static constexpr uint32_t Frames = 3; //regions (frames in flight)
+
+	GLuint buffer = 0;
+	GLsizeiptr frame_size = 0; //bytes per region
+	uint32_t frame = 0; //region being written
+	GLsizeiptr used = 0; //bytes used in that region
+	GLsync fences[Frames] = { nullptr }; //(nullptr if the region is free)
+	uint8_t *persistent_data = nullptr; //(Persistent: the whole buffer, mapped)
+	bool mapped = false; //(Unsynchronized: an allocation is mapped)
+
+	//where map(bytes, alignment) would start, relative to the region:
+	GLsizeiptr aligned_used(GLsizeiptr alignment) const;
+	//(re)create storage with 'frame_size' bytes per region:
+	void create_storage(GLsizeiptr frame_size);
+	void delete_storage();
+};
@@ -0,0 +1,346 @@
+#include "Versus.hpp"
+
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+#include "Profiler.hpp" //for marking build vs. submit time
+
+#include <algorithm>
+#include <cassert>
+#include <limits>
+
+constexpr uint32_t Versus::MaxPlayers;
+
+SDL_Scancode const Versus::Keys[MaxPlayers][4] = {
+	{ SDL_SCANCODE_A, SDL_SCANCODE_D, SDL_SCANCODE_S, SDL_SCANCODE_W },
+	{ SDL_SCANCODE_LEFT, SDL_SCANCODE_RIGHT, SDL_SCANCODE_DOWN, SDL_SCANCODE_UP },
+	{ SDL_SCANCODE_J, SDL_SCANCODE_L, SDL_SCANCODE_K, SDL_SCANCODE_I },
+	{ SDL_SCANCODE_KP_4, SDL_SCANCODE_KP_6, SDL_SCANCODE_KP_5, SDL_SCANCODE_KP_8 },
+};
+
+Versus::Versus(BoardMeshes const *meshes_, InstancedShading *shading_) : meshes(meshes_), shading(shading_), course(meshes_) {
+	assert(meshes);
+	assert(shading);
+
+	glGenBuffers(1, &course_vbo);
+	if (shading->tier == InstancedShading::Tier45) {
+		glGenBuffers(1, &course_commands);
+	}
+
+	start(2);
+
+	GL_ERRORS();
+}
+
+Versus::~Versus() {
+	gl_state_DeleteBuffers(1, &course_vbo);
+	course_vbo = -1U;
+	if (course_commands != -1U) {
+		gl_state_DeleteBuffers(1, &course_commands);
+		course_commands = -1U;
+	}
+
+	GL_ERRORS();
+}
+
+//------- game state -------
+
+void Versus::start(uint32_t players) {
+	players = std::max(2U, std::min(MaxPlayers, players));
+	racers.clear();
+	slides.clear();
+	winner = -1U;
+	for (uint32_t i = 0; i < players; ++i) {
+		racers.emplace_back(course);
+		slides.add(glm::vec2(course.player));
+	}
+	next_round();
+}
+
+void Versus::next_round() {
+	//the next course starts where the last one was won:
+	if (winner != -1U) course.player = racers[winner].board.player;
+	course.create_board(mt);
+	course.checkpoints = 0;
+	winner = -1U;
+
+	for (uint32_t i = 0; i < racers.size(); ++i) {
+		Racer &racer = racers[i];
+		racer.board = course;
+		racer.sliding_move = glm::ivec2(0);
+		racer.queued_moves.clear();
+		slides.snap_to(i, glm::vec2(course.player));
+	}
+	dirty = true;
+}
+
+bool Versus::handle_key(SDL_Scancode key) {
+	if (key == SDL_SCANCODE_SPACE) {
+		//space (once someone has won): next round
+		if (winner == -1U) return false;
+		next_round();
+		return true;
+	}
+	if (key == SDL_SCANCODE_2 || key == SDL_SCANCODE_3 || key == SDL_SCANCODE_4) {
+		start(2 + uint32_t(key - SDL_SCANCODE_2));
+		return true;
+	}
+
+	static const glm::ivec2 directions[4] = {
+		glm::ivec2(-1,0), glm::ivec2(1,0),
+		glm::ivec2(0,-1), glm::ivec2(0,1)
+	};
+	for (uint32_t i = 0; i < racers.size(); ++i) {
+		for (uint32_t d = 0; d < 4; ++d) {
+			if (key != Keys[i][d]) continue;
+			//(moves are queued, and play out in tick(); the race is over once someone has won)
+			if (winner == -1U) racers[i].queued_moves.push(directions[d]);
+			return true;
+		}
+	}
+	return false;
+}
+
+void Versus::tick(float dt) {
+	for (uint32_t i = 0; i < racers.size(); ++i) {
+		Racer &racer = racers[i];
+
+		//slide faster when more moves are waiting:
+		float hurry = (racer.queued_moves.empty() ? 1.0f : 2.0f);
+		slides.hurry[i] = hurry;
+
+		//apply the move once the robot arrives:
+		if (racer.sliding_move != glm::ivec2(0) && !slides.sliding(i)) {
+			racer.board.move_player(racer.sliding_move.x, racer.sliding_move.y);
+			racer.sliding_move = glm::ivec2(0);
+			if (racer.board.won && winner == -1U) {
+				winner = i;
+				racer.wins += 1;
+				for (Racer &other : racers) {
+					other.queued_moves.clear();
+				}
+			}
+		}
+
+		//start the next queued move:
+		glm::ivec2 move;
+		while (racer.sliding_move == glm::ivec2(0) && racer.queued_moves.pop(&move)) {
+			glm::uvec2 to = racer.board.slide_destination(move.x, move.y);
+			if (to == racer.board.player) continue; //(already against a wall)
+			racer.sliding_move = move;
+			slides.slide_to(i, glm::vec2(to), hurry);
+		}
+	}
+	slides.tick(dt);
+}
+
+bool Versus::animating() const {
+	for (uint32_t i = 0; i < racers.size(); ++i) {
+		if (racers[i].sliding_move != glm::ivec2(0) || !racers[i].queued_moves.empty() || slides.moving(i)) return true;
+	}
+	return false;
+}
+
+//------- drawing -------
+
+Versus::Viewport Versus::viewport(uint32_t player, uint32_t players, glm::uvec2 drawable_size) {
+	//two players split the long side of the screen; three or four get a quarter each:
+	glm::uvec2 cells = glm::uvec2(2, 2);
+	if (players <= 2) {
+		cells = (drawable_size.x >= drawable_size.y ? glm::uvec2(2, 1) : glm::uvec2(1, 2));
+	}
+	//(a few pixels of background between viewports)
+	static constexpr uint32_t Gap = 4;
+	glm::uvec2 gaps = (cells - 1U) * Gap;
+	Viewport ret;
+	ret.size = glm::max(glm::uvec2(1), (drawable_size - glm::min(drawable_size, gaps)) / cells);
+	//(players are numbered from the top left, like reading)
+	glm::uvec2 cell = glm::uvec2(player % cells.x, cells.y - 1 - player / cells.x);
+	ret.min = cell * (ret.size + Gap);
+	return ret;
+}
+
+glm::mat4 Versus::world_to_clip(Viewport const &viewport, glm::uvec2 drawable_size) const {
+	//bounding box of the whole (sheared) board -- not just its tile centers, like Board::world_to_clip,
+	// since the outer walls would spill into the next viewport:
+	glm::vec2 board_min = glm::vec2(std::numeric_limits< float >::infinity());
+	glm::vec2 board_max = glm::vec2(-std::numeric_limits< float >::infinity());
+	for (float cx : { 0.0f, float(course.size.x) }) {
+		for (float cy : { 0.0f, float(course.size.y) }) {
+			for (float cz : { 0.0f, 1.0f }) {
+				glm::vec2 pt = glm::vec2(Board::shear * glm::vec4(cx, cy, cz, 1.0f));
+				board_min = glm::min(board_min, pt);
+				board_max = glm::max(board_max, pt);
+			}
+		}
+	}
+
+	//pixels per board unit that fit the board in the viewport (with a little room to spare), as a scale in clip space:
+	float pixels = 0.95f * std::min(
+		viewport.size.x / (board_max.x - board_min.x),
+		viewport.size.y / (board_max.y - board_min.y)
+	);
+	glm::vec2 scale = 2.0f * pixels / glm::vec2(drawable_size);
+	//viewport's center in clip space:
+	glm::vec2 center = (2.0f * glm::vec2(viewport.min) + glm::vec2(viewport.size)) / glm::vec2(drawable_size) - 1.0f;
+	glm::vec2 board_center = 0.5f * (board_min + board_max);
+
+	//NOTE: glm matrices are specified in column-major order
+	return glm::mat4(
+		scale.x, 0.0f, 0.0f, 0.0f,
+		0.0f, scale.y, 0.0f, 0.0f,
+		0.0f, 0.0f,-0.1f, 0.0f, //<-- same depth range as Board::world_to_clip
+		center.x - scale.x * board_center.x, center.y - scale.y * board_center.y, 0.0f, 1.0f
+	);
+}
+
+void Versus::upload_course() {
+	//meshes that are the same on every racer's board; every one gets a batch:
+	Mesh const *kinds[] = {
+		&meshes->wall, &meshes->floor, &meshes->goop, &meshes->goal,
+	};
+
+	glm::mat3 shear = glm::mat3(Board::shear);
+
+	course_data.clear();
+	course_batches.clear();
+	for (Mesh const *kind : kinds) {
+		GLsizei first = GLsizei(course_data.size());
+		for (uint32_t y = 0; y < course.size.y; ++y) {
+			for (uint32_t x = 0; x < course.size.x; ++x) {
+				uint32_t i = y * course.size.x + x;
+				if (course.board_meshes[i] != kind && course.goal_meshes[i] != kind) continue;
+				course_data.emplace_back(shear * glm::vec3(x + 0.5f, y + 0.5f, 0.0f), 1.0f);
+			}
+		}
+		if (GLsizei(course_data.size()) == first) continue;
+		course_batches.emplace_back();
+		course_batches.back().mesh = kind;
+		course_batches.back().first_instance = first;
+		course_batches.back().instance_count = GLsizei(course_data.size()) - first;
+	}
+
+	//(re-specifying the storage orphans the old one, so last round's draws still in flight are unaffected)
+	gl_state_BindBuffer(GL_ARRAY_BUFFER, course_vbo);
+	glBufferData(GL_ARRAY_BUFFER, course_data.size() * sizeof(glm::vec4), course_data.data(), GL_STATIC_DRAW);
+
+	if (shading->tier == InstancedShading::Tier45) {
+		//the course's draw commands don't change during the round either:
+		std::vector< InstancedShading::DrawCommand > commands;
+		for (Batch const &batch : course_batches) {
+			InstancedShading::DrawCommand command;
+			command.count = GLuint(batch.mesh->count);
+			command.instance_count = GLuint(batch.instance_count);
+			command.first_index = GLuint(batch.mesh->first);
+			command.base_vertex = batch.mesh->base_vertex;
+			command.base_instance = GLuint(batch.first_instance);
+			commands.emplace_back(command);
+		}
+		gl_state_BindBuffer(GL_COPY_WRITE_BUFFER, course_commands);
+		glBufferData(GL_COPY_WRITE_BUFFER, commands.size() * sizeof(InstancedShading::DrawCommand), commands.data(), GL_STATIC_DRAW);
+	}
+
+	course_uploads += 1;
+	dirty = false;
+
+	GL_ERRORS();
+}
+
+void Versus::draw(glm::uvec2 drawable_size, float alpha) {
+	if (dirty) upload_course();
+
+	{ //collect what differs between racers (robot, checkpoints, and wins), batched by mesh, racer by racer:
+		glm::mat3 shear = glm::mat3(Board::shear);
+		racer_data.clear();
+		racer_batches.clear();
+		racer_batch_starts.clear();
+		for (uint32_t r = 0; r < racers.size(); ++r) {
+			Board const &board = racers[r].board;
+			racer_batch_starts.emplace_back(uint32_t(racer_batches.size()));
+			auto batch = [&](Mesh const *mesh, GLsizei first) {
+				if (GLsizei(racer_data.size()) == first) return;
+				racer_batches.emplace_back();
+				racer_batches.back().mesh = mesh;
+				racer_batches.back().first_instance = first;
+				racer_batches.back().instance_count = GLsizei(racer_data.size()) - first;
+			};
+
+			GLsizei first = GLsizei(racer_data.size());
+			racer_data.emplace_back(shear * glm::vec3(slides.at(r, alpha) + 0.5f, 0.0f), 1.0f);
+			batch(&meshes->player, first);
+
+			for (Mesh const *kind : { &meshes->checkpoint, &meshes->checkpoint_collected }) {
+				first = GLsizei(racer_data.size());
+				for (uint32_t y = 0; y < board.size.y; ++y) {
+					for (uint32_t x = 0; x < board.size.x; ++x) {
+						if (board.goal_meshes[y * board.size.x + x] != kind) continue;
+						racer_data.emplace_back(shear * glm::vec3(x + 0.5f, y + 0.5f, 0.0f), 1.0f);
+					}
+				}
+				batch(kind, first);
+			}
+
+			//rounds won, as little goals on the left edge of the board (where the single-player score goes):
+			first = GLsizei(racer_data.size());
+			for (uint32_t c = 0; c < racers[r].wins; ++c) {
+				float s = 0.25f;
+				glm::vec3 at = glm::vec3(
+					0.5f + (float(c % 4) - 2.0f + 0.5f) * (0.9f * s),
+					1.0f + ((c / 4) + 0.6f) * (0.9f * s),
+					1.0f
+				);
+				racer_data.emplace_back(shear * at, s);
+			}
+			batch(&meshes->goal, first);
+		}
+		racer_batch_starts.emplace_back(uint32_t(racer_batches.size()));
+	}
+
+	Profiler::mark(Profiler::Submit);
+
+	uint32_t players = uint32_t(racers.size());
+	shading->begin(world_to_clip(viewport(0, players, drawable_size), drawable_size));
+
+	instances_drawn = 0;
+	if (shading->tier == InstancedShading::Tier45) {
+		//each viewport draws the course's commands straight from its buffers, then queues its racer's instances:
+		for (uint32_t r = 0; r < players; ++r) {
+			shading->set_world_to_clip(world_to_clip(viewport(r, players, drawable_size), drawable_size));
+			shading->draw_indirect(course_vbo, course_commands, GLsizei(course_batches.size()));
+			instances_drawn += uint32_t(course_data.size());
+			for (uint32_t b = racer_batch_starts[r]; b < racer_batch_starts[r + 1]; ++b) {
+				Batch const &batch = racer_batches[b];
+				shading->queue(*batch.mesh, &racer_data[batch.first_instance], batch.instance_count);
+				instances_drawn += batch.instance_count;
+			}
+		}
+		shading->end();
+		GL_ERRORS();
+		return;
+	}
+
+	//every racer's instances go up in one piece:
+	racers_stream.begin_frame();
+	StreamBuffer::Allocation racers_at = racers_stream.write(racer_data.data(), racer_data.size() * sizeof(glm::vec4), sizeof(glm::vec4));
+	GLsizei racers_first = GLsizei(racers_at.offset / sizeof(glm::vec4));
+
+	//each viewport draws the same course instances (only world_to_clip changes), then its racer's:
+	for (uint32_t r = 0; r < players; ++r) {
+		shading->set_world_to_clip(world_to_clip(viewport(r, players, drawable_size), drawable_size));
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, course_vbo);
+		for (Batch const &batch : course_batches) {
+			shading->draw(*batch.mesh, batch.first_instance, batch.instance_count);
+			instances_drawn += batch.instance_count;
+		}
+		gl_state_BindBuffer(GL_ARRAY_BUFFER, racers_at.buffer);
+		for (uint32_t b = racer_batch_starts[r]; b < racer_batch_starts[r + 1]; ++b) {
+			Batch const &batch = racer_batches[b];
+			shading->draw(*batch.mesh, racers_first + batch.first_instance, batch.instance_count);
+			instances_drawn += batch.instance_count;
+		}
+	}
+	racers_stream.end_frame();
+
+	shading->end();
+
+	GL_ERRORS();
+}
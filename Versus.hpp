@@ -0,0 +1,103 @@
+#pragma once
+
+#include "GL.hpp"
+#include "Board.hpp"
+#include "InstancedShading.hpp"
+#include "SlideAnimations.hpp"
+#include "StreamBuffer.hpp"
+
+#include <SDL.h>
+#include <glm/glm.hpp>
+
+#include <random>
+#include <vector>
+
+//'Versus' is a local split-screen race: two to four players each slide around their own copy of the
+// same board (in their own viewport) and the first to reach the goal wins the round.
+// - The parts of the board that are the same for everyone (walls, floor, goop, goal) are uploaded to
+//   one instance buffer once per round, and every viewport draws that same buffer; only world_to_clip
+//   (which places the board in the viewport's corner of the screen) changes between viewports.
+// - Each player's robot, checkpoints (collected or not), and round wins are streamed every frame.
+// - Boards come from their own generator, so the single-player sequence isn't disturbed.
+struct Versus {
+	//creates OpenGL resources; 'meshes' and 'shading' must outlive the versus mode:
+	Versus(BoardMeshes const *meshes, InstancedShading *shading);
+	~Versus();
+
+	BoardMeshes const *meshes;
+	InstancedShading *shading; //(not const: Tier45 queues instances into its ring)
+
+	//------- game state -------
+
+	static constexpr uint32_t MaxPlayers = 4;
+
+	struct Racer {
+		Racer(Board const &course) : board(course) { }
+		Board board; //(a copy of the course, so checkpoints are collected separately)
+		glm::ivec2 sliding_move = glm::ivec2(0); //move being animated (zero if none)
+		MoveQueue queued_moves; //moves entered during a slide
+		uint32_t wins = 0; //rounds won
+	};
+	std::vector< Racer > racers;
+	SlideAnimations slides; //(slides[i] is racers[i]'s robot)
+
+	Board course; //the layout every racer starts the round on
+	std::mt19937 mt = std::mt19937(0x5e25a5);
+	uint32_t winner = -1U; //racer that reached the goal first this round (-1U while racing)
+
+	//start over with 'players' racers (clamped to [2,MaxPlayers]):
+	void start(uint32_t players);
+	//new course (starting from where the last one was won), every racer back at the start:
+	void next_round();
+
+	//slide keys for each player (in order: left, right, down, up):
+	static SDL_Scancode const Keys[MaxPlayers][4];
+	//returns true if the key did something (a move, a new round, or a new number of players):
+	bool handle_key(SDL_Scancode key);
+
+	void tick(float dt); //advance every racer's slide by one fixed timestep
+	bool animating() const;
+
+	//------- drawing -------
+
+	//screen rectangle (in pixels) of each player's viewport:
+	struct Viewport {
+		glm::uvec2 min = glm::uvec2(0);
+		glm::uvec2 size = glm::uvec2(0);
+	};
+	static Viewport viewport(uint32_t player, uint32_t players, glm::uvec2 drawable_size);
+	//fits the course into 'viewport' (which is where it goes in clip space; nothing else changes per viewport):
+	glm::mat4 world_to_clip(Viewport const &viewport, glm::uvec2 drawable_size) const;
+
+	//'alpha' is how far (in [0,1]) the frame is between the last two ticks:
+	void draw(glm::uvec2 drawable_size, float alpha);
+
+	//one instanced draw:
+	struct Batch {
+		Mesh const *mesh = nullptr;
+		GLsizei first_instance = 0;
+		GLsizei instance_count = 0;
+	};
+
+	//the course's unchanging meshes, one batch per mesh type (uploaded when 'dirty'):
+	std::vector< glm::vec4 > course_data;
+	std::vector< Batch > course_batches;
+	bool dirty = true;
+	void upload_course();
+
+	//everything that differs between racers, rebuilt every frame (racer i's batches are
+	// racer_batches[racer_batch_starts[i]] up to racer_batch_starts[i+1]):
+	std::vector< glm::vec4 > racer_data;
+	std::vector< Batch > racer_batches;
+	std::vector< uint32_t > racer_batch_starts;
+
+	//drawing stats from the last frame:
+	uint32_t instances_drawn = 0;
+	uint32_t course_uploads = 0; //(ever)
+
+	//------- opengl resources -------
+
+	GLuint course_vbo = -1U; //course instances (rewritten once per round)
+	GLuint course_commands = -1U; //one InstancedShading::DrawCommand per course batch (Tier45)
+	StreamBuffer racers_stream{ "versus racers", 4 << 10 }; //racer instances, streamed every frame (Tier33)
+};
@@ -0,0 +1,309 @@
+#include "compile_program.hpp"
+
+#include "data_path.hpp" //helper to get paths relative to executable
+#include "gl_extensions.hpp" //helpers to check what the context supports
+
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+#include <cerrno>
+#include <cstdio>
+#include <cstring>
+
+#include <algorithm>
+#include <fstream>
+#include <iostream>
+#include <stdexcept>
+#include <vector>
+
+//program binaries (glGetProgramBinary/glProgramBinary, core since GL 4.1) aren't loaded by the
+// Windows shims, and programs loaded from binaries would be missing from GL_RECORD recordings:
+#if !defined(_WIN32) && !defined(GL_RECORD)
+#define PROGRAM_CACHE
+#endif
+
+//can the driver compile and link in the background? (GL_KHR_parallel_shader_compile, or the equivalent ARB extension)
+// (checked once; also asks the driver to use as many threads as it likes)
+static bool parallel_compile_supported() {
+	static int supported = -1;
+	if (supported == -1) {
+		supported = 0;
+		#if !defined(_WIN32) //(the Windows shims only load GL 3.3 functions)
+		if (gl_has_extension("GL_ARB_parallel_shader_compile")) {
+			glMaxShaderCompilerThreadsARB(0xffffffff);
+			supported = 1;
+		} else if (gl_has_extension("GL_KHR_parallel_shader_compile")) {
+			//(same enum as the ARB version; the thread count is left at the driver's default)
+			supported = 1;
+		}
+		#endif
+	}
+	return supported == 1;
+}
+
+//returns false (after printing the info log) if a shader didn't compile:
+static bool shader_compiled(GLuint shader) {
+	GLint compile_status = GL_FALSE;
+	glGetShaderiv(shader, GL_COMPILE_STATUS, &compile_status);
+	if (compile_status != GL_TRUE) {
+		std::cerr << "Failed to compile shader." << std::endl;
+		GLint info_log_length = 0;
+		glGetShaderiv(shader, GL_INFO_LOG_LENGTH, &info_log_length);
+		std::vector< GLchar > info_log(info_log_length, 0);
+		GLsizei length = 0;
+		glGetShaderInfoLog(shader, GLsizei(info_log.size()), &length, &info_log[0]);
+		std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
+		return false;
+	}
+	return true;
+}
+
+//create an OpenGL shader and start compiling it from source:
+static GLuint start_shader(GLenum type, std::string const &source) {
+	GLuint shader = glCreateShader(type);
+	GLchar const *str = source.c_str();
+	GLint length = GLint(source.size());
+	glShaderSource(shader, 1, &str, &length);
+	glCompileShader(shader);
+	return shader;
+}
+
+//create and return an OpenGL shader from source:
+GLuint compile_shader(GLenum type, std::string const &source) {
+	GLuint shader = start_shader(type, source);
+	if (!shader_compiled(shader)) {
+		glDeleteShader(shader);
+		throw std::runtime_error("Failed to compile shader.");
+	}
+	return shader;
+}
+
+#ifdef PROGRAM_CACHE
+//------------ program binary cache ------------
+//Linked programs are saved to data_path("shader-cache/") as "<key>.bin", where the key hashes the
+// sources along with the driver's vendor, renderer, and version strings (so a driver update, or
+// running on another GPU, just misses the cache). Binaries the driver rejects are deleted and the
+// program is compiled from source as usual.
+
+namespace {
+	constexpr char ProgramCacheMagic[8] = { 'P', 'R', 'O', 'G', 'B', 'I', 'N', '1' };
+
+	//does the context support program binaries? (checked once; GL 4.1 or ARB_get_program_binary, with at least one format)
+	bool program_cache_supported() {
+		static int supported = -1;
+		if (supported == -1) {
+			supported = 0;
+			bool binaries = gl_version_at_least(4, 1) || gl_has_extension("GL_ARB_get_program_binary");
+			if (binaries) {
+				GLint formats = 0;
+				glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &formats);
+				if (formats > 0) supported = 1;
+			}
+		}
+		return supported == 1;
+	}
+
+	//64-bit FNV-1a, over the sources and the driver's strings:
+	std::string program_cache_key(std::string const &vertex_source, std::string const &fragment_source) {
+		uint64_t hash = 0xcbf29ce484222325ULL;
+		auto add = [&hash](char const *str, size_t size) {
+			for (size_t i = 0; i < size; ++i) {
+				hash = (hash ^ uint8_t(str[i])) * 0x100000001b3ULL;
+			}
+			hash = (hash ^ 0xff) * 0x100000001b3ULL; //(separator, so "ab"+"c" differs from "a"+"bc")
+		};
+		add(vertex_source.data(), vertex_source.size());
+		add(fragment_source.data(), fragment_source.size());
+		for (GLenum name : { GL_VENDOR, GL_RENDERER, GL_VERSION }) {
+			char const *str = reinterpret_cast< char const * >(glGetString(name));
+			if (!str) str = "";
+			add(str, std::strlen(str));
+		}
+		char hex[17];
+		snprintf(hex, sizeof(hex), "%016llx", (unsigned long long)hash);
+		return hex;
+	}
+
+	std::string program_cache_path(std::string const &key) {
+		return data_path("shader-cache/" + key + ".bin");
+	}
+
+	//returns a linked program from the cache, or 0 if there isn't a usable one:
+	GLuint load_cached_program(std::string const &key) {
+		std::string path = program_cache_path(key);
+		std::ifstream file(path, std::ios::binary);
+		if (!file) return 0;
+
+		//file is: magic, uint32 binary format, then the binary:
+		char magic[sizeof(ProgramCacheMagic)];
+		uint32_t format = 0;
+		if (!file.read(magic, sizeof(magic)) || std::memcmp(magic, ProgramCacheMagic, sizeof(magic)) != 0
+		 || !file.read(reinterpret_cast< char * >(&format), sizeof(format))) {
+			std::cerr << "NOTE: ignoring malformed cached program '" << path << "'." << std::endl;
+			return 0;
+		}
+		std::vector< char > binary((std::istreambuf_iterator< char >(file)), std::istreambuf_iterator< char >());
+		file.close();
+
+		//(glProgramBinary fails with an error, rather than just not linking, for formats the driver doesn't list)
+		GLint format_count = 0;
+		glGetIntegerv(GL_NUM_PROGRAM_BINARY_FORMATS, &format_count);
+		std::vector< GLint > formats(std::max(format_count, 0));
+		if (!formats.empty()) glGetIntegerv(GL_PROGRAM_BINARY_FORMATS, formats.data());
+
+		GLuint program = 0;
+		if (std::find(formats.begin(), formats.end(), GLint(format)) != formats.end() && !binary.empty()) {
+			program = glCreateProgram();
+			glProgramBinary(program, GLenum(format), binary.data(), GLsizei(binary.size()));
+			GLint link_status = GL_FALSE;
+			glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+			if (link_status != GL_TRUE) {
+				glDeleteProgram(program);
+				program = 0;
+			}
+		}
+		if (program == 0) {
+			std::cerr << "NOTE: driver rejected cached program '" << path << "'; compiling from source." << std::endl;
+			std::remove(path.c_str());
+		}
+		return program;
+	}
+
+	void save_cached_program(std::string const &key, GLuint program) {
+		GLint length = 0;
+		glGetProgramiv(program, GL_PROGRAM_BINARY_LENGTH, &length);
+		if (length <= 0) return;
+		std::vector< char > binary(length);
+		GLenum format = 0;
+		GLsizei got = 0;
+		glGetProgramBinary(program, length, &got, &format, binary.data());
+		if (got <= 0) return;
+		binary.resize(got);
+
+		std::string dir = data_path("shader-cache");
+		#if defined(_WIN32)
+		int made = _mkdir(dir.c_str());
+		#else
+		int made = mkdir(dir.c_str(), 0755);
+		#endif
+		if (made != 0 && errno != EEXIST) {
+			std::cerr << "NOTE: can't create '" << dir << "', so programs won't be cached." << std::endl;
+			return;
+		}
+
+		//written to a temporary file first, so a crash (or another instance) never leaves a partial binary under the real name:
+		std::string path = program_cache_path(key);
+		std::string temp = path + ".tmp";
+		{
+			std::ofstream file(temp, std::ios::binary);
+			uint32_t format_ = format;
+			file.write(ProgramCacheMagic, sizeof(ProgramCacheMagic));
+			file.write(reinterpret_cast< char const * >(&format_), sizeof(format_));
+			file.write(binary.data(), binary.size());
+			if (!file) {
+				std::cerr << "NOTE: failed to write cached program '" << temp << "'." << std::endl;
+				file.close();
+				std::remove(temp.c_str());
+				return;
+			}
+		}
+		if (std::rename(temp.c_str(), path.c_str()) != 0) {
+			std::remove(temp.c_str());
+		}
+	}
+}
+#endif //PROGRAM_CACHE
+
+PendingProgram start_program(std::string const &vertex_source, std::string const &fragment_source) {
+	PendingProgram pending;
+
+	#ifdef PROGRAM_CACHE
+	if (program_cache_supported()) {
+		pending.cache_key = program_cache_key(vertex_source, fragment_source);
+		pending.program = load_cached_program(pending.cache_key);
+		if (pending.program != 0) {
+			pending.cache_key = ""; //(already cached)
+			return pending;
+		}
+	}
+	#endif //PROGRAM_CACHE
+
+	parallel_compile_supported(); //(so the driver knows it may use threads before the first compile)
+
+	//start everything, and only check on it in finish_program (so a driver with background compiles can get on with it):
+	pending.vertex_shader = start_shader(GL_VERTEX_SHADER, vertex_source);
+	pending.fragment_shader = start_shader(GL_FRAGMENT_SHADER, fragment_source);
+
+	pending.program = glCreateProgram();
+	glAttachShader(pending.program, pending.vertex_shader);
+	glAttachShader(pending.program, pending.fragment_shader);
+
+	#ifdef PROGRAM_CACHE
+	//(lets the driver know the binary will be retrieved; some keep extra information around for it)
+	if (pending.cache_key != "") glProgramParameteri(pending.program, GL_PROGRAM_BINARY_RETRIEVABLE_HINT, GL_TRUE);
+	#endif //PROGRAM_CACHE
+
+	glLinkProgram(pending.program);
+
+	return pending;
+}
+
+bool program_ready(PendingProgram const &pending) {
+	if (pending.vertex_shader == 0 || !parallel_compile_supported()) return true;
+	#if defined(_WIN32)
+	return true; //(not reached: parallel_compile_supported() is always false with the shims)
+	#else
+	GLint done = GL_FALSE;
+	glGetProgramiv(pending.program, GL_COMPLETION_STATUS_ARB, &done);
+	return done == GL_TRUE;
+	#endif
+}
+
+GLuint finish_program(PendingProgram &pending) {
+	GLuint program = pending.program;
+	GLuint vertex_shader = pending.vertex_shader;
+	GLuint fragment_shader = pending.fragment_shader;
+	std::string cache_key = pending.cache_key;
+	pending = PendingProgram();
+
+	if (vertex_shader == 0) return program; //(loaded from the cache, so already checked)
+
+	//shaders are reference counted so this makes sure they are freed after program is deleted:
+	// (they can still be checked until then)
+	glDeleteShader(vertex_shader);
+	glDeleteShader(fragment_shader);
+
+	//report compile errors before link errors (they explain them):
+	if (!shader_compiled(vertex_shader) || !shader_compiled(fragment_shader)) {
+		glDeleteProgram(program);
+		throw std::runtime_error("Failed to compile shader.");
+	}
+
+	//throw errors if linking failed:
+	GLint link_status = GL_FALSE;
+	glGetProgramiv(program, GL_LINK_STATUS, &link_status);
+	if (link_status != GL_TRUE) {
+		std::cerr << "Failed to link shader program." << std::endl;
+		GLint info_log_length = 0;
+		glGetProgramiv(program, GL_INFO_LOG_LENGTH, &info_log_length);
+		std::vector< GLchar > info_log(info_log_length, 0);
+		GLsizei length = 0;
+		glGetProgramInfoLog(program, GLsizei(info_log.size()), &length, &info_log[0]);
+		std::cerr << "Info log: " << std::string(info_log.begin(), info_log.begin() + length);
+		glDeleteProgram(program);
+		throw std::runtime_error("failed to link program");
+	}
+
+	#ifdef PROGRAM_CACHE
+	if (cache_key != "") save_cached_program(cache_key, program);
+	#endif //PROGRAM_CACHE
+
+	return program;
+}
+
+GLuint compile_program(std::string const &vertex_source, std::string const &fragment_source) {
+	PendingProgram pending = start_program(vertex_source, fragment_source);
+	return finish_program(pending);
+}
@@ -0,0 +1,33 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <string>
+
+//compile_shader creates and compiles a shader object from source;
+// throws (after printing the info log) if compilation fails:
+GLuint compile_shader(GLenum type, std::string const &source);
+
+//compile_program compiles and links a vertex+fragment program;
+// throws (after printing the info log) if compilation or linking fails.
+//When the driver supports program binaries, linked programs are cached in data_path("shader-cache/")
+// and loaded from there on later runs (see compile_program.cpp):
+GLuint compile_program(std::string const &vertex_source, std::string const &fragment_source);
+
+//PendingProgram is a program that may still be compiling and linking (see start_program):
+struct PendingProgram {
+	GLuint program = 0;
+	GLuint vertex_shader = 0; //(0 if the program came from the cache)
+	GLuint fragment_shader = 0;
+	std::string cache_key; //(empty if the program won't be cached)
+};
+
+//start_program starts compiling and linking a program without waiting for the results, so drivers with
+// GL_KHR_parallel_shader_compile can work on several programs (in the background) at once:
+PendingProgram start_program(std::string const &vertex_source, std::string const &fragment_source);
+
+//program_ready returns true once finish_program won't have to wait (always true without parallel compiles):
+bool program_ready(PendingProgram const &pending);
+
+//finish_program waits for a program, checks it (and throws) like compile_program, and returns it:
+GLuint finish_program(PendingProgram &pending);
@@ -0,0 +1,17 @@
+#version 330
+uniform mat4 world_to_clip;
+uniform mat3 shear;
+uniform vec3 offset;
+//attribute locations are fixed, so a reloaded shader still matches the vertex array built for the first one:
+layout(location=0) in vec4 Position;
+layout(location=1) in vec3 Normal;
+layout(location=2) in vec4 Color;
+layout(location=3) in vec4 Instance; //xyz: (sheared) offset, w: scale
+out vec3 normal;
+out vec4 color;
+void main() {
+	vec3 position = offset + Instance.xyz + shear * (Instance.w * Position.xyz);
+	gl_Position = world_to_clip * vec4(position, 1.0);
+	normal = Normal; //(instances are only translated and uniformly scaled, so lighting happens in object space)
+	color = Color;
+}
@@ -0,0 +1,17 @@
+#version 330
+uniform mat4 object_to_clip;
+uniform mat4x3 object_to_light;
+uniform mat3 normal_to_light;
+//attribute locations are fixed, so a reloaded shader still matches the vertex array built for the first one:
+layout(location=0) in vec4 Position;
+layout(location=1) in vec3 Normal;
+layout(location=2) in vec4 Color;
+out vec3 position;
+out vec3 normal;
+out vec4 color;
+void main() {
+	gl_Position = object_to_clip * Position;
+	position = object_to_light * Position;
+	normal = normal_to_light * Normal;
+	color = Color;
+}
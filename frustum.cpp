@@ -0,0 +1,25 @@
+#include "frustum.hpp"
+
+bool box_in_frustum(glm::mat4 const &to_clip, glm::vec3 const &min, glm::vec3 const &max) {
+	glm::vec4 corners[8];
+	for (uint32_t i = 0; i < 8; ++i) {
+		corners[i] = to_clip * glm::vec4(
+			(i & 1 ? max.x : min.x),
+			(i & 2 ? max.y : min.y),
+			(i & 4 ? max.z : min.z),
+			1.0f
+		);
+	}
+
+	//the box is outside if every corner is on the outside of the same plane (-w <= x,y,z <= w):
+	for (uint32_t axis = 0; axis < 3; ++axis) {
+		bool all_below = true;
+		bool all_above = true;
+		for (glm::vec4 const &c : corners) {
+			if (c[axis] >= -c.w) all_below = false;
+			if (c[axis] <= c.w) all_above = false;
+		}
+		if (all_below || all_above) return false;
+	}
+	return true;
+}
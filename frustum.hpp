@@ -0,0 +1,9 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+//box_in_frustum returns false only if the axis-aligned box [min,max], transformed by 'to_clip',
+// is entirely outside the view volume (so it can safely be skipped when drawing).
+//It tests the box's eight corners against each clip plane in turn, so it may keep a few boxes
+// that are actually off-screen (near frustum corners), but it never culls a visible one.
+bool box_in_frustum(glm::mat4 const &to_clip, glm::vec3 const &min, glm::vec3 const &max);
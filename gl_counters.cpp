@@ -0,0 +1,5 @@
+//storage for the counts kept by gl_counters.hpp's wrappers (nothing, unless built with GL_COUNTERS):
+#ifdef GL_COUNTERS
+#define GL_COUNTERS_IMPLEMENTATION
+#include "GL.hpp"
+#endif
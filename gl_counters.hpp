@@ -0,0 +1,1413 @@
+#pragma once
+//NOTE: generated by 'make-gl-shims.py --counters'; don't edit by hand.
+
+//gl_counters.hpp wraps every core OpenGL (through 3.3) entry point with a version that counts
+// calls (per entry point), bytes uploaded through glBuffer*Data and glUniform*, and draw calls
+// and vertices. It is only used when GL_COUNTERS is defined (see GL.hpp); the Profiler reads
+// and resets the counts once per frame.
+
+#include <cstdint>
+
+enum GLCounter : uint32_t {
+	GLCounter_CullFace,
+	GLCounter_FrontFace,
+	GLCounter_Hint,
+	GLCounter_LineWidth,
+	GLCounter_PointSize,
+	GLCounter_PolygonMode,
+	GLCounter_Scissor,
+	GLCounter_TexParameterf,
+	GLCounter_TexParameterfv,
+	GLCounter_TexParameteri,
+	GLCounter_TexParameteriv,
+	GLCounter_TexImage1D,
+	GLCounter_TexImage2D,
+	GLCounter_DrawBuffer,
+	GLCounter_Clear,
+	GLCounter_ClearColor,
+	GLCounter_ClearStencil,
+	GLCounter_ClearDepth,
+	GLCounter_StencilMask,
+	GLCounter_ColorMask,
+	GLCounter_DepthMask,
+	GLCounter_Disable,
+	GLCounter_Enable,
+	GLCounter_Finish,
+	GLCounter_Flush,
+	GLCounter_BlendFunc,
+	GLCounter_LogicOp,
+	GLCounter_StencilFunc,
+	GLCounter_StencilOp,
+	GLCounter_DepthFunc,
+	GLCounter_PixelStoref,
+	GLCounter_PixelStorei,
+	GLCounter_ReadBuffer,
+	GLCounter_ReadPixels,
+	GLCounter_GetBooleanv,
+	GLCounter_GetDoublev,
+	GLCounter_GetError,
+	GLCounter_GetFloatv,
+	GLCounter_GetIntegerv,
+	GLCounter_GetString,
+	GLCounter_GetTexImage,
+	GLCounter_GetTexParameterfv,
+	GLCounter_GetTexParameteriv,
+	GLCounter_GetTexLevelParameterfv,
+	GLCounter_GetTexLevelParameteriv,
+	GLCounter_IsEnabled,
+	GLCounter_DepthRange,
+	GLCounter_Viewport,
+	GLCounter_DrawArrays,
+	GLCounter_DrawElements,
+	GLCounter_GetPointerv,
+	GLCounter_PolygonOffset,
+	GLCounter_CopyTexImage1D,
+	GLCounter_CopyTexImage2D,
+	GLCounter_CopyTexSubImage1D,
+	GLCounter_CopyTexSubImage2D,
+	GLCounter_TexSubImage1D,
+	GLCounter_TexSubImage2D,
+	GLCounter_BindTexture,
+	GLCounter_DeleteTextures,
+	GLCounter_GenTextures,
+	GLCounter_IsTexture,
+	GLCounter_DrawRangeElements,
+	GLCounter_TexImage3D,
+	GLCounter_TexSubImage3D,
+	GLCounter_CopyTexSubImage3D,
+	GLCounter_ActiveTexture,
+	GLCounter_SampleCoverage,
+	GLCounter_CompressedTexImage3D,
+	GLCounter_CompressedTexImage2D,
+	GLCounter_CompressedTexImage1D,
+	GLCounter_CompressedTexSubImage3D,
+	GLCounter_CompressedTexSubImage2D,
+	GLCounter_CompressedTexSubImage1D,
+	GLCounter_GetCompressedTexImage,
+	GLCounter_BlendFuncSeparate,
+	GLCounter_MultiDrawArrays,
+	GLCounter_MultiDrawElements,
+	GLCounter_PointParameterf,
+	GLCounter_PointParameterfv,
+	GLCounter_PointParameteri,
+	GLCounter_PointParameteriv,
+	GLCounter_BlendColor,
+	GLCounter_BlendEquation,
+	GLCounter_GenQueries,
+	GLCounter_DeleteQueries,
+	GLCounter_IsQuery,
+	GLCounter_BeginQuery,
+	GLCounter_EndQuery,
+	GLCounter_GetQueryiv,
+	GLCounter_GetQueryObjectiv,
+	GLCounter_GetQueryObjectuiv,
+	GLCounter_BindBuffer,
+	GLCounter_DeleteBuffers,
+	GLCounter_GenBuffers,
+	GLCounter_IsBuffer,
+	GLCounter_BufferData,
+	GLCounter_BufferSubData,
+	GLCounter_GetBufferSubData,
+	GLCounter_MapBuffer,
+	GLCounter_UnmapBuffer,
+	GLCounter_GetBufferParameteriv,
+	GLCounter_GetBufferPointerv,
+	GLCounter_BlendEquationSeparate,
+	GLCounter_DrawBuffers,
+	GLCounter_StencilOpSeparate,
+	GLCounter_StencilFuncSeparate,
+	GLCounter_StencilMaskSeparate,
+	GLCounter_AttachShader,
+	GLCounter_BindAttribLocation,
+	GLCounter_CompileShader,
+	GLCounter_CreateProgram,
+	GLCounter_CreateShader,
+	GLCounter_DeleteProgram,
+	GLCounter_DeleteShader,
+	GLCounter_DetachShader,
+	GLCounter_DisableVertexAttribArray,
+	GLCounter_EnableVertexAttribArray,
+	GLCounter_GetActiveAttrib,
+	GLCounter_GetActiveUniform,
+	GLCounter_GetAttachedShaders,
+	GLCounter_GetAttribLocation,
+	GLCounter_GetProgramiv,
+	GLCounter_GetProgramInfoLog,
+	GLCounter_GetShaderiv,
+	GLCounter_GetShaderInfoLog,
+	GLCounter_GetShaderSource,
+	GLCounter_GetUniformLocation,
+	GLCounter_GetUniformfv,
+	GLCounter_GetUniformiv,
+	GLCounter_GetVertexAttribdv,
+	GLCounter_GetVertexAttribfv,
+	GLCounter_GetVertexAttribiv,
+	GLCounter_GetVertexAttribPointerv,
+	GLCounter_IsProgram,
+	GLCounter_IsShader,
+	GLCounter_LinkProgram,
+	GLCounter_ShaderSource,
+	GLCounter_UseProgram,
+	GLCounter_Uniform1f,
+	GLCounter_Uniform2f,
+	GLCounter_Uniform3f,
+	GLCounter_Uniform4f,
+	GLCounter_Uniform1i,
+	GLCounter_Uniform2i,
+	GLCounter_Uniform3i,
+	GLCounter_Uniform4i,
+	GLCounter_Uniform1fv,
+	GLCounter_Uniform2fv,
+	GLCounter_Uniform3fv,
+	GLCounter_Uniform4fv,
+	GLCounter_Uniform1iv,
+	GLCounter_Uniform2iv,
+	GLCounter_Uniform3iv,
+	GLCounter_Uniform4iv,
+	GLCounter_UniformMatrix2fv,
+	GLCounter_UniformMatrix3fv,
+	GLCounter_UniformMatrix4fv,
+	GLCounter_ValidateProgram,
+	GLCounter_VertexAttrib1d,
+	GLCounter_VertexAttrib1dv,
+	GLCounter_VertexAttrib1f,
+	GLCounter_VertexAttrib1fv,
+	GLCounter_VertexAttrib1s,
+	GLCounter_VertexAttrib1sv,
+	GLCounter_VertexAttrib2d,
+	GLCounter_VertexAttrib2dv,
+	GLCounter_VertexAttrib2f,
+	GLCounter_VertexAttrib2fv,
+	GLCounter_VertexAttrib2s,
+	GLCounter_VertexAttrib2sv,
+	GLCounter_VertexAttrib3d,
+	GLCounter_VertexAttrib3dv,
+	GLCounter_VertexAttrib3f,
+	GLCounter_VertexAttrib3fv,
+	GLCounter_VertexAttrib3s,
+	GLCounter_VertexAttrib3sv,
+	GLCounter_VertexAttrib4Nbv,
+	GLCounter_VertexAttrib4Niv,
+	GLCounter_VertexAttrib4Nsv,
+	GLCounter_VertexAttrib4Nub,
+	GLCounter_VertexAttrib4Nubv,
+	GLCounter_VertexAttrib4Nuiv,
+	GLCounter_VertexAttrib4Nusv,
+	GLCounter_VertexAttrib4bv,
+	GLCounter_VertexAttrib4d,
+	GLCounter_VertexAttrib4dv,
+	GLCounter_VertexAttrib4f,
+	GLCounter_VertexAttrib4fv,
+	GLCounter_VertexAttrib4iv,
+	GLCounter_VertexAttrib4s,
+	GLCounter_VertexAttrib4sv,
+	GLCounter_VertexAttrib4ubv,
+	GLCounter_VertexAttrib4uiv,
+	GLCounter_VertexAttrib4usv,
+	GLCounter_VertexAttribPointer,
+	GLCounter_UniformMatrix2x3fv,
+	GLCounter_UniformMatrix3x2fv,
+	GLCounter_UniformMatrix2x4fv,
+	GLCounter_UniformMatrix4x2fv,
+	GLCounter_UniformMatrix3x4fv,
+	GLCounter_UniformMatrix4x3fv,
+	GLCounter_ColorMaski,
+	GLCounter_GetBooleani_v,
+	GLCounter_GetIntegeri_v,
+	GLCounter_Enablei,
+	GLCounter_Disablei,
+	GLCounter_IsEnabledi,
+	GLCounter_BeginTransformFeedback,
+	GLCounter_EndTransformFeedback,
+	GLCounter_BindBufferRange,
+	GLCounter_BindBufferBase,
+	GLCounter_TransformFeedbackVaryings,
+	GLCounter_GetTransformFeedbackVarying,
+	GLCounter_ClampColor,
+	GLCounter_BeginConditionalRender,
+	GLCounter_EndConditionalRender,
+	GLCounter_VertexAttribIPointer,
+	GLCounter_GetVertexAttribIiv,
+	GLCounter_GetVertexAttribIuiv,
+	GLCounter_VertexAttribI1i,
+	GLCounter_VertexAttribI2i,
+	GLCounter_VertexAttribI3i,
+	GLCounter_VertexAttribI4i,
+	GLCounter_VertexAttribI1ui,
+	GLCounter_VertexAttribI2ui,
+	GLCounter_VertexAttribI3ui,
+	GLCounter_VertexAttribI4ui,
+	GLCounter_VertexAttribI1iv,
+	GLCounter_VertexAttribI2iv,
+	GLCounter_VertexAttribI3iv,
+	GLCounter_VertexAttribI4iv,
+	GLCounter_VertexAttribI1uiv,
+	GLCounter_VertexAttribI2uiv,
+	GLCounter_VertexAttribI3uiv,
+	GLCounter_VertexAttribI4uiv,
+	GLCounter_VertexAttribI4bv,
+	GLCounter_VertexAttribI4sv,
+	GLCounter_VertexAttribI4ubv,
+	GLCounter_VertexAttribI4usv,
+	GLCounter_GetUniformuiv,
+	GLCounter_BindFragDataLocation,
+	GLCounter_GetFragDataLocation,
+	GLCounter_Uniform1ui,
+	GLCounter_Uniform2ui,
+	GLCounter_Uniform3ui,
+	GLCounter_Uniform4ui,
+	GLCounter_Uniform1uiv,
+	GLCounter_Uniform2uiv,
+	GLCounter_Uniform3uiv,
+	GLCounter_Uniform4uiv,
+	GLCounter_TexParameterIiv,
+	GLCounter_TexParameterIuiv,
+	GLCounter_GetTexParameterIiv,
+	GLCounter_GetTexParameterIuiv,
+	GLCounter_ClearBufferiv,
+	GLCounter_ClearBufferuiv,
+	GLCounter_ClearBufferfv,
+	GLCounter_ClearBufferfi,
+	GLCounter_GetStringi,
+	GLCounter_IsRenderbuffer,
+	GLCounter_BindRenderbuffer,
+	GLCounter_DeleteRenderbuffers,
+	GLCounter_GenRenderbuffers,
+	GLCounter_RenderbufferStorage,
+	GLCounter_GetRenderbufferParameteriv,
+	GLCounter_IsFramebuffer,
+	GLCounter_BindFramebuffer,
+	GLCounter_DeleteFramebuffers,
+	GLCounter_GenFramebuffers,
+	GLCounter_CheckFramebufferStatus,
+	GLCounter_FramebufferTexture1D,
+	GLCounter_FramebufferTexture2D,
+	GLCounter_FramebufferTexture3D,
+	GLCounter_FramebufferRenderbuffer,
+	GLCounter_GetFramebufferAttachmentParameteriv,
+	GLCounter_GenerateMipmap,
+	GLCounter_BlitFramebuffer,
+	GLCounter_RenderbufferStorageMultisample,
+	GLCounter_FramebufferTextureLayer,
+	GLCounter_MapBufferRange,
+	GLCounter_FlushMappedBufferRange,
+	GLCounter_BindVertexArray,
+	GLCounter_DeleteVertexArrays,
+	GLCounter_GenVertexArrays,
+	GLCounter_IsVertexArray,
+	GLCounter_DrawArraysInstanced,
+	GLCounter_DrawElementsInstanced,
+	GLCounter_TexBuffer,
+	GLCounter_PrimitiveRestartIndex,
+	GLCounter_CopyBufferSubData,
+	GLCounter_GetUniformIndices,
+	GLCounter_GetActiveUniformsiv,
+	GLCounter_GetActiveUniformName,
+	GLCounter_GetUniformBlockIndex,
+	GLCounter_GetActiveUniformBlockiv,
+	GLCounter_GetActiveUniformBlockName,
+	GLCounter_UniformBlockBinding,
+	GLCounter_DrawElementsBaseVertex,
+	GLCounter_DrawRangeElementsBaseVertex,
+	GLCounter_DrawElementsInstancedBaseVertex,
+	GLCounter_MultiDrawElementsBaseVertex,
+	GLCounter_ProvokingVertex,
+	GLCounter_FenceSync,
+	GLCounter_IsSync,
+	GLCounter_DeleteSync,
+	GLCounter_ClientWaitSync,
+	GLCounter_WaitSync,
+	GLCounter_GetInteger64v,
+	GLCounter_GetSynciv,
+	GLCounter_GetInteger64i_v,
+	GLCounter_GetBufferParameteri64v,
+	GLCounter_FramebufferTexture,
+	GLCounter_TexImage2DMultisample,
+	GLCounter_TexImage3DMultisample,
+	GLCounter_GetMultisamplefv,
+	GLCounter_SampleMaski,
+	GLCounter_BindFragDataLocationIndexed,
+	GLCounter_GetFragDataIndex,
+	GLCounter_GenSamplers,
+	GLCounter_DeleteSamplers,
+	GLCounter_IsSampler,
+	GLCounter_BindSampler,
+	GLCounter_SamplerParameteri,
+	GLCounter_SamplerParameteriv,
+	GLCounter_SamplerParameterf,
+	GLCounter_SamplerParameterfv,
+	GLCounter_SamplerParameterIiv,
+	GLCounter_SamplerParameterIuiv,
+	GLCounter_GetSamplerParameteriv,
+	GLCounter_GetSamplerParameterIiv,
+	GLCounter_GetSamplerParameterfv,
+	GLCounter_GetSamplerParameterIuiv,
+	GLCounter_QueryCounter,
+	GLCounter_GetQueryObjecti64v,
+	GLCounter_GetQueryObjectui64v,
+	GLCounter_VertexAttribDivisor,
+	GLCounter_VertexAttribP1ui,
+	GLCounter_VertexAttribP1uiv,
+	GLCounter_VertexAttribP2ui,
+	GLCounter_VertexAttribP2uiv,
+	GLCounter_VertexAttribP3ui,
+	GLCounter_VertexAttribP3uiv,
+	GLCounter_VertexAttribP4ui,
+	GLCounter_VertexAttribP4uiv,
+	GLCounterCount
+};
+
+struct GLCounters {
+	uint64_t calls[GLCounterCount]; //calls to each entry point
+	uint64_t buffer_bytes; //bytes uploaded through glBufferData/glBufferSubData (not counting allocations without data)
+	uint64_t uniform_bytes; //bytes passed to glUniform*
+	uint64_t draws; //draw calls (each draw in a multi-draw counts)
+	uint64_t vertices; //vertices drawn (times instances)
+};
+extern GLCounters gl_counters;
+extern char const *const GLCounterNames[GLCounterCount]; //(entry point names, including 'gl')
+
+//wrappers call the real entry points (so must be declared before the names are redirected):
+inline void APIENTRY gl_counted_CullFace(GLenum mode) { ++gl_counters.calls[GLCounter_CullFace]; return glCullFace(mode); }
+inline void APIENTRY gl_counted_FrontFace(GLenum mode) { ++gl_counters.calls[GLCounter_FrontFace]; return glFrontFace(mode); }
+inline void APIENTRY gl_counted_Hint(GLenum target, GLenum mode) { ++gl_counters.calls[GLCounter_Hint]; return glHint(target, mode); }
+inline void APIENTRY gl_counted_LineWidth(GLfloat width) { ++gl_counters.calls[GLCounter_LineWidth]; return glLineWidth(width); }
+inline void APIENTRY gl_counted_PointSize(GLfloat size) { ++gl_counters.calls[GLCounter_PointSize]; return glPointSize(size); }
+inline void APIENTRY gl_counted_PolygonMode(GLenum face, GLenum mode) { ++gl_counters.calls[GLCounter_PolygonMode]; return glPolygonMode(face, mode); }
+inline void APIENTRY gl_counted_Scissor(GLint x, GLint y, GLsizei width, GLsizei height) { ++gl_counters.calls[GLCounter_Scissor]; return glScissor(x, y, width, height); }
+inline void APIENTRY gl_counted_TexParameterf(GLenum target, GLenum pname, GLfloat param) { ++gl_counters.calls[GLCounter_TexParameterf]; return glTexParameterf(target, pname, param); }
+inline void APIENTRY gl_counted_TexParameterfv(GLenum target, GLenum pname, const GLfloat *params) { ++gl_counters.calls[GLCounter_TexParameterfv]; return glTexParameterfv(target, pname, params); }
+inline void APIENTRY gl_counted_TexParameteri(GLenum target, GLenum pname, GLint param) { ++gl_counters.calls[GLCounter_TexParameteri]; return glTexParameteri(target, pname, param); }
+inline void APIENTRY gl_counted_TexParameteriv(GLenum target, GLenum pname, const GLint *params) { ++gl_counters.calls[GLCounter_TexParameteriv]; return glTexParameteriv(target, pname, params); }
+inline void APIENTRY gl_counted_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) { ++gl_counters.calls[GLCounter_TexImage1D]; return glTexImage1D(target, level, internalformat, width, border, format, type, pixels); }
+inline void APIENTRY gl_counted_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) { ++gl_counters.calls[GLCounter_TexImage2D]; return glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels); }
+inline void APIENTRY gl_counted_DrawBuffer(GLenum buf) { ++gl_counters.calls[GLCounter_DrawBuffer]; return glDrawBuffer(buf); }
+inline void APIENTRY gl_counted_Clear(GLbitfield mask) { ++gl_counters.calls[GLCounter_Clear]; return glClear(mask); }
+inline void APIENTRY gl_counted_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { ++gl_counters.calls[GLCounter_ClearColor]; return glClearColor(red, green, blue, alpha); }
+inline void APIENTRY gl_counted_ClearStencil(GLint s) { ++gl_counters.calls[GLCounter_ClearStencil]; return glClearStencil(s); }
+inline void APIENTRY gl_counted_ClearDepth(GLdouble depth) { ++gl_counters.calls[GLCounter_ClearDepth]; return glClearDepth(depth); }
+inline void APIENTRY gl_counted_StencilMask(GLuint mask) { ++gl_counters.calls[GLCounter_StencilMask]; return glStencilMask(mask); }
+inline void APIENTRY gl_counted_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) { ++gl_counters.calls[GLCounter_ColorMask]; return glColorMask(red, green, blue, alpha); }
+inline void APIENTRY gl_counted_DepthMask(GLboolean flag) { ++gl_counters.calls[GLCounter_DepthMask]; return glDepthMask(flag); }
+inline void APIENTRY gl_counted_Disable(GLenum cap) { ++gl_counters.calls[GLCounter_Disable]; return glDisable(cap); }
+inline void APIENTRY gl_counted_Enable(GLenum cap) { ++gl_counters.calls[GLCounter_Enable]; return glEnable(cap); }
+inline void APIENTRY gl_counted_Finish(void) { ++gl_counters.calls[GLCounter_Finish]; return glFinish(); }
+inline void APIENTRY gl_counted_Flush(void) { ++gl_counters.calls[GLCounter_Flush]; return glFlush(); }
+inline void APIENTRY gl_counted_BlendFunc(GLenum sfactor, GLenum dfactor) { ++gl_counters.calls[GLCounter_BlendFunc]; return glBlendFunc(sfactor, dfactor); }
+inline void APIENTRY gl_counted_LogicOp(GLenum opcode) { ++gl_counters.calls[GLCounter_LogicOp]; return glLogicOp(opcode); }
+inline void APIENTRY gl_counted_StencilFunc(GLenum func, GLint ref, GLuint mask) { ++gl_counters.calls[GLCounter_StencilFunc]; return glStencilFunc(func, ref, mask); }
+inline void APIENTRY gl_counted_StencilOp(GLenum fail, GLenum zfail, GLenum zpass) { ++gl_counters.calls[GLCounter_StencilOp]; return glStencilOp(fail, zfail, zpass); }
+inline void APIENTRY gl_counted_DepthFunc(GLenum func) { ++gl_counters.calls[GLCounter_DepthFunc]; return glDepthFunc(func); }
+inline void APIENTRY gl_counted_PixelStoref(GLenum pname, GLfloat param) { ++gl_counters.calls[GLCounter_PixelStoref]; return glPixelStoref(pname, param); }
+inline void APIENTRY gl_counted_PixelStorei(GLenum pname, GLint param) { ++gl_counters.calls[GLCounter_PixelStorei]; return glPixelStorei(pname, param); }
+inline void APIENTRY gl_counted_ReadBuffer(GLenum src) { ++gl_counters.calls[GLCounter_ReadBuffer]; return glReadBuffer(src); }
+inline void APIENTRY gl_counted_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) { ++gl_counters.calls[GLCounter_ReadPixels]; return glReadPixels(x, y, width, height, format, type, pixels); }
+inline void APIENTRY gl_counted_GetBooleanv(GLenum pname, GLboolean *data) { ++gl_counters.calls[GLCounter_GetBooleanv]; return glGetBooleanv(pname, data); }
+inline void APIENTRY gl_counted_GetDoublev(GLenum pname, GLdouble *data) { ++gl_counters.calls[GLCounter_GetDoublev]; return glGetDoublev(pname, data); }
+inline GLenum APIENTRY gl_counted_GetError(void) { ++gl_counters.calls[GLCounter_GetError]; return glGetError(); }
+inline void APIENTRY gl_counted_GetFloatv(GLenum pname, GLfloat *data) { ++gl_counters.calls[GLCounter_GetFloatv]; return glGetFloatv(pname, data); }
+inline void APIENTRY gl_counted_GetIntegerv(GLenum pname, GLint *data) { ++gl_counters.calls[GLCounter_GetIntegerv]; return glGetIntegerv(pname, data); }
+inline const GLubyte * APIENTRY gl_counted_GetString(GLenum name) { ++gl_counters.calls[GLCounter_GetString]; return glGetString(name); }
+inline void APIENTRY gl_counted_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) { ++gl_counters.calls[GLCounter_GetTexImage]; return glGetTexImage(target, level, format, type, pixels); }
+inline void APIENTRY gl_counted_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) { ++gl_counters.calls[GLCounter_GetTexParameterfv]; return glGetTexParameterfv(target, pname, params); }
+inline void APIENTRY gl_counted_GetTexParameteriv(GLenum target, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetTexParameteriv]; return glGetTexParameteriv(target, pname, params); }
+inline void APIENTRY gl_counted_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) { ++gl_counters.calls[GLCounter_GetTexLevelParameterfv]; return glGetTexLevelParameterfv(target, level, pname, params); }
+inline void APIENTRY gl_counted_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetTexLevelParameteriv]; return glGetTexLevelParameteriv(target, level, pname, params); }
+inline GLboolean APIENTRY gl_counted_IsEnabled(GLenum cap) { ++gl_counters.calls[GLCounter_IsEnabled]; return glIsEnabled(cap); }
+inline void APIENTRY gl_counted_DepthRange(GLdouble near, GLdouble far) { ++gl_counters.calls[GLCounter_DepthRange]; return glDepthRange(near, far); }
+inline void APIENTRY gl_counted_Viewport(GLint x, GLint y, GLsizei width, GLsizei height) { ++gl_counters.calls[GLCounter_Viewport]; return glViewport(x, y, width, height); }
+inline void APIENTRY gl_counted_DrawArrays(GLenum mode, GLint first, GLsizei count) { ++gl_counters.calls[GLCounter_DrawArrays]; gl_counters.draws += 1; gl_counters.vertices += uint64_t(count); return glDrawArrays(mode, first, count); }
+inline void APIENTRY gl_counted_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) { ++gl_counters.calls[GLCounter_DrawElements]; gl_counters.draws += 1; gl_counters.vertices += uint64_t(count); return glDrawElements(mode, count, type, indices); }
+inline void APIENTRY gl_counted_GetPointerv(GLenum pname, void **params) { ++gl_counters.calls[GLCounter_GetPointerv]; return glGetPointerv(pname, params); }
+inline void APIENTRY gl_counted_PolygonOffset(GLfloat factor, GLfloat units) { ++gl_counters.calls[GLCounter_PolygonOffset]; return glPolygonOffset(factor, units); }
+inline void APIENTRY gl_counted_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) { ++gl_counters.calls[GLCounter_CopyTexImage1D]; return glCopyTexImage1D(target, level, internalformat, x, y, width, border); }
+inline void APIENTRY gl_counted_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) { ++gl_counters.calls[GLCounter_CopyTexImage2D]; return glCopyTexImage2D(target, level, internalformat, x, y, width, height, border); }
+inline void APIENTRY gl_counted_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) { ++gl_counters.calls[GLCounter_CopyTexSubImage1D]; return glCopyTexSubImage1D(target, level, xoffset, x, y, width); }
+inline void APIENTRY gl_counted_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) { ++gl_counters.calls[GLCounter_CopyTexSubImage2D]; return glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height); }
+inline void APIENTRY gl_counted_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) { ++gl_counters.calls[GLCounter_TexSubImage1D]; return glTexSubImage1D(target, level, xoffset, width, format, type, pixels); }
+inline void APIENTRY gl_counted_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) { ++gl_counters.calls[GLCounter_TexSubImage2D]; return glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels); }
+inline void APIENTRY gl_counted_BindTexture(GLenum target, GLuint texture) { ++gl_counters.calls[GLCounter_BindTexture]; return glBindTexture(target, texture); }
+inline void APIENTRY gl_counted_DeleteTextures(GLsizei n, const GLuint *textures) { ++gl_counters.calls[GLCounter_DeleteTextures]; return glDeleteTextures(n, textures); }
+inline void APIENTRY gl_counted_GenTextures(GLsizei n, GLuint *textures) { ++gl_counters.calls[GLCounter_GenTextures]; return glGenTextures(n, textures); }
+inline GLboolean APIENTRY gl_counted_IsTexture(GLuint texture) { ++gl_counters.calls[GLCounter_IsTexture]; return glIsTexture(texture); }
+inline void APIENTRY gl_counted_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) { ++gl_counters.calls[GLCounter_DrawRangeElements]; gl_counters.draws += 1; gl_counters.vertices += uint64_t(count); return glDrawRangeElements(mode, start, end, count, type, indices); }
+inline void APIENTRY gl_counted_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) { ++gl_counters.calls[GLCounter_TexImage3D]; return glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels); }
+inline void APIENTRY gl_counted_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) { ++gl_counters.calls[GLCounter_TexSubImage3D]; return glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels); }
+inline void APIENTRY gl_counted_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) { ++gl_counters.calls[GLCounter_CopyTexSubImage3D]; return glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height); }
+inline void APIENTRY gl_counted_ActiveTexture(GLenum texture) { ++gl_counters.calls[GLCounter_ActiveTexture]; return glActiveTexture(texture); }
+inline void APIENTRY gl_counted_SampleCoverage(GLfloat value, GLboolean invert) { ++gl_counters.calls[GLCounter_SampleCoverage]; return glSampleCoverage(value, invert); }
+inline void APIENTRY gl_counted_CompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) { ++gl_counters.calls[GLCounter_CompressedTexImage3D]; return glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data); }
+inline void APIENTRY gl_counted_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) { ++gl_counters.calls[GLCounter_CompressedTexImage2D]; return glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data); }
+inline void APIENTRY gl_counted_CompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) { ++gl_counters.calls[GLCounter_CompressedTexImage1D]; return glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data); }
+inline void APIENTRY gl_counted_CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) { ++gl_counters.calls[GLCounter_CompressedTexSubImage3D]; return glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data); }
+inline void APIENTRY gl_counted_CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) { ++gl_counters.calls[GLCounter_CompressedTexSubImage2D]; return glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data); }
+inline void APIENTRY gl_counted_CompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) { ++gl_counters.calls[GLCounter_CompressedTexSubImage1D]; return glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data); }
+inline void APIENTRY gl_counted_GetCompressedTexImage(GLenum target, GLint level, void *img) { ++gl_counters.calls[GLCounter_GetCompressedTexImage]; return glGetCompressedTexImage(target, level, img); }
+inline void APIENTRY gl_counted_BlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) { ++gl_counters.calls[GLCounter_BlendFuncSeparate]; return glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha); }
+inline void APIENTRY gl_counted_MultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) { ++gl_counters.calls[GLCounter_MultiDrawArrays]; gl_counters.draws += uint64_t(drawcount); for (GLsizei i = 0; i < drawcount; ++i) gl_counters.vertices += uint64_t(count[i]); return glMultiDrawArrays(mode, first, count, drawcount); }
+inline void APIENTRY gl_counted_MultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) { ++gl_counters.calls[GLCounter_MultiDrawElements]; gl_counters.draws += uint64_t(drawcount); for (GLsizei i = 0; i < drawcount; ++i) gl_counters.vertices += uint64_t(count[i]); return glMultiDrawElements(mode, count, type, indices, drawcount); }
+inline void APIENTRY gl_counted_PointParameterf(GLenum pname, GLfloat param) { ++gl_counters.calls[GLCounter_PointParameterf]; return glPointParameterf(pname, param); }
+inline void APIENTRY gl_counted_PointParameterfv(GLenum pname, const GLfloat *params) { ++gl_counters.calls[GLCounter_PointParameterfv]; return glPointParameterfv(pname, params); }
+inline void APIENTRY gl_counted_PointParameteri(GLenum pname, GLint param) { ++gl_counters.calls[GLCounter_PointParameteri]; return glPointParameteri(pname, param); }
+inline void APIENTRY gl_counted_PointParameteriv(GLenum pname, const GLint *params) { ++gl_counters.calls[GLCounter_PointParameteriv]; return glPointParameteriv(pname, params); }
+inline void APIENTRY gl_counted_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) { ++gl_counters.calls[GLCounter_BlendColor]; return glBlendColor(red, green, blue, alpha); }
+inline void APIENTRY gl_counted_BlendEquation(GLenum mode) { ++gl_counters.calls[GLCounter_BlendEquation]; return glBlendEquation(mode); }
+inline void APIENTRY gl_counted_GenQueries(GLsizei n, GLuint *ids) { ++gl_counters.calls[GLCounter_GenQueries]; return glGenQueries(n, ids); }
+inline void APIENTRY gl_counted_DeleteQueries(GLsizei n, const GLuint *ids) { ++gl_counters.calls[GLCounter_DeleteQueries]; return glDeleteQueries(n, ids); }
+inline GLboolean APIENTRY gl_counted_IsQuery(GLuint id) { ++gl_counters.calls[GLCounter_IsQuery]; return glIsQuery(id); }
+inline void APIENTRY gl_counted_BeginQuery(GLenum target, GLuint id) { ++gl_counters.calls[GLCounter_BeginQuery]; return glBeginQuery(target, id); }
+inline void APIENTRY gl_counted_EndQuery(GLenum target) { ++gl_counters.calls[GLCounter_EndQuery]; return glEndQuery(target); }
+inline void APIENTRY gl_counted_GetQueryiv(GLenum target, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetQueryiv]; return glGetQueryiv(target, pname, params); }
+inline void APIENTRY gl_counted_GetQueryObjectiv(GLuint id, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetQueryObjectiv]; return glGetQueryObjectiv(id, pname, params); }
+inline void APIENTRY gl_counted_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) { ++gl_counters.calls[GLCounter_GetQueryObjectuiv]; return glGetQueryObjectuiv(id, pname, params); }
+inline void APIENTRY gl_counted_BindBuffer(GLenum target, GLuint buffer) { ++gl_counters.calls[GLCounter_BindBuffer]; return glBindBuffer(target, buffer); }
+inline void APIENTRY gl_counted_DeleteBuffers(GLsizei n, const GLuint *buffers) { ++gl_counters.calls[GLCounter_DeleteBuffers]; return glDeleteBuffers(n, buffers); }
+inline void APIENTRY gl_counted_GenBuffers(GLsizei n, GLuint *buffers) { ++gl_counters.calls[GLCounter_GenBuffers]; return glGenBuffers(n, buffers); }
+inline GLboolean APIENTRY gl_counted_IsBuffer(GLuint buffer) { ++gl_counters.calls[GLCounter_IsBuffer]; return glIsBuffer(buffer); }
+inline void APIENTRY gl_counted_BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) { ++gl_counters.calls[GLCounter_BufferData]; if (data) gl_counters.buffer_bytes += uint64_t(size); return glBufferData(target, size, data, usage); }
+inline void APIENTRY gl_counted_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) { ++gl_counters.calls[GLCounter_BufferSubData]; gl_counters.buffer_bytes += uint64_t(size); return glBufferSubData(target, offset, size, data); }
+inline void APIENTRY gl_counted_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) { ++gl_counters.calls[GLCounter_GetBufferSubData]; return glGetBufferSubData(target, offset, size, data); }
+inline void * APIENTRY gl_counted_MapBuffer(GLenum target, GLenum access) { ++gl_counters.calls[GLCounter_MapBuffer]; return glMapBuffer(target, access); }
+inline GLboolean APIENTRY gl_counted_UnmapBuffer(GLenum target) { ++gl_counters.calls[GLCounter_UnmapBuffer]; return glUnmapBuffer(target); }
+inline void APIENTRY gl_counted_GetBufferParameteriv(GLenum target, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetBufferParameteriv]; return glGetBufferParameteriv(target, pname, params); }
+inline void APIENTRY gl_counted_GetBufferPointerv(GLenum target, GLenum pname, void **params) { ++gl_counters.calls[GLCounter_GetBufferPointerv]; return glGetBufferPointerv(target, pname, params); }
+inline void APIENTRY gl_counted_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) { ++gl_counters.calls[GLCounter_BlendEquationSeparate]; return glBlendEquationSeparate(modeRGB, modeAlpha); }
+inline void APIENTRY gl_counted_DrawBuffers(GLsizei n, const GLenum *bufs) { ++gl_counters.calls[GLCounter_DrawBuffers]; return glDrawBuffers(n, bufs); }
+inline void APIENTRY gl_counted_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) { ++gl_counters.calls[GLCounter_StencilOpSeparate]; return glStencilOpSeparate(face, sfail, dpfail, dppass); }
+inline void APIENTRY gl_counted_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) { ++gl_counters.calls[GLCounter_StencilFuncSeparate]; return glStencilFuncSeparate(face, func, ref, mask); }
+inline void APIENTRY gl_counted_StencilMaskSeparate(GLenum face, GLuint mask) { ++gl_counters.calls[GLCounter_StencilMaskSeparate]; return glStencilMaskSeparate(face, mask); }
+inline void APIENTRY gl_counted_AttachShader(GLuint program, GLuint shader) { ++gl_counters.calls[GLCounter_AttachShader]; return glAttachShader(program, shader); }
+inline void APIENTRY gl_counted_BindAttribLocation(GLuint program, GLuint index, const GLchar *name) { ++gl_counters.calls[GLCounter_BindAttribLocation]; return glBindAttribLocation(program, index, name); }
+inline void APIENTRY gl_counted_CompileShader(GLuint shader) { ++gl_counters.calls[GLCounter_CompileShader]; return glCompileShader(shader); }
+inline GLuint APIENTRY gl_counted_CreateProgram(void) { ++gl_counters.calls[GLCounter_CreateProgram]; return glCreateProgram(); }
+inline GLuint APIENTRY gl_counted_CreateShader(GLenum type) { ++gl_counters.calls[GLCounter_CreateShader]; return glCreateShader(type); }
+inline void APIENTRY gl_counted_DeleteProgram(GLuint program) { ++gl_counters.calls[GLCounter_DeleteProgram]; return glDeleteProgram(program); }
+inline void APIENTRY gl_counted_DeleteShader(GLuint shader) { ++gl_counters.calls[GLCounter_DeleteShader]; return glDeleteShader(shader); }
+inline void APIENTRY gl_counted_DetachShader(GLuint program, GLuint shader) { ++gl_counters.calls[GLCounter_DetachShader]; return glDetachShader(program, shader); }
+inline void APIENTRY gl_counted_DisableVertexAttribArray(GLuint index) { ++gl_counters.calls[GLCounter_DisableVertexAttribArray]; return glDisableVertexAttribArray(index); }
+inline void APIENTRY gl_counted_EnableVertexAttribArray(GLuint index) { ++gl_counters.calls[GLCounter_EnableVertexAttribArray]; return glEnableVertexAttribArray(index); }
+inline void APIENTRY gl_counted_GetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { ++gl_counters.calls[GLCounter_GetActiveAttrib]; return glGetActiveAttrib(program, index, bufSize, length, size, type, name); }
+inline void APIENTRY gl_counted_GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) { ++gl_counters.calls[GLCounter_GetActiveUniform]; return glGetActiveUniform(program, index, bufSize, length, size, type, name); }
+inline void APIENTRY gl_counted_GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) { ++gl_counters.calls[GLCounter_GetAttachedShaders]; return glGetAttachedShaders(program, maxCount, count, shaders); }
+inline GLint APIENTRY gl_counted_GetAttribLocation(GLuint program, const GLchar *name) { ++gl_counters.calls[GLCounter_GetAttribLocation]; return glGetAttribLocation(program, name); }
+inline void APIENTRY gl_counted_GetProgramiv(GLuint program, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetProgramiv]; return glGetProgramiv(program, pname, params); }
+inline void APIENTRY gl_counted_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { ++gl_counters.calls[GLCounter_GetProgramInfoLog]; return glGetProgramInfoLog(program, bufSize, length, infoLog); }
+inline void APIENTRY gl_counted_GetShaderiv(GLuint shader, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetShaderiv]; return glGetShaderiv(shader, pname, params); }
+inline void APIENTRY gl_counted_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) { ++gl_counters.calls[GLCounter_GetShaderInfoLog]; return glGetShaderInfoLog(shader, bufSize, length, infoLog); }
+inline void APIENTRY gl_counted_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) { ++gl_counters.calls[GLCounter_GetShaderSource]; return glGetShaderSource(shader, bufSize, length, source); }
+inline GLint APIENTRY gl_counted_GetUniformLocation(GLuint program, const GLchar *name) { ++gl_counters.calls[GLCounter_GetUniformLocation]; return glGetUniformLocation(program, name); }
+inline void APIENTRY gl_counted_GetUniformfv(GLuint program, GLint location, GLfloat *params) { ++gl_counters.calls[GLCounter_GetUniformfv]; return glGetUniformfv(program, location, params); }
+inline void APIENTRY gl_counted_GetUniformiv(GLuint program, GLint location, GLint *params) { ++gl_counters.calls[GLCounter_GetUniformiv]; return glGetUniformiv(program, location, params); }
+inline void APIENTRY gl_counted_GetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) { ++gl_counters.calls[GLCounter_GetVertexAttribdv]; return glGetVertexAttribdv(index, pname, params); }
+inline void APIENTRY gl_counted_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) { ++gl_counters.calls[GLCounter_GetVertexAttribfv]; return glGetVertexAttribfv(index, pname, params); }
+inline void APIENTRY gl_counted_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetVertexAttribiv]; return glGetVertexAttribiv(index, pname, params); }
+inline void APIENTRY gl_counted_GetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) { ++gl_counters.calls[GLCounter_GetVertexAttribPointerv]; return glGetVertexAttribPointerv(index, pname, pointer); }
+inline GLboolean APIENTRY gl_counted_IsProgram(GLuint program) { ++gl_counters.calls[GLCounter_IsProgram]; return glIsProgram(program); }
+inline GLboolean APIENTRY gl_counted_IsShader(GLuint shader) { ++gl_counters.calls[GLCounter_IsShader]; return glIsShader(shader); }
+inline void APIENTRY gl_counted_LinkProgram(GLuint program) { ++gl_counters.calls[GLCounter_LinkProgram]; return glLinkProgram(program); }
+inline void APIENTRY gl_counted_ShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) { ++gl_counters.calls[GLCounter_ShaderSource]; return glShaderSource(shader, count, string, length); }
+inline void APIENTRY gl_counted_UseProgram(GLuint program) { ++gl_counters.calls[GLCounter_UseProgram]; return glUseProgram(program); }
+inline void APIENTRY gl_counted_Uniform1f(GLint location, GLfloat v0) { ++gl_counters.calls[GLCounter_Uniform1f]; gl_counters.uniform_bytes += 4; return glUniform1f(location, v0); }
+inline void APIENTRY gl_counted_Uniform2f(GLint location, GLfloat v0, GLfloat v1) { ++gl_counters.calls[GLCounter_Uniform2f]; gl_counters.uniform_bytes += 8; return glUniform2f(location, v0, v1); }
+inline void APIENTRY gl_counted_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) { ++gl_counters.calls[GLCounter_Uniform3f]; gl_counters.uniform_bytes += 12; return glUniform3f(location, v0, v1, v2); }
+inline void APIENTRY gl_counted_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) { ++gl_counters.calls[GLCounter_Uniform4f]; gl_counters.uniform_bytes += 16; return glUniform4f(location, v0, v1, v2, v3); }
+inline void APIENTRY gl_counted_Uniform1i(GLint location, GLint v0) { ++gl_counters.calls[GLCounter_Uniform1i]; gl_counters.uniform_bytes += 4; return glUniform1i(location, v0); }
+inline void APIENTRY gl_counted_Uniform2i(GLint location, GLint v0, GLint v1) { ++gl_counters.calls[GLCounter_Uniform2i]; gl_counters.uniform_bytes += 8; return glUniform2i(location, v0, v1); }
+inline void APIENTRY gl_counted_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2) { ++gl_counters.calls[GLCounter_Uniform3i]; gl_counters.uniform_bytes += 12; return glUniform3i(location, v0, v1, v2); }
+inline void APIENTRY gl_counted_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) { ++gl_counters.calls[GLCounter_Uniform4i]; gl_counters.uniform_bytes += 16; return glUniform4i(location, v0, v1, v2, v3); }
+inline void APIENTRY gl_counted_Uniform1fv(GLint location, GLsizei count, const GLfloat *value) { ++gl_counters.calls[GLCounter_Uniform1fv]; gl_counters.uniform_bytes += uint64_t(count) * 4; return glUniform1fv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform2fv(GLint location, GLsizei count, const GLfloat *value) { ++gl_counters.calls[GLCounter_Uniform2fv]; gl_counters.uniform_bytes += uint64_t(count) * 8; return glUniform2fv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform3fv(GLint location, GLsizei count, const GLfloat *value) { ++gl_counters.calls[GLCounter_Uniform3fv]; gl_counters.uniform_bytes += uint64_t(count) * 12; return glUniform3fv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform4fv(GLint location, GLsizei count, const GLfloat *value) { ++gl_counters.calls[GLCounter_Uniform4fv]; gl_counters.uniform_bytes += uint64_t(count) * 16; return glUniform4fv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform1iv(GLint location, GLsizei count, const GLint *value) { ++gl_counters.calls[GLCounter_Uniform1iv]; gl_counters.uniform_bytes += uint64_t(count) * 4; return glUniform1iv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform2iv(GLint location, GLsizei count, const GLint *value) { ++gl_counters.calls[GLCounter_Uniform2iv]; gl_counters.uniform_bytes += uint64_t(count) * 8; return glUniform2iv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform3iv(GLint location, GLsizei count, const GLint *value) { ++gl_counters.calls[GLCounter_Uniform3iv]; gl_counters.uniform_bytes += uint64_t(count) * 12; return glUniform3iv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform4iv(GLint location, GLsizei count, const GLint *value) { ++gl_counters.calls[GLCounter_Uniform4iv]; gl_counters.uniform_bytes += uint64_t(count) * 16; return glUniform4iv(location, count, value); }
+inline void APIENTRY gl_counted_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix2fv]; gl_counters.uniform_bytes += uint64_t(count) * 16; return glUniformMatrix2fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix3fv]; gl_counters.uniform_bytes += uint64_t(count) * 36; return glUniformMatrix3fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix4fv]; gl_counters.uniform_bytes += uint64_t(count) * 64; return glUniformMatrix4fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_ValidateProgram(GLuint program) { ++gl_counters.calls[GLCounter_ValidateProgram]; return glValidateProgram(program); }
+inline void APIENTRY gl_counted_VertexAttrib1d(GLuint index, GLdouble x) { ++gl_counters.calls[GLCounter_VertexAttrib1d]; return glVertexAttrib1d(index, x); }
+inline void APIENTRY gl_counted_VertexAttrib1dv(GLuint index, const GLdouble *v) { ++gl_counters.calls[GLCounter_VertexAttrib1dv]; return glVertexAttrib1dv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib1f(GLuint index, GLfloat x) { ++gl_counters.calls[GLCounter_VertexAttrib1f]; return glVertexAttrib1f(index, x); }
+inline void APIENTRY gl_counted_VertexAttrib1fv(GLuint index, const GLfloat *v) { ++gl_counters.calls[GLCounter_VertexAttrib1fv]; return glVertexAttrib1fv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib1s(GLuint index, GLshort x) { ++gl_counters.calls[GLCounter_VertexAttrib1s]; return glVertexAttrib1s(index, x); }
+inline void APIENTRY gl_counted_VertexAttrib1sv(GLuint index, const GLshort *v) { ++gl_counters.calls[GLCounter_VertexAttrib1sv]; return glVertexAttrib1sv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib2d(GLuint index, GLdouble x, GLdouble y) { ++gl_counters.calls[GLCounter_VertexAttrib2d]; return glVertexAttrib2d(index, x, y); }
+inline void APIENTRY gl_counted_VertexAttrib2dv(GLuint index, const GLdouble *v) { ++gl_counters.calls[GLCounter_VertexAttrib2dv]; return glVertexAttrib2dv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y) { ++gl_counters.calls[GLCounter_VertexAttrib2f]; return glVertexAttrib2f(index, x, y); }
+inline void APIENTRY gl_counted_VertexAttrib2fv(GLuint index, const GLfloat *v) { ++gl_counters.calls[GLCounter_VertexAttrib2fv]; return glVertexAttrib2fv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib2s(GLuint index, GLshort x, GLshort y) { ++gl_counters.calls[GLCounter_VertexAttrib2s]; return glVertexAttrib2s(index, x, y); }
+inline void APIENTRY gl_counted_VertexAttrib2sv(GLuint index, const GLshort *v) { ++gl_counters.calls[GLCounter_VertexAttrib2sv]; return glVertexAttrib2sv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) { ++gl_counters.calls[GLCounter_VertexAttrib3d]; return glVertexAttrib3d(index, x, y, z); }
+inline void APIENTRY gl_counted_VertexAttrib3dv(GLuint index, const GLdouble *v) { ++gl_counters.calls[GLCounter_VertexAttrib3dv]; return glVertexAttrib3dv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) { ++gl_counters.calls[GLCounter_VertexAttrib3f]; return glVertexAttrib3f(index, x, y, z); }
+inline void APIENTRY gl_counted_VertexAttrib3fv(GLuint index, const GLfloat *v) { ++gl_counters.calls[GLCounter_VertexAttrib3fv]; return glVertexAttrib3fv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) { ++gl_counters.calls[GLCounter_VertexAttrib3s]; return glVertexAttrib3s(index, x, y, z); }
+inline void APIENTRY gl_counted_VertexAttrib3sv(GLuint index, const GLshort *v) { ++gl_counters.calls[GLCounter_VertexAttrib3sv]; return glVertexAttrib3sv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4Nbv(GLuint index, const GLbyte *v) { ++gl_counters.calls[GLCounter_VertexAttrib4Nbv]; return glVertexAttrib4Nbv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4Niv(GLuint index, const GLint *v) { ++gl_counters.calls[GLCounter_VertexAttrib4Niv]; return glVertexAttrib4Niv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4Nsv(GLuint index, const GLshort *v) { ++gl_counters.calls[GLCounter_VertexAttrib4Nsv]; return glVertexAttrib4Nsv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) { ++gl_counters.calls[GLCounter_VertexAttrib4Nub]; return glVertexAttrib4Nub(index, x, y, z, w); }
+inline void APIENTRY gl_counted_VertexAttrib4Nubv(GLuint index, const GLubyte *v) { ++gl_counters.calls[GLCounter_VertexAttrib4Nubv]; return glVertexAttrib4Nubv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4Nuiv(GLuint index, const GLuint *v) { ++gl_counters.calls[GLCounter_VertexAttrib4Nuiv]; return glVertexAttrib4Nuiv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4Nusv(GLuint index, const GLushort *v) { ++gl_counters.calls[GLCounter_VertexAttrib4Nusv]; return glVertexAttrib4Nusv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4bv(GLuint index, const GLbyte *v) { ++gl_counters.calls[GLCounter_VertexAttrib4bv]; return glVertexAttrib4bv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) { ++gl_counters.calls[GLCounter_VertexAttrib4d]; return glVertexAttrib4d(index, x, y, z, w); }
+inline void APIENTRY gl_counted_VertexAttrib4dv(GLuint index, const GLdouble *v) { ++gl_counters.calls[GLCounter_VertexAttrib4dv]; return glVertexAttrib4dv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) { ++gl_counters.calls[GLCounter_VertexAttrib4f]; return glVertexAttrib4f(index, x, y, z, w); }
+inline void APIENTRY gl_counted_VertexAttrib4fv(GLuint index, const GLfloat *v) { ++gl_counters.calls[GLCounter_VertexAttrib4fv]; return glVertexAttrib4fv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4iv(GLuint index, const GLint *v) { ++gl_counters.calls[GLCounter_VertexAttrib4iv]; return glVertexAttrib4iv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) { ++gl_counters.calls[GLCounter_VertexAttrib4s]; return glVertexAttrib4s(index, x, y, z, w); }
+inline void APIENTRY gl_counted_VertexAttrib4sv(GLuint index, const GLshort *v) { ++gl_counters.calls[GLCounter_VertexAttrib4sv]; return glVertexAttrib4sv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4ubv(GLuint index, const GLubyte *v) { ++gl_counters.calls[GLCounter_VertexAttrib4ubv]; return glVertexAttrib4ubv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4uiv(GLuint index, const GLuint *v) { ++gl_counters.calls[GLCounter_VertexAttrib4uiv]; return glVertexAttrib4uiv(index, v); }
+inline void APIENTRY gl_counted_VertexAttrib4usv(GLuint index, const GLushort *v) { ++gl_counters.calls[GLCounter_VertexAttrib4usv]; return glVertexAttrib4usv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) { ++gl_counters.calls[GLCounter_VertexAttribPointer]; return glVertexAttribPointer(index, size, type, normalized, stride, pointer); }
+inline void APIENTRY gl_counted_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix2x3fv]; gl_counters.uniform_bytes += uint64_t(count) * 24; return glUniformMatrix2x3fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix3x2fv]; gl_counters.uniform_bytes += uint64_t(count) * 24; return glUniformMatrix3x2fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix2x4fv]; gl_counters.uniform_bytes += uint64_t(count) * 32; return glUniformMatrix2x4fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix4x2fv]; gl_counters.uniform_bytes += uint64_t(count) * 32; return glUniformMatrix4x2fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix3x4fv]; gl_counters.uniform_bytes += uint64_t(count) * 48; return glUniformMatrix3x4fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) { ++gl_counters.calls[GLCounter_UniformMatrix4x3fv]; gl_counters.uniform_bytes += uint64_t(count) * 48; return glUniformMatrix4x3fv(location, count, transpose, value); }
+inline void APIENTRY gl_counted_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) { ++gl_counters.calls[GLCounter_ColorMaski]; return glColorMaski(index, r, g, b, a); }
+inline void APIENTRY gl_counted_GetBooleani_v(GLenum target, GLuint index, GLboolean *data) { ++gl_counters.calls[GLCounter_GetBooleani_v]; return glGetBooleani_v(target, index, data); }
+inline void APIENTRY gl_counted_GetIntegeri_v(GLenum target, GLuint index, GLint *data) { ++gl_counters.calls[GLCounter_GetIntegeri_v]; return glGetIntegeri_v(target, index, data); }
+inline void APIENTRY gl_counted_Enablei(GLenum target, GLuint index) { ++gl_counters.calls[GLCounter_Enablei]; return glEnablei(target, index); }
+inline void APIENTRY gl_counted_Disablei(GLenum target, GLuint index) { ++gl_counters.calls[GLCounter_Disablei]; return glDisablei(target, index); }
+inline GLboolean APIENTRY gl_counted_IsEnabledi(GLenum target, GLuint index) { ++gl_counters.calls[GLCounter_IsEnabledi]; return glIsEnabledi(target, index); }
+inline void APIENTRY gl_counted_BeginTransformFeedback(GLenum primitiveMode) { ++gl_counters.calls[GLCounter_BeginTransformFeedback]; return glBeginTransformFeedback(primitiveMode); }
+inline void APIENTRY gl_counted_EndTransformFeedback(void) { ++gl_counters.calls[GLCounter_EndTransformFeedback]; return glEndTransformFeedback(); }
+inline void APIENTRY gl_counted_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) { ++gl_counters.calls[GLCounter_BindBufferRange]; return glBindBufferRange(target, index, buffer, offset, size); }
+inline void APIENTRY gl_counted_BindBufferBase(GLenum target, GLuint index, GLuint buffer) { ++gl_counters.calls[GLCounter_BindBufferBase]; return glBindBufferBase(target, index, buffer); }
+inline void APIENTRY gl_counted_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) { ++gl_counters.calls[GLCounter_TransformFeedbackVaryings]; return glTransformFeedbackVaryings(program, count, varyings, bufferMode); }
+inline void APIENTRY gl_counted_GetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) { ++gl_counters.calls[GLCounter_GetTransformFeedbackVarying]; return glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name); }
+inline void APIENTRY gl_counted_ClampColor(GLenum target, GLenum clamp) { ++gl_counters.calls[GLCounter_ClampColor]; return glClampColor(target, clamp); }
+inline void APIENTRY gl_counted_BeginConditionalRender(GLuint id, GLenum mode) { ++gl_counters.calls[GLCounter_BeginConditionalRender]; return glBeginConditionalRender(id, mode); }
+inline void APIENTRY gl_counted_EndConditionalRender(void) { ++gl_counters.calls[GLCounter_EndConditionalRender]; return glEndConditionalRender(); }
+inline void APIENTRY gl_counted_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) { ++gl_counters.calls[GLCounter_VertexAttribIPointer]; return glVertexAttribIPointer(index, size, type, stride, pointer); }
+inline void APIENTRY gl_counted_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetVertexAttribIiv]; return glGetVertexAttribIiv(index, pname, params); }
+inline void APIENTRY gl_counted_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) { ++gl_counters.calls[GLCounter_GetVertexAttribIuiv]; return glGetVertexAttribIuiv(index, pname, params); }
+inline void APIENTRY gl_counted_VertexAttribI1i(GLuint index, GLint x) { ++gl_counters.calls[GLCounter_VertexAttribI1i]; return glVertexAttribI1i(index, x); }
+inline void APIENTRY gl_counted_VertexAttribI2i(GLuint index, GLint x, GLint y) { ++gl_counters.calls[GLCounter_VertexAttribI2i]; return glVertexAttribI2i(index, x, y); }
+inline void APIENTRY gl_counted_VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) { ++gl_counters.calls[GLCounter_VertexAttribI3i]; return glVertexAttribI3i(index, x, y, z); }
+inline void APIENTRY gl_counted_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) { ++gl_counters.calls[GLCounter_VertexAttribI4i]; return glVertexAttribI4i(index, x, y, z, w); }
+inline void APIENTRY gl_counted_VertexAttribI1ui(GLuint index, GLuint x) { ++gl_counters.calls[GLCounter_VertexAttribI1ui]; return glVertexAttribI1ui(index, x); }
+inline void APIENTRY gl_counted_VertexAttribI2ui(GLuint index, GLuint x, GLuint y) { ++gl_counters.calls[GLCounter_VertexAttribI2ui]; return glVertexAttribI2ui(index, x, y); }
+inline void APIENTRY gl_counted_VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) { ++gl_counters.calls[GLCounter_VertexAttribI3ui]; return glVertexAttribI3ui(index, x, y, z); }
+inline void APIENTRY gl_counted_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) { ++gl_counters.calls[GLCounter_VertexAttribI4ui]; return glVertexAttribI4ui(index, x, y, z, w); }
+inline void APIENTRY gl_counted_VertexAttribI1iv(GLuint index, const GLint *v) { ++gl_counters.calls[GLCounter_VertexAttribI1iv]; return glVertexAttribI1iv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI2iv(GLuint index, const GLint *v) { ++gl_counters.calls[GLCounter_VertexAttribI2iv]; return glVertexAttribI2iv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI3iv(GLuint index, const GLint *v) { ++gl_counters.calls[GLCounter_VertexAttribI3iv]; return glVertexAttribI3iv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI4iv(GLuint index, const GLint *v) { ++gl_counters.calls[GLCounter_VertexAttribI4iv]; return glVertexAttribI4iv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI1uiv(GLuint index, const GLuint *v) { ++gl_counters.calls[GLCounter_VertexAttribI1uiv]; return glVertexAttribI1uiv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI2uiv(GLuint index, const GLuint *v) { ++gl_counters.calls[GLCounter_VertexAttribI2uiv]; return glVertexAttribI2uiv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI3uiv(GLuint index, const GLuint *v) { ++gl_counters.calls[GLCounter_VertexAttribI3uiv]; return glVertexAttribI3uiv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI4uiv(GLuint index, const GLuint *v) { ++gl_counters.calls[GLCounter_VertexAttribI4uiv]; return glVertexAttribI4uiv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI4bv(GLuint index, const GLbyte *v) { ++gl_counters.calls[GLCounter_VertexAttribI4bv]; return glVertexAttribI4bv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI4sv(GLuint index, const GLshort *v) { ++gl_counters.calls[GLCounter_VertexAttribI4sv]; return glVertexAttribI4sv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI4ubv(GLuint index, const GLubyte *v) { ++gl_counters.calls[GLCounter_VertexAttribI4ubv]; return glVertexAttribI4ubv(index, v); }
+inline void APIENTRY gl_counted_VertexAttribI4usv(GLuint index, const GLushort *v) { ++gl_counters.calls[GLCounter_VertexAttribI4usv]; return glVertexAttribI4usv(index, v); }
+inline void APIENTRY gl_counted_GetUniformuiv(GLuint program, GLint location, GLuint *params) { ++gl_counters.calls[GLCounter_GetUniformuiv]; return glGetUniformuiv(program, location, params); }
+inline void APIENTRY gl_counted_BindFragDataLocation(GLuint program, GLuint color, const GLchar *name) { ++gl_counters.calls[GLCounter_BindFragDataLocation]; return glBindFragDataLocation(program, color, name); }
+inline GLint APIENTRY gl_counted_GetFragDataLocation(GLuint program, const GLchar *name) { ++gl_counters.calls[GLCounter_GetFragDataLocation]; return glGetFragDataLocation(program, name); }
+inline void APIENTRY gl_counted_Uniform1ui(GLint location, GLuint v0) { ++gl_counters.calls[GLCounter_Uniform1ui]; gl_counters.uniform_bytes += 4; return glUniform1ui(location, v0); }
+inline void APIENTRY gl_counted_Uniform2ui(GLint location, GLuint v0, GLuint v1) { ++gl_counters.calls[GLCounter_Uniform2ui]; gl_counters.uniform_bytes += 8; return glUniform2ui(location, v0, v1); }
+inline void APIENTRY gl_counted_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) { ++gl_counters.calls[GLCounter_Uniform3ui]; gl_counters.uniform_bytes += 12; return glUniform3ui(location, v0, v1, v2); }
+inline void APIENTRY gl_counted_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) { ++gl_counters.calls[GLCounter_Uniform4ui]; gl_counters.uniform_bytes += 16; return glUniform4ui(location, v0, v1, v2, v3); }
+inline void APIENTRY gl_counted_Uniform1uiv(GLint location, GLsizei count, const GLuint *value) { ++gl_counters.calls[GLCounter_Uniform1uiv]; gl_counters.uniform_bytes += uint64_t(count) * 4; return glUniform1uiv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform2uiv(GLint location, GLsizei count, const GLuint *value) { ++gl_counters.calls[GLCounter_Uniform2uiv]; gl_counters.uniform_bytes += uint64_t(count) * 8; return glUniform2uiv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform3uiv(GLint location, GLsizei count, const GLuint *value) { ++gl_counters.calls[GLCounter_Uniform3uiv]; gl_counters.uniform_bytes += uint64_t(count) * 12; return glUniform3uiv(location, count, value); }
+inline void APIENTRY gl_counted_Uniform4uiv(GLint location, GLsizei count, const GLuint *value) { ++gl_counters.calls[GLCounter_Uniform4uiv]; gl_counters.uniform_bytes += uint64_t(count) * 16; return glUniform4uiv(location, count, value); }
+inline void APIENTRY gl_counted_TexParameterIiv(GLenum target, GLenum pname, const GLint *params) { ++gl_counters.calls[GLCounter_TexParameterIiv]; return glTexParameterIiv(target, pname, params); }
+inline void APIENTRY gl_counted_TexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) { ++gl_counters.calls[GLCounter_TexParameterIuiv]; return glTexParameterIuiv(target, pname, params); }
+inline void APIENTRY gl_counted_GetTexParameterIiv(GLenum target, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetTexParameterIiv]; return glGetTexParameterIiv(target, pname, params); }
+inline void APIENTRY gl_counted_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) { ++gl_counters.calls[GLCounter_GetTexParameterIuiv]; return glGetTexParameterIuiv(target, pname, params); }
+inline void APIENTRY gl_counted_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) { ++gl_counters.calls[GLCounter_ClearBufferiv]; return glClearBufferiv(buffer, drawbuffer, value); }
+inline void APIENTRY gl_counted_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) { ++gl_counters.calls[GLCounter_ClearBufferuiv]; return glClearBufferuiv(buffer, drawbuffer, value); }
+inline void APIENTRY gl_counted_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) { ++gl_counters.calls[GLCounter_ClearBufferfv]; return glClearBufferfv(buffer, drawbuffer, value); }
+inline void APIENTRY gl_counted_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) { ++gl_counters.calls[GLCounter_ClearBufferfi]; return glClearBufferfi(buffer, drawbuffer, depth, stencil); }
+inline const GLubyte * APIENTRY gl_counted_GetStringi(GLenum name, GLuint index) { ++gl_counters.calls[GLCounter_GetStringi]; return glGetStringi(name, index); }
+inline GLboolean APIENTRY gl_counted_IsRenderbuffer(GLuint renderbuffer) { ++gl_counters.calls[GLCounter_IsRenderbuffer]; return glIsRenderbuffer(renderbuffer); }
+inline void APIENTRY gl_counted_BindRenderbuffer(GLenum target, GLuint renderbuffer) { ++gl_counters.calls[GLCounter_BindRenderbuffer]; return glBindRenderbuffer(target, renderbuffer); }
+inline void APIENTRY gl_counted_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) { ++gl_counters.calls[GLCounter_DeleteRenderbuffers]; return glDeleteRenderbuffers(n, renderbuffers); }
+inline void APIENTRY gl_counted_GenRenderbuffers(GLsizei n, GLuint *renderbuffers) { ++gl_counters.calls[GLCounter_GenRenderbuffers]; return glGenRenderbuffers(n, renderbuffers); }
+inline void APIENTRY gl_counted_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) { ++gl_counters.calls[GLCounter_RenderbufferStorage]; return glRenderbufferStorage(target, internalformat, width, height); }
+inline void APIENTRY gl_counted_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetRenderbufferParameteriv]; return glGetRenderbufferParameteriv(target, pname, params); }
+inline GLboolean APIENTRY gl_counted_IsFramebuffer(GLuint framebuffer) { ++gl_counters.calls[GLCounter_IsFramebuffer]; return glIsFramebuffer(framebuffer); }
+inline void APIENTRY gl_counted_BindFramebuffer(GLenum target, GLuint framebuffer) { ++gl_counters.calls[GLCounter_BindFramebuffer]; return glBindFramebuffer(target, framebuffer); }
+inline void APIENTRY gl_counted_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers) { ++gl_counters.calls[GLCounter_DeleteFramebuffers]; return glDeleteFramebuffers(n, framebuffers); }
+inline void APIENTRY gl_counted_GenFramebuffers(GLsizei n, GLuint *framebuffers) { ++gl_counters.calls[GLCounter_GenFramebuffers]; return glGenFramebuffers(n, framebuffers); }
+inline GLenum APIENTRY gl_counted_CheckFramebufferStatus(GLenum target) { ++gl_counters.calls[GLCounter_CheckFramebufferStatus]; return glCheckFramebufferStatus(target); }
+inline void APIENTRY gl_counted_FramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { ++gl_counters.calls[GLCounter_FramebufferTexture1D]; return glFramebufferTexture1D(target, attachment, textarget, texture, level); }
+inline void APIENTRY gl_counted_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) { ++gl_counters.calls[GLCounter_FramebufferTexture2D]; return glFramebufferTexture2D(target, attachment, textarget, texture, level); }
+inline void APIENTRY gl_counted_FramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) { ++gl_counters.calls[GLCounter_FramebufferTexture3D]; return glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset); }
+inline void APIENTRY gl_counted_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) { ++gl_counters.calls[GLCounter_FramebufferRenderbuffer]; return glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer); }
+inline void APIENTRY gl_counted_GetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetFramebufferAttachmentParameteriv]; return glGetFramebufferAttachmentParameteriv(target, attachment, pname, params); }
+inline void APIENTRY gl_counted_GenerateMipmap(GLenum target) { ++gl_counters.calls[GLCounter_GenerateMipmap]; return glGenerateMipmap(target); }
+inline void APIENTRY gl_counted_BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) { ++gl_counters.calls[GLCounter_BlitFramebuffer]; return glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter); }
+inline void APIENTRY gl_counted_RenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) { ++gl_counters.calls[GLCounter_RenderbufferStorageMultisample]; return glRenderbufferStorageMultisample(target, samples, internalformat, width, height); }
+inline void APIENTRY gl_counted_FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) { ++gl_counters.calls[GLCounter_FramebufferTextureLayer]; return glFramebufferTextureLayer(target, attachment, texture, level, layer); }
+inline void * APIENTRY gl_counted_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) { ++gl_counters.calls[GLCounter_MapBufferRange]; return glMapBufferRange(target, offset, length, access); }
+inline void APIENTRY gl_counted_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) { ++gl_counters.calls[GLCounter_FlushMappedBufferRange]; return glFlushMappedBufferRange(target, offset, length); }
+inline void APIENTRY gl_counted_BindVertexArray(GLuint array) { ++gl_counters.calls[GLCounter_BindVertexArray]; return glBindVertexArray(array); }
+inline void APIENTRY gl_counted_DeleteVertexArrays(GLsizei n, const GLuint *arrays) { ++gl_counters.calls[GLCounter_DeleteVertexArrays]; return glDeleteVertexArrays(n, arrays); }
+inline void APIENTRY gl_counted_GenVertexArrays(GLsizei n, GLuint *arrays) { ++gl_counters.calls[GLCounter_GenVertexArrays]; return glGenVertexArrays(n, arrays); }
+inline GLboolean APIENTRY gl_counted_IsVertexArray(GLuint array) { ++gl_counters.calls[GLCounter_IsVertexArray]; return glIsVertexArray(array); }
+inline void APIENTRY gl_counted_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) { ++gl_counters.calls[GLCounter_DrawArraysInstanced]; gl_counters.draws += 1; gl_counters.vertices += uint64_t(count) * uint64_t(instancecount); return glDrawArraysInstanced(mode, first, count, instancecount); }
+inline void APIENTRY gl_counted_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) { ++gl_counters.calls[GLCounter_DrawElementsInstanced]; gl_counters.draws += 1; gl_counters.vertices += uint64_t(count) * uint64_t(instancecount); return glDrawElementsInstanced(mode, count, type, indices, instancecount); }
+inline void APIENTRY gl_counted_TexBuffer(GLenum target, GLenum internalformat, GLuint buffer) { ++gl_counters.calls[GLCounter_TexBuffer]; return glTexBuffer(target, internalformat, buffer); }
+inline void APIENTRY gl_counted_PrimitiveRestartIndex(GLuint index) { ++gl_counters.calls[GLCounter_PrimitiveRestartIndex]; return glPrimitiveRestartIndex(index); }
+inline void APIENTRY gl_counted_CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) { ++gl_counters.calls[GLCounter_CopyBufferSubData]; return glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size); }
+inline void APIENTRY gl_counted_GetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) { ++gl_counters.calls[GLCounter_GetUniformIndices]; return glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices); }
+inline void APIENTRY gl_counted_GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetActiveUniformsiv]; return glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params); }
+inline void APIENTRY gl_counted_GetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) { ++gl_counters.calls[GLCounter_GetActiveUniformName]; return glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName); }
+inline GLuint APIENTRY gl_counted_GetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) { ++gl_counters.calls[GLCounter_GetUniformBlockIndex]; return glGetUniformBlockIndex(program, uniformBlockName); }
+inline void APIENTRY gl_counted_GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetActiveUniformBlockiv]; return glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params); }
+inline void APIENTRY gl_counted_GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) { ++gl_counters.calls[GLCounter_GetActiveUniformBlockName]; return glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName); }
+inline void APIENTRY gl_counted_UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) { ++gl_counters.calls[GLCounter_UniformBlockBinding]; return glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding); }
+inline void APIENTRY gl_counted_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) { ++gl_counters.calls[GLCounter_DrawElementsBaseVertex]; gl_counters.draws += 1; gl_counters.vertices += uint64_t(count); return glDrawElementsBaseVertex(mode, count, type, indices, basevertex); }
+inline void APIENTRY gl_counted_DrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) { ++gl_counters.calls[GLCounter_DrawRangeElementsBaseVertex]; gl_counters.draws += 1; gl_counters.vertices += uint64_t(count); return glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex); }
+inline void APIENTRY gl_counted_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) { ++gl_counters.calls[GLCounter_DrawElementsInstancedBaseVertex]; gl_counters.draws += 1; gl_counters.vertices += uint64_t(count) * uint64_t(instancecount); return glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex); }
+inline void APIENTRY gl_counted_MultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) { ++gl_counters.calls[GLCounter_MultiDrawElementsBaseVertex]; gl_counters.draws += uint64_t(drawcount); for (GLsizei i = 0; i < drawcount; ++i) gl_counters.vertices += uint64_t(count[i]); return glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex); }
+inline void APIENTRY gl_counted_ProvokingVertex(GLenum mode) { ++gl_counters.calls[GLCounter_ProvokingVertex]; return glProvokingVertex(mode); }
+inline GLsync APIENTRY gl_counted_FenceSync(GLenum condition, GLbitfield flags) { ++gl_counters.calls[GLCounter_FenceSync]; return glFenceSync(condition, flags); }
+inline GLboolean APIENTRY gl_counted_IsSync(GLsync sync) { ++gl_counters.calls[GLCounter_IsSync]; return glIsSync(sync); }
+inline void APIENTRY gl_counted_DeleteSync(GLsync sync) { ++gl_counters.calls[GLCounter_DeleteSync]; return glDeleteSync(sync); }
+inline GLenum APIENTRY gl_counted_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { ++gl_counters.calls[GLCounter_ClientWaitSync]; return glClientWaitSync(sync, flags, timeout); }
+inline void APIENTRY gl_counted_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) { ++gl_counters.calls[GLCounter_WaitSync]; return glWaitSync(sync, flags, timeout); }
+inline void APIENTRY gl_counted_GetInteger64v(GLenum pname, GLint64 *data) { ++gl_counters.calls[GLCounter_GetInteger64v]; return glGetInteger64v(pname, data); }
+inline void APIENTRY gl_counted_GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) { ++gl_counters.calls[GLCounter_GetSynciv]; return glGetSynciv(sync, pname, bufSize, length, values); }
+inline void APIENTRY gl_counted_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data) { ++gl_counters.calls[GLCounter_GetInteger64i_v]; return glGetInteger64i_v(target, index, data); }
+inline void APIENTRY gl_counted_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) { ++gl_counters.calls[GLCounter_GetBufferParameteri64v]; return glGetBufferParameteri64v(target, pname, params); }
+inline void APIENTRY gl_counted_FramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) { ++gl_counters.calls[GLCounter_FramebufferTexture]; return glFramebufferTexture(target, attachment, texture, level); }
+inline void APIENTRY gl_counted_TexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) { ++gl_counters.calls[GLCounter_TexImage2DMultisample]; return glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations); }
+inline void APIENTRY gl_counted_TexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) { ++gl_counters.calls[GLCounter_TexImage3DMultisample]; return glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations); }
+inline void APIENTRY gl_counted_GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) { ++gl_counters.calls[GLCounter_GetMultisamplefv]; return glGetMultisamplefv(pname, index, val); }
+inline void APIENTRY gl_counted_SampleMaski(GLuint maskNumber, GLbitfield mask) { ++gl_counters.calls[GLCounter_SampleMaski]; return glSampleMaski(maskNumber, mask); }
+inline void APIENTRY gl_counted_BindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) { ++gl_counters.calls[GLCounter_BindFragDataLocationIndexed]; return glBindFragDataLocationIndexed(program, colorNumber, index, name); }
+inline GLint APIENTRY gl_counted_GetFragDataIndex(GLuint program, const GLchar *name) { ++gl_counters.calls[GLCounter_GetFragDataIndex]; return glGetFragDataIndex(program, name); }
+inline void APIENTRY gl_counted_GenSamplers(GLsizei count, GLuint *samplers) { ++gl_counters.calls[GLCounter_GenSamplers]; return glGenSamplers(count, samplers); }
+inline void APIENTRY gl_counted_DeleteSamplers(GLsizei count, const GLuint *samplers) { ++gl_counters.calls[GLCounter_DeleteSamplers]; return glDeleteSamplers(count, samplers); }
+inline GLboolean APIENTRY gl_counted_IsSampler(GLuint sampler) { ++gl_counters.calls[GLCounter_IsSampler]; return glIsSampler(sampler); }
+inline void APIENTRY gl_counted_BindSampler(GLuint unit, GLuint sampler) { ++gl_counters.calls[GLCounter_BindSampler]; return glBindSampler(unit, sampler); }
+inline void APIENTRY gl_counted_SamplerParameteri(GLuint sampler, GLenum pname, GLint param) { ++gl_counters.calls[GLCounter_SamplerParameteri]; return glSamplerParameteri(sampler, pname, param); }
+inline void APIENTRY gl_counted_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) { ++gl_counters.calls[GLCounter_SamplerParameteriv]; return glSamplerParameteriv(sampler, pname, param); }
+inline void APIENTRY gl_counted_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) { ++gl_counters.calls[GLCounter_SamplerParameterf]; return glSamplerParameterf(sampler, pname, param); }
+inline void APIENTRY gl_counted_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) { ++gl_counters.calls[GLCounter_SamplerParameterfv]; return glSamplerParameterfv(sampler, pname, param); }
+inline void APIENTRY gl_counted_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) { ++gl_counters.calls[GLCounter_SamplerParameterIiv]; return glSamplerParameterIiv(sampler, pname, param); }
+inline void APIENTRY gl_counted_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) { ++gl_counters.calls[GLCounter_SamplerParameterIuiv]; return glSamplerParameterIuiv(sampler, pname, param); }
+inline void APIENTRY gl_counted_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetSamplerParameteriv]; return glGetSamplerParameteriv(sampler, pname, params); }
+inline void APIENTRY gl_counted_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) { ++gl_counters.calls[GLCounter_GetSamplerParameterIiv]; return glGetSamplerParameterIiv(sampler, pname, params); }
+inline void APIENTRY gl_counted_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) { ++gl_counters.calls[GLCounter_GetSamplerParameterfv]; return glGetSamplerParameterfv(sampler, pname, params); }
+inline void APIENTRY gl_counted_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) { ++gl_counters.calls[GLCounter_GetSamplerParameterIuiv]; return glGetSamplerParameterIuiv(sampler, pname, params); }
+inline void APIENTRY gl_counted_QueryCounter(GLuint id, GLenum target) { ++gl_counters.calls[GLCounter_QueryCounter]; return glQueryCounter(id, target); }
+inline void APIENTRY gl_counted_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) { ++gl_counters.calls[GLCounter_GetQueryObjecti64v]; return glGetQueryObjecti64v(id, pname, params); }
+inline void APIENTRY gl_counted_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) { ++gl_counters.calls[GLCounter_GetQueryObjectui64v]; return glGetQueryObjectui64v(id, pname, params); }
+inline void APIENTRY gl_counted_VertexAttribDivisor(GLuint index, GLuint divisor) { ++gl_counters.calls[GLCounter_VertexAttribDivisor]; return glVertexAttribDivisor(index, divisor); }
+inline void APIENTRY gl_counted_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { ++gl_counters.calls[GLCounter_VertexAttribP1ui]; return glVertexAttribP1ui(index, type, normalized, value); }
+inline void APIENTRY gl_counted_VertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { ++gl_counters.calls[GLCounter_VertexAttribP1uiv]; return glVertexAttribP1uiv(index, type, normalized, value); }
+inline void APIENTRY gl_counted_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { ++gl_counters.calls[GLCounter_VertexAttribP2ui]; return glVertexAttribP2ui(index, type, normalized, value); }
+inline void APIENTRY gl_counted_VertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { ++gl_counters.calls[GLCounter_VertexAttribP2uiv]; return glVertexAttribP2uiv(index, type, normalized, value); }
+inline void APIENTRY gl_counted_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { ++gl_counters.calls[GLCounter_VertexAttribP3ui]; return glVertexAttribP3ui(index, type, normalized, value); }
+inline void APIENTRY gl_counted_VertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { ++gl_counters.calls[GLCounter_VertexAttribP3uiv]; return glVertexAttribP3uiv(index, type, normalized, value); }
+inline void APIENTRY gl_counted_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) { ++gl_counters.calls[GLCounter_VertexAttribP4ui]; return glVertexAttribP4ui(index, type, normalized, value); }
+inline void APIENTRY gl_counted_VertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) { ++gl_counters.calls[GLCounter_VertexAttribP4uiv]; return glVertexAttribP4uiv(index, type, normalized, value); }
+
+//every use of a GL function now goes through its wrapper:
+#define glCullFace gl_counted_CullFace
+#define glFrontFace gl_counted_FrontFace
+#define glHint gl_counted_Hint
+#define glLineWidth gl_counted_LineWidth
+#define glPointSize gl_counted_PointSize
+#define glPolygonMode gl_counted_PolygonMode
+#define glScissor gl_counted_Scissor
+#define glTexParameterf gl_counted_TexParameterf
+#define glTexParameterfv gl_counted_TexParameterfv
+#define glTexParameteri gl_counted_TexParameteri
+#define glTexParameteriv gl_counted_TexParameteriv
+#define glTexImage1D gl_counted_TexImage1D
+#define glTexImage2D gl_counted_TexImage2D
+#define glDrawBuffer gl_counted_DrawBuffer
+#define glClear gl_counted_Clear
+#define glClearColor gl_counted_ClearColor
+#define glClearStencil gl_counted_ClearStencil
+#define glClearDepth gl_counted_ClearDepth
+#define glStencilMask gl_counted_StencilMask
+#define glColorMask gl_counted_ColorMask
+#define glDepthMask gl_counted_DepthMask
+#define glDisable gl_counted_Disable
+#define glEnable gl_counted_Enable
+#define glFinish gl_counted_Finish
+#define glFlush gl_counted_Flush
+#define glBlendFunc gl_counted_BlendFunc
+#define glLogicOp gl_counted_LogicOp
+#define glStencilFunc gl_counted_StencilFunc
+#define glStencilOp gl_counted_StencilOp
+#define glDepthFunc gl_counted_DepthFunc
+#define glPixelStoref gl_counted_PixelStoref
+#define glPixelStorei gl_counted_PixelStorei
+#define glReadBuffer gl_counted_ReadBuffer
+#define glReadPixels gl_counted_ReadPixels
+#define glGetBooleanv gl_counted_GetBooleanv
+#define glGetDoublev gl_counted_GetDoublev
+#define glGetError gl_counted_GetError
+#define glGetFloatv gl_counted_GetFloatv
+#define glGetIntegerv gl_counted_GetIntegerv
+#define glGetString gl_counted_GetString
+#define glGetTexImage gl_counted_GetTexImage
+#define glGetTexParameterfv gl_counted_GetTexParameterfv
+#define glGetTexParameteriv gl_counted_GetTexParameteriv
+#define glGetTexLevelParameterfv gl_counted_GetTexLevelParameterfv
+#define glGetTexLevelParameteriv gl_counted_GetTexLevelParameteriv
+#define glIsEnabled gl_counted_IsEnabled
+#define glDepthRange gl_counted_DepthRange
+#define glViewport gl_counted_Viewport
+#define glDrawArrays gl_counted_DrawArrays
+#define glDrawElements gl_counted_DrawElements
+#define glGetPointerv gl_counted_GetPointerv
+#define glPolygonOffset gl_counted_PolygonOffset
+#define glCopyTexImage1D gl_counted_CopyTexImage1D
+#define glCopyTexImage2D gl_counted_CopyTexImage2D
+#define glCopyTexSubImage1D gl_counted_CopyTexSubImage1D
+#define glCopyTexSubImage2D gl_counted_CopyTexSubImage2D
+#define glTexSubImage1D gl_counted_TexSubImage1D
+#define glTexSubImage2D gl_counted_TexSubImage2D
+#define glBindTexture gl_counted_BindTexture
+#define glDeleteTextures gl_counted_DeleteTextures
+#define glGenTextures gl_counted_GenTextures
+#define glIsTexture gl_counted_IsTexture
+#define glDrawRangeElements gl_counted_DrawRangeElements
+#define glTexImage3D gl_counted_TexImage3D
+#define glTexSubImage3D gl_counted_TexSubImage3D
+#define glCopyTexSubImage3D gl_counted_CopyTexSubImage3D
+#define glActiveTexture gl_counted_ActiveTexture
+#define glSampleCoverage gl_counted_SampleCoverage
+#define glCompressedTexImage3D gl_counted_CompressedTexImage3D
+#define glCompressedTexImage2D gl_counted_CompressedTexImage2D
+#define glCompressedTexImage1D gl_counted_CompressedTexImage1D
+#define glCompressedTexSubImage3D gl_counted_CompressedTexSubImage3D
+#define glCompressedTexSubImage2D gl_counted_CompressedTexSubImage2D
+#define glCompressedTexSubImage1D gl_counted_CompressedTexSubImage1D
+#define glGetCompressedTexImage gl_counted_GetCompressedTexImage
+#define glBlendFuncSeparate gl_counted_BlendFuncSeparate
+#define glMultiDrawArrays gl_counted_MultiDrawArrays
+#define glMultiDrawElements gl_counted_MultiDrawElements
+#define glPointParameterf gl_counted_PointParameterf
+#define glPointParameterfv gl_counted_PointParameterfv
+#define glPointParameteri gl_counted_PointParameteri
+#define glPointParameteriv gl_counted_PointParameteriv
+#define glBlendColor gl_counted_BlendColor
+#define glBlendEquation gl_counted_BlendEquation
+#define glGenQueries gl_counted_GenQueries
+#define glDeleteQueries gl_counted_DeleteQueries
+#define glIsQuery gl_counted_IsQuery
+#define glBeginQuery gl_counted_BeginQuery
+#define glEndQuery gl_counted_EndQuery
+#define glGetQueryiv gl_counted_GetQueryiv
+#define glGetQueryObjectiv gl_counted_GetQueryObjectiv
+#define glGetQueryObjectuiv gl_counted_GetQueryObjectuiv
+#define glBindBuffer gl_counted_BindBuffer
+#define glDeleteBuffers gl_counted_DeleteBuffers
+#define glGenBuffers gl_counted_GenBuffers
+#define glIsBuffer gl_counted_IsBuffer
+#define glBufferData gl_counted_BufferData
+#define glBufferSubData gl_counted_BufferSubData
+#define glGetBufferSubData gl_counted_GetBufferSubData
+#define glMapBuffer gl_counted_MapBuffer
+#define glUnmapBuffer gl_counted_UnmapBuffer
+#define glGetBufferParameteriv gl_counted_GetBufferParameteriv
+#define glGetBufferPointerv gl_counted_GetBufferPointerv
+#define glBlendEquationSeparate gl_counted_BlendEquationSeparate
+#define glDrawBuffers gl_counted_DrawBuffers
+#define glStencilOpSeparate gl_counted_StencilOpSeparate
+#define glStencilFuncSeparate gl_counted_StencilFuncSeparate
+#define glStencilMaskSeparate gl_counted_StencilMaskSeparate
+#define glAttachShader gl_counted_AttachShader
+#define glBindAttribLocation gl_counted_BindAttribLocation
+#define glCompileShader gl_counted_CompileShader
+#define glCreateProgram gl_counted_CreateProgram
+#define glCreateShader gl_counted_CreateShader
+#define glDeleteProgram gl_counted_DeleteProgram
+#define glDeleteShader gl_counted_DeleteShader
+#define glDetachShader gl_counted_DetachShader
+#define glDisableVertexAttribArray gl_counted_DisableVertexAttribArray
+#define glEnableVertexAttribArray gl_counted_EnableVertexAttribArray
+#define glGetActiveAttrib gl_counted_GetActiveAttrib
+#define glGetActiveUniform gl_counted_GetActiveUniform
+#define glGetAttachedShaders gl_counted_GetAttachedShaders
+#define glGetAttribLocation gl_counted_GetAttribLocation
+#define glGetProgramiv gl_counted_GetProgramiv
+#define glGetProgramInfoLog gl_counted_GetProgramInfoLog
+#define glGetShaderiv gl_counted_GetShaderiv
+#define glGetShaderInfoLog gl_counted_GetShaderInfoLog
+#define glGetShaderSource gl_counted_GetShaderSource
+#define glGetUniformLocation gl_counted_GetUniformLocation
+#define glGetUniformfv gl_counted_GetUniformfv
+#define glGetUniformiv gl_counted_GetUniformiv
+#define glGetVertexAttribdv gl_counted_GetVertexAttribdv
+#define glGetVertexAttribfv gl_counted_GetVertexAttribfv
+#define glGetVertexAttribiv gl_counted_GetVertexAttribiv
+#define glGetVertexAttribPointerv gl_counted_GetVertexAttribPointerv
+#define glIsProgram gl_counted_IsProgram
+#define glIsShader gl_counted_IsShader
+#define glLinkProgram gl_counted_LinkProgram
+#define glShaderSource gl_counted_ShaderSource
+#define glUseProgram gl_counted_UseProgram
+#define glUniform1f gl_counted_Uniform1f
+#define glUniform2f gl_counted_Uniform2f
+#define glUniform3f gl_counted_Uniform3f
+#define glUniform4f gl_counted_Uniform4f
+#define glUniform1i gl_counted_Uniform1i
+#define glUniform2i gl_counted_Uniform2i
+#define glUniform3i gl_counted_Uniform3i
+#define glUniform4i gl_counted_Uniform4i
+#define glUniform1fv gl_counted_Uniform1fv
+#define glUniform2fv gl_counted_Uniform2fv
+#define glUniform3fv gl_counted_Uniform3fv
+#define glUniform4fv gl_counted_Uniform4fv
+#define glUniform1iv gl_counted_Uniform1iv
+#define glUniform2iv gl_counted_Uniform2iv
+#define glUniform3iv gl_counted_Uniform3iv
+#define glUniform4iv gl_counted_Uniform4iv
+#define glUniformMatrix2fv gl_counted_UniformMatrix2fv
+#define glUniformMatrix3fv gl_counted_UniformMatrix3fv
+#define glUniformMatrix4fv gl_counted_UniformMatrix4fv
+#define glValidateProgram gl_counted_ValidateProgram
+#define glVertexAttrib1d gl_counted_VertexAttrib1d
+#define glVertexAttrib1dv gl_counted_VertexAttrib1dv
+#define glVertexAttrib1f gl_counted_VertexAttrib1f
+#define glVertexAttrib1fv gl_counted_VertexAttrib1fv
+#define glVertexAttrib1s gl_counted_VertexAttrib1s
+#define glVertexAttrib1sv gl_counted_VertexAttrib1sv
+#define glVertexAttrib2d gl_counted_VertexAttrib2d
+#define glVertexAttrib2dv gl_counted_VertexAttrib2dv
+#define glVertexAttrib2f gl_counted_VertexAttrib2f
+#define glVertexAttrib2fv gl_counted_VertexAttrib2fv
+#define glVertexAttrib2s gl_counted_VertexAttrib2s
+#define glVertexAttrib2sv gl_counted_VertexAttrib2sv
+#define glVertexAttrib3d gl_counted_VertexAttrib3d
+#define glVertexAttrib3dv gl_counted_VertexAttrib3dv
+#define glVertexAttrib3f gl_counted_VertexAttrib3f
+#define glVertexAttrib3fv gl_counted_VertexAttrib3fv
+#define glVertexAttrib3s gl_counted_VertexAttrib3s
+#define glVertexAttrib3sv gl_counted_VertexAttrib3sv
+#define glVertexAttrib4Nbv gl_counted_VertexAttrib4Nbv
+#define glVertexAttrib4Niv gl_counted_VertexAttrib4Niv
+#define glVertexAttrib4Nsv gl_counted_VertexAttrib4Nsv
+#define glVertexAttrib4Nub gl_counted_VertexAttrib4Nub
+#define glVertexAttrib4Nubv gl_counted_VertexAttrib4Nubv
+#define glVertexAttrib4Nuiv gl_counted_VertexAttrib4Nuiv
+#define glVertexAttrib4Nusv gl_counted_VertexAttrib4Nusv
+#define glVertexAttrib4bv gl_counted_VertexAttrib4bv
+#define glVertexAttrib4d gl_counted_VertexAttrib4d
+#define glVertexAttrib4dv gl_counted_VertexAttrib4dv
+#define glVertexAttrib4f gl_counted_VertexAttrib4f
+#define glVertexAttrib4fv gl_counted_VertexAttrib4fv
+#define glVertexAttrib4iv gl_counted_VertexAttrib4iv
+#define glVertexAttrib4s gl_counted_VertexAttrib4s
+#define glVertexAttrib4sv gl_counted_VertexAttrib4sv
+#define glVertexAttrib4ubv gl_counted_VertexAttrib4ubv
+#define glVertexAttrib4uiv gl_counted_VertexAttrib4uiv
+#define glVertexAttrib4usv gl_counted_VertexAttrib4usv
+#define glVertexAttribPointer gl_counted_VertexAttribPointer
+#define glUniformMatrix2x3fv gl_counted_UniformMatrix2x3fv
+#define glUniformMatrix3x2fv gl_counted_UniformMatrix3x2fv
+#define glUniformMatrix2x4fv gl_counted_UniformMatrix2x4fv
+#define glUniformMatrix4x2fv gl_counted_UniformMatrix4x2fv
+#define glUniformMatrix3x4fv gl_counted_UniformMatrix3x4fv
+#define glUniformMatrix4x3fv gl_counted_UniformMatrix4x3fv
+#define glColorMaski gl_counted_ColorMaski
+#define glGetBooleani_v gl_counted_GetBooleani_v
+#define glGetIntegeri_v gl_counted_GetIntegeri_v
+#define glEnablei gl_counted_Enablei
+#define glDisablei gl_counted_Disablei
+#define glIsEnabledi gl_counted_IsEnabledi
+#define glBeginTransformFeedback gl_counted_BeginTransformFeedback
+#define glEndTransformFeedback gl_counted_EndTransformFeedback
+#define glBindBufferRange gl_counted_BindBufferRange
+#define glBindBufferBase gl_counted_BindBufferBase
+#define glTransformFeedbackVaryings gl_counted_TransformFeedbackVaryings
+#define glGetTransformFeedbackVarying gl_counted_GetTransformFeedbackVarying
+#define glClampColor gl_counted_ClampColor
+#define glBeginConditionalRender gl_counted_BeginConditionalRender
+#define glEndConditionalRender gl_counted_EndConditionalRender
+#define glVertexAttribIPointer gl_counted_VertexAttribIPointer
+#define glGetVertexAttribIiv gl_counted_GetVertexAttribIiv
+#define glGetVertexAttribIuiv gl_counted_GetVertexAttribIuiv
+#define glVertexAttribI1i gl_counted_VertexAttribI1i
+#define glVertexAttribI2i gl_counted_VertexAttribI2i
+#define glVertexAttribI3i gl_counted_VertexAttribI3i
+#define glVertexAttribI4i gl_counted_VertexAttribI4i
+#define glVertexAttribI1ui gl_counted_VertexAttribI1ui
+#define glVertexAttribI2ui gl_counted_VertexAttribI2ui
+#define glVertexAttribI3ui gl_counted_VertexAttribI3ui
+#define glVertexAttribI4ui gl_counted_VertexAttribI4ui
+#define glVertexAttribI1iv gl_counted_VertexAttribI1iv
+#define glVertexAttribI2iv gl_counted_VertexAttribI2iv
+#define glVertexAttribI3iv gl_counted_VertexAttribI3iv
+#define glVertexAttribI4iv gl_counted_VertexAttribI4iv
+#define glVertexAttribI1uiv gl_counted_VertexAttribI1uiv
+#define glVertexAttribI2uiv gl_counted_VertexAttribI2uiv
+#define glVertexAttribI3uiv gl_counted_VertexAttribI3uiv
+#define glVertexAttribI4uiv gl_counted_VertexAttribI4uiv
+#define glVertexAttribI4bv gl_counted_VertexAttribI4bv
+#define glVertexAttribI4sv gl_counted_VertexAttribI4sv
+#define glVertexAttribI4ubv gl_counted_VertexAttribI4ubv
+#define glVertexAttribI4usv gl_counted_VertexAttribI4usv
+#define glGetUniformuiv gl_counted_GetUniformuiv
+#define glBindFragDataLocation gl_counted_BindFragDataLocation
+#define glGetFragDataLocation gl_counted_GetFragDataLocation
+#define glUniform1ui gl_counted_Uniform1ui
+#define glUniform2ui gl_counted_Uniform2ui
+#define glUniform3ui gl_counted_Uniform3ui
+#define glUniform4ui gl_counted_Uniform4ui
+#define glUniform1uiv gl_counted_Uniform1uiv
+#define glUniform2uiv gl_counted_Uniform2uiv
+#define glUniform3uiv gl_counted_Uniform3uiv
+#define glUniform4uiv gl_counted_Uniform4uiv
+#define glTexParameterIiv gl_counted_TexParameterIiv
+#define glTexParameterIuiv gl_counted_TexParameterIuiv
+#define glGetTexParameterIiv gl_counted_GetTexParameterIiv
+#define glGetTexParameterIuiv gl_counted_GetTexParameterIuiv
+#define glClearBufferiv gl_counted_ClearBufferiv
+#define glClearBufferuiv gl_counted_ClearBufferuiv
+#define glClearBufferfv gl_counted_ClearBufferfv
+#define glClearBufferfi gl_counted_ClearBufferfi
+#define glGetStringi gl_counted_GetStringi
+#define glIsRenderbuffer gl_counted_IsRenderbuffer
+#define glBindRenderbuffer gl_counted_BindRenderbuffer
+#define glDeleteRenderbuffers gl_counted_DeleteRenderbuffers
+#define glGenRenderbuffers gl_counted_GenRenderbuffers
+#define glRenderbufferStorage gl_counted_RenderbufferStorage
+#define glGetRenderbufferParameteriv gl_counted_GetRenderbufferParameteriv
+#define glIsFramebuffer gl_counted_IsFramebuffer
+#define glBindFramebuffer gl_counted_BindFramebuffer
+#define glDeleteFramebuffers gl_counted_DeleteFramebuffers
+#define glGenFramebuffers gl_counted_GenFramebuffers
+#define glCheckFramebufferStatus gl_counted_CheckFramebufferStatus
+#define glFramebufferTexture1D gl_counted_FramebufferTexture1D
+#define glFramebufferTexture2D gl_counted_FramebufferTexture2D
+#define glFramebufferTexture3D gl_counted_FramebufferTexture3D
+#define glFramebufferRenderbuffer gl_counted_FramebufferRenderbuffer
+#define glGetFramebufferAttachmentParameteriv gl_counted_GetFramebufferAttachmentParameteriv
+#define glGenerateMipmap gl_counted_GenerateMipmap
+#define glBlitFramebuffer gl_counted_BlitFramebuffer
+#define glRenderbufferStorageMultisample gl_counted_RenderbufferStorageMultisample
+#define glFramebufferTextureLayer gl_counted_FramebufferTextureLayer
+#define glMapBufferRange gl_counted_MapBufferRange
+#define glFlushMappedBufferRange gl_counted_FlushMappedBufferRange
+#define glBindVertexArray gl_counted_BindVertexArray
+#define glDeleteVertexArrays gl_counted_DeleteVertexArrays
+#define glGenVertexArrays gl_counted_GenVertexArrays
+#define glIsVertexArray gl_counted_IsVertexArray
+#define glDrawArraysInstanced gl_counted_DrawArraysInstanced
+#define glDrawElementsInstanced gl_counted_DrawElementsInstanced
+#define glTexBuffer gl_counted_TexBuffer
+#define glPrimitiveRestartIndex gl_counted_PrimitiveRestartIndex
+#define glCopyBufferSubData gl_counted_CopyBufferSubData
+#define glGetUniformIndices gl_counted_GetUniformIndices
+#define glGetActiveUniformsiv gl_counted_GetActiveUniformsiv
+#define glGetActiveUniformName gl_counted_GetActiveUniformName
+#define glGetUniformBlockIndex gl_counted_GetUniformBlockIndex
+#define glGetActiveUniformBlockiv gl_counted_GetActiveUniformBlockiv
+#define glGetActiveUniformBlockName gl_counted_GetActiveUniformBlockName
+#define glUniformBlockBinding gl_counted_UniformBlockBinding
+#define glDrawElementsBaseVertex gl_counted_DrawElementsBaseVertex
+#define glDrawRangeElementsBaseVertex gl_counted_DrawRangeElementsBaseVertex
+#define glDrawElementsInstancedBaseVertex gl_counted_DrawElementsInstancedBaseVertex
+#define glMultiDrawElementsBaseVertex gl_counted_MultiDrawElementsBaseVertex
+#define glProvokingVertex gl_counted_ProvokingVertex
+#define glFenceSync gl_counted_FenceSync
+#define glIsSync gl_counted_IsSync
+#define glDeleteSync gl_counted_DeleteSync
+#define glClientWaitSync gl_counted_ClientWaitSync
+#define glWaitSync gl_counted_WaitSync
+#define glGetInteger64v gl_counted_GetInteger64v
+#define glGetSynciv gl_counted_GetSynciv
+#define glGetInteger64i_v gl_counted_GetInteger64i_v
+#define glGetBufferParameteri64v gl_counted_GetBufferParameteri64v
+#define glFramebufferTexture gl_counted_FramebufferTexture
+#define glTexImage2DMultisample gl_counted_TexImage2DMultisample
+#define glTexImage3DMultisample gl_counted_TexImage3DMultisample
+#define glGetMultisamplefv gl_counted_GetMultisamplefv
+#define glSampleMaski gl_counted_SampleMaski
+#define glBindFragDataLocationIndexed gl_counted_BindFragDataLocationIndexed
+#define glGetFragDataIndex gl_counted_GetFragDataIndex
+#define glGenSamplers gl_counted_GenSamplers
+#define glDeleteSamplers gl_counted_DeleteSamplers
+#define glIsSampler gl_counted_IsSampler
+#define glBindSampler gl_counted_BindSampler
+#define glSamplerParameteri gl_counted_SamplerParameteri
+#define glSamplerParameteriv gl_counted_SamplerParameteriv
+#define glSamplerParameterf gl_counted_SamplerParameterf
+#define glSamplerParameterfv gl_counted_SamplerParameterfv
+#define glSamplerParameterIiv gl_counted_SamplerParameterIiv
+#define glSamplerParameterIuiv gl_counted_SamplerParameterIuiv
+#define glGetSamplerParameteriv gl_counted_GetSamplerParameteriv
+#define glGetSamplerParameterIiv gl_counted_GetSamplerParameterIiv
+#define glGetSamplerParameterfv gl_counted_GetSamplerParameterfv
+#define glGetSamplerParameterIuiv gl_counted_GetSamplerParameterIuiv
+#define glQueryCounter gl_counted_QueryCounter
+#define glGetQueryObjecti64v gl_counted_GetQueryObjecti64v
+#define glGetQueryObjectui64v gl_counted_GetQueryObjectui64v
+#define glVertexAttribDivisor gl_counted_VertexAttribDivisor
+#define glVertexAttribP1ui gl_counted_VertexAttribP1ui
+#define glVertexAttribP1uiv gl_counted_VertexAttribP1uiv
+#define glVertexAttribP2ui gl_counted_VertexAttribP2ui
+#define glVertexAttribP2uiv gl_counted_VertexAttribP2uiv
+#define glVertexAttribP3ui gl_counted_VertexAttribP3ui
+#define glVertexAttribP3uiv gl_counted_VertexAttribP3uiv
+#define glVertexAttribP4ui gl_counted_VertexAttribP4ui
+#define glVertexAttribP4uiv gl_counted_VertexAttribP4uiv
+
+#ifdef GL_COUNTERS_IMPLEMENTATION
+GLCounters gl_counters;
+char const *const GLCounterNames[GLCounterCount] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+};
+#endif //GL_COUNTERS_IMPLEMENTATION
@@ -0,0 +1,143 @@
+#include "gl_debug.hpp"
+
+#include "GL.hpp"
+#include "gl_errors.hpp"
+
+#include <SDL.h>
+
+#include <chrono>
+#include <functional>
+#include <iostream>
+#include <mutex>
+#include <string>
+#include <unordered_map>
+
+namespace {
+	//at most this many new messages are printed per second:
+	constexpr uint32_t MaxMessagesPerSecond = 10;
+
+	struct Seen {
+		std::string text; //(as first printed)
+		uint32_t count = 0; //times the message has been sent
+		uint32_t printed = 0; //times it has been printed (0 or 1)
+	};
+
+	//(the callback may be called from a driver thread when output is asynchronous)
+	std::mutex mutex;
+	std::unordered_map< size_t, Seen > seen;
+	std::chrono::steady_clock::time_point window_start;
+	uint32_t printed_in_window = 0;
+	uint32_t suppressed_in_window = 0;
+
+	char const *source_name(GLenum source) {
+		switch (source) {
+			case GL_DEBUG_SOURCE_API: return "api";
+			case GL_DEBUG_SOURCE_WINDOW_SYSTEM: return "window system";
+			case GL_DEBUG_SOURCE_SHADER_COMPILER: return "shader compiler";
+			case GL_DEBUG_SOURCE_THIRD_PARTY: return "third party";
+			case GL_DEBUG_SOURCE_APPLICATION: return "application";
+			default: return "other";
+		}
+	}
+
+	char const *type_name(GLenum type) {
+		switch (type) {
+			case GL_DEBUG_TYPE_ERROR: return "error";
+			case GL_DEBUG_TYPE_DEPRECATED_BEHAVIOR: return "deprecated behavior";
+			case GL_DEBUG_TYPE_UNDEFINED_BEHAVIOR: return "undefined behavior";
+			case GL_DEBUG_TYPE_PORTABILITY: return "portability";
+			case GL_DEBUG_TYPE_PERFORMANCE: return "performance";
+			default: return "other";
+		}
+	}
+
+	char const *severity_name(GLenum severity) {
+		switch (severity) {
+			case GL_DEBUG_SEVERITY_HIGH: return "high";
+			case GL_DEBUG_SEVERITY_MEDIUM: return "medium";
+			case GL_DEBUG_SEVERITY_LOW: return "low";
+			default: return "notification";
+		}
+	}
+
+	void APIENTRY debug_callback(GLenum source, GLenum type, GLuint id, GLenum severity, GLsizei length, GLchar const *message, void const *) {
+		//notifications are chatty (buffer placement, etc.) and not problems:
+		if (severity == GL_DEBUG_SEVERITY_NOTIFICATION) return;
+
+		std::string text = (length >= 0 ? std::string(message, length) : std::string(message));
+		size_t key = std::hash< std::string >()(text) ^ ((size_t(source) * 31 + size_t(type)) * 31 + size_t(id));
+
+		std::unique_lock< std::mutex > lock(mutex);
+
+		Seen &entry = seen[key];
+		++entry.count;
+		if (entry.printed) return; //(repeats are only counted)
+
+		//rate limit: only a few new messages per one-second window:
+		auto now = std::chrono::steady_clock::now();
+		if (now - window_start >= std::chrono::seconds(1)) {
+			if (suppressed_in_window) {
+				std::cerr << "WARNING: " << suppressed_in_window << " more OpenGL messages were not shown." << std::endl;
+			}
+			window_start = now;
+			printed_in_window = 0;
+			suppressed_in_window = 0;
+		}
+		if (printed_in_window >= MaxMessagesPerSecond) {
+			++suppressed_in_window;
+			return;
+		}
+		++printed_in_window;
+
+		entry.text = text;
+		entry.printed = 1;
+		std::cerr << "WARNING: gl " << type_name(type) << " (" << source_name(source) << ", " << severity_name(severity) << " severity): " << text << std::endl;
+	}
+}
+
+bool gl_debug_init() {
+	//KHR_debug functions have no suffix on desktop GL (and are core in 4.3); ARB_debug_output's have 'ARB':
+	PFNGLDEBUGMESSAGECALLBACKPROC message_callback = nullptr;
+	PFNGLDEBUGMESSAGECONTROLPROC message_control = nullptr;
+	bool khr = false;
+	if (SDL_GL_ExtensionSupported("GL_KHR_debug")) {
+		message_callback = (PFNGLDEBUGMESSAGECALLBACKPROC)SDL_GL_GetProcAddress("glDebugMessageCallback");
+		message_control = (PFNGLDEBUGMESSAGECONTROLPROC)SDL_GL_GetProcAddress("glDebugMessageControl");
+		khr = true;
+	} else if (SDL_GL_ExtensionSupported("GL_ARB_debug_output")) {
+		message_callback = (PFNGLDEBUGMESSAGECALLBACKPROC)SDL_GL_GetProcAddress("glDebugMessageCallbackARB");
+		message_control = (PFNGLDEBUGMESSAGECONTROLPROC)SDL_GL_GetProcAddress("glDebugMessageControlARB");
+	}
+	if (!message_callback) return false;
+
+	//clear any errors from before the callback existed:
+	while (glGetError() != GL_NO_ERROR) { }
+
+	message_callback(debug_callback, nullptr);
+	if (message_control) {
+		//(the callback ignores these too, but this way the driver doesn't bother making them)
+		message_control(GL_DONT_CARE, GL_DONT_CARE, GL_DEBUG_SEVERITY_NOTIFICATION, 0, nullptr, GL_FALSE);
+	}
+	if (khr) glEnable(GL_DEBUG_OUTPUT); //(ARB_debug_output is always on in a debug context)
+	#ifndef NDEBUG
+	//in debug builds, report messages during the offending call (so a breakpoint in the callback shows where it came from):
+	glEnable(GL_DEBUG_OUTPUT_SYNCHRONOUS);
+	#endif
+
+	gl_debug_installed() = true;
+	return true;
+}
+
+void gl_debug_report() {
+	std::unique_lock< std::mutex > lock(mutex);
+	if (suppressed_in_window) {
+		std::cerr << "WARNING: " << suppressed_in_window << " more OpenGL messages were not shown." << std::endl;
+		suppressed_in_window = 0;
+	}
+	for (auto const &kv : seen) {
+		Seen const &entry = kv.second;
+		if (entry.printed && entry.count > 1) {
+			std::cerr << "NOTE: OpenGL message repeated " << entry.count << " times: " << entry.text << std::endl;
+		}
+	}
+}
@@ -0,0 +1,14 @@
+#pragma once
+
+//gl_debug_init installs a GL_KHR_debug (or GL_ARB_debug_output) message callback, if the
+// context supports one, so OpenGL errors are reported as they happen instead of being
+// polled for with glGetError (which can stall the pipeline):
+// - repeats of a message are counted rather than printed again,
+// - at most a few new messages are printed per second (the rest are counted), and
+// - gl_debug_report() prints how often each message was repeated.
+//Once the callback is installed, GL_ERRORS() stops calling glGetError.
+//Returns true if the callback was installed; must be called with the context current.
+bool gl_debug_init();
+
+//print repeat counts for messages that were held back (e.g., at exit):
+void gl_debug_report();
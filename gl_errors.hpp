@@ -28,5 +28,18 @@ inline void gl_errors(std::string const &where) {
 		#undef CHECK
 	}
 }
-#define GL_ERRORS() gl_errors(__FILE__  ":" STR(__LINE__) )
+
+//set by gl_debug_init once OpenGL errors are reported through a debug message callback:
+inline bool &gl_debug_installed() {
+	static bool installed = false;
+	return installed;
+}
+
+//GL_ERRORS() checks for errors (unless they are already being reported by a debug callback);
+// release builds (NDEBUG) don't check at all, so no per-frame error query is issued:
+#ifdef NDEBUG
+#define GL_ERRORS() ((void)0)
+#else
+#define GL_ERRORS() do { if (!gl_debug_installed()) gl_errors(__FILE__  ":" STR(__LINE__) ); } while (0)
+#endif
 
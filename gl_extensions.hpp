@@ -0,0 +1,24 @@
+#pragma once
+
+#include "GL.hpp"
+
+#include <cstring>
+
+//does the current context list extension 'name'? (e.g., "GL_ARB_buffer_storage")
+inline bool gl_has_extension(char const *name) {
+	GLint extensions = 0;
+	glGetIntegerv(GL_NUM_EXTENSIONS, &extensions);
+	for (GLint i = 0; i < extensions; ++i) {
+		char const *extension = reinterpret_cast< char const * >(glGetStringi(GL_EXTENSIONS, i));
+		if (extension && std::strcmp(extension, name) == 0) return true;
+	}
+	return false;
+}
+
+//is the context at least version major.minor?
+inline bool gl_version_at_least(GLint major, GLint minor) {
+	GLint have_major = 0, have_minor = 0;
+	glGetIntegerv(GL_MAJOR_VERSION, &have_major);
+	glGetIntegerv(GL_MINOR_VERSION, &have_minor);
+	return have_major > major || (have_major == major && have_minor >= minor);
+}
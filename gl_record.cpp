@@ -0,0 +1,265 @@
+//(the wrappers' names are not redirected here, so the recorder's own GL calls aren't recorded)
+#define GL_RECORD_IMPLEMENTATION
+#include "gl_record.hpp"
+
+#include <cstdio>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <unordered_map>
+#include <vector>
+
+#ifdef GL_RECORD
+
+bool gl_recording = false;
+
+namespace {
+	std::string path;
+	FILE *file = nullptr;
+	std::vector< char > buffer; //(written to the file in large pieces)
+	uint32_t frames_to_record = 0;
+	uint32_t frames_recorded = 0;
+	uint64_t calls_recorded = 0;
+	uint64_t bytes_written = 0;
+	std::vector< uint32_t > unsupported; //calls that couldn't be recorded, by id
+
+	//buffers mapped while recording, so whatever is written to them can be recorded when they are flushed or unmapped:
+	struct Mapping {
+		uint8_t *pointer = nullptr;
+		GLsizeiptr length = 0;
+		GLbitfield access = 0;
+	};
+	std::unordered_map< GLenum, Mapping > mappings;
+
+	void flush() {
+		if (!buffer.empty() && fwrite(buffer.data(), 1, buffer.size(), file) != buffer.size()) {
+			std::cerr << "WARNING: failed to write to recording '" << path << "'." << std::endl;
+		}
+		bytes_written += buffer.size();
+		buffer.clear();
+	}
+
+	void mapped_data(GLenum target, Mapping const &mapping, GLintptr offset, GLsizeiptr length) {
+		if (!mapping.pointer || offset < 0 || length < 0 || offset + length > mapping.length) return;
+		gl_record_call(GLRecordMappedData);
+		gl_record_value(target);
+		gl_record_value(uint64_t(offset));
+		gl_record_data(mapping.pointer + offset, size_t(length));
+	}
+}
+
+void gl_record_call(uint16_t call) {
+	gl_record_value(call);
+	++calls_recorded;
+}
+
+void gl_record_bytes(void const *bytes, size_t size) {
+	buffer.insert(buffer.end(), reinterpret_cast< char const * >(bytes), reinterpret_cast< char const * >(bytes) + size);
+	if (buffer.size() >= (1 << 20)) flush();
+}
+
+void gl_record_data(void const *data, size_t size) {
+	if (!data) {
+		gl_record_value(uint8_t(GLRecordNull));
+		return;
+	}
+	gl_record_value(uint8_t(GLRecordBytes));
+	gl_record_value(uint64_t(size));
+	gl_record_bytes(data, size);
+}
+
+void gl_record_string(char const *str) {
+	//(including the terminator, so the replayer can use the string where it is)
+	gl_record_data(str, str ? std::strlen(str) + 1 : 0);
+}
+
+void gl_record_strings(GLsizei count, GLchar const *const *strs, GLint const *lengths) {
+	gl_record_value(uint32_t(gl_record_count(count)));
+	for (GLsizei i = 0; i < count; ++i) {
+		size_t length = (lengths && lengths[i] >= 0 ? size_t(lengths[i]) : std::strlen(strs[i]));
+		gl_record_value(uint8_t(GLRecordBytes));
+		gl_record_value(uint64_t(length + 1));
+		gl_record_bytes(strs[i], length);
+		gl_record_value('\0');
+	}
+}
+
+void gl_record_offsets(void const *const *offsets, GLsizei count) {
+	if (!offsets) {
+		gl_record_data(nullptr, 0);
+		return;
+	}
+	std::vector< uint64_t > values(gl_record_count(count));
+	for (size_t i = 0; i < values.size(); ++i) {
+		values[i] = uint64_t(uintptr_t(offsets[i]));
+	}
+	gl_record_data(values.data(), values.size() * sizeof(uint64_t));
+}
+
+void gl_record_pixels(void const *pixels, size_t size) {
+	GLint unpack = 0;
+	glGetIntegerv(GL_PIXEL_UNPACK_BUFFER_BINDING, &unpack);
+	if (unpack != 0) {
+		gl_record_value(uint8_t(GLRecordOffset));
+		gl_record_value(uint64_t(uintptr_t(pixels)));
+	} else {
+		gl_record_data(pixels, size);
+	}
+}
+
+void gl_record_pixels_out(void *pixels) {
+	GLint pack = 0;
+	glGetIntegerv(GL_PIXEL_PACK_BUFFER_BINDING, &pack);
+	if (pack != 0) {
+		gl_record_value(uint8_t(GLRecordOffset));
+		gl_record_value(uint64_t(uintptr_t(pixels)));
+	} else {
+		//(read into client memory; the replayer reads into memory of its own)
+		gl_record_value(uint8_t(GLRecordNull));
+	}
+}
+
+void gl_record_unsupported(uint16_t call) {
+	//(recorded without parameters, so the replayer can count what it's missing)
+	gl_record_call(call);
+	if (unsupported.size() <= call) unsupported.resize(call + 1, 0);
+	unsupported[call] += 1;
+}
+
+void gl_record_mapped(GLenum target, void *pointer, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	Mapping &mapping = mappings[target];
+	mapping.pointer = reinterpret_cast< uint8_t * >(pointer);
+	mapping.length = length;
+	mapping.access = access;
+	if (length < 0) {
+		//glMapBuffer maps the whole buffer, with an access enum instead of bits:
+		GLint size = 0;
+		glGetBufferParameteriv(target, GL_BUFFER_SIZE, &size);
+		mapping.length = size;
+		if (access == GL_READ_ONLY) mapping.access = GL_MAP_READ_BIT;
+		else if (access == GL_WRITE_ONLY) mapping.access = GL_MAP_WRITE_BIT;
+		else mapping.access = GL_MAP_READ_BIT | GL_MAP_WRITE_BIT;
+	}
+}
+
+void gl_record_unmapping(GLenum target) {
+	auto f = mappings.find(target);
+	if (f == mappings.end()) return;
+	//(explicitly flushed ranges were already recorded when they were flushed)
+	if ((f->second.access & GL_MAP_WRITE_BIT) && !(f->second.access & GL_MAP_FLUSH_EXPLICIT_BIT)) {
+		mapped_data(target, f->second, 0, f->second.length);
+	}
+	mappings.erase(f);
+}
+
+void gl_record_flushing(GLenum target, GLintptr offset, GLsizeiptr length) {
+	auto f = mappings.find(target);
+	if (f == mappings.end()) return;
+	mapped_data(target, f->second, offset, length);
+}
+
+bool gl_record_available() {
+	return true;
+}
+
+void gl_record_begin(std::string const &path_, uint32_t frames, glm::uvec2 drawable_size) {
+	if (file) throw std::runtime_error("Already recording to '" + path + "'.");
+	file = fopen(path_.c_str(), "wb");
+	if (!file) throw std::runtime_error("Failed to open '" + path_ + "' for writing.");
+	path = path_;
+	frames_to_record = frames;
+	frames_recorded = 0;
+	calls_recorded = 0;
+	bytes_written = 0;
+	unsupported.clear();
+	mappings.clear();
+
+	gl_record_bytes(GLRecordMagic, sizeof(GLRecordMagic));
+	gl_record_value(GLRecordVersion);
+	gl_record_value(uint32_t(drawable_size.x));
+	gl_record_value(uint32_t(drawable_size.y));
+	gl_record_value(uint32_t(GLRecordCallCount));
+	for (uint32_t i = 0; i < GLRecordCallCount; ++i) {
+		std::string name = GLRecordCallNames[i];
+		gl_record_value(uint8_t(name.size()));
+		gl_record_bytes(name.data(), name.size());
+	}
+
+	gl_recording = true;
+	std::cout << "Recording OpenGL calls for " << frames << " frames to '" << path << "'." << std::endl;
+}
+
+void gl_record_frame() {
+	if (!gl_recording) return;
+	gl_record_value(GLRecordFrameEnd);
+	++frames_recorded;
+	if (frames_recorded >= frames_to_record) gl_record_end();
+}
+
+void gl_record_end() {
+	if (!file) return;
+	gl_recording = false;
+	flush();
+	fclose(file);
+	file = nullptr;
+
+	std::cout << "Recorded " << frames_recorded << " frames (" << calls_recorded << " calls, "
+		<< (bytes_written / 1024) << " KB) to '" << path << "'." << std::endl;
+	for (uint32_t i = 0; i < unsupported.size(); ++i) {
+		if (unsupported[i]) {
+			std::cerr << "WARNING: " << GLRecordCallNames[i] << " was called " << unsupported[i] << " times, but can't be recorded (replays will skip it)." << std::endl;
+		}
+	}
+}
+
+#else //GL_RECORD
+
+bool gl_record_available() {
+	return false;
+}
+
+void gl_record_begin(std::string const &, uint32_t, glm::uvec2) {
+	throw std::runtime_error("This build can't record OpenGL calls (rebuild with 'jam -sGL_RECORD=1').");
+}
+
+void gl_record_frame() {
+}
+
+void gl_record_end() {
+}
+
+#endif //GL_RECORD
+
+size_t gl_pixels_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type) {
+	if (width <= 0 || height <= 0 || depth <= 0) return 0;
+
+	size_t components = 4;
+	switch (format) {
+		case GL_RED: case GL_GREEN: case GL_BLUE: case GL_RED_INTEGER: case GL_GREEN_INTEGER: case GL_BLUE_INTEGER:
+		case GL_DEPTH_COMPONENT: case GL_STENCIL_INDEX:
+			components = 1; break;
+		case GL_RG: case GL_RG_INTEGER: case GL_DEPTH_STENCIL:
+			components = 2; break;
+		case GL_RGB: case GL_BGR: case GL_RGB_INTEGER: case GL_BGR_INTEGER:
+			components = 3; break;
+		default:
+			components = 4; break;
+	}
+
+	size_t pixel = 0;
+	switch (type) {
+		case GL_UNSIGNED_BYTE: case GL_BYTE: pixel = components; break;
+		case GL_UNSIGNED_SHORT: case GL_SHORT: case GL_HALF_FLOAT: pixel = 2 * components; break;
+		case GL_UNSIGNED_INT: case GL_INT: case GL_FLOAT: pixel = 4 * components; break;
+		case GL_UNSIGNED_BYTE_3_3_2: case GL_UNSIGNED_BYTE_2_3_3_REV: pixel = 1; break;
+		case GL_UNSIGNED_SHORT_5_6_5: case GL_UNSIGNED_SHORT_5_6_5_REV:
+		case GL_UNSIGNED_SHORT_4_4_4_4: case GL_UNSIGNED_SHORT_4_4_4_4_REV:
+		case GL_UNSIGNED_SHORT_5_5_5_1: case GL_UNSIGNED_SHORT_1_5_5_5_REV:
+			pixel = 2; break;
+		case GL_FLOAT_32_UNSIGNED_INT_24_8_REV: pixel = 8; break;
+		default: pixel = 4; break; //(the remaining packed types are 32 bits)
+	}
+
+	size_t row = (size_t(width) * pixel + 3) & ~size_t(3);
+	return row * size_t(height) * size_t(depth);
+}
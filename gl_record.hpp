@@ -0,0 +1,49 @@
+#pragma once
+
+//gl_record writes the OpenGL call stream -- every call, its parameters, and the data behind them
+// (buffer contents, uniform values, shader source, ...) -- to a compact binary file, so the
+// session can be re-issued and timed later by 'gl_replay' (see gl_replay.cpp) on any driver,
+// without the game or its assets.
+//Recording only works in builds with GL_RECORD defined ('jam -sGL_RECORD=1'), where every GL call
+// goes through a wrapper from gl_record_calls.hpp (generated by 'make-gl-shims.py --record').
+//A recording should start right after the context is created, so every object the recorded
+// frames use is created in the recording, too.
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <cstddef>
+#include <cstdint>
+#include <string>
+
+//File layout (all values little-endian, as written by the recording machine):
+// header: "GLRECORD", uint32 version, uint32 drawable width, uint32 drawable height,
+//         uint32 call name count, then each name as uint8 length + characters
+// calls:  uint16 call id (an index into the names), then its parameters (see gl_record_calls.hpp)
+constexpr char GLRecordMagic[8] = { 'G', 'L', 'R', 'E', 'C', 'O', 'R', 'D' };
+constexpr uint32_t GLRecordVersion = 1;
+//pseudo-calls mixed in with the real ones:
+constexpr uint16_t GLRecordFrameEnd = 0xffff; //end of a frame (no parameters)
+constexpr uint16_t GLRecordMappedData = 0xfffe; //data written to a mapped buffer: GLenum target, uint64 offset (into the mapping), data
+//how a data parameter is stored: a kind byte, then (for GLRecordBytes) uint64 size + the bytes, or (for GLRecordOffset) uint64 offset:
+enum GLRecordDataKind : uint8_t {
+	GLRecordNull = 0,
+	GLRecordBytes = 1,
+	GLRecordOffset = 2, //(pixel data in a bound pixel pack/unpack buffer)
+};
+
+//true if this build can record (was built with GL_RECORD):
+bool gl_record_available();
+
+//start recording to 'path' for 'frames' frames; throws on failure (including when !gl_record_available()):
+void gl_record_begin(std::string const &path, uint32_t frames, glm::uvec2 drawable_size);
+
+//call after each swap; stops recording once enough frames have been recorded:
+void gl_record_frame();
+
+//stop recording early (does nothing if not recording), and print a summary:
+void gl_record_end();
+
+//bytes of pixel data glTexImage*/glReadPixels read or write, for tightly-packed rows (padded to GL_PACK/UNPACK_ALIGNMENT's default of 4):
+size_t gl_pixels_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type);
@@ -0,0 +1,3831 @@
+#pragma once
+//NOTE: generated by 'make-gl-shims.py --record'; don't edit by hand.
+
+//gl_record_calls.hpp wraps every core OpenGL (through 3.3) entry point with a version that, while
+// recording (see gl_record.hpp), writes the call and its parameters -- including the data behind
+// pointers, like buffer contents and shader source -- to the recording. It is only used when
+// GL_RECORD is defined (see GL.hpp); gl_replay_calls.hpp reads the calls back.
+
+#include <cstddef>
+#include <cstdint>
+
+extern bool gl_recording; //(set by gl_record_begin, cleared by gl_record_end)
+
+//writers used by the wrappers (gl_record.cpp):
+void gl_record_call(uint16_t call);
+void gl_record_bytes(void const *bytes, size_t size);
+template< typename T >
+inline void gl_record_value(T const &value) { gl_record_bytes(&value, sizeof(value)); }
+inline size_t gl_record_count(int64_t count) { return count > 0 ? size_t(count) : 0; }
+size_t gl_pixels_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type); //(see gl_record.hpp)
+void gl_record_data(void const *data, size_t size); //(data may be null)
+void gl_record_string(char const *str);
+void gl_record_strings(GLsizei count, GLchar const *const *strs, GLint const *lengths);
+void gl_record_offsets(void const *const *offsets, GLsizei count);
+void gl_record_pixels(void const *pixels, size_t size); //(an offset, if a GL_PIXEL_UNPACK_BUFFER is bound)
+void gl_record_pixels_out(void *pixels); //(an offset, if a GL_PIXEL_PACK_BUFFER is bound)
+void gl_record_unsupported(uint16_t call);
+void gl_record_mapped(GLenum target, void *pointer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+void gl_record_unmapping(GLenum target);
+void gl_record_flushing(GLenum target, GLintptr offset, GLsizeiptr length);
+
+enum GLRecordCall : uint16_t {
+	GLRecordCall_CullFace,
+	GLRecordCall_FrontFace,
+	GLRecordCall_Hint,
+	GLRecordCall_LineWidth,
+	GLRecordCall_PointSize,
+	GLRecordCall_PolygonMode,
+	GLRecordCall_Scissor,
+	GLRecordCall_TexParameterf,
+	GLRecordCall_TexParameterfv,
+	GLRecordCall_TexParameteri,
+	GLRecordCall_TexParameteriv,
+	GLRecordCall_TexImage1D,
+	GLRecordCall_TexImage2D,
+	GLRecordCall_DrawBuffer,
+	GLRecordCall_Clear,
+	GLRecordCall_ClearColor,
+	GLRecordCall_ClearStencil,
+	GLRecordCall_ClearDepth,
+	GLRecordCall_StencilMask,
+	GLRecordCall_ColorMask,
+	GLRecordCall_DepthMask,
+	GLRecordCall_Disable,
+	GLRecordCall_Enable,
+	GLRecordCall_Finish,
+	GLRecordCall_Flush,
+	GLRecordCall_BlendFunc,
+	GLRecordCall_LogicOp,
+	GLRecordCall_StencilFunc,
+	GLRecordCall_StencilOp,
+	GLRecordCall_DepthFunc,
+	GLRecordCall_PixelStoref,
+	GLRecordCall_PixelStorei,
+	GLRecordCall_ReadBuffer,
+	GLRecordCall_ReadPixels,
+	GLRecordCall_GetBooleanv,
+	GLRecordCall_GetDoublev,
+	GLRecordCall_GetError,
+	GLRecordCall_GetFloatv,
+	GLRecordCall_GetIntegerv,
+	GLRecordCall_GetString,
+	GLRecordCall_GetTexImage,
+	GLRecordCall_GetTexParameterfv,
+	GLRecordCall_GetTexParameteriv,
+	GLRecordCall_GetTexLevelParameterfv,
+	GLRecordCall_GetTexLevelParameteriv,
+	GLRecordCall_IsEnabled,
+	GLRecordCall_DepthRange,
+	GLRecordCall_Viewport,
+	GLRecordCall_DrawArrays,
+	GLRecordCall_DrawElements,
+	GLRecordCall_GetPointerv,
+	GLRecordCall_PolygonOffset,
+	GLRecordCall_CopyTexImage1D,
+	GLRecordCall_CopyTexImage2D,
+	GLRecordCall_CopyTexSubImage1D,
+	GLRecordCall_CopyTexSubImage2D,
+	GLRecordCall_TexSubImage1D,
+	GLRecordCall_TexSubImage2D,
+	GLRecordCall_BindTexture,
+	GLRecordCall_DeleteTextures,
+	GLRecordCall_GenTextures,
+	GLRecordCall_IsTexture,
+	GLRecordCall_DrawRangeElements,
+	GLRecordCall_TexImage3D,
+	GLRecordCall_TexSubImage3D,
+	GLRecordCall_CopyTexSubImage3D,
+	GLRecordCall_ActiveTexture,
+	GLRecordCall_SampleCoverage,
+	GLRecordCall_CompressedTexImage3D,
+	GLRecordCall_CompressedTexImage2D,
+	GLRecordCall_CompressedTexImage1D,
+	GLRecordCall_CompressedTexSubImage3D,
+	GLRecordCall_CompressedTexSubImage2D,
+	GLRecordCall_CompressedTexSubImage1D,
+	GLRecordCall_GetCompressedTexImage,
+	GLRecordCall_BlendFuncSeparate,
+	GLRecordCall_MultiDrawArrays,
+	GLRecordCall_MultiDrawElements,
+	GLRecordCall_PointParameterf,
+	GLRecordCall_PointParameterfv,
+	GLRecordCall_PointParameteri,
+	GLRecordCall_PointParameteriv,
+	GLRecordCall_BlendColor,
+	GLRecordCall_BlendEquation,
+	GLRecordCall_GenQueries,
+	GLRecordCall_DeleteQueries,
+	GLRecordCall_IsQuery,
+	GLRecordCall_BeginQuery,
+	GLRecordCall_EndQuery,
+	GLRecordCall_GetQueryiv,
+	GLRecordCall_GetQueryObjectiv,
+	GLRecordCall_GetQueryObjectuiv,
+	GLRecordCall_BindBuffer,
+	GLRecordCall_DeleteBuffers,
+	GLRecordCall_GenBuffers,
+	GLRecordCall_IsBuffer,
+	GLRecordCall_BufferData,
+	GLRecordCall_BufferSubData,
+	GLRecordCall_GetBufferSubData,
+	GLRecordCall_MapBuffer,
+	GLRecordCall_UnmapBuffer,
+	GLRecordCall_GetBufferParameteriv,
+	GLRecordCall_GetBufferPointerv,
+	GLRecordCall_BlendEquationSeparate,
+	GLRecordCall_DrawBuffers,
+	GLRecordCall_StencilOpSeparate,
+	GLRecordCall_StencilFuncSeparate,
+	GLRecordCall_StencilMaskSeparate,
+	GLRecordCall_AttachShader,
+	GLRecordCall_BindAttribLocation,
+	GLRecordCall_CompileShader,
+	GLRecordCall_CreateProgram,
+	GLRecordCall_CreateShader,
+	GLRecordCall_DeleteProgram,
+	GLRecordCall_DeleteShader,
+	GLRecordCall_DetachShader,
+	GLRecordCall_DisableVertexAttribArray,
+	GLRecordCall_EnableVertexAttribArray,
+	GLRecordCall_GetActiveAttrib,
+	GLRecordCall_GetActiveUniform,
+	GLRecordCall_GetAttachedShaders,
+	GLRecordCall_GetAttribLocation,
+	GLRecordCall_GetProgramiv,
+	GLRecordCall_GetProgramInfoLog,
+	GLRecordCall_GetShaderiv,
+	GLRecordCall_GetShaderInfoLog,
+	GLRecordCall_GetShaderSource,
+	GLRecordCall_GetUniformLocation,
+	GLRecordCall_GetUniformfv,
+	GLRecordCall_GetUniformiv,
+	GLRecordCall_GetVertexAttribdv,
+	GLRecordCall_GetVertexAttribfv,
+	GLRecordCall_GetVertexAttribiv,
+	GLRecordCall_GetVertexAttribPointerv,
+	GLRecordCall_IsProgram,
+	GLRecordCall_IsShader,
+	GLRecordCall_LinkProgram,
+	GLRecordCall_ShaderSource,
+	GLRecordCall_UseProgram,
+	GLRecordCall_Uniform1f,
+	GLRecordCall_Uniform2f,
+	GLRecordCall_Uniform3f,
+	GLRecordCall_Uniform4f,
+	GLRecordCall_Uniform1i,
+	GLRecordCall_Uniform2i,
+	GLRecordCall_Uniform3i,
+	GLRecordCall_Uniform4i,
+	GLRecordCall_Uniform1fv,
+	GLRecordCall_Uniform2fv,
+	GLRecordCall_Uniform3fv,
+	GLRecordCall_Uniform4fv,
+	GLRecordCall_Uniform1iv,
+	GLRecordCall_Uniform2iv,
+	GLRecordCall_Uniform3iv,
+	GLRecordCall_Uniform4iv,
+	GLRecordCall_UniformMatrix2fv,
+	GLRecordCall_UniformMatrix3fv,
+	GLRecordCall_UniformMatrix4fv,
+	GLRecordCall_ValidateProgram,
+	GLRecordCall_VertexAttrib1d,
+	GLRecordCall_VertexAttrib1dv,
+	GLRecordCall_VertexAttrib1f,
+	GLRecordCall_VertexAttrib1fv,
+	GLRecordCall_VertexAttrib1s,
+	GLRecordCall_VertexAttrib1sv,
+	GLRecordCall_VertexAttrib2d,
+	GLRecordCall_VertexAttrib2dv,
+	GLRecordCall_VertexAttrib2f,
+	GLRecordCall_VertexAttrib2fv,
+	GLRecordCall_VertexAttrib2s,
+	GLRecordCall_VertexAttrib2sv,
+	GLRecordCall_VertexAttrib3d,
+	GLRecordCall_VertexAttrib3dv,
+	GLRecordCall_VertexAttrib3f,
+	GLRecordCall_VertexAttrib3fv,
+	GLRecordCall_VertexAttrib3s,
+	GLRecordCall_VertexAttrib3sv,
+	GLRecordCall_VertexAttrib4Nbv,
+	GLRecordCall_VertexAttrib4Niv,
+	GLRecordCall_VertexAttrib4Nsv,
+	GLRecordCall_VertexAttrib4Nub,
+	GLRecordCall_VertexAttrib4Nubv,
+	GLRecordCall_VertexAttrib4Nuiv,
+	GLRecordCall_VertexAttrib4Nusv,
+	GLRecordCall_VertexAttrib4bv,
+	GLRecordCall_VertexAttrib4d,
+	GLRecordCall_VertexAttrib4dv,
+	GLRecordCall_VertexAttrib4f,
+	GLRecordCall_VertexAttrib4fv,
+	GLRecordCall_VertexAttrib4iv,
+	GLRecordCall_VertexAttrib4s,
+	GLRecordCall_VertexAttrib4sv,
+	GLRecordCall_VertexAttrib4ubv,
+	GLRecordCall_VertexAttrib4uiv,
+	GLRecordCall_VertexAttrib4usv,
+	GLRecordCall_VertexAttribPointer,
+	GLRecordCall_UniformMatrix2x3fv,
+	GLRecordCall_UniformMatrix3x2fv,
+	GLRecordCall_UniformMatrix2x4fv,
+	GLRecordCall_UniformMatrix4x2fv,
+	GLRecordCall_UniformMatrix3x4fv,
+	GLRecordCall_UniformMatrix4x3fv,
+	GLRecordCall_ColorMaski,
+	GLRecordCall_GetBooleani_v,
+	GLRecordCall_GetIntegeri_v,
+	GLRecordCall_Enablei,
+	GLRecordCall_Disablei,
+	GLRecordCall_IsEnabledi,
+	GLRecordCall_BeginTransformFeedback,
+	GLRecordCall_EndTransformFeedback,
+	GLRecordCall_BindBufferRange,
+	GLRecordCall_BindBufferBase,
+	GLRecordCall_TransformFeedbackVaryings,
+	GLRecordCall_GetTransformFeedbackVarying,
+	GLRecordCall_ClampColor,
+	GLRecordCall_BeginConditionalRender,
+	GLRecordCall_EndConditionalRender,
+	GLRecordCall_VertexAttribIPointer,
+	GLRecordCall_GetVertexAttribIiv,
+	GLRecordCall_GetVertexAttribIuiv,
+	GLRecordCall_VertexAttribI1i,
+	GLRecordCall_VertexAttribI2i,
+	GLRecordCall_VertexAttribI3i,
+	GLRecordCall_VertexAttribI4i,
+	GLRecordCall_VertexAttribI1ui,
+	GLRecordCall_VertexAttribI2ui,
+	GLRecordCall_VertexAttribI3ui,
+	GLRecordCall_VertexAttribI4ui,
+	GLRecordCall_VertexAttribI1iv,
+	GLRecordCall_VertexAttribI2iv,
+	GLRecordCall_VertexAttribI3iv,
+	GLRecordCall_VertexAttribI4iv,
+	GLRecordCall_VertexAttribI1uiv,
+	GLRecordCall_VertexAttribI2uiv,
+	GLRecordCall_VertexAttribI3uiv,
+	GLRecordCall_VertexAttribI4uiv,
+	GLRecordCall_VertexAttribI4bv,
+	GLRecordCall_VertexAttribI4sv,
+	GLRecordCall_VertexAttribI4ubv,
+	GLRecordCall_VertexAttribI4usv,
+	GLRecordCall_GetUniformuiv,
+	GLRecordCall_BindFragDataLocation,
+	GLRecordCall_GetFragDataLocation,
+	GLRecordCall_Uniform1ui,
+	GLRecordCall_Uniform2ui,
+	GLRecordCall_Uniform3ui,
+	GLRecordCall_Uniform4ui,
+	GLRecordCall_Uniform1uiv,
+	GLRecordCall_Uniform2uiv,
+	GLRecordCall_Uniform3uiv,
+	GLRecordCall_Uniform4uiv,
+	GLRecordCall_TexParameterIiv,
+	GLRecordCall_TexParameterIuiv,
+	GLRecordCall_GetTexParameterIiv,
+	GLRecordCall_GetTexParameterIuiv,
+	GLRecordCall_ClearBufferiv,
+	GLRecordCall_ClearBufferuiv,
+	GLRecordCall_ClearBufferfv,
+	GLRecordCall_ClearBufferfi,
+	GLRecordCall_GetStringi,
+	GLRecordCall_IsRenderbuffer,
+	GLRecordCall_BindRenderbuffer,
+	GLRecordCall_DeleteRenderbuffers,
+	GLRecordCall_GenRenderbuffers,
+	GLRecordCall_RenderbufferStorage,
+	GLRecordCall_GetRenderbufferParameteriv,
+	GLRecordCall_IsFramebuffer,
+	GLRecordCall_BindFramebuffer,
+	GLRecordCall_DeleteFramebuffers,
+	GLRecordCall_GenFramebuffers,
+	GLRecordCall_CheckFramebufferStatus,
+	GLRecordCall_FramebufferTexture1D,
+	GLRecordCall_FramebufferTexture2D,
+	GLRecordCall_FramebufferTexture3D,
+	GLRecordCall_FramebufferRenderbuffer,
+	GLRecordCall_GetFramebufferAttachmentParameteriv,
+	GLRecordCall_GenerateMipmap,
+	GLRecordCall_BlitFramebuffer,
+	GLRecordCall_RenderbufferStorageMultisample,
+	GLRecordCall_FramebufferTextureLayer,
+	GLRecordCall_MapBufferRange,
+	GLRecordCall_FlushMappedBufferRange,
+	GLRecordCall_BindVertexArray,
+	GLRecordCall_DeleteVertexArrays,
+	GLRecordCall_GenVertexArrays,
+	GLRecordCall_IsVertexArray,
+	GLRecordCall_DrawArraysInstanced,
+	GLRecordCall_DrawElementsInstanced,
+	GLRecordCall_TexBuffer,
+	GLRecordCall_PrimitiveRestartIndex,
+	GLRecordCall_CopyBufferSubData,
+	GLRecordCall_GetUniformIndices,
+	GLRecordCall_GetActiveUniformsiv,
+	GLRecordCall_GetActiveUniformName,
+	GLRecordCall_GetUniformBlockIndex,
+	GLRecordCall_GetActiveUniformBlockiv,
+	GLRecordCall_GetActiveUniformBlockName,
+	GLRecordCall_UniformBlockBinding,
+	GLRecordCall_DrawElementsBaseVertex,
+	GLRecordCall_DrawRangeElementsBaseVertex,
+	GLRecordCall_DrawElementsInstancedBaseVertex,
+	GLRecordCall_MultiDrawElementsBaseVertex,
+	GLRecordCall_ProvokingVertex,
+	GLRecordCall_FenceSync,
+	GLRecordCall_IsSync,
+	GLRecordCall_DeleteSync,
+	GLRecordCall_ClientWaitSync,
+	GLRecordCall_WaitSync,
+	GLRecordCall_GetInteger64v,
+	GLRecordCall_GetSynciv,
+	GLRecordCall_GetInteger64i_v,
+	GLRecordCall_GetBufferParameteri64v,
+	GLRecordCall_FramebufferTexture,
+	GLRecordCall_TexImage2DMultisample,
+	GLRecordCall_TexImage3DMultisample,
+	GLRecordCall_GetMultisamplefv,
+	GLRecordCall_SampleMaski,
+	GLRecordCall_BindFragDataLocationIndexed,
+	GLRecordCall_GetFragDataIndex,
+	GLRecordCall_GenSamplers,
+	GLRecordCall_DeleteSamplers,
+	GLRecordCall_IsSampler,
+	GLRecordCall_BindSampler,
+	GLRecordCall_SamplerParameteri,
+	GLRecordCall_SamplerParameteriv,
+	GLRecordCall_SamplerParameterf,
+	GLRecordCall_SamplerParameterfv,
+	GLRecordCall_SamplerParameterIiv,
+	GLRecordCall_SamplerParameterIuiv,
+	GLRecordCall_GetSamplerParameteriv,
+	GLRecordCall_GetSamplerParameterIiv,
+	GLRecordCall_GetSamplerParameterfv,
+	GLRecordCall_GetSamplerParameterIuiv,
+	GLRecordCall_QueryCounter,
+	GLRecordCall_GetQueryObjecti64v,
+	GLRecordCall_GetQueryObjectui64v,
+	GLRecordCall_VertexAttribDivisor,
+	GLRecordCall_VertexAttribP1ui,
+	GLRecordCall_VertexAttribP1uiv,
+	GLRecordCall_VertexAttribP2ui,
+	GLRecordCall_VertexAttribP2uiv,
+	GLRecordCall_VertexAttribP3ui,
+	GLRecordCall_VertexAttribP3uiv,
+	GLRecordCall_VertexAttribP4ui,
+	GLRecordCall_VertexAttribP4uiv,
+	GLRecordCallCount
+};
+extern char const *const GLRecordCallNames[GLRecordCallCount];
+
+//wrappers call the real entry points (so must be declared before the names are redirected):
+inline void APIENTRY gl_recorded_CullFace(GLenum mode) {
+	glCullFace(mode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CullFace);
+	gl_record_value(mode);
+}
+inline void APIENTRY gl_recorded_FrontFace(GLenum mode) {
+	glFrontFace(mode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_FrontFace);
+	gl_record_value(mode);
+}
+inline void APIENTRY gl_recorded_Hint(GLenum target, GLenum mode) {
+	glHint(target, mode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Hint);
+	gl_record_value(target);
+	gl_record_value(mode);
+}
+inline void APIENTRY gl_recorded_LineWidth(GLfloat width) {
+	glLineWidth(width);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_LineWidth);
+	gl_record_value(width);
+}
+inline void APIENTRY gl_recorded_PointSize(GLfloat size) {
+	glPointSize(size);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PointSize);
+	gl_record_value(size);
+}
+inline void APIENTRY gl_recorded_PolygonMode(GLenum face, GLenum mode) {
+	glPolygonMode(face, mode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PolygonMode);
+	gl_record_value(face);
+	gl_record_value(mode);
+}
+inline void APIENTRY gl_recorded_Scissor(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glScissor(x, y, width, height);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Scissor);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(width);
+	gl_record_value(height);
+}
+inline void APIENTRY gl_recorded_TexParameterf(GLenum target, GLenum pname, GLfloat param) {
+	glTexParameterf(target, pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexParameterf);
+	gl_record_value(target);
+	gl_record_value(pname);
+	gl_record_value(param);
+}
+inline void APIENTRY gl_recorded_TexParameterfv(GLenum target, GLenum pname, const GLfloat *params) {
+	glTexParameterfv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexParameterfv);
+	gl_record_value(target);
+	gl_record_value(pname);
+	gl_record_data(params, gl_record_count((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_TexParameteri(GLenum target, GLenum pname, GLint param) {
+	glTexParameteri(target, pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexParameteri);
+	gl_record_value(target);
+	gl_record_value(pname);
+	gl_record_value(param);
+}
+inline void APIENTRY gl_recorded_TexParameteriv(GLenum target, GLenum pname, const GLint *params) {
+	glTexParameteriv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexParameteriv);
+	gl_record_value(target);
+	gl_record_value(pname);
+	gl_record_data(params, gl_record_count((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_TexImage1D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexImage1D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(border);
+	gl_record_value(format);
+	gl_record_value(type);
+	gl_record_pixels(pixels, gl_pixels_size(width, 1, 1, format, type));
+}
+inline void APIENTRY gl_recorded_TexImage2D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexImage2D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(border);
+	gl_record_value(format);
+	gl_record_value(type);
+	gl_record_pixels(pixels, gl_pixels_size(width, height, 1, format, type));
+}
+inline void APIENTRY gl_recorded_DrawBuffer(GLenum buf) {
+	glDrawBuffer(buf);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawBuffer);
+	gl_record_value(buf);
+}
+inline void APIENTRY gl_recorded_Clear(GLbitfield mask) {
+	glClear(mask);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Clear);
+	gl_record_value(mask);
+}
+inline void APIENTRY gl_recorded_ClearColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glClearColor(red, green, blue, alpha);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ClearColor);
+	gl_record_value(red);
+	gl_record_value(green);
+	gl_record_value(blue);
+	gl_record_value(alpha);
+}
+inline void APIENTRY gl_recorded_ClearStencil(GLint s) {
+	glClearStencil(s);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ClearStencil);
+	gl_record_value(s);
+}
+inline void APIENTRY gl_recorded_ClearDepth(GLdouble depth) {
+	glClearDepth(depth);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ClearDepth);
+	gl_record_value(depth);
+}
+inline void APIENTRY gl_recorded_StencilMask(GLuint mask) {
+	glStencilMask(mask);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_StencilMask);
+	gl_record_value(mask);
+}
+inline void APIENTRY gl_recorded_ColorMask(GLboolean red, GLboolean green, GLboolean blue, GLboolean alpha) {
+	glColorMask(red, green, blue, alpha);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ColorMask);
+	gl_record_value(red);
+	gl_record_value(green);
+	gl_record_value(blue);
+	gl_record_value(alpha);
+}
+inline void APIENTRY gl_recorded_DepthMask(GLboolean flag) {
+	glDepthMask(flag);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DepthMask);
+	gl_record_value(flag);
+}
+inline void APIENTRY gl_recorded_Disable(GLenum cap) {
+	glDisable(cap);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Disable);
+	gl_record_value(cap);
+}
+inline void APIENTRY gl_recorded_Enable(GLenum cap) {
+	glEnable(cap);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Enable);
+	gl_record_value(cap);
+}
+inline void APIENTRY gl_recorded_Finish(void) {
+	glFinish();
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Finish);
+}
+inline void APIENTRY gl_recorded_Flush(void) {
+	glFlush();
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Flush);
+}
+inline void APIENTRY gl_recorded_BlendFunc(GLenum sfactor, GLenum dfactor) {
+	glBlendFunc(sfactor, dfactor);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BlendFunc);
+	gl_record_value(sfactor);
+	gl_record_value(dfactor);
+}
+inline void APIENTRY gl_recorded_LogicOp(GLenum opcode) {
+	glLogicOp(opcode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_LogicOp);
+	gl_record_value(opcode);
+}
+inline void APIENTRY gl_recorded_StencilFunc(GLenum func, GLint ref, GLuint mask) {
+	glStencilFunc(func, ref, mask);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_StencilFunc);
+	gl_record_value(func);
+	gl_record_value(ref);
+	gl_record_value(mask);
+}
+inline void APIENTRY gl_recorded_StencilOp(GLenum fail, GLenum zfail, GLenum zpass) {
+	glStencilOp(fail, zfail, zpass);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_StencilOp);
+	gl_record_value(fail);
+	gl_record_value(zfail);
+	gl_record_value(zpass);
+}
+inline void APIENTRY gl_recorded_DepthFunc(GLenum func) {
+	glDepthFunc(func);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DepthFunc);
+	gl_record_value(func);
+}
+inline void APIENTRY gl_recorded_PixelStoref(GLenum pname, GLfloat param) {
+	glPixelStoref(pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PixelStoref);
+	gl_record_value(pname);
+	gl_record_value(param);
+}
+inline void APIENTRY gl_recorded_PixelStorei(GLenum pname, GLint param) {
+	glPixelStorei(pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PixelStorei);
+	gl_record_value(pname);
+	gl_record_value(param);
+}
+inline void APIENTRY gl_recorded_ReadBuffer(GLenum src) {
+	glReadBuffer(src);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ReadBuffer);
+	gl_record_value(src);
+}
+inline void APIENTRY gl_recorded_ReadPixels(GLint x, GLint y, GLsizei width, GLsizei height, GLenum format, GLenum type, void *pixels) {
+	glReadPixels(x, y, width, height, format, type, pixels);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ReadPixels);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(format);
+	gl_record_value(type);
+	gl_record_pixels_out(pixels);
+}
+inline void APIENTRY gl_recorded_GetBooleanv(GLenum pname, GLboolean *data) {
+	glGetBooleanv(pname, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetBooleanv);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetDoublev(GLenum pname, GLdouble *data) {
+	glGetDoublev(pname, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetDoublev);
+	gl_record_value(pname);
+}
+inline GLenum APIENTRY gl_recorded_GetError(void) {
+	GLenum ret = glGetError();
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_GetError);
+	return ret;
+}
+inline void APIENTRY gl_recorded_GetFloatv(GLenum pname, GLfloat *data) {
+	glGetFloatv(pname, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetFloatv);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetIntegerv(GLenum pname, GLint *data) {
+	glGetIntegerv(pname, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetIntegerv);
+	gl_record_value(pname);
+}
+inline const GLubyte * APIENTRY gl_recorded_GetString(GLenum name) {
+	const GLubyte * ret = glGetString(name);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_GetString);
+	gl_record_value(name);
+	return ret;
+}
+inline void APIENTRY gl_recorded_GetTexImage(GLenum target, GLint level, GLenum format, GLenum type, void *pixels) {
+	glGetTexImage(target, level, format, type, pixels);
+	if (!gl_recording) return;
+	gl_record_unsupported(GLRecordCall_GetTexImage);
+}
+inline void APIENTRY gl_recorded_GetTexParameterfv(GLenum target, GLenum pname, GLfloat *params) {
+	glGetTexParameterfv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetTexParameterfv);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetTexParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glGetTexParameteriv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetTexParameteriv);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetTexLevelParameterfv(GLenum target, GLint level, GLenum pname, GLfloat *params) {
+	glGetTexLevelParameterfv(target, level, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetTexLevelParameterfv);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetTexLevelParameteriv(GLenum target, GLint level, GLenum pname, GLint *params) {
+	glGetTexLevelParameteriv(target, level, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetTexLevelParameteriv);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(pname);
+}
+inline GLboolean APIENTRY gl_recorded_IsEnabled(GLenum cap) {
+	GLboolean ret = glIsEnabled(cap);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsEnabled);
+	gl_record_value(cap);
+	return ret;
+}
+inline void APIENTRY gl_recorded_DepthRange(GLdouble near, GLdouble far) {
+	glDepthRange(near, far);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DepthRange);
+	gl_record_value(near);
+	gl_record_value(far);
+}
+inline void APIENTRY gl_recorded_Viewport(GLint x, GLint y, GLsizei width, GLsizei height) {
+	glViewport(x, y, width, height);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Viewport);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(width);
+	gl_record_value(height);
+}
+inline void APIENTRY gl_recorded_DrawArrays(GLenum mode, GLint first, GLsizei count) {
+	glDrawArrays(mode, first, count);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawArrays);
+	gl_record_value(mode);
+	gl_record_value(first);
+	gl_record_value(count);
+}
+inline void APIENTRY gl_recorded_DrawElements(GLenum mode, GLsizei count, GLenum type, const void *indices) {
+	glDrawElements(mode, count, type, indices);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawElements);
+	gl_record_value(mode);
+	gl_record_value(count);
+	gl_record_value(type);
+	gl_record_value(uint64_t(uintptr_t(indices)));
+}
+inline void APIENTRY gl_recorded_GetPointerv(GLenum pname, void **params) {
+	glGetPointerv(pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetPointerv);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_PolygonOffset(GLfloat factor, GLfloat units) {
+	glPolygonOffset(factor, units);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PolygonOffset);
+	gl_record_value(factor);
+	gl_record_value(units);
+}
+inline void APIENTRY gl_recorded_CopyTexImage1D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLint border) {
+	glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CopyTexImage1D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(internalformat);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(width);
+	gl_record_value(border);
+}
+inline void APIENTRY gl_recorded_CopyTexImage2D(GLenum target, GLint level, GLenum internalformat, GLint x, GLint y, GLsizei width, GLsizei height, GLint border) {
+	glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CopyTexImage2D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(internalformat);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(border);
+}
+inline void APIENTRY gl_recorded_CopyTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLint x, GLint y, GLsizei width) {
+	glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CopyTexSubImage1D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(width);
+}
+inline void APIENTRY gl_recorded_CopyTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CopyTexSubImage2D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(yoffset);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(width);
+	gl_record_value(height);
+}
+inline void APIENTRY gl_recorded_TexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLenum type, const void *pixels) {
+	glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexSubImage1D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(width);
+	gl_record_value(format);
+	gl_record_value(type);
+	gl_record_pixels(pixels, gl_pixels_size(width, 1, 1, format, type));
+}
+inline void APIENTRY gl_recorded_TexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLenum type, const void *pixels) {
+	glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexSubImage2D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(yoffset);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(format);
+	gl_record_value(type);
+	gl_record_pixels(pixels, gl_pixels_size(width, height, 1, format, type));
+}
+inline void APIENTRY gl_recorded_BindTexture(GLenum target, GLuint texture) {
+	glBindTexture(target, texture);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindTexture);
+	gl_record_value(target);
+	gl_record_value(texture);
+}
+inline void APIENTRY gl_recorded_DeleteTextures(GLsizei n, const GLuint *textures) {
+	glDeleteTextures(n, textures);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteTextures);
+	gl_record_value(n);
+	gl_record_data(textures, gl_record_count(n) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_GenTextures(GLsizei n, GLuint *textures) {
+	glGenTextures(n, textures);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GenTextures);
+	gl_record_value(n);
+	gl_record_data(textures, gl_record_count(n) * sizeof(GLuint));
+}
+inline GLboolean APIENTRY gl_recorded_IsTexture(GLuint texture) {
+	GLboolean ret = glIsTexture(texture);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsTexture);
+	gl_record_value(texture);
+	return ret;
+}
+inline void APIENTRY gl_recorded_DrawRangeElements(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices) {
+	glDrawRangeElements(mode, start, end, count, type, indices);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawRangeElements);
+	gl_record_value(mode);
+	gl_record_value(start);
+	gl_record_value(end);
+	gl_record_value(count);
+	gl_record_value(type);
+	gl_record_value(uint64_t(uintptr_t(indices)));
+}
+inline void APIENTRY gl_recorded_TexImage3D(GLenum target, GLint level, GLint internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLenum format, GLenum type, const void *pixels) {
+	glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexImage3D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(depth);
+	gl_record_value(border);
+	gl_record_value(format);
+	gl_record_value(type);
+	gl_record_pixels(pixels, gl_pixels_size(width, height, depth, format, type));
+}
+inline void APIENTRY gl_recorded_TexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type, const void *pixels) {
+	glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexSubImage3D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(yoffset);
+	gl_record_value(zoffset);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(depth);
+	gl_record_value(format);
+	gl_record_value(type);
+	gl_record_pixels(pixels, gl_pixels_size(width, height, depth, format, type));
+}
+inline void APIENTRY gl_recorded_CopyTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLint x, GLint y, GLsizei width, GLsizei height) {
+	glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CopyTexSubImage3D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(yoffset);
+	gl_record_value(zoffset);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(width);
+	gl_record_value(height);
+}
+inline void APIENTRY gl_recorded_ActiveTexture(GLenum texture) {
+	glActiveTexture(texture);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ActiveTexture);
+	gl_record_value(texture);
+}
+inline void APIENTRY gl_recorded_SampleCoverage(GLfloat value, GLboolean invert) {
+	glSampleCoverage(value, invert);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_SampleCoverage);
+	gl_record_value(value);
+	gl_record_value(invert);
+}
+inline void APIENTRY gl_recorded_CompressedTexImage3D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLint border, GLsizei imageSize, const void *data) {
+	glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CompressedTexImage3D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(depth);
+	gl_record_value(border);
+	gl_record_value(imageSize);
+	gl_record_pixels(data, imageSize);
+}
+inline void APIENTRY gl_recorded_CompressedTexImage2D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLsizei height, GLint border, GLsizei imageSize, const void *data) {
+	glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CompressedTexImage2D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(border);
+	gl_record_value(imageSize);
+	gl_record_pixels(data, imageSize);
+}
+inline void APIENTRY gl_recorded_CompressedTexImage1D(GLenum target, GLint level, GLenum internalformat, GLsizei width, GLint border, GLsizei imageSize, const void *data) {
+	glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CompressedTexImage1D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(border);
+	gl_record_value(imageSize);
+	gl_record_pixels(data, imageSize);
+}
+inline void APIENTRY gl_recorded_CompressedTexSubImage3D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLint zoffset, GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLsizei imageSize, const void *data) {
+	glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CompressedTexSubImage3D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(yoffset);
+	gl_record_value(zoffset);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(depth);
+	gl_record_value(format);
+	gl_record_value(imageSize);
+	gl_record_pixels(data, imageSize);
+}
+inline void APIENTRY gl_recorded_CompressedTexSubImage2D(GLenum target, GLint level, GLint xoffset, GLint yoffset, GLsizei width, GLsizei height, GLenum format, GLsizei imageSize, const void *data) {
+	glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CompressedTexSubImage2D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(yoffset);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(format);
+	gl_record_value(imageSize);
+	gl_record_pixels(data, imageSize);
+}
+inline void APIENTRY gl_recorded_CompressedTexSubImage1D(GLenum target, GLint level, GLint xoffset, GLsizei width, GLenum format, GLsizei imageSize, const void *data) {
+	glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CompressedTexSubImage1D);
+	gl_record_value(target);
+	gl_record_value(level);
+	gl_record_value(xoffset);
+	gl_record_value(width);
+	gl_record_value(format);
+	gl_record_value(imageSize);
+	gl_record_pixels(data, imageSize);
+}
+inline void APIENTRY gl_recorded_GetCompressedTexImage(GLenum target, GLint level, void *img) {
+	glGetCompressedTexImage(target, level, img);
+	if (!gl_recording) return;
+	gl_record_unsupported(GLRecordCall_GetCompressedTexImage);
+}
+inline void APIENTRY gl_recorded_BlendFuncSeparate(GLenum sfactorRGB, GLenum dfactorRGB, GLenum sfactorAlpha, GLenum dfactorAlpha) {
+	glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BlendFuncSeparate);
+	gl_record_value(sfactorRGB);
+	gl_record_value(dfactorRGB);
+	gl_record_value(sfactorAlpha);
+	gl_record_value(dfactorAlpha);
+}
+inline void APIENTRY gl_recorded_MultiDrawArrays(GLenum mode, const GLint *first, const GLsizei *count, GLsizei drawcount) {
+	glMultiDrawArrays(mode, first, count, drawcount);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_MultiDrawArrays);
+	gl_record_value(mode);
+	gl_record_data(first, gl_record_count(drawcount) * sizeof(GLint));
+	gl_record_data(count, gl_record_count(drawcount) * sizeof(GLsizei));
+	gl_record_value(drawcount);
+}
+inline void APIENTRY gl_recorded_MultiDrawElements(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount) {
+	glMultiDrawElements(mode, count, type, indices, drawcount);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_MultiDrawElements);
+	gl_record_value(mode);
+	gl_record_data(count, gl_record_count(drawcount) * sizeof(GLsizei));
+	gl_record_value(type);
+	gl_record_offsets(indices, drawcount);
+	gl_record_value(drawcount);
+}
+inline void APIENTRY gl_recorded_PointParameterf(GLenum pname, GLfloat param) {
+	glPointParameterf(pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PointParameterf);
+	gl_record_value(pname);
+	gl_record_value(param);
+}
+inline void APIENTRY gl_recorded_PointParameterfv(GLenum pname, const GLfloat *params) {
+	glPointParameterfv(pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PointParameterfv);
+	gl_record_value(pname);
+	gl_record_data(params, gl_record_count(1) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_PointParameteri(GLenum pname, GLint param) {
+	glPointParameteri(pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PointParameteri);
+	gl_record_value(pname);
+	gl_record_value(param);
+}
+inline void APIENTRY gl_recorded_PointParameteriv(GLenum pname, const GLint *params) {
+	glPointParameteriv(pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PointParameteriv);
+	gl_record_value(pname);
+	gl_record_data(params, gl_record_count(1) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_BlendColor(GLfloat red, GLfloat green, GLfloat blue, GLfloat alpha) {
+	glBlendColor(red, green, blue, alpha);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BlendColor);
+	gl_record_value(red);
+	gl_record_value(green);
+	gl_record_value(blue);
+	gl_record_value(alpha);
+}
+inline void APIENTRY gl_recorded_BlendEquation(GLenum mode) {
+	glBlendEquation(mode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BlendEquation);
+	gl_record_value(mode);
+}
+inline void APIENTRY gl_recorded_GenQueries(GLsizei n, GLuint *ids) {
+	glGenQueries(n, ids);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GenQueries);
+	gl_record_value(n);
+	gl_record_data(ids, gl_record_count(n) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_DeleteQueries(GLsizei n, const GLuint *ids) {
+	glDeleteQueries(n, ids);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteQueries);
+	gl_record_value(n);
+	gl_record_data(ids, gl_record_count(n) * sizeof(GLuint));
+}
+inline GLboolean APIENTRY gl_recorded_IsQuery(GLuint id) {
+	GLboolean ret = glIsQuery(id);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsQuery);
+	gl_record_value(id);
+	return ret;
+}
+inline void APIENTRY gl_recorded_BeginQuery(GLenum target, GLuint id) {
+	glBeginQuery(target, id);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BeginQuery);
+	gl_record_value(target);
+	gl_record_value(id);
+}
+inline void APIENTRY gl_recorded_EndQuery(GLenum target) {
+	glEndQuery(target);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_EndQuery);
+	gl_record_value(target);
+}
+inline void APIENTRY gl_recorded_GetQueryiv(GLenum target, GLenum pname, GLint *params) {
+	glGetQueryiv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetQueryiv);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetQueryObjectiv(GLuint id, GLenum pname, GLint *params) {
+	glGetQueryObjectiv(id, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetQueryObjectiv);
+	gl_record_value(id);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetQueryObjectuiv(GLuint id, GLenum pname, GLuint *params) {
+	glGetQueryObjectuiv(id, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetQueryObjectuiv);
+	gl_record_value(id);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_BindBuffer(GLenum target, GLuint buffer) {
+	glBindBuffer(target, buffer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindBuffer);
+	gl_record_value(target);
+	gl_record_value(buffer);
+}
+inline void APIENTRY gl_recorded_DeleteBuffers(GLsizei n, const GLuint *buffers) {
+	glDeleteBuffers(n, buffers);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteBuffers);
+	gl_record_value(n);
+	gl_record_data(buffers, gl_record_count(n) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_GenBuffers(GLsizei n, GLuint *buffers) {
+	glGenBuffers(n, buffers);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GenBuffers);
+	gl_record_value(n);
+	gl_record_data(buffers, gl_record_count(n) * sizeof(GLuint));
+}
+inline GLboolean APIENTRY gl_recorded_IsBuffer(GLuint buffer) {
+	GLboolean ret = glIsBuffer(buffer);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsBuffer);
+	gl_record_value(buffer);
+	return ret;
+}
+inline void APIENTRY gl_recorded_BufferData(GLenum target, GLsizeiptr size, const void *data, GLenum usage) {
+	glBufferData(target, size, data, usage);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BufferData);
+	gl_record_value(target);
+	gl_record_value(int64_t(size));
+	gl_record_data(data, gl_record_count(size));
+	gl_record_value(usage);
+}
+inline void APIENTRY gl_recorded_BufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, const void *data) {
+	glBufferSubData(target, offset, size, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BufferSubData);
+	gl_record_value(target);
+	gl_record_value(int64_t(offset));
+	gl_record_value(int64_t(size));
+	gl_record_data(data, gl_record_count(size));
+}
+inline void APIENTRY gl_recorded_GetBufferSubData(GLenum target, GLintptr offset, GLsizeiptr size, void *data) {
+	glGetBufferSubData(target, offset, size, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetBufferSubData);
+	gl_record_value(target);
+	gl_record_value(int64_t(offset));
+	gl_record_value(int64_t(size));
+}
+inline void * APIENTRY gl_recorded_MapBuffer(GLenum target, GLenum access) {
+	void * ret = glMapBuffer(target, access);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_MapBuffer);
+	gl_record_value(target);
+	gl_record_value(access);
+	gl_record_mapped(target, ret, 0, -1, access);
+	return ret;
+}
+inline GLboolean APIENTRY gl_recorded_UnmapBuffer(GLenum target) {
+	if (gl_recording) gl_record_unmapping(target);
+	GLboolean ret = glUnmapBuffer(target);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_UnmapBuffer);
+	gl_record_value(target);
+	return ret;
+}
+inline void APIENTRY gl_recorded_GetBufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glGetBufferParameteriv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetBufferParameteriv);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetBufferPointerv(GLenum target, GLenum pname, void **params) {
+	glGetBufferPointerv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetBufferPointerv);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_BlendEquationSeparate(GLenum modeRGB, GLenum modeAlpha) {
+	glBlendEquationSeparate(modeRGB, modeAlpha);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BlendEquationSeparate);
+	gl_record_value(modeRGB);
+	gl_record_value(modeAlpha);
+}
+inline void APIENTRY gl_recorded_DrawBuffers(GLsizei n, const GLenum *bufs) {
+	glDrawBuffers(n, bufs);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawBuffers);
+	gl_record_value(n);
+	gl_record_data(bufs, gl_record_count(n) * sizeof(GLenum));
+}
+inline void APIENTRY gl_recorded_StencilOpSeparate(GLenum face, GLenum sfail, GLenum dpfail, GLenum dppass) {
+	glStencilOpSeparate(face, sfail, dpfail, dppass);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_StencilOpSeparate);
+	gl_record_value(face);
+	gl_record_value(sfail);
+	gl_record_value(dpfail);
+	gl_record_value(dppass);
+}
+inline void APIENTRY gl_recorded_StencilFuncSeparate(GLenum face, GLenum func, GLint ref, GLuint mask) {
+	glStencilFuncSeparate(face, func, ref, mask);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_StencilFuncSeparate);
+	gl_record_value(face);
+	gl_record_value(func);
+	gl_record_value(ref);
+	gl_record_value(mask);
+}
+inline void APIENTRY gl_recorded_StencilMaskSeparate(GLenum face, GLuint mask) {
+	glStencilMaskSeparate(face, mask);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_StencilMaskSeparate);
+	gl_record_value(face);
+	gl_record_value(mask);
+}
+inline void APIENTRY gl_recorded_AttachShader(GLuint program, GLuint shader) {
+	glAttachShader(program, shader);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_AttachShader);
+	gl_record_value(program);
+	gl_record_value(shader);
+}
+inline void APIENTRY gl_recorded_BindAttribLocation(GLuint program, GLuint index, const GLchar *name) {
+	glBindAttribLocation(program, index, name);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindAttribLocation);
+	gl_record_value(program);
+	gl_record_value(index);
+	gl_record_string(name);
+}
+inline void APIENTRY gl_recorded_CompileShader(GLuint shader) {
+	glCompileShader(shader);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CompileShader);
+	gl_record_value(shader);
+}
+inline GLuint APIENTRY gl_recorded_CreateProgram(void) {
+	GLuint ret = glCreateProgram();
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_CreateProgram);
+	gl_record_value(ret);
+	return ret;
+}
+inline GLuint APIENTRY gl_recorded_CreateShader(GLenum type) {
+	GLuint ret = glCreateShader(type);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_CreateShader);
+	gl_record_value(type);
+	gl_record_value(ret);
+	return ret;
+}
+inline void APIENTRY gl_recorded_DeleteProgram(GLuint program) {
+	glDeleteProgram(program);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteProgram);
+	gl_record_value(program);
+}
+inline void APIENTRY gl_recorded_DeleteShader(GLuint shader) {
+	glDeleteShader(shader);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteShader);
+	gl_record_value(shader);
+}
+inline void APIENTRY gl_recorded_DetachShader(GLuint program, GLuint shader) {
+	glDetachShader(program, shader);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DetachShader);
+	gl_record_value(program);
+	gl_record_value(shader);
+}
+inline void APIENTRY gl_recorded_DisableVertexAttribArray(GLuint index) {
+	glDisableVertexAttribArray(index);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DisableVertexAttribArray);
+	gl_record_value(index);
+}
+inline void APIENTRY gl_recorded_EnableVertexAttribArray(GLuint index) {
+	glEnableVertexAttribArray(index);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_EnableVertexAttribArray);
+	gl_record_value(index);
+}
+inline void APIENTRY gl_recorded_GetActiveAttrib(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetActiveAttrib);
+	gl_record_value(program);
+	gl_record_value(index);
+	gl_record_value(bufSize);
+}
+inline void APIENTRY gl_recorded_GetActiveUniform(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLint *size, GLenum *type, GLchar *name) {
+	glGetActiveUniform(program, index, bufSize, length, size, type, name);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetActiveUniform);
+	gl_record_value(program);
+	gl_record_value(index);
+	gl_record_value(bufSize);
+}
+inline void APIENTRY gl_recorded_GetAttachedShaders(GLuint program, GLsizei maxCount, GLsizei *count, GLuint *shaders) {
+	glGetAttachedShaders(program, maxCount, count, shaders);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetAttachedShaders);
+	gl_record_value(program);
+	gl_record_value(maxCount);
+}
+inline GLint APIENTRY gl_recorded_GetAttribLocation(GLuint program, const GLchar *name) {
+	GLint ret = glGetAttribLocation(program, name);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_GetAttribLocation);
+	gl_record_value(program);
+	gl_record_string(name);
+	gl_record_value(ret);
+	return ret;
+}
+inline void APIENTRY gl_recorded_GetProgramiv(GLuint program, GLenum pname, GLint *params) {
+	glGetProgramiv(program, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetProgramiv);
+	gl_record_value(program);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetProgramInfoLog(GLuint program, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glGetProgramInfoLog(program, bufSize, length, infoLog);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetProgramInfoLog);
+	gl_record_value(program);
+	gl_record_value(bufSize);
+}
+inline void APIENTRY gl_recorded_GetShaderiv(GLuint shader, GLenum pname, GLint *params) {
+	glGetShaderiv(shader, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetShaderiv);
+	gl_record_value(shader);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetShaderInfoLog(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *infoLog) {
+	glGetShaderInfoLog(shader, bufSize, length, infoLog);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetShaderInfoLog);
+	gl_record_value(shader);
+	gl_record_value(bufSize);
+}
+inline void APIENTRY gl_recorded_GetShaderSource(GLuint shader, GLsizei bufSize, GLsizei *length, GLchar *source) {
+	glGetShaderSource(shader, bufSize, length, source);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetShaderSource);
+	gl_record_value(shader);
+	gl_record_value(bufSize);
+}
+inline GLint APIENTRY gl_recorded_GetUniformLocation(GLuint program, const GLchar *name) {
+	GLint ret = glGetUniformLocation(program, name);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_GetUniformLocation);
+	gl_record_value(program);
+	gl_record_string(name);
+	gl_record_value(ret);
+	return ret;
+}
+inline void APIENTRY gl_recorded_GetUniformfv(GLuint program, GLint location, GLfloat *params) {
+	glGetUniformfv(program, location, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetUniformfv);
+	gl_record_value(program);
+	gl_record_value(location);
+}
+inline void APIENTRY gl_recorded_GetUniformiv(GLuint program, GLint location, GLint *params) {
+	glGetUniformiv(program, location, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetUniformiv);
+	gl_record_value(program);
+	gl_record_value(location);
+}
+inline void APIENTRY gl_recorded_GetVertexAttribdv(GLuint index, GLenum pname, GLdouble *params) {
+	glGetVertexAttribdv(index, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetVertexAttribdv);
+	gl_record_value(index);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetVertexAttribfv(GLuint index, GLenum pname, GLfloat *params) {
+	glGetVertexAttribfv(index, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetVertexAttribfv);
+	gl_record_value(index);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetVertexAttribiv(GLuint index, GLenum pname, GLint *params) {
+	glGetVertexAttribiv(index, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetVertexAttribiv);
+	gl_record_value(index);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetVertexAttribPointerv(GLuint index, GLenum pname, void **pointer) {
+	glGetVertexAttribPointerv(index, pname, pointer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetVertexAttribPointerv);
+	gl_record_value(index);
+	gl_record_value(pname);
+}
+inline GLboolean APIENTRY gl_recorded_IsProgram(GLuint program) {
+	GLboolean ret = glIsProgram(program);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsProgram);
+	gl_record_value(program);
+	return ret;
+}
+inline GLboolean APIENTRY gl_recorded_IsShader(GLuint shader) {
+	GLboolean ret = glIsShader(shader);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsShader);
+	gl_record_value(shader);
+	return ret;
+}
+inline void APIENTRY gl_recorded_LinkProgram(GLuint program) {
+	glLinkProgram(program);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_LinkProgram);
+	gl_record_value(program);
+}
+inline void APIENTRY gl_recorded_ShaderSource(GLuint shader, GLsizei count, const GLchar *const*string, const GLint *length) {
+	glShaderSource(shader, count, string, length);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ShaderSource);
+	gl_record_value(shader);
+	gl_record_value(count);
+	gl_record_strings(count, string, length);
+}
+inline void APIENTRY gl_recorded_UseProgram(GLuint program) {
+	glUseProgram(program);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UseProgram);
+	gl_record_value(program);
+}
+inline void APIENTRY gl_recorded_Uniform1f(GLint location, GLfloat v0) {
+	glUniform1f(location, v0);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform1f);
+	gl_record_value(location);
+	gl_record_value(v0);
+}
+inline void APIENTRY gl_recorded_Uniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	glUniform2f(location, v0, v1);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform2f);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+}
+inline void APIENTRY gl_recorded_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	glUniform3f(location, v0, v1, v2);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform3f);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+	gl_record_value(v2);
+}
+inline void APIENTRY gl_recorded_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	glUniform4f(location, v0, v1, v2, v3);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform4f);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+	gl_record_value(v2);
+	gl_record_value(v3);
+}
+inline void APIENTRY gl_recorded_Uniform1i(GLint location, GLint v0) {
+	glUniform1i(location, v0);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform1i);
+	gl_record_value(location);
+	gl_record_value(v0);
+}
+inline void APIENTRY gl_recorded_Uniform2i(GLint location, GLint v0, GLint v1) {
+	glUniform2i(location, v0, v1);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform2i);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+}
+inline void APIENTRY gl_recorded_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	glUniform3i(location, v0, v1, v2);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform3i);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+	gl_record_value(v2);
+}
+inline void APIENTRY gl_recorded_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	glUniform4i(location, v0, v1, v2, v3);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform4i);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+	gl_record_value(v2);
+	gl_record_value(v3);
+}
+inline void APIENTRY gl_recorded_Uniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	glUniform1fv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform1fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 1) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_Uniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	glUniform2fv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform2fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 2) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_Uniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	glUniform3fv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform3fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 3) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_Uniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	glUniform4fv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform4fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 4) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_Uniform1iv(GLint location, GLsizei count, const GLint *value) {
+	glUniform1iv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform1iv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 1) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_Uniform2iv(GLint location, GLsizei count, const GLint *value) {
+	glUniform2iv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform2iv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 2) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_Uniform3iv(GLint location, GLsizei count, const GLint *value) {
+	glUniform3iv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform3iv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 3) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_Uniform4iv(GLint location, GLsizei count, const GLint *value) {
+	glUniform4iv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform4iv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 4) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix2fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix2fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 4) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix3fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix3fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 9) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix4fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix4fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 16) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_ValidateProgram(GLuint program) {
+	glValidateProgram(program);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ValidateProgram);
+	gl_record_value(program);
+}
+inline void APIENTRY gl_recorded_VertexAttrib1d(GLuint index, GLdouble x) {
+	glVertexAttrib1d(index, x);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib1d);
+	gl_record_value(index);
+	gl_record_value(x);
+}
+inline void APIENTRY gl_recorded_VertexAttrib1dv(GLuint index, const GLdouble *v) {
+	glVertexAttrib1dv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib1dv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(1) * sizeof(GLdouble));
+}
+inline void APIENTRY gl_recorded_VertexAttrib1f(GLuint index, GLfloat x) {
+	glVertexAttrib1f(index, x);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib1f);
+	gl_record_value(index);
+	gl_record_value(x);
+}
+inline void APIENTRY gl_recorded_VertexAttrib1fv(GLuint index, const GLfloat *v) {
+	glVertexAttrib1fv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib1fv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(1) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_VertexAttrib1s(GLuint index, GLshort x) {
+	glVertexAttrib1s(index, x);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib1s);
+	gl_record_value(index);
+	gl_record_value(x);
+}
+inline void APIENTRY gl_recorded_VertexAttrib1sv(GLuint index, const GLshort *v) {
+	glVertexAttrib1sv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib1sv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(1) * sizeof(GLshort));
+}
+inline void APIENTRY gl_recorded_VertexAttrib2d(GLuint index, GLdouble x, GLdouble y) {
+	glVertexAttrib2d(index, x, y);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib2d);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+}
+inline void APIENTRY gl_recorded_VertexAttrib2dv(GLuint index, const GLdouble *v) {
+	glVertexAttrib2dv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib2dv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(2) * sizeof(GLdouble));
+}
+inline void APIENTRY gl_recorded_VertexAttrib2f(GLuint index, GLfloat x, GLfloat y) {
+	glVertexAttrib2f(index, x, y);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib2f);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+}
+inline void APIENTRY gl_recorded_VertexAttrib2fv(GLuint index, const GLfloat *v) {
+	glVertexAttrib2fv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib2fv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(2) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_VertexAttrib2s(GLuint index, GLshort x, GLshort y) {
+	glVertexAttrib2s(index, x, y);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib2s);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+}
+inline void APIENTRY gl_recorded_VertexAttrib2sv(GLuint index, const GLshort *v) {
+	glVertexAttrib2sv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib2sv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(2) * sizeof(GLshort));
+}
+inline void APIENTRY gl_recorded_VertexAttrib3d(GLuint index, GLdouble x, GLdouble y, GLdouble z) {
+	glVertexAttrib3d(index, x, y, z);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib3d);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+}
+inline void APIENTRY gl_recorded_VertexAttrib3dv(GLuint index, const GLdouble *v) {
+	glVertexAttrib3dv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib3dv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(3) * sizeof(GLdouble));
+}
+inline void APIENTRY gl_recorded_VertexAttrib3f(GLuint index, GLfloat x, GLfloat y, GLfloat z) {
+	glVertexAttrib3f(index, x, y, z);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib3f);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+}
+inline void APIENTRY gl_recorded_VertexAttrib3fv(GLuint index, const GLfloat *v) {
+	glVertexAttrib3fv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib3fv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(3) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_VertexAttrib3s(GLuint index, GLshort x, GLshort y, GLshort z) {
+	glVertexAttrib3s(index, x, y, z);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib3s);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+}
+inline void APIENTRY gl_recorded_VertexAttrib3sv(GLuint index, const GLshort *v) {
+	glVertexAttrib3sv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib3sv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(3) * sizeof(GLshort));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4Nbv(GLuint index, const GLbyte *v) {
+	glVertexAttrib4Nbv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4Nbv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLbyte));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4Niv(GLuint index, const GLint *v) {
+	glVertexAttrib4Niv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4Niv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4Nsv(GLuint index, const GLshort *v) {
+	glVertexAttrib4Nsv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4Nsv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLshort));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4Nub(GLuint index, GLubyte x, GLubyte y, GLubyte z, GLubyte w) {
+	glVertexAttrib4Nub(index, x, y, z, w);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4Nub);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+	gl_record_value(w);
+}
+inline void APIENTRY gl_recorded_VertexAttrib4Nubv(GLuint index, const GLubyte *v) {
+	glVertexAttrib4Nubv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4Nubv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLubyte));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4Nuiv(GLuint index, const GLuint *v) {
+	glVertexAttrib4Nuiv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4Nuiv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4Nusv(GLuint index, const GLushort *v) {
+	glVertexAttrib4Nusv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4Nusv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLushort));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4bv(GLuint index, const GLbyte *v) {
+	glVertexAttrib4bv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4bv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLbyte));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4d(GLuint index, GLdouble x, GLdouble y, GLdouble z, GLdouble w) {
+	glVertexAttrib4d(index, x, y, z, w);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4d);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+	gl_record_value(w);
+}
+inline void APIENTRY gl_recorded_VertexAttrib4dv(GLuint index, const GLdouble *v) {
+	glVertexAttrib4dv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4dv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLdouble));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4f(GLuint index, GLfloat x, GLfloat y, GLfloat z, GLfloat w) {
+	glVertexAttrib4f(index, x, y, z, w);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4f);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+	gl_record_value(w);
+}
+inline void APIENTRY gl_recorded_VertexAttrib4fv(GLuint index, const GLfloat *v) {
+	glVertexAttrib4fv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4fv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4iv(GLuint index, const GLint *v) {
+	glVertexAttrib4iv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4iv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4s(GLuint index, GLshort x, GLshort y, GLshort z, GLshort w) {
+	glVertexAttrib4s(index, x, y, z, w);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4s);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+	gl_record_value(w);
+}
+inline void APIENTRY gl_recorded_VertexAttrib4sv(GLuint index, const GLshort *v) {
+	glVertexAttrib4sv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4sv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLshort));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4ubv(GLuint index, const GLubyte *v) {
+	glVertexAttrib4ubv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4ubv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLubyte));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4uiv(GLuint index, const GLuint *v) {
+	glVertexAttrib4uiv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4uiv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttrib4usv(GLuint index, const GLushort *v) {
+	glVertexAttrib4usv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttrib4usv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLushort));
+}
+inline void APIENTRY gl_recorded_VertexAttribPointer(GLuint index, GLint size, GLenum type, GLboolean normalized, GLsizei stride, const void *pointer) {
+	glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribPointer);
+	gl_record_value(index);
+	gl_record_value(size);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_value(stride);
+	gl_record_value(uint64_t(uintptr_t(pointer)));
+}
+inline void APIENTRY gl_recorded_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix2x3fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix2x3fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 6) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix3x2fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix3x2fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 6) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix2x4fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix2x4fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 8) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix4x2fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix4x2fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 8) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix3x4fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix3x4fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 12) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	glUniformMatrix4x3fv(location, count, transpose, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformMatrix4x3fv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_value(transpose);
+	gl_record_data(value, gl_record_count(count * 12) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_ColorMaski(GLuint index, GLboolean r, GLboolean g, GLboolean b, GLboolean a) {
+	glColorMaski(index, r, g, b, a);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ColorMaski);
+	gl_record_value(index);
+	gl_record_value(r);
+	gl_record_value(g);
+	gl_record_value(b);
+	gl_record_value(a);
+}
+inline void APIENTRY gl_recorded_GetBooleani_v(GLenum target, GLuint index, GLboolean *data) {
+	glGetBooleani_v(target, index, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetBooleani_v);
+	gl_record_value(target);
+	gl_record_value(index);
+}
+inline void APIENTRY gl_recorded_GetIntegeri_v(GLenum target, GLuint index, GLint *data) {
+	glGetIntegeri_v(target, index, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetIntegeri_v);
+	gl_record_value(target);
+	gl_record_value(index);
+}
+inline void APIENTRY gl_recorded_Enablei(GLenum target, GLuint index) {
+	glEnablei(target, index);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Enablei);
+	gl_record_value(target);
+	gl_record_value(index);
+}
+inline void APIENTRY gl_recorded_Disablei(GLenum target, GLuint index) {
+	glDisablei(target, index);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Disablei);
+	gl_record_value(target);
+	gl_record_value(index);
+}
+inline GLboolean APIENTRY gl_recorded_IsEnabledi(GLenum target, GLuint index) {
+	GLboolean ret = glIsEnabledi(target, index);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsEnabledi);
+	gl_record_value(target);
+	gl_record_value(index);
+	return ret;
+}
+inline void APIENTRY gl_recorded_BeginTransformFeedback(GLenum primitiveMode) {
+	glBeginTransformFeedback(primitiveMode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BeginTransformFeedback);
+	gl_record_value(primitiveMode);
+}
+inline void APIENTRY gl_recorded_EndTransformFeedback(void) {
+	glEndTransformFeedback();
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_EndTransformFeedback);
+}
+inline void APIENTRY gl_recorded_BindBufferRange(GLenum target, GLuint index, GLuint buffer, GLintptr offset, GLsizeiptr size) {
+	glBindBufferRange(target, index, buffer, offset, size);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindBufferRange);
+	gl_record_value(target);
+	gl_record_value(index);
+	gl_record_value(buffer);
+	gl_record_value(int64_t(offset));
+	gl_record_value(int64_t(size));
+}
+inline void APIENTRY gl_recorded_BindBufferBase(GLenum target, GLuint index, GLuint buffer) {
+	glBindBufferBase(target, index, buffer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindBufferBase);
+	gl_record_value(target);
+	gl_record_value(index);
+	gl_record_value(buffer);
+}
+inline void APIENTRY gl_recorded_TransformFeedbackVaryings(GLuint program, GLsizei count, const GLchar *const*varyings, GLenum bufferMode) {
+	glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TransformFeedbackVaryings);
+	gl_record_value(program);
+	gl_record_value(count);
+	gl_record_strings(count, varyings, nullptr);
+	gl_record_value(bufferMode);
+}
+inline void APIENTRY gl_recorded_GetTransformFeedbackVarying(GLuint program, GLuint index, GLsizei bufSize, GLsizei *length, GLsizei *size, GLenum *type, GLchar *name) {
+	glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetTransformFeedbackVarying);
+	gl_record_value(program);
+	gl_record_value(index);
+	gl_record_value(bufSize);
+}
+inline void APIENTRY gl_recorded_ClampColor(GLenum target, GLenum clamp) {
+	glClampColor(target, clamp);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ClampColor);
+	gl_record_value(target);
+	gl_record_value(clamp);
+}
+inline void APIENTRY gl_recorded_BeginConditionalRender(GLuint id, GLenum mode) {
+	glBeginConditionalRender(id, mode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BeginConditionalRender);
+	gl_record_value(id);
+	gl_record_value(mode);
+}
+inline void APIENTRY gl_recorded_EndConditionalRender(void) {
+	glEndConditionalRender();
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_EndConditionalRender);
+}
+inline void APIENTRY gl_recorded_VertexAttribIPointer(GLuint index, GLint size, GLenum type, GLsizei stride, const void *pointer) {
+	glVertexAttribIPointer(index, size, type, stride, pointer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribIPointer);
+	gl_record_value(index);
+	gl_record_value(size);
+	gl_record_value(type);
+	gl_record_value(stride);
+	gl_record_value(uint64_t(uintptr_t(pointer)));
+}
+inline void APIENTRY gl_recorded_GetVertexAttribIiv(GLuint index, GLenum pname, GLint *params) {
+	glGetVertexAttribIiv(index, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetVertexAttribIiv);
+	gl_record_value(index);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetVertexAttribIuiv(GLuint index, GLenum pname, GLuint *params) {
+	glGetVertexAttribIuiv(index, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetVertexAttribIuiv);
+	gl_record_value(index);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_VertexAttribI1i(GLuint index, GLint x) {
+	glVertexAttribI1i(index, x);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI1i);
+	gl_record_value(index);
+	gl_record_value(x);
+}
+inline void APIENTRY gl_recorded_VertexAttribI2i(GLuint index, GLint x, GLint y) {
+	glVertexAttribI2i(index, x, y);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI2i);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+}
+inline void APIENTRY gl_recorded_VertexAttribI3i(GLuint index, GLint x, GLint y, GLint z) {
+	glVertexAttribI3i(index, x, y, z);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI3i);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+}
+inline void APIENTRY gl_recorded_VertexAttribI4i(GLuint index, GLint x, GLint y, GLint z, GLint w) {
+	glVertexAttribI4i(index, x, y, z, w);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI4i);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+	gl_record_value(w);
+}
+inline void APIENTRY gl_recorded_VertexAttribI1ui(GLuint index, GLuint x) {
+	glVertexAttribI1ui(index, x);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI1ui);
+	gl_record_value(index);
+	gl_record_value(x);
+}
+inline void APIENTRY gl_recorded_VertexAttribI2ui(GLuint index, GLuint x, GLuint y) {
+	glVertexAttribI2ui(index, x, y);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI2ui);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+}
+inline void APIENTRY gl_recorded_VertexAttribI3ui(GLuint index, GLuint x, GLuint y, GLuint z) {
+	glVertexAttribI3ui(index, x, y, z);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI3ui);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+}
+inline void APIENTRY gl_recorded_VertexAttribI4ui(GLuint index, GLuint x, GLuint y, GLuint z, GLuint w) {
+	glVertexAttribI4ui(index, x, y, z, w);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI4ui);
+	gl_record_value(index);
+	gl_record_value(x);
+	gl_record_value(y);
+	gl_record_value(z);
+	gl_record_value(w);
+}
+inline void APIENTRY gl_recorded_VertexAttribI1iv(GLuint index, const GLint *v) {
+	glVertexAttribI1iv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI1iv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(1) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_VertexAttribI2iv(GLuint index, const GLint *v) {
+	glVertexAttribI2iv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI2iv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(2) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_VertexAttribI3iv(GLuint index, const GLint *v) {
+	glVertexAttribI3iv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI3iv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(3) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_VertexAttribI4iv(GLuint index, const GLint *v) {
+	glVertexAttribI4iv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI4iv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_VertexAttribI1uiv(GLuint index, const GLuint *v) {
+	glVertexAttribI1uiv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI1uiv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(1) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttribI2uiv(GLuint index, const GLuint *v) {
+	glVertexAttribI2uiv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI2uiv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(2) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttribI3uiv(GLuint index, const GLuint *v) {
+	glVertexAttribI3uiv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI3uiv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(3) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttribI4uiv(GLuint index, const GLuint *v) {
+	glVertexAttribI4uiv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI4uiv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttribI4bv(GLuint index, const GLbyte *v) {
+	glVertexAttribI4bv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI4bv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLbyte));
+}
+inline void APIENTRY gl_recorded_VertexAttribI4sv(GLuint index, const GLshort *v) {
+	glVertexAttribI4sv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI4sv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLshort));
+}
+inline void APIENTRY gl_recorded_VertexAttribI4ubv(GLuint index, const GLubyte *v) {
+	glVertexAttribI4ubv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI4ubv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLubyte));
+}
+inline void APIENTRY gl_recorded_VertexAttribI4usv(GLuint index, const GLushort *v) {
+	glVertexAttribI4usv(index, v);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribI4usv);
+	gl_record_value(index);
+	gl_record_data(v, gl_record_count(4) * sizeof(GLushort));
+}
+inline void APIENTRY gl_recorded_GetUniformuiv(GLuint program, GLint location, GLuint *params) {
+	glGetUniformuiv(program, location, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetUniformuiv);
+	gl_record_value(program);
+	gl_record_value(location);
+}
+inline void APIENTRY gl_recorded_BindFragDataLocation(GLuint program, GLuint color, const GLchar *name) {
+	glBindFragDataLocation(program, color, name);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindFragDataLocation);
+	gl_record_value(program);
+	gl_record_value(color);
+	gl_record_string(name);
+}
+inline GLint APIENTRY gl_recorded_GetFragDataLocation(GLuint program, const GLchar *name) {
+	GLint ret = glGetFragDataLocation(program, name);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_GetFragDataLocation);
+	gl_record_value(program);
+	gl_record_string(name);
+	return ret;
+}
+inline void APIENTRY gl_recorded_Uniform1ui(GLint location, GLuint v0) {
+	glUniform1ui(location, v0);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform1ui);
+	gl_record_value(location);
+	gl_record_value(v0);
+}
+inline void APIENTRY gl_recorded_Uniform2ui(GLint location, GLuint v0, GLuint v1) {
+	glUniform2ui(location, v0, v1);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform2ui);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+}
+inline void APIENTRY gl_recorded_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	glUniform3ui(location, v0, v1, v2);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform3ui);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+	gl_record_value(v2);
+}
+inline void APIENTRY gl_recorded_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	glUniform4ui(location, v0, v1, v2, v3);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform4ui);
+	gl_record_value(location);
+	gl_record_value(v0);
+	gl_record_value(v1);
+	gl_record_value(v2);
+	gl_record_value(v3);
+}
+inline void APIENTRY gl_recorded_Uniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	glUniform1uiv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform1uiv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 1) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_Uniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	glUniform2uiv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform2uiv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 2) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_Uniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	glUniform3uiv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform3uiv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 3) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_Uniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	glUniform4uiv(location, count, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_Uniform4uiv);
+	gl_record_value(location);
+	gl_record_value(count);
+	gl_record_data(value, gl_record_count(count * 4) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_TexParameterIiv(GLenum target, GLenum pname, const GLint *params) {
+	glTexParameterIiv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexParameterIiv);
+	gl_record_value(target);
+	gl_record_value(pname);
+	gl_record_data(params, gl_record_count((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_TexParameterIuiv(GLenum target, GLenum pname, const GLuint *params) {
+	glTexParameterIuiv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexParameterIuiv);
+	gl_record_value(target);
+	gl_record_value(pname);
+	gl_record_data(params, gl_record_count((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_GetTexParameterIiv(GLenum target, GLenum pname, GLint *params) {
+	glGetTexParameterIiv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetTexParameterIiv);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetTexParameterIuiv(GLenum target, GLenum pname, GLuint *params) {
+	glGetTexParameterIuiv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetTexParameterIuiv);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_ClearBufferiv(GLenum buffer, GLint drawbuffer, const GLint *value) {
+	glClearBufferiv(buffer, drawbuffer, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ClearBufferiv);
+	gl_record_value(buffer);
+	gl_record_value(drawbuffer);
+	gl_record_data(value, gl_record_count((buffer == GL_COLOR ? 4 : 1)) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_ClearBufferuiv(GLenum buffer, GLint drawbuffer, const GLuint *value) {
+	glClearBufferuiv(buffer, drawbuffer, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ClearBufferuiv);
+	gl_record_value(buffer);
+	gl_record_value(drawbuffer);
+	gl_record_data(value, gl_record_count((buffer == GL_COLOR ? 4 : 1)) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_ClearBufferfv(GLenum buffer, GLint drawbuffer, const GLfloat *value) {
+	glClearBufferfv(buffer, drawbuffer, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ClearBufferfv);
+	gl_record_value(buffer);
+	gl_record_value(drawbuffer);
+	gl_record_data(value, gl_record_count((buffer == GL_COLOR ? 4 : 1)) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_ClearBufferfi(GLenum buffer, GLint drawbuffer, GLfloat depth, GLint stencil) {
+	glClearBufferfi(buffer, drawbuffer, depth, stencil);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ClearBufferfi);
+	gl_record_value(buffer);
+	gl_record_value(drawbuffer);
+	gl_record_value(depth);
+	gl_record_value(stencil);
+}
+inline const GLubyte * APIENTRY gl_recorded_GetStringi(GLenum name, GLuint index) {
+	const GLubyte * ret = glGetStringi(name, index);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_GetStringi);
+	gl_record_value(name);
+	gl_record_value(index);
+	return ret;
+}
+inline GLboolean APIENTRY gl_recorded_IsRenderbuffer(GLuint renderbuffer) {
+	GLboolean ret = glIsRenderbuffer(renderbuffer);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsRenderbuffer);
+	gl_record_value(renderbuffer);
+	return ret;
+}
+inline void APIENTRY gl_recorded_BindRenderbuffer(GLenum target, GLuint renderbuffer) {
+	glBindRenderbuffer(target, renderbuffer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindRenderbuffer);
+	gl_record_value(target);
+	gl_record_value(renderbuffer);
+}
+inline void APIENTRY gl_recorded_DeleteRenderbuffers(GLsizei n, const GLuint *renderbuffers) {
+	glDeleteRenderbuffers(n, renderbuffers);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteRenderbuffers);
+	gl_record_value(n);
+	gl_record_data(renderbuffers, gl_record_count(n) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_GenRenderbuffers(GLsizei n, GLuint *renderbuffers) {
+	glGenRenderbuffers(n, renderbuffers);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GenRenderbuffers);
+	gl_record_value(n);
+	gl_record_data(renderbuffers, gl_record_count(n) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_RenderbufferStorage(GLenum target, GLenum internalformat, GLsizei width, GLsizei height) {
+	glRenderbufferStorage(target, internalformat, width, height);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_RenderbufferStorage);
+	gl_record_value(target);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(height);
+}
+inline void APIENTRY gl_recorded_GetRenderbufferParameteriv(GLenum target, GLenum pname, GLint *params) {
+	glGetRenderbufferParameteriv(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetRenderbufferParameteriv);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline GLboolean APIENTRY gl_recorded_IsFramebuffer(GLuint framebuffer) {
+	GLboolean ret = glIsFramebuffer(framebuffer);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsFramebuffer);
+	gl_record_value(framebuffer);
+	return ret;
+}
+inline void APIENTRY gl_recorded_BindFramebuffer(GLenum target, GLuint framebuffer) {
+	glBindFramebuffer(target, framebuffer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindFramebuffer);
+	gl_record_value(target);
+	gl_record_value(framebuffer);
+}
+inline void APIENTRY gl_recorded_DeleteFramebuffers(GLsizei n, const GLuint *framebuffers) {
+	glDeleteFramebuffers(n, framebuffers);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteFramebuffers);
+	gl_record_value(n);
+	gl_record_data(framebuffers, gl_record_count(n) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_GenFramebuffers(GLsizei n, GLuint *framebuffers) {
+	glGenFramebuffers(n, framebuffers);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GenFramebuffers);
+	gl_record_value(n);
+	gl_record_data(framebuffers, gl_record_count(n) * sizeof(GLuint));
+}
+inline GLenum APIENTRY gl_recorded_CheckFramebufferStatus(GLenum target) {
+	GLenum ret = glCheckFramebufferStatus(target);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_CheckFramebufferStatus);
+	gl_record_value(target);
+	return ret;
+}
+inline void APIENTRY gl_recorded_FramebufferTexture1D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glFramebufferTexture1D(target, attachment, textarget, texture, level);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_FramebufferTexture1D);
+	gl_record_value(target);
+	gl_record_value(attachment);
+	gl_record_value(textarget);
+	gl_record_value(texture);
+	gl_record_value(level);
+}
+inline void APIENTRY gl_recorded_FramebufferTexture2D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level) {
+	glFramebufferTexture2D(target, attachment, textarget, texture, level);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_FramebufferTexture2D);
+	gl_record_value(target);
+	gl_record_value(attachment);
+	gl_record_value(textarget);
+	gl_record_value(texture);
+	gl_record_value(level);
+}
+inline void APIENTRY gl_recorded_FramebufferTexture3D(GLenum target, GLenum attachment, GLenum textarget, GLuint texture, GLint level, GLint zoffset) {
+	glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_FramebufferTexture3D);
+	gl_record_value(target);
+	gl_record_value(attachment);
+	gl_record_value(textarget);
+	gl_record_value(texture);
+	gl_record_value(level);
+	gl_record_value(zoffset);
+}
+inline void APIENTRY gl_recorded_FramebufferRenderbuffer(GLenum target, GLenum attachment, GLenum renderbuffertarget, GLuint renderbuffer) {
+	glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_FramebufferRenderbuffer);
+	gl_record_value(target);
+	gl_record_value(attachment);
+	gl_record_value(renderbuffertarget);
+	gl_record_value(renderbuffer);
+}
+inline void APIENTRY gl_recorded_GetFramebufferAttachmentParameteriv(GLenum target, GLenum attachment, GLenum pname, GLint *params) {
+	glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetFramebufferAttachmentParameteriv);
+	gl_record_value(target);
+	gl_record_value(attachment);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GenerateMipmap(GLenum target) {
+	glGenerateMipmap(target);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GenerateMipmap);
+	gl_record_value(target);
+}
+inline void APIENTRY gl_recorded_BlitFramebuffer(GLint srcX0, GLint srcY0, GLint srcX1, GLint srcY1, GLint dstX0, GLint dstY0, GLint dstX1, GLint dstY1, GLbitfield mask, GLenum filter) {
+	glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BlitFramebuffer);
+	gl_record_value(srcX0);
+	gl_record_value(srcY0);
+	gl_record_value(srcX1);
+	gl_record_value(srcY1);
+	gl_record_value(dstX0);
+	gl_record_value(dstY0);
+	gl_record_value(dstX1);
+	gl_record_value(dstY1);
+	gl_record_value(mask);
+	gl_record_value(filter);
+}
+inline void APIENTRY gl_recorded_RenderbufferStorageMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height) {
+	glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_RenderbufferStorageMultisample);
+	gl_record_value(target);
+	gl_record_value(samples);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(height);
+}
+inline void APIENTRY gl_recorded_FramebufferTextureLayer(GLenum target, GLenum attachment, GLuint texture, GLint level, GLint layer) {
+	glFramebufferTextureLayer(target, attachment, texture, level, layer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_FramebufferTextureLayer);
+	gl_record_value(target);
+	gl_record_value(attachment);
+	gl_record_value(texture);
+	gl_record_value(level);
+	gl_record_value(layer);
+}
+inline void * APIENTRY gl_recorded_MapBufferRange(GLenum target, GLintptr offset, GLsizeiptr length, GLbitfield access) {
+	void * ret = glMapBufferRange(target, offset, length, access);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_MapBufferRange);
+	gl_record_value(target);
+	gl_record_value(int64_t(offset));
+	gl_record_value(int64_t(length));
+	gl_record_value(access);
+	gl_record_mapped(target, ret, offset, length, access);
+	return ret;
+}
+inline void APIENTRY gl_recorded_FlushMappedBufferRange(GLenum target, GLintptr offset, GLsizeiptr length) {
+	if (gl_recording) gl_record_flushing(target, offset, length);
+	glFlushMappedBufferRange(target, offset, length);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_FlushMappedBufferRange);
+	gl_record_value(target);
+	gl_record_value(int64_t(offset));
+	gl_record_value(int64_t(length));
+}
+inline void APIENTRY gl_recorded_BindVertexArray(GLuint array) {
+	glBindVertexArray(array);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindVertexArray);
+	gl_record_value(array);
+}
+inline void APIENTRY gl_recorded_DeleteVertexArrays(GLsizei n, const GLuint *arrays) {
+	glDeleteVertexArrays(n, arrays);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteVertexArrays);
+	gl_record_value(n);
+	gl_record_data(arrays, gl_record_count(n) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_GenVertexArrays(GLsizei n, GLuint *arrays) {
+	glGenVertexArrays(n, arrays);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GenVertexArrays);
+	gl_record_value(n);
+	gl_record_data(arrays, gl_record_count(n) * sizeof(GLuint));
+}
+inline GLboolean APIENTRY gl_recorded_IsVertexArray(GLuint array) {
+	GLboolean ret = glIsVertexArray(array);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsVertexArray);
+	gl_record_value(array);
+	return ret;
+}
+inline void APIENTRY gl_recorded_DrawArraysInstanced(GLenum mode, GLint first, GLsizei count, GLsizei instancecount) {
+	glDrawArraysInstanced(mode, first, count, instancecount);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawArraysInstanced);
+	gl_record_value(mode);
+	gl_record_value(first);
+	gl_record_value(count);
+	gl_record_value(instancecount);
+}
+inline void APIENTRY gl_recorded_DrawElementsInstanced(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount) {
+	glDrawElementsInstanced(mode, count, type, indices, instancecount);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawElementsInstanced);
+	gl_record_value(mode);
+	gl_record_value(count);
+	gl_record_value(type);
+	gl_record_value(uint64_t(uintptr_t(indices)));
+	gl_record_value(instancecount);
+}
+inline void APIENTRY gl_recorded_TexBuffer(GLenum target, GLenum internalformat, GLuint buffer) {
+	glTexBuffer(target, internalformat, buffer);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexBuffer);
+	gl_record_value(target);
+	gl_record_value(internalformat);
+	gl_record_value(buffer);
+}
+inline void APIENTRY gl_recorded_PrimitiveRestartIndex(GLuint index) {
+	glPrimitiveRestartIndex(index);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_PrimitiveRestartIndex);
+	gl_record_value(index);
+}
+inline void APIENTRY gl_recorded_CopyBufferSubData(GLenum readTarget, GLenum writeTarget, GLintptr readOffset, GLintptr writeOffset, GLsizeiptr size) {
+	glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_CopyBufferSubData);
+	gl_record_value(readTarget);
+	gl_record_value(writeTarget);
+	gl_record_value(int64_t(readOffset));
+	gl_record_value(int64_t(writeOffset));
+	gl_record_value(int64_t(size));
+}
+inline void APIENTRY gl_recorded_GetUniformIndices(GLuint program, GLsizei uniformCount, const GLchar *const*uniformNames, GLuint *uniformIndices) {
+	glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetUniformIndices);
+	gl_record_value(program);
+	gl_record_value(uniformCount);
+	gl_record_strings(uniformCount, uniformNames, nullptr);
+}
+inline void APIENTRY gl_recorded_GetActiveUniformsiv(GLuint program, GLsizei uniformCount, const GLuint *uniformIndices, GLenum pname, GLint *params) {
+	glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetActiveUniformsiv);
+	gl_record_value(program);
+	gl_record_value(uniformCount);
+	gl_record_data(uniformIndices, gl_record_count(uniformCount) * sizeof(GLuint));
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetActiveUniformName(GLuint program, GLuint uniformIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformName) {
+	glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetActiveUniformName);
+	gl_record_value(program);
+	gl_record_value(uniformIndex);
+	gl_record_value(bufSize);
+}
+inline GLuint APIENTRY gl_recorded_GetUniformBlockIndex(GLuint program, const GLchar *uniformBlockName) {
+	GLuint ret = glGetUniformBlockIndex(program, uniformBlockName);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_GetUniformBlockIndex);
+	gl_record_value(program);
+	gl_record_string(uniformBlockName);
+	return ret;
+}
+inline void APIENTRY gl_recorded_GetActiveUniformBlockiv(GLuint program, GLuint uniformBlockIndex, GLenum pname, GLint *params) {
+	glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetActiveUniformBlockiv);
+	gl_record_value(program);
+	gl_record_value(uniformBlockIndex);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetActiveUniformBlockName(GLuint program, GLuint uniformBlockIndex, GLsizei bufSize, GLsizei *length, GLchar *uniformBlockName) {
+	glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetActiveUniformBlockName);
+	gl_record_value(program);
+	gl_record_value(uniformBlockIndex);
+	gl_record_value(bufSize);
+}
+inline void APIENTRY gl_recorded_UniformBlockBinding(GLuint program, GLuint uniformBlockIndex, GLuint uniformBlockBinding) {
+	glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_UniformBlockBinding);
+	gl_record_value(program);
+	gl_record_value(uniformBlockIndex);
+	gl_record_value(uniformBlockBinding);
+}
+inline void APIENTRY gl_recorded_DrawElementsBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawElementsBaseVertex);
+	gl_record_value(mode);
+	gl_record_value(count);
+	gl_record_value(type);
+	gl_record_value(uint64_t(uintptr_t(indices)));
+	gl_record_value(basevertex);
+}
+inline void APIENTRY gl_recorded_DrawRangeElementsBaseVertex(GLenum mode, GLuint start, GLuint end, GLsizei count, GLenum type, const void *indices, GLint basevertex) {
+	glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawRangeElementsBaseVertex);
+	gl_record_value(mode);
+	gl_record_value(start);
+	gl_record_value(end);
+	gl_record_value(count);
+	gl_record_value(type);
+	gl_record_value(uint64_t(uintptr_t(indices)));
+	gl_record_value(basevertex);
+}
+inline void APIENTRY gl_recorded_DrawElementsInstancedBaseVertex(GLenum mode, GLsizei count, GLenum type, const void *indices, GLsizei instancecount, GLint basevertex) {
+	glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DrawElementsInstancedBaseVertex);
+	gl_record_value(mode);
+	gl_record_value(count);
+	gl_record_value(type);
+	gl_record_value(uint64_t(uintptr_t(indices)));
+	gl_record_value(instancecount);
+	gl_record_value(basevertex);
+}
+inline void APIENTRY gl_recorded_MultiDrawElementsBaseVertex(GLenum mode, const GLsizei *count, GLenum type, const void *const*indices, GLsizei drawcount, const GLint *basevertex) {
+	glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_MultiDrawElementsBaseVertex);
+	gl_record_value(mode);
+	gl_record_data(count, gl_record_count(drawcount) * sizeof(GLsizei));
+	gl_record_value(type);
+	gl_record_offsets(indices, drawcount);
+	gl_record_value(drawcount);
+	gl_record_data(basevertex, gl_record_count(drawcount) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_ProvokingVertex(GLenum mode) {
+	glProvokingVertex(mode);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_ProvokingVertex);
+	gl_record_value(mode);
+}
+inline GLsync APIENTRY gl_recorded_FenceSync(GLenum condition, GLbitfield flags) {
+	GLsync ret = glFenceSync(condition, flags);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_FenceSync);
+	gl_record_value(condition);
+	gl_record_value(flags);
+	gl_record_value(uint64_t(uintptr_t(ret)));
+	return ret;
+}
+inline GLboolean APIENTRY gl_recorded_IsSync(GLsync sync) {
+	GLboolean ret = glIsSync(sync);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsSync);
+	gl_record_value(uint64_t(uintptr_t(sync)));
+	return ret;
+}
+inline void APIENTRY gl_recorded_DeleteSync(GLsync sync) {
+	glDeleteSync(sync);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteSync);
+	gl_record_value(uint64_t(uintptr_t(sync)));
+}
+inline GLenum APIENTRY gl_recorded_ClientWaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	GLenum ret = glClientWaitSync(sync, flags, timeout);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_ClientWaitSync);
+	gl_record_value(uint64_t(uintptr_t(sync)));
+	gl_record_value(flags);
+	gl_record_value(timeout);
+	return ret;
+}
+inline void APIENTRY gl_recorded_WaitSync(GLsync sync, GLbitfield flags, GLuint64 timeout) {
+	glWaitSync(sync, flags, timeout);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_WaitSync);
+	gl_record_value(uint64_t(uintptr_t(sync)));
+	gl_record_value(flags);
+	gl_record_value(timeout);
+}
+inline void APIENTRY gl_recorded_GetInteger64v(GLenum pname, GLint64 *data) {
+	glGetInteger64v(pname, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetInteger64v);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetSynciv(GLsync sync, GLenum pname, GLsizei bufSize, GLsizei *length, GLint *values) {
+	glGetSynciv(sync, pname, bufSize, length, values);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetSynciv);
+	gl_record_value(uint64_t(uintptr_t(sync)));
+	gl_record_value(pname);
+	gl_record_value(bufSize);
+}
+inline void APIENTRY gl_recorded_GetInteger64i_v(GLenum target, GLuint index, GLint64 *data) {
+	glGetInteger64i_v(target, index, data);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetInteger64i_v);
+	gl_record_value(target);
+	gl_record_value(index);
+}
+inline void APIENTRY gl_recorded_GetBufferParameteri64v(GLenum target, GLenum pname, GLint64 *params) {
+	glGetBufferParameteri64v(target, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetBufferParameteri64v);
+	gl_record_value(target);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_FramebufferTexture(GLenum target, GLenum attachment, GLuint texture, GLint level) {
+	glFramebufferTexture(target, attachment, texture, level);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_FramebufferTexture);
+	gl_record_value(target);
+	gl_record_value(attachment);
+	gl_record_value(texture);
+	gl_record_value(level);
+}
+inline void APIENTRY gl_recorded_TexImage2DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLboolean fixedsamplelocations) {
+	glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexImage2DMultisample);
+	gl_record_value(target);
+	gl_record_value(samples);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(fixedsamplelocations);
+}
+inline void APIENTRY gl_recorded_TexImage3DMultisample(GLenum target, GLsizei samples, GLenum internalformat, GLsizei width, GLsizei height, GLsizei depth, GLboolean fixedsamplelocations) {
+	glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_TexImage3DMultisample);
+	gl_record_value(target);
+	gl_record_value(samples);
+	gl_record_value(internalformat);
+	gl_record_value(width);
+	gl_record_value(height);
+	gl_record_value(depth);
+	gl_record_value(fixedsamplelocations);
+}
+inline void APIENTRY gl_recorded_GetMultisamplefv(GLenum pname, GLuint index, GLfloat *val) {
+	glGetMultisamplefv(pname, index, val);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetMultisamplefv);
+	gl_record_value(pname);
+	gl_record_value(index);
+}
+inline void APIENTRY gl_recorded_SampleMaski(GLuint maskNumber, GLbitfield mask) {
+	glSampleMaski(maskNumber, mask);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_SampleMaski);
+	gl_record_value(maskNumber);
+	gl_record_value(mask);
+}
+inline void APIENTRY gl_recorded_BindFragDataLocationIndexed(GLuint program, GLuint colorNumber, GLuint index, const GLchar *name) {
+	glBindFragDataLocationIndexed(program, colorNumber, index, name);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindFragDataLocationIndexed);
+	gl_record_value(program);
+	gl_record_value(colorNumber);
+	gl_record_value(index);
+	gl_record_string(name);
+}
+inline GLint APIENTRY gl_recorded_GetFragDataIndex(GLuint program, const GLchar *name) {
+	GLint ret = glGetFragDataIndex(program, name);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_GetFragDataIndex);
+	gl_record_value(program);
+	gl_record_string(name);
+	return ret;
+}
+inline void APIENTRY gl_recorded_GenSamplers(GLsizei count, GLuint *samplers) {
+	glGenSamplers(count, samplers);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GenSamplers);
+	gl_record_value(count);
+	gl_record_data(samplers, gl_record_count(count) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_DeleteSamplers(GLsizei count, const GLuint *samplers) {
+	glDeleteSamplers(count, samplers);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_DeleteSamplers);
+	gl_record_value(count);
+	gl_record_data(samplers, gl_record_count(count) * sizeof(GLuint));
+}
+inline GLboolean APIENTRY gl_recorded_IsSampler(GLuint sampler) {
+	GLboolean ret = glIsSampler(sampler);
+	if (!gl_recording) return ret;
+	gl_record_call(GLRecordCall_IsSampler);
+	gl_record_value(sampler);
+	return ret;
+}
+inline void APIENTRY gl_recorded_BindSampler(GLuint unit, GLuint sampler) {
+	glBindSampler(unit, sampler);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_BindSampler);
+	gl_record_value(unit);
+	gl_record_value(sampler);
+}
+inline void APIENTRY gl_recorded_SamplerParameteri(GLuint sampler, GLenum pname, GLint param) {
+	glSamplerParameteri(sampler, pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_SamplerParameteri);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+	gl_record_value(param);
+}
+inline void APIENTRY gl_recorded_SamplerParameteriv(GLuint sampler, GLenum pname, const GLint *param) {
+	glSamplerParameteriv(sampler, pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_SamplerParameteriv);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+	gl_record_data(param, gl_record_count((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_SamplerParameterf(GLuint sampler, GLenum pname, GLfloat param) {
+	glSamplerParameterf(sampler, pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_SamplerParameterf);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+	gl_record_value(param);
+}
+inline void APIENTRY gl_recorded_SamplerParameterfv(GLuint sampler, GLenum pname, const GLfloat *param) {
+	glSamplerParameterfv(sampler, pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_SamplerParameterfv);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+	gl_record_data(param, gl_record_count((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)) * sizeof(GLfloat));
+}
+inline void APIENTRY gl_recorded_SamplerParameterIiv(GLuint sampler, GLenum pname, const GLint *param) {
+	glSamplerParameterIiv(sampler, pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_SamplerParameterIiv);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+	gl_record_data(param, gl_record_count((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)) * sizeof(GLint));
+}
+inline void APIENTRY gl_recorded_SamplerParameterIuiv(GLuint sampler, GLenum pname, const GLuint *param) {
+	glSamplerParameterIuiv(sampler, pname, param);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_SamplerParameterIuiv);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+	gl_record_data(param, gl_record_count((pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_GetSamplerParameteriv(GLuint sampler, GLenum pname, GLint *params) {
+	glGetSamplerParameteriv(sampler, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetSamplerParameteriv);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetSamplerParameterIiv(GLuint sampler, GLenum pname, GLint *params) {
+	glGetSamplerParameterIiv(sampler, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetSamplerParameterIiv);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetSamplerParameterfv(GLuint sampler, GLenum pname, GLfloat *params) {
+	glGetSamplerParameterfv(sampler, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetSamplerParameterfv);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetSamplerParameterIuiv(GLuint sampler, GLenum pname, GLuint *params) {
+	glGetSamplerParameterIuiv(sampler, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetSamplerParameterIuiv);
+	gl_record_value(sampler);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_QueryCounter(GLuint id, GLenum target) {
+	glQueryCounter(id, target);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_QueryCounter);
+	gl_record_value(id);
+	gl_record_value(target);
+}
+inline void APIENTRY gl_recorded_GetQueryObjecti64v(GLuint id, GLenum pname, GLint64 *params) {
+	glGetQueryObjecti64v(id, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetQueryObjecti64v);
+	gl_record_value(id);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_GetQueryObjectui64v(GLuint id, GLenum pname, GLuint64 *params) {
+	glGetQueryObjectui64v(id, pname, params);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_GetQueryObjectui64v);
+	gl_record_value(id);
+	gl_record_value(pname);
+}
+inline void APIENTRY gl_recorded_VertexAttribDivisor(GLuint index, GLuint divisor) {
+	glVertexAttribDivisor(index, divisor);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribDivisor);
+	gl_record_value(index);
+	gl_record_value(divisor);
+}
+inline void APIENTRY gl_recorded_VertexAttribP1ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glVertexAttribP1ui(index, type, normalized, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribP1ui);
+	gl_record_value(index);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_value(value);
+}
+inline void APIENTRY gl_recorded_VertexAttribP1uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glVertexAttribP1uiv(index, type, normalized, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribP1uiv);
+	gl_record_value(index);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_data(value, gl_record_count(1) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttribP2ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glVertexAttribP2ui(index, type, normalized, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribP2ui);
+	gl_record_value(index);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_value(value);
+}
+inline void APIENTRY gl_recorded_VertexAttribP2uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glVertexAttribP2uiv(index, type, normalized, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribP2uiv);
+	gl_record_value(index);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_data(value, gl_record_count(1) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttribP3ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glVertexAttribP3ui(index, type, normalized, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribP3ui);
+	gl_record_value(index);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_value(value);
+}
+inline void APIENTRY gl_recorded_VertexAttribP3uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glVertexAttribP3uiv(index, type, normalized, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribP3uiv);
+	gl_record_value(index);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_data(value, gl_record_count(1) * sizeof(GLuint));
+}
+inline void APIENTRY gl_recorded_VertexAttribP4ui(GLuint index, GLenum type, GLboolean normalized, GLuint value) {
+	glVertexAttribP4ui(index, type, normalized, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribP4ui);
+	gl_record_value(index);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_value(value);
+}
+inline void APIENTRY gl_recorded_VertexAttribP4uiv(GLuint index, GLenum type, GLboolean normalized, const GLuint *value) {
+	glVertexAttribP4uiv(index, type, normalized, value);
+	if (!gl_recording) return;
+	gl_record_call(GLRecordCall_VertexAttribP4uiv);
+	gl_record_value(index);
+	gl_record_value(type);
+	gl_record_value(normalized);
+	gl_record_data(value, gl_record_count(1) * sizeof(GLuint));
+}
+
+//every use of a GL function now goes through its wrapper (except in gl_record.cpp, which needs the real ones):
+#ifndef GL_RECORD_IMPLEMENTATION
+#define glCullFace gl_recorded_CullFace
+#define glFrontFace gl_recorded_FrontFace
+#define glHint gl_recorded_Hint
+#define glLineWidth gl_recorded_LineWidth
+#define glPointSize gl_recorded_PointSize
+#define glPolygonMode gl_recorded_PolygonMode
+#define glScissor gl_recorded_Scissor
+#define glTexParameterf gl_recorded_TexParameterf
+#define glTexParameterfv gl_recorded_TexParameterfv
+#define glTexParameteri gl_recorded_TexParameteri
+#define glTexParameteriv gl_recorded_TexParameteriv
+#define glTexImage1D gl_recorded_TexImage1D
+#define glTexImage2D gl_recorded_TexImage2D
+#define glDrawBuffer gl_recorded_DrawBuffer
+#define glClear gl_recorded_Clear
+#define glClearColor gl_recorded_ClearColor
+#define glClearStencil gl_recorded_ClearStencil
+#define glClearDepth gl_recorded_ClearDepth
+#define glStencilMask gl_recorded_StencilMask
+#define glColorMask gl_recorded_ColorMask
+#define glDepthMask gl_recorded_DepthMask
+#define glDisable gl_recorded_Disable
+#define glEnable gl_recorded_Enable
+#define glFinish gl_recorded_Finish
+#define glFlush gl_recorded_Flush
+#define glBlendFunc gl_recorded_BlendFunc
+#define glLogicOp gl_recorded_LogicOp
+#define glStencilFunc gl_recorded_StencilFunc
+#define glStencilOp gl_recorded_StencilOp
+#define glDepthFunc gl_recorded_DepthFunc
+#define glPixelStoref gl_recorded_PixelStoref
+#define glPixelStorei gl_recorded_PixelStorei
+#define glReadBuffer gl_recorded_ReadBuffer
+#define glReadPixels gl_recorded_ReadPixels
+#define glGetBooleanv gl_recorded_GetBooleanv
+#define glGetDoublev gl_recorded_GetDoublev
+#define glGetError gl_recorded_GetError
+#define glGetFloatv gl_recorded_GetFloatv
+#define glGetIntegerv gl_recorded_GetIntegerv
+#define glGetString gl_recorded_GetString
+#define glGetTexImage gl_recorded_GetTexImage
+#define glGetTexParameterfv gl_recorded_GetTexParameterfv
+#define glGetTexParameteriv gl_recorded_GetTexParameteriv
+#define glGetTexLevelParameterfv gl_recorded_GetTexLevelParameterfv
+#define glGetTexLevelParameteriv gl_recorded_GetTexLevelParameteriv
+#define glIsEnabled gl_recorded_IsEnabled
+#define glDepthRange gl_recorded_DepthRange
+#define glViewport gl_recorded_Viewport
+#define glDrawArrays gl_recorded_DrawArrays
+#define glDrawElements gl_recorded_DrawElements
+#define glGetPointerv gl_recorded_GetPointerv
+#define glPolygonOffset gl_recorded_PolygonOffset
+#define glCopyTexImage1D gl_recorded_CopyTexImage1D
+#define glCopyTexImage2D gl_recorded_CopyTexImage2D
+#define glCopyTexSubImage1D gl_recorded_CopyTexSubImage1D
+#define glCopyTexSubImage2D gl_recorded_CopyTexSubImage2D
+#define glTexSubImage1D gl_recorded_TexSubImage1D
+#define glTexSubImage2D gl_recorded_TexSubImage2D
+#define glBindTexture gl_recorded_BindTexture
+#define glDeleteTextures gl_recorded_DeleteTextures
+#define glGenTextures gl_recorded_GenTextures
+#define glIsTexture gl_recorded_IsTexture
+#define glDrawRangeElements gl_recorded_DrawRangeElements
+#define glTexImage3D gl_recorded_TexImage3D
+#define glTexSubImage3D gl_recorded_TexSubImage3D
+#define glCopyTexSubImage3D gl_recorded_CopyTexSubImage3D
+#define glActiveTexture gl_recorded_ActiveTexture
+#define glSampleCoverage gl_recorded_SampleCoverage
+#define glCompressedTexImage3D gl_recorded_CompressedTexImage3D
+#define glCompressedTexImage2D gl_recorded_CompressedTexImage2D
+#define glCompressedTexImage1D gl_recorded_CompressedTexImage1D
+#define glCompressedTexSubImage3D gl_recorded_CompressedTexSubImage3D
+#define glCompressedTexSubImage2D gl_recorded_CompressedTexSubImage2D
+#define glCompressedTexSubImage1D gl_recorded_CompressedTexSubImage1D
+#define glGetCompressedTexImage gl_recorded_GetCompressedTexImage
+#define glBlendFuncSeparate gl_recorded_BlendFuncSeparate
+#define glMultiDrawArrays gl_recorded_MultiDrawArrays
+#define glMultiDrawElements gl_recorded_MultiDrawElements
+#define glPointParameterf gl_recorded_PointParameterf
+#define glPointParameterfv gl_recorded_PointParameterfv
+#define glPointParameteri gl_recorded_PointParameteri
+#define glPointParameteriv gl_recorded_PointParameteriv
+#define glBlendColor gl_recorded_BlendColor
+#define glBlendEquation gl_recorded_BlendEquation
+#define glGenQueries gl_recorded_GenQueries
+#define glDeleteQueries gl_recorded_DeleteQueries
+#define glIsQuery gl_recorded_IsQuery
+#define glBeginQuery gl_recorded_BeginQuery
+#define glEndQuery gl_recorded_EndQuery
+#define glGetQueryiv gl_recorded_GetQueryiv
+#define glGetQueryObjectiv gl_recorded_GetQueryObjectiv
+#define glGetQueryObjectuiv gl_recorded_GetQueryObjectuiv
+#define glBindBuffer gl_recorded_BindBuffer
+#define glDeleteBuffers gl_recorded_DeleteBuffers
+#define glGenBuffers gl_recorded_GenBuffers
+#define glIsBuffer gl_recorded_IsBuffer
+#define glBufferData gl_recorded_BufferData
+#define glBufferSubData gl_recorded_BufferSubData
+#define glGetBufferSubData gl_recorded_GetBufferSubData
+#define glMapBuffer gl_recorded_MapBuffer
+#define glUnmapBuffer gl_recorded_UnmapBuffer
+#define glGetBufferParameteriv gl_recorded_GetBufferParameteriv
+#define glGetBufferPointerv gl_recorded_GetBufferPointerv
+#define glBlendEquationSeparate gl_recorded_BlendEquationSeparate
+#define glDrawBuffers gl_recorded_DrawBuffers
+#define glStencilOpSeparate gl_recorded_StencilOpSeparate
+#define glStencilFuncSeparate gl_recorded_StencilFuncSeparate
+#define glStencilMaskSeparate gl_recorded_StencilMaskSeparate
+#define glAttachShader gl_recorded_AttachShader
+#define glBindAttribLocation gl_recorded_BindAttribLocation
+#define glCompileShader gl_recorded_CompileShader
+#define glCreateProgram gl_recorded_CreateProgram
+#define glCreateShader gl_recorded_CreateShader
+#define glDeleteProgram gl_recorded_DeleteProgram
+#define glDeleteShader gl_recorded_DeleteShader
+#define glDetachShader gl_recorded_DetachShader
+#define glDisableVertexAttribArray gl_recorded_DisableVertexAttribArray
+#define glEnableVertexAttribArray gl_recorded_EnableVertexAttribArray
+#define glGetActiveAttrib gl_recorded_GetActiveAttrib
+#define glGetActiveUniform gl_recorded_GetActiveUniform
+#define glGetAttachedShaders gl_recorded_GetAttachedShaders
+#define glGetAttribLocation gl_recorded_GetAttribLocation
+#define glGetProgramiv gl_recorded_GetProgramiv
+#define glGetProgramInfoLog gl_recorded_GetProgramInfoLog
+#define glGetShaderiv gl_recorded_GetShaderiv
+#define glGetShaderInfoLog gl_recorded_GetShaderInfoLog
+#define glGetShaderSource gl_recorded_GetShaderSource
+#define glGetUniformLocation gl_recorded_GetUniformLocation
+#define glGetUniformfv gl_recorded_GetUniformfv
+#define glGetUniformiv gl_recorded_GetUniformiv
+#define glGetVertexAttribdv gl_recorded_GetVertexAttribdv
+#define glGetVertexAttribfv gl_recorded_GetVertexAttribfv
+#define glGetVertexAttribiv gl_recorded_GetVertexAttribiv
+#define glGetVertexAttribPointerv gl_recorded_GetVertexAttribPointerv
+#define glIsProgram gl_recorded_IsProgram
+#define glIsShader gl_recorded_IsShader
+#define glLinkProgram gl_recorded_LinkProgram
+#define glShaderSource gl_recorded_ShaderSource
+#define glUseProgram gl_recorded_UseProgram
+#define glUniform1f gl_recorded_Uniform1f
+#define glUniform2f gl_recorded_Uniform2f
+#define glUniform3f gl_recorded_Uniform3f
+#define glUniform4f gl_recorded_Uniform4f
+#define glUniform1i gl_recorded_Uniform1i
+#define glUniform2i gl_recorded_Uniform2i
+#define glUniform3i gl_recorded_Uniform3i
+#define glUniform4i gl_recorded_Uniform4i
+#define glUniform1fv gl_recorded_Uniform1fv
+#define glUniform2fv gl_recorded_Uniform2fv
+#define glUniform3fv gl_recorded_Uniform3fv
+#define glUniform4fv gl_recorded_Uniform4fv
+#define glUniform1iv gl_recorded_Uniform1iv
+#define glUniform2iv gl_recorded_Uniform2iv
+#define glUniform3iv gl_recorded_Uniform3iv
+#define glUniform4iv gl_recorded_Uniform4iv
+#define glUniformMatrix2fv gl_recorded_UniformMatrix2fv
+#define glUniformMatrix3fv gl_recorded_UniformMatrix3fv
+#define glUniformMatrix4fv gl_recorded_UniformMatrix4fv
+#define glValidateProgram gl_recorded_ValidateProgram
+#define glVertexAttrib1d gl_recorded_VertexAttrib1d
+#define glVertexAttrib1dv gl_recorded_VertexAttrib1dv
+#define glVertexAttrib1f gl_recorded_VertexAttrib1f
+#define glVertexAttrib1fv gl_recorded_VertexAttrib1fv
+#define glVertexAttrib1s gl_recorded_VertexAttrib1s
+#define glVertexAttrib1sv gl_recorded_VertexAttrib1sv
+#define glVertexAttrib2d gl_recorded_VertexAttrib2d
+#define glVertexAttrib2dv gl_recorded_VertexAttrib2dv
+#define glVertexAttrib2f gl_recorded_VertexAttrib2f
+#define glVertexAttrib2fv gl_recorded_VertexAttrib2fv
+#define glVertexAttrib2s gl_recorded_VertexAttrib2s
+#define glVertexAttrib2sv gl_recorded_VertexAttrib2sv
+#define glVertexAttrib3d gl_recorded_VertexAttrib3d
+#define glVertexAttrib3dv gl_recorded_VertexAttrib3dv
+#define glVertexAttrib3f gl_recorded_VertexAttrib3f
+#define glVertexAttrib3fv gl_recorded_VertexAttrib3fv
+#define glVertexAttrib3s gl_recorded_VertexAttrib3s
+#define glVertexAttrib3sv gl_recorded_VertexAttrib3sv
+#define glVertexAttrib4Nbv gl_recorded_VertexAttrib4Nbv
+#define glVertexAttrib4Niv gl_recorded_VertexAttrib4Niv
+#define glVertexAttrib4Nsv gl_recorded_VertexAttrib4Nsv
+#define glVertexAttrib4Nub gl_recorded_VertexAttrib4Nub
+#define glVertexAttrib4Nubv gl_recorded_VertexAttrib4Nubv
+#define glVertexAttrib4Nuiv gl_recorded_VertexAttrib4Nuiv
+#define glVertexAttrib4Nusv gl_recorded_VertexAttrib4Nusv
+#define glVertexAttrib4bv gl_recorded_VertexAttrib4bv
+#define glVertexAttrib4d gl_recorded_VertexAttrib4d
+#define glVertexAttrib4dv gl_recorded_VertexAttrib4dv
+#define glVertexAttrib4f gl_recorded_VertexAttrib4f
+#define glVertexAttrib4fv gl_recorded_VertexAttrib4fv
+#define glVertexAttrib4iv gl_recorded_VertexAttrib4iv
+#define glVertexAttrib4s gl_recorded_VertexAttrib4s
+#define glVertexAttrib4sv gl_recorded_VertexAttrib4sv
+#define glVertexAttrib4ubv gl_recorded_VertexAttrib4ubv
+#define glVertexAttrib4uiv gl_recorded_VertexAttrib4uiv
+#define glVertexAttrib4usv gl_recorded_VertexAttrib4usv
+#define glVertexAttribPointer gl_recorded_VertexAttribPointer
+#define glUniformMatrix2x3fv gl_recorded_UniformMatrix2x3fv
+#define glUniformMatrix3x2fv gl_recorded_UniformMatrix3x2fv
+#define glUniformMatrix2x4fv gl_recorded_UniformMatrix2x4fv
+#define glUniformMatrix4x2fv gl_recorded_UniformMatrix4x2fv
+#define glUniformMatrix3x4fv gl_recorded_UniformMatrix3x4fv
+#define glUniformMatrix4x3fv gl_recorded_UniformMatrix4x3fv
+#define glColorMaski gl_recorded_ColorMaski
+#define glGetBooleani_v gl_recorded_GetBooleani_v
+#define glGetIntegeri_v gl_recorded_GetIntegeri_v
+#define glEnablei gl_recorded_Enablei
+#define glDisablei gl_recorded_Disablei
+#define glIsEnabledi gl_recorded_IsEnabledi
+#define glBeginTransformFeedback gl_recorded_BeginTransformFeedback
+#define glEndTransformFeedback gl_recorded_EndTransformFeedback
+#define glBindBufferRange gl_recorded_BindBufferRange
+#define glBindBufferBase gl_recorded_BindBufferBase
+#define glTransformFeedbackVaryings gl_recorded_TransformFeedbackVaryings
+#define glGetTransformFeedbackVarying gl_recorded_GetTransformFeedbackVarying
+#define glClampColor gl_recorded_ClampColor
+#define glBeginConditionalRender gl_recorded_BeginConditionalRender
+#define glEndConditionalRender gl_recorded_EndConditionalRender
+#define glVertexAttribIPointer gl_recorded_VertexAttribIPointer
+#define glGetVertexAttribIiv gl_recorded_GetVertexAttribIiv
+#define glGetVertexAttribIuiv gl_recorded_GetVertexAttribIuiv
+#define glVertexAttribI1i gl_recorded_VertexAttribI1i
+#define glVertexAttribI2i gl_recorded_VertexAttribI2i
+#define glVertexAttribI3i gl_recorded_VertexAttribI3i
+#define glVertexAttribI4i gl_recorded_VertexAttribI4i
+#define glVertexAttribI1ui gl_recorded_VertexAttribI1ui
+#define glVertexAttribI2ui gl_recorded_VertexAttribI2ui
+#define glVertexAttribI3ui gl_recorded_VertexAttribI3ui
+#define glVertexAttribI4ui gl_recorded_VertexAttribI4ui
+#define glVertexAttribI1iv gl_recorded_VertexAttribI1iv
+#define glVertexAttribI2iv gl_recorded_VertexAttribI2iv
+#define glVertexAttribI3iv gl_recorded_VertexAttribI3iv
+#define glVertexAttribI4iv gl_recorded_VertexAttribI4iv
+#define glVertexAttribI1uiv gl_recorded_VertexAttribI1uiv
+#define glVertexAttribI2uiv gl_recorded_VertexAttribI2uiv
+#define glVertexAttribI3uiv gl_recorded_VertexAttribI3uiv
+#define glVertexAttribI4uiv gl_recorded_VertexAttribI4uiv
+#define glVertexAttribI4bv gl_recorded_VertexAttribI4bv
+#define glVertexAttribI4sv gl_recorded_VertexAttribI4sv
+#define glVertexAttribI4ubv gl_recorded_VertexAttribI4ubv
+#define glVertexAttribI4usv gl_recorded_VertexAttribI4usv
+#define glGetUniformuiv gl_recorded_GetUniformuiv
+#define glBindFragDataLocation gl_recorded_BindFragDataLocation
+#define glGetFragDataLocation gl_recorded_GetFragDataLocation
+#define glUniform1ui gl_recorded_Uniform1ui
+#define glUniform2ui gl_recorded_Uniform2ui
+#define glUniform3ui gl_recorded_Uniform3ui
+#define glUniform4ui gl_recorded_Uniform4ui
+#define glUniform1uiv gl_recorded_Uniform1uiv
+#define glUniform2uiv gl_recorded_Uniform2uiv
+#define glUniform3uiv gl_recorded_Uniform3uiv
+#define glUniform4uiv gl_recorded_Uniform4uiv
+#define glTexParameterIiv gl_recorded_TexParameterIiv
+#define glTexParameterIuiv gl_recorded_TexParameterIuiv
+#define glGetTexParameterIiv gl_recorded_GetTexParameterIiv
+#define glGetTexParameterIuiv gl_recorded_GetTexParameterIuiv
+#define glClearBufferiv gl_recorded_ClearBufferiv
+#define glClearBufferuiv gl_recorded_ClearBufferuiv
+#define glClearBufferfv gl_recorded_ClearBufferfv
+#define glClearBufferfi gl_recorded_ClearBufferfi
+#define glGetStringi gl_recorded_GetStringi
+#define glIsRenderbuffer gl_recorded_IsRenderbuffer
+#define glBindRenderbuffer gl_recorded_BindRenderbuffer
+#define glDeleteRenderbuffers gl_recorded_DeleteRenderbuffers
+#define glGenRenderbuffers gl_recorded_GenRenderbuffers
+#define glRenderbufferStorage gl_recorded_RenderbufferStorage
+#define glGetRenderbufferParameteriv gl_recorded_GetRenderbufferParameteriv
+#define glIsFramebuffer gl_recorded_IsFramebuffer
+#define glBindFramebuffer gl_recorded_BindFramebuffer
+#define glDeleteFramebuffers gl_recorded_DeleteFramebuffers
+#define glGenFramebuffers gl_recorded_GenFramebuffers
+#define glCheckFramebufferStatus gl_recorded_CheckFramebufferStatus
+#define glFramebufferTexture1D gl_recorded_FramebufferTexture1D
+#define glFramebufferTexture2D gl_recorded_FramebufferTexture2D
+#define glFramebufferTexture3D gl_recorded_FramebufferTexture3D
+#define glFramebufferRenderbuffer gl_recorded_FramebufferRenderbuffer
+#define glGetFramebufferAttachmentParameteriv gl_recorded_GetFramebufferAttachmentParameteriv
+#define glGenerateMipmap gl_recorded_GenerateMipmap
+#define glBlitFramebuffer gl_recorded_BlitFramebuffer
+#define glRenderbufferStorageMultisample gl_recorded_RenderbufferStorageMultisample
+#define glFramebufferTextureLayer gl_recorded_FramebufferTextureLayer
+#define glMapBufferRange gl_recorded_MapBufferRange
+#define glFlushMappedBufferRange gl_recorded_FlushMappedBufferRange
+#define glBindVertexArray gl_recorded_BindVertexArray
+#define glDeleteVertexArrays gl_recorded_DeleteVertexArrays
+#define glGenVertexArrays gl_recorded_GenVertexArrays
+#define glIsVertexArray gl_recorded_IsVertexArray
+#define glDrawArraysInstanced gl_recorded_DrawArraysInstanced
+#define glDrawElementsInstanced gl_recorded_DrawElementsInstanced
+#define glTexBuffer gl_recorded_TexBuffer
+#define glPrimitiveRestartIndex gl_recorded_PrimitiveRestartIndex
+#define glCopyBufferSubData gl_recorded_CopyBufferSubData
+#define glGetUniformIndices gl_recorded_GetUniformIndices
+#define glGetActiveUniformsiv gl_recorded_GetActiveUniformsiv
+#define glGetActiveUniformName gl_recorded_GetActiveUniformName
+#define glGetUniformBlockIndex gl_recorded_GetUniformBlockIndex
+#define glGetActiveUniformBlockiv gl_recorded_GetActiveUniformBlockiv
+#define glGetActiveUniformBlockName gl_recorded_GetActiveUniformBlockName
+#define glUniformBlockBinding gl_recorded_UniformBlockBinding
+#define glDrawElementsBaseVertex gl_recorded_DrawElementsBaseVertex
+#define glDrawRangeElementsBaseVertex gl_recorded_DrawRangeElementsBaseVertex
+#define glDrawElementsInstancedBaseVertex gl_recorded_DrawElementsInstancedBaseVertex
+#define glMultiDrawElementsBaseVertex gl_recorded_MultiDrawElementsBaseVertex
+#define glProvokingVertex gl_recorded_ProvokingVertex
+#define glFenceSync gl_recorded_FenceSync
+#define glIsSync gl_recorded_IsSync
+#define glDeleteSync gl_recorded_DeleteSync
+#define glClientWaitSync gl_recorded_ClientWaitSync
+#define glWaitSync gl_recorded_WaitSync
+#define glGetInteger64v gl_recorded_GetInteger64v
+#define glGetSynciv gl_recorded_GetSynciv
+#define glGetInteger64i_v gl_recorded_GetInteger64i_v
+#define glGetBufferParameteri64v gl_recorded_GetBufferParameteri64v
+#define glFramebufferTexture gl_recorded_FramebufferTexture
+#define glTexImage2DMultisample gl_recorded_TexImage2DMultisample
+#define glTexImage3DMultisample gl_recorded_TexImage3DMultisample
+#define glGetMultisamplefv gl_recorded_GetMultisamplefv
+#define glSampleMaski gl_recorded_SampleMaski
+#define glBindFragDataLocationIndexed gl_recorded_BindFragDataLocationIndexed
+#define glGetFragDataIndex gl_recorded_GetFragDataIndex
+#define glGenSamplers gl_recorded_GenSamplers
+#define glDeleteSamplers gl_recorded_DeleteSamplers
+#define glIsSampler gl_recorded_IsSampler
+#define glBindSampler gl_recorded_BindSampler
+#define glSamplerParameteri gl_recorded_SamplerParameteri
+#define glSamplerParameteriv gl_recorded_SamplerParameteriv
+#define glSamplerParameterf gl_recorded_SamplerParameterf
+#define glSamplerParameterfv gl_recorded_SamplerParameterfv
+#define glSamplerParameterIiv gl_recorded_SamplerParameterIiv
+#define glSamplerParameterIuiv gl_recorded_SamplerParameterIuiv
+#define glGetSamplerParameteriv gl_recorded_GetSamplerParameteriv
+#define glGetSamplerParameterIiv gl_recorded_GetSamplerParameterIiv
+#define glGetSamplerParameterfv gl_recorded_GetSamplerParameterfv
+#define glGetSamplerParameterIuiv gl_recorded_GetSamplerParameterIuiv
+#define glQueryCounter gl_recorded_QueryCounter
+#define glGetQueryObjecti64v gl_recorded_GetQueryObjecti64v
+#define glGetQueryObjectui64v gl_recorded_GetQueryObjectui64v
+#define glVertexAttribDivisor gl_recorded_VertexAttribDivisor
+#define glVertexAttribP1ui gl_recorded_VertexAttribP1ui
+#define glVertexAttribP1uiv gl_recorded_VertexAttribP1uiv
+#define glVertexAttribP2ui gl_recorded_VertexAttribP2ui
+#define glVertexAttribP2uiv gl_recorded_VertexAttribP2uiv
+#define glVertexAttribP3ui gl_recorded_VertexAttribP3ui
+#define glVertexAttribP3uiv gl_recorded_VertexAttribP3uiv
+#define glVertexAttribP4ui gl_recorded_VertexAttribP4ui
+#define glVertexAttribP4uiv gl_recorded_VertexAttribP4uiv
+#endif
+
+#ifdef GL_RECORD_IMPLEMENTATION
+char const *const GLRecordCallNames[GLRecordCallCount] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+};
+#endif //GL_RECORD_IMPLEMENTATION
@@ -0,0 +1,352 @@
+//gl_replay re-issues an OpenGL call stream recorded by a GL_RECORD build (see gl_record.hpp) on a
+// window-less context, and times every frame -- a repeatable GPU benchmark of a real session that
+// needs neither the game's state nor its assets.
+// usage: gl_replay <recording> [repeats]
+//The first frame includes everything set up before it (loading meshes, compiling shaders, ...),
+// so it is reported separately. With repeats, the frames after it are replayed that many times.
+
+//(the replayer's own calls are never recorded, even in a GL_RECORD build)
+#undef GL_RECORD
+
+#include "headless_context.hpp" //window-less OpenGL context
+#include "gl_record.hpp" //recording format
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+
+#include "GL.hpp"
+
+#include <algorithm>
+#include <chrono>
+#include <cstring>
+#include <fstream>
+#include <iostream>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//reads parameters from a recording, and maps recorded names (etc.) to the ones made while replaying:
+struct GLReplay {
+	GLReplay(std::vector< uint8_t > const &recording) : at(recording.data()), end(recording.data() + recording.size()) { }
+
+	uint8_t const *at;
+	uint8_t const *end;
+
+	void need(size_t bytes) {
+		if (size_t(end - at) < bytes) throw std::runtime_error("Recording ends in the middle of a call.");
+	}
+
+	template< typename T >
+	T value() {
+		need(sizeof(T));
+		T ret;
+		std::memcpy(&ret, at, sizeof(T));
+		at += sizeof(T);
+		return ret;
+	}
+
+	//data parameters point into the recording itself:
+	void const *data() {
+		uint8_t kind = value< uint8_t >();
+		if (kind == GLRecordNull) return nullptr;
+		if (kind != GLRecordBytes) throw std::runtime_error("Expected data in recording.");
+		uint64_t size = value< uint64_t >();
+		need(size);
+		void const *ret = at;
+		at += size;
+		return ret;
+	}
+	GLchar const *string() {
+		return reinterpret_cast< GLchar const * >(data());
+	}
+	std::vector< GLchar const * > strings_;
+	GLchar const *const *strings() {
+		strings_.resize(value< uint32_t >());
+		for (auto &str : strings_) str = string();
+		return strings_.data();
+	}
+	std::vector< void const * > offsets_;
+	void const *const *offsets() {
+		uint8_t const *recorded = reinterpret_cast< uint8_t const * >(data());
+		if (!recorded) return nullptr;
+		offsets_.resize((at - recorded) / sizeof(uint64_t));
+		for (size_t i = 0; i < offsets_.size(); ++i) {
+			uint64_t offset;
+			std::memcpy(&offset, recorded + i * sizeof(uint64_t), sizeof(uint64_t));
+			offsets_[i] = reinterpret_cast< void const * >(uintptr_t(offset));
+		}
+		return offsets_.data();
+	}
+	void const *pixels() {
+		need(1);
+		if (*at == GLRecordOffset) {
+			++at;
+			return reinterpret_cast< void const * >(uintptr_t(value< uint64_t >()));
+		}
+		return data();
+	}
+	void *pixels_out(size_t size) {
+		uint8_t kind = value< uint8_t >();
+		if (kind == GLRecordOffset) return reinterpret_cast< void * >(uintptr_t(value< uint64_t >()));
+		return scratch(size);
+	}
+
+	//somewhere for GL to write results nobody reads (fresh memory for each output of a call):
+	std::vector< std::vector< uint8_t > > scratches;
+	uint32_t scratch_used = 0;
+	void *scratch(size_t size) {
+		if (scratch_used == scratches.size()) scratches.emplace_back();
+		std::vector< uint8_t > &s = scratches[scratch_used++];
+		s.resize(std::max(s.size(), std::max(size, size_t(4096))));
+		return s.data();
+	}
+	size_t count(GLsizei n) { return n > 0 ? size_t(n) : 0; }
+
+	//object names:
+	enum Namespace : uint32_t { Program, Shader, Buffer, VertexArray, Framebuffer, Renderbuffer, Texture, Sampler, Query, NamespaceCount };
+	std::unordered_map< GLuint, GLuint > names_[NamespaceCount];
+	GLuint default_framebuffer = 0; //(the recording's window; here, a framebuffer object)
+	GLuint name(Namespace ns, GLuint recorded) {
+		if (recorded == 0) return (ns == Framebuffer ? default_framebuffer : 0);
+		auto f = names_[ns].find(recorded);
+		return (f != names_[ns].end() ? f->second : recorded);
+	}
+	void bind_name(Namespace ns, GLuint recorded, GLuint replayed) {
+		names_[ns][recorded] = replayed;
+	}
+	std::vector< GLuint > mapped_names;
+	GLuint const *names(Namespace ns) {
+		uint8_t const *recorded = reinterpret_cast< uint8_t const * >(data());
+		if (!recorded) return nullptr;
+		mapped_names.resize((at - recorded) / sizeof(GLuint));
+		for (size_t i = 0; i < mapped_names.size(); ++i) {
+			GLuint n;
+			std::memcpy(&n, recorded + i * sizeof(GLuint), sizeof(GLuint));
+			mapped_names[i] = name(ns, n);
+		}
+		return mapped_names.data();
+	}
+	void bind_names(Namespace ns, GLsizei n, GLuint const *recorded, GLuint const *replayed) {
+		if (!recorded) return;
+		for (GLsizei i = 0; i < n; ++i) {
+			GLuint r;
+			std::memcpy(&r, reinterpret_cast< uint8_t const * >(recorded) + i * sizeof(GLuint), sizeof(GLuint));
+			bind_name(ns, r, replayed[i]);
+		}
+	}
+
+	//uniform locations (per program) and attribute indices:
+	GLuint current_program = 0; //(as recorded)
+	std::map< std::pair< GLuint, GLint >, GLint > locations;
+	GLint location(GLint recorded) {
+		auto f = locations.find(std::make_pair(current_program, recorded));
+		return (f != locations.end() ? f->second : recorded);
+	}
+	void bind_location(GLuint program, GLint recorded, GLint replayed) {
+		locations[std::make_pair(program, recorded)] = replayed;
+	}
+	//(attribute indices are assumed to mean the same thing in every program -- true of this game's programs)
+	std::unordered_map< GLint, GLint > attribs;
+	GLuint attrib(GLuint recorded) {
+		auto f = attribs.find(GLint(recorded));
+		return GLuint(f != attribs.end() ? f->second : GLint(recorded));
+	}
+	void bind_attrib(GLint recorded, GLint replayed) {
+		if (recorded >= 0) attribs[recorded] = replayed;
+	}
+
+	std::unordered_map< uint64_t, GLsync > syncs;
+	GLsync sync(uint64_t recorded) {
+		auto f = syncs.find(recorded);
+		return (f != syncs.end() ? f->second : nullptr);
+	}
+	void bind_sync(uint64_t recorded, GLsync replayed) {
+		syncs[recorded] = replayed;
+	}
+
+	//mapped buffers, by target:
+	std::unordered_map< GLenum, uint8_t * > maps;
+	void mapped(GLenum target, void *pointer) {
+		maps[target] = reinterpret_cast< uint8_t * >(pointer);
+	}
+	void mapped_data() {
+		GLenum target = value< GLenum >();
+		uint64_t offset = value< uint64_t >();
+		uint8_t const *recorded = reinterpret_cast< uint8_t const * >(data());
+		auto f = maps.find(target);
+		if (recorded && f != maps.end() && f->second) {
+			std::memcpy(f->second + offset, recorded, at - recorded);
+		}
+	}
+
+	std::vector< uint32_t > skipped; //calls that weren't recorded, by id
+	void unsupported(uint16_t call) {
+		if (skipped.size() <= call) skipped.resize(call + 1, 0);
+		skipped[call] += 1;
+	}
+	void unknown(uint16_t call) {
+		throw std::runtime_error("Unknown call " + std::to_string(call) + " in recording.");
+	}
+};
+
+#include "gl_replay_calls.hpp"
+
+int main(int argc, char **argv) {
+	if (argc != 2 && argc != 3) {
+		std::cerr << "Usage:\n\t" << argv[0] << " <recording> [repeats]\n"
+			"Replays OpenGL calls recorded with 'main --record' and reports how long each frame took." << std::endl;
+		return 1;
+	}
+	std::string path = argv[1];
+	uint32_t repeats = (argc == 3 ? uint32_t(std::stoul(argv[2])) : 1);
+
+	try {
+		std::vector< uint8_t > recording;
+		{
+			std::ifstream in(path, std::ios::binary);
+			if (!in) throw std::runtime_error("Failed to open '" + path + "'.");
+			recording.assign(std::istreambuf_iterator< char >(in), std::istreambuf_iterator< char >());
+		}
+
+		GLReplay replay(recording);
+
+		//------------ header ------------
+
+		char magic[sizeof(GLRecordMagic)];
+		replay.need(sizeof(magic));
+		std::memcpy(magic, replay.at, sizeof(magic));
+		replay.at += sizeof(magic);
+		if (std::memcmp(magic, GLRecordMagic, sizeof(magic)) != 0) throw std::runtime_error("'" + path + "' isn't an OpenGL recording.");
+		uint32_t version = replay.value< uint32_t >();
+		if (version != GLRecordVersion) throw std::runtime_error("'" + path + "' is recording version " + std::to_string(version) + ", but this is version " + std::to_string(GLRecordVersion) + ".");
+		glm::uvec2 size;
+		size.x = replay.value< uint32_t >();
+		size.y = replay.value< uint32_t >();
+
+		//the recording names its calls, so it can be replayed even if the call table has changed since:
+		std::unordered_map< std::string, uint16_t > ids;
+		for (uint16_t i = 0; i < sizeof(GLReplayCallNames) / sizeof(GLReplayCallNames[0]); ++i) {
+			ids[GLReplayCallNames[i]] = i;
+		}
+		std::vector< uint16_t > to_id(replay.value< uint32_t >());
+		std::vector< std::string > recorded_names(to_id.size());
+		for (uint32_t i = 0; i < to_id.size(); ++i) {
+			uint8_t length = replay.value< uint8_t >();
+			replay.need(length);
+			recorded_names[i] = std::string(reinterpret_cast< char const * >(replay.at), length);
+			replay.at += length;
+			auto f = ids.find(recorded_names[i]);
+			if (f == ids.end()) throw std::runtime_error("Recording uses " + recorded_names[i] + ", which this replayer doesn't know.");
+			to_id[i] = f->second;
+		}
+
+		//------------ context ------------
+
+		HeadlessContext headless;
+		std::cout << "Replaying '" << path << "' (" << size.x << "x" << size.y << ") with " << glGetString(GL_RENDERER) << " (" << glGetString(GL_VERSION) << ")" << std::endl;
+
+		//framebuffer standing in for the recording's window:
+		GLuint color_rb = 0, depth_rb = 0, fb = 0;
+		glGenRenderbuffers(1, &color_rb);
+		glBindRenderbuffer(GL_RENDERBUFFER, color_rb);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, size.x, size.y);
+		glGenRenderbuffers(1, &depth_rb);
+		glBindRenderbuffer(GL_RENDERBUFFER, depth_rb);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, size.x, size.y);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		glGenFramebuffers(1, &fb);
+		glBindFramebuffer(GL_FRAMEBUFFER, fb);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color_rb);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth_rb);
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+			throw std::runtime_error("Framebuffer for replay is incomplete.");
+		}
+		glViewport(0, 0, size.x, size.y);
+		replay.default_framebuffer = fb;
+		GL_ERRORS();
+
+		//------------ replay ------------
+
+		typedef std::chrono::steady_clock Clock;
+		struct Frame {
+			float submit_ms = 0.0f; //issuing the frame's calls
+			float finish_ms = 0.0f; //issuing them, then waiting (glFinish) until the GPU is done with them
+			uint32_t calls = 0;
+		};
+		std::vector< Frame > frames;
+
+		//replay calls until the end of a frame (returns false at the end of the recording):
+		auto replay_frame = [&]() -> bool {
+			if (replay.at == replay.end) return false;
+			Frame frame;
+			Clock::time_point start = Clock::now();
+			while (true) {
+				uint16_t call = replay.value< uint16_t >();
+				if (call == GLRecordFrameEnd) break;
+				if (call == GLRecordMappedData) {
+					replay.mapped_data();
+					continue;
+				}
+				if (call >= to_id.size()) replay.unknown(call);
+				replay.scratch_used = 0;
+				gl_replay_call(replay, to_id[call]);
+				++frame.calls;
+				if (replay.at == replay.end) break; //(recording stopped mid-frame)
+			}
+			Clock::time_point submitted = Clock::now();
+			glFinish();
+			Clock::time_point finished = Clock::now();
+			frame.submit_ms = std::chrono::duration< float, std::milli >(submitted - start).count();
+			frame.finish_ms = std::chrono::duration< float, std::milli >(finished - start).count();
+			frames.emplace_back(frame);
+			GL_ERRORS();
+			return true;
+		};
+
+		if (!replay_frame()) throw std::runtime_error("Recording has no frames.");
+		Frame first = frames[0];
+		frames.clear();
+
+		uint8_t const *second = replay.at;
+		for (uint32_t r = 0; r < repeats; ++r) {
+			//(objects a frame creates are created again on every repeat; they just replace the earlier ones' mappings)
+			replay.at = second;
+			while (replay_frame()) { }
+		}
+
+		//------------ report ------------
+
+		std::cout << "First frame (with setup): " << first.calls << " calls, " << first.submit_ms << " ms to submit, " << first.finish_ms << " ms to finish." << std::endl;
+		if (!frames.empty()) {
+			uint64_t calls = 0;
+			for (Frame const &frame : frames) calls += frame.calls;
+			auto report = [&frames](char const *what, float Frame::*ms) {
+				std::vector< float > sorted;
+				for (Frame const &frame : frames) sorted.emplace_back(frame.*ms);
+				std::sort(sorted.begin(), sorted.end());
+				auto percentile = [&sorted](float p) {
+					return sorted[std::min(sorted.size() - 1, size_t(p / 100.0f * sorted.size()))];
+				};
+				std::cout << "  " << what << " ms: p50 " << percentile(50.0f) << ", p95 " << percentile(95.0f) << ", max " << sorted.back() << std::endl;
+			};
+			std::cout << "Replayed " << frames.size() << " more frames (" << (calls / frames.size()) << " calls per frame):" << std::endl;
+			report("submit", &Frame::submit_ms);
+			report("finish", &Frame::finish_ms);
+		}
+		for (uint32_t i = 0; i < replay.skipped.size(); ++i) {
+			if (replay.skipped[i]) {
+				std::cerr << "WARNING: skipped " << replay.skipped[i] << " calls to " << GLReplayCallNames[i] << " (they couldn't be recorded)." << std::endl;
+			}
+		}
+
+		glDeleteFramebuffers(1, &fb);
+		glDeleteRenderbuffers(1, &color_rb);
+		glDeleteRenderbuffers(1, &depth_rb);
+	} catch (std::exception &e) {
+		std::cerr << "Unhandled exception:\n" << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
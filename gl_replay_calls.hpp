@@ -0,0 +1,2908 @@
+#pragma once
+//NOTE: generated by 'make-gl-shims.py --replay'; don't edit by hand.
+
+//gl_replay_calls.hpp reads back calls written by gl_record_calls.hpp's wrappers and re-issues them.
+//It must be included after the GLReplay type (see gl_replay.cpp) that reads parameters from the
+// recording and maps recorded object names, uniform locations, and syncs to the ones created while replaying.
+
+#include <cstdint>
+
+//names of the calls, by id (a recording lists the names it was made with, so they can be checked):
+static char const *const GLReplayCallNames[] = {
+	"glCullFace",
+	"glFrontFace",
+	"glHint",
+	"glLineWidth",
+	"glPointSize",
+	"glPolygonMode",
+	"glScissor",
+	"glTexParameterf",
+	"glTexParameterfv",
+	"glTexParameteri",
+	"glTexParameteriv",
+	"glTexImage1D",
+	"glTexImage2D",
+	"glDrawBuffer",
+	"glClear",
+	"glClearColor",
+	"glClearStencil",
+	"glClearDepth",
+	"glStencilMask",
+	"glColorMask",
+	"glDepthMask",
+	"glDisable",
+	"glEnable",
+	"glFinish",
+	"glFlush",
+	"glBlendFunc",
+	"glLogicOp",
+	"glStencilFunc",
+	"glStencilOp",
+	"glDepthFunc",
+	"glPixelStoref",
+	"glPixelStorei",
+	"glReadBuffer",
+	"glReadPixels",
+	"glGetBooleanv",
+	"glGetDoublev",
+	"glGetError",
+	"glGetFloatv",
+	"glGetIntegerv",
+	"glGetString",
+	"glGetTexImage",
+	"glGetTexParameterfv",
+	"glGetTexParameteriv",
+	"glGetTexLevelParameterfv",
+	"glGetTexLevelParameteriv",
+	"glIsEnabled",
+	"glDepthRange",
+	"glViewport",
+	"glDrawArrays",
+	"glDrawElements",
+	"glGetPointerv",
+	"glPolygonOffset",
+	"glCopyTexImage1D",
+	"glCopyTexImage2D",
+	"glCopyTexSubImage1D",
+	"glCopyTexSubImage2D",
+	"glTexSubImage1D",
+	"glTexSubImage2D",
+	"glBindTexture",
+	"glDeleteTextures",
+	"glGenTextures",
+	"glIsTexture",
+	"glDrawRangeElements",
+	"glTexImage3D",
+	"glTexSubImage3D",
+	"glCopyTexSubImage3D",
+	"glActiveTexture",
+	"glSampleCoverage",
+	"glCompressedTexImage3D",
+	"glCompressedTexImage2D",
+	"glCompressedTexImage1D",
+	"glCompressedTexSubImage3D",
+	"glCompressedTexSubImage2D",
+	"glCompressedTexSubImage1D",
+	"glGetCompressedTexImage",
+	"glBlendFuncSeparate",
+	"glMultiDrawArrays",
+	"glMultiDrawElements",
+	"glPointParameterf",
+	"glPointParameterfv",
+	"glPointParameteri",
+	"glPointParameteriv",
+	"glBlendColor",
+	"glBlendEquation",
+	"glGenQueries",
+	"glDeleteQueries",
+	"glIsQuery",
+	"glBeginQuery",
+	"glEndQuery",
+	"glGetQueryiv",
+	"glGetQueryObjectiv",
+	"glGetQueryObjectuiv",
+	"glBindBuffer",
+	"glDeleteBuffers",
+	"glGenBuffers",
+	"glIsBuffer",
+	"glBufferData",
+	"glBufferSubData",
+	"glGetBufferSubData",
+	"glMapBuffer",
+	"glUnmapBuffer",
+	"glGetBufferParameteriv",
+	"glGetBufferPointerv",
+	"glBlendEquationSeparate",
+	"glDrawBuffers",
+	"glStencilOpSeparate",
+	"glStencilFuncSeparate",
+	"glStencilMaskSeparate",
+	"glAttachShader",
+	"glBindAttribLocation",
+	"glCompileShader",
+	"glCreateProgram",
+	"glCreateShader",
+	"glDeleteProgram",
+	"glDeleteShader",
+	"glDetachShader",
+	"glDisableVertexAttribArray",
+	"glEnableVertexAttribArray",
+	"glGetActiveAttrib",
+	"glGetActiveUniform",
+	"glGetAttachedShaders",
+	"glGetAttribLocation",
+	"glGetProgramiv",
+	"glGetProgramInfoLog",
+	"glGetShaderiv",
+	"glGetShaderInfoLog",
+	"glGetShaderSource",
+	"glGetUniformLocation",
+	"glGetUniformfv",
+	"glGetUniformiv",
+	"glGetVertexAttribdv",
+	"glGetVertexAttribfv",
+	"glGetVertexAttribiv",
+	"glGetVertexAttribPointerv",
+	"glIsProgram",
+	"glIsShader",
+	"glLinkProgram",
+	"glShaderSource",
+	"glUseProgram",
+	"glUniform1f",
+	"glUniform2f",
+	"glUniform3f",
+	"glUniform4f",
+	"glUniform1i",
+	"glUniform2i",
+	"glUniform3i",
+	"glUniform4i",
+	"glUniform1fv",
+	"glUniform2fv",
+	"glUniform3fv",
+	"glUniform4fv",
+	"glUniform1iv",
+	"glUniform2iv",
+	"glUniform3iv",
+	"glUniform4iv",
+	"glUniformMatrix2fv",
+	"glUniformMatrix3fv",
+	"glUniformMatrix4fv",
+	"glValidateProgram",
+	"glVertexAttrib1d",
+	"glVertexAttrib1dv",
+	"glVertexAttrib1f",
+	"glVertexAttrib1fv",
+	"glVertexAttrib1s",
+	"glVertexAttrib1sv",
+	"glVertexAttrib2d",
+	"glVertexAttrib2dv",
+	"glVertexAttrib2f",
+	"glVertexAttrib2fv",
+	"glVertexAttrib2s",
+	"glVertexAttrib2sv",
+	"glVertexAttrib3d",
+	"glVertexAttrib3dv",
+	"glVertexAttrib3f",
+	"glVertexAttrib3fv",
+	"glVertexAttrib3s",
+	"glVertexAttrib3sv",
+	"glVertexAttrib4Nbv",
+	"glVertexAttrib4Niv",
+	"glVertexAttrib4Nsv",
+	"glVertexAttrib4Nub",
+	"glVertexAttrib4Nubv",
+	"glVertexAttrib4Nuiv",
+	"glVertexAttrib4Nusv",
+	"glVertexAttrib4bv",
+	"glVertexAttrib4d",
+	"glVertexAttrib4dv",
+	"glVertexAttrib4f",
+	"glVertexAttrib4fv",
+	"glVertexAttrib4iv",
+	"glVertexAttrib4s",
+	"glVertexAttrib4sv",
+	"glVertexAttrib4ubv",
+	"glVertexAttrib4uiv",
+	"glVertexAttrib4usv",
+	"glVertexAttribPointer",
+	"glUniformMatrix2x3fv",
+	"glUniformMatrix3x2fv",
+	"glUniformMatrix2x4fv",
+	"glUniformMatrix4x2fv",
+	"glUniformMatrix3x4fv",
+	"glUniformMatrix4x3fv",
+	"glColorMaski",
+	"glGetBooleani_v",
+	"glGetIntegeri_v",
+	"glEnablei",
+	"glDisablei",
+	"glIsEnabledi",
+	"glBeginTransformFeedback",
+	"glEndTransformFeedback",
+	"glBindBufferRange",
+	"glBindBufferBase",
+	"glTransformFeedbackVaryings",
+	"glGetTransformFeedbackVarying",
+	"glClampColor",
+	"glBeginConditionalRender",
+	"glEndConditionalRender",
+	"glVertexAttribIPointer",
+	"glGetVertexAttribIiv",
+	"glGetVertexAttribIuiv",
+	"glVertexAttribI1i",
+	"glVertexAttribI2i",
+	"glVertexAttribI3i",
+	"glVertexAttribI4i",
+	"glVertexAttribI1ui",
+	"glVertexAttribI2ui",
+	"glVertexAttribI3ui",
+	"glVertexAttribI4ui",
+	"glVertexAttribI1iv",
+	"glVertexAttribI2iv",
+	"glVertexAttribI3iv",
+	"glVertexAttribI4iv",
+	"glVertexAttribI1uiv",
+	"glVertexAttribI2uiv",
+	"glVertexAttribI3uiv",
+	"glVertexAttribI4uiv",
+	"glVertexAttribI4bv",
+	"glVertexAttribI4sv",
+	"glVertexAttribI4ubv",
+	"glVertexAttribI4usv",
+	"glGetUniformuiv",
+	"glBindFragDataLocation",
+	"glGetFragDataLocation",
+	"glUniform1ui",
+	"glUniform2ui",
+	"glUniform3ui",
+	"glUniform4ui",
+	"glUniform1uiv",
+	"glUniform2uiv",
+	"glUniform3uiv",
+	"glUniform4uiv",
+	"glTexParameterIiv",
+	"glTexParameterIuiv",
+	"glGetTexParameterIiv",
+	"glGetTexParameterIuiv",
+	"glClearBufferiv",
+	"glClearBufferuiv",
+	"glClearBufferfv",
+	"glClearBufferfi",
+	"glGetStringi",
+	"glIsRenderbuffer",
+	"glBindRenderbuffer",
+	"glDeleteRenderbuffers",
+	"glGenRenderbuffers",
+	"glRenderbufferStorage",
+	"glGetRenderbufferParameteriv",
+	"glIsFramebuffer",
+	"glBindFramebuffer",
+	"glDeleteFramebuffers",
+	"glGenFramebuffers",
+	"glCheckFramebufferStatus",
+	"glFramebufferTexture1D",
+	"glFramebufferTexture2D",
+	"glFramebufferTexture3D",
+	"glFramebufferRenderbuffer",
+	"glGetFramebufferAttachmentParameteriv",
+	"glGenerateMipmap",
+	"glBlitFramebuffer",
+	"glRenderbufferStorageMultisample",
+	"glFramebufferTextureLayer",
+	"glMapBufferRange",
+	"glFlushMappedBufferRange",
+	"glBindVertexArray",
+	"glDeleteVertexArrays",
+	"glGenVertexArrays",
+	"glIsVertexArray",
+	"glDrawArraysInstanced",
+	"glDrawElementsInstanced",
+	"glTexBuffer",
+	"glPrimitiveRestartIndex",
+	"glCopyBufferSubData",
+	"glGetUniformIndices",
+	"glGetActiveUniformsiv",
+	"glGetActiveUniformName",
+	"glGetUniformBlockIndex",
+	"glGetActiveUniformBlockiv",
+	"glGetActiveUniformBlockName",
+	"glUniformBlockBinding",
+	"glDrawElementsBaseVertex",
+	"glDrawRangeElementsBaseVertex",
+	"glDrawElementsInstancedBaseVertex",
+	"glMultiDrawElementsBaseVertex",
+	"glProvokingVertex",
+	"glFenceSync",
+	"glIsSync",
+	"glDeleteSync",
+	"glClientWaitSync",
+	"glWaitSync",
+	"glGetInteger64v",
+	"glGetSynciv",
+	"glGetInteger64i_v",
+	"glGetBufferParameteri64v",
+	"glFramebufferTexture",
+	"glTexImage2DMultisample",
+	"glTexImage3DMultisample",
+	"glGetMultisamplefv",
+	"glSampleMaski",
+	"glBindFragDataLocationIndexed",
+	"glGetFragDataIndex",
+	"glGenSamplers",
+	"glDeleteSamplers",
+	"glIsSampler",
+	"glBindSampler",
+	"glSamplerParameteri",
+	"glSamplerParameteriv",
+	"glSamplerParameterf",
+	"glSamplerParameterfv",
+	"glSamplerParameterIiv",
+	"glSamplerParameterIuiv",
+	"glGetSamplerParameteriv",
+	"glGetSamplerParameterIiv",
+	"glGetSamplerParameterfv",
+	"glGetSamplerParameterIuiv",
+	"glQueryCounter",
+	"glGetQueryObjecti64v",
+	"glGetQueryObjectui64v",
+	"glVertexAttribDivisor",
+	"glVertexAttribP1ui",
+	"glVertexAttribP1uiv",
+	"glVertexAttribP2ui",
+	"glVertexAttribP2uiv",
+	"glVertexAttribP3ui",
+	"glVertexAttribP3uiv",
+	"glVertexAttribP4ui",
+	"glVertexAttribP4uiv",
+};
+
+//read the parameters of 'call' and issue it:
+inline void gl_replay_call(GLReplay &replay, uint16_t call) {
+	switch (call) {
+	case 0: { //glCullFace
+		GLenum mode = replay.value< GLenum >();
+		glCullFace(mode);
+		break;
+	}
+	case 1: { //glFrontFace
+		GLenum mode = replay.value< GLenum >();
+		glFrontFace(mode);
+		break;
+	}
+	case 2: { //glHint
+		GLenum target = replay.value< GLenum >();
+		GLenum mode = replay.value< GLenum >();
+		glHint(target, mode);
+		break;
+	}
+	case 3: { //glLineWidth
+		GLfloat width = replay.value< GLfloat >();
+		glLineWidth(width);
+		break;
+	}
+	case 4: { //glPointSize
+		GLfloat size = replay.value< GLfloat >();
+		glPointSize(size);
+		break;
+	}
+	case 5: { //glPolygonMode
+		GLenum face = replay.value< GLenum >();
+		GLenum mode = replay.value< GLenum >();
+		glPolygonMode(face, mode);
+		break;
+	}
+	case 6: { //glScissor
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		glScissor(x, y, width, height);
+		break;
+	}
+	case 7: { //glTexParameterf
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLfloat param = replay.value< GLfloat >();
+		glTexParameterf(target, pname, param);
+		break;
+	}
+	case 8: { //glTexParameterfv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		const GLfloat *params = (const GLfloat *)replay.data();
+		glTexParameterfv(target, pname, params);
+		break;
+	}
+	case 9: { //glTexParameteri
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLint param = replay.value< GLint >();
+		glTexParameteri(target, pname, param);
+		break;
+	}
+	case 10: { //glTexParameteriv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		const GLint *params = (const GLint *)replay.data();
+		glTexParameteriv(target, pname, params);
+		break;
+	}
+	case 11: { //glTexImage1D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint internalformat = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLint border = replay.value< GLint >();
+		GLenum format = replay.value< GLenum >();
+		GLenum type = replay.value< GLenum >();
+		const void *pixels = replay.pixels();
+		glTexImage1D(target, level, internalformat, width, border, format, type, pixels);
+		break;
+	}
+	case 12: { //glTexImage2D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint internalformat = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLint border = replay.value< GLint >();
+		GLenum format = replay.value< GLenum >();
+		GLenum type = replay.value< GLenum >();
+		const void *pixels = replay.pixels();
+		glTexImage2D(target, level, internalformat, width, height, border, format, type, pixels);
+		break;
+	}
+	case 13: { //glDrawBuffer
+		GLenum buf = replay.value< GLenum >();
+		glDrawBuffer(buf);
+		break;
+	}
+	case 14: { //glClear
+		GLbitfield mask = replay.value< GLbitfield >();
+		glClear(mask);
+		break;
+	}
+	case 15: { //glClearColor
+		GLfloat red = replay.value< GLfloat >();
+		GLfloat green = replay.value< GLfloat >();
+		GLfloat blue = replay.value< GLfloat >();
+		GLfloat alpha = replay.value< GLfloat >();
+		glClearColor(red, green, blue, alpha);
+		break;
+	}
+	case 16: { //glClearStencil
+		GLint s = replay.value< GLint >();
+		glClearStencil(s);
+		break;
+	}
+	case 17: { //glClearDepth
+		GLdouble depth = replay.value< GLdouble >();
+		glClearDepth(depth);
+		break;
+	}
+	case 18: { //glStencilMask
+		GLuint mask = replay.value< GLuint >();
+		glStencilMask(mask);
+		break;
+	}
+	case 19: { //glColorMask
+		GLboolean red = replay.value< GLboolean >();
+		GLboolean green = replay.value< GLboolean >();
+		GLboolean blue = replay.value< GLboolean >();
+		GLboolean alpha = replay.value< GLboolean >();
+		glColorMask(red, green, blue, alpha);
+		break;
+	}
+	case 20: { //glDepthMask
+		GLboolean flag = replay.value< GLboolean >();
+		glDepthMask(flag);
+		break;
+	}
+	case 21: { //glDisable
+		GLenum cap = replay.value< GLenum >();
+		glDisable(cap);
+		break;
+	}
+	case 22: { //glEnable
+		GLenum cap = replay.value< GLenum >();
+		glEnable(cap);
+		break;
+	}
+	case 23: { //glFinish
+		glFinish();
+		break;
+	}
+	case 24: { //glFlush
+		glFlush();
+		break;
+	}
+	case 25: { //glBlendFunc
+		GLenum sfactor = replay.value< GLenum >();
+		GLenum dfactor = replay.value< GLenum >();
+		glBlendFunc(sfactor, dfactor);
+		break;
+	}
+	case 26: { //glLogicOp
+		GLenum opcode = replay.value< GLenum >();
+		glLogicOp(opcode);
+		break;
+	}
+	case 27: { //glStencilFunc
+		GLenum func = replay.value< GLenum >();
+		GLint ref = replay.value< GLint >();
+		GLuint mask = replay.value< GLuint >();
+		glStencilFunc(func, ref, mask);
+		break;
+	}
+	case 28: { //glStencilOp
+		GLenum fail = replay.value< GLenum >();
+		GLenum zfail = replay.value< GLenum >();
+		GLenum zpass = replay.value< GLenum >();
+		glStencilOp(fail, zfail, zpass);
+		break;
+	}
+	case 29: { //glDepthFunc
+		GLenum func = replay.value< GLenum >();
+		glDepthFunc(func);
+		break;
+	}
+	case 30: { //glPixelStoref
+		GLenum pname = replay.value< GLenum >();
+		GLfloat param = replay.value< GLfloat >();
+		glPixelStoref(pname, param);
+		break;
+	}
+	case 31: { //glPixelStorei
+		GLenum pname = replay.value< GLenum >();
+		GLint param = replay.value< GLint >();
+		glPixelStorei(pname, param);
+		break;
+	}
+	case 32: { //glReadBuffer
+		GLenum src = replay.value< GLenum >();
+		glReadBuffer(src);
+		break;
+	}
+	case 33: { //glReadPixels
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLenum format = replay.value< GLenum >();
+		GLenum type = replay.value< GLenum >();
+		void *pixels = replay.pixels_out(gl_pixels_size(width, height, 1, format, type));
+		glReadPixels(x, y, width, height, format, type, pixels);
+		break;
+	}
+	case 34: { //glGetBooleanv
+		GLenum pname = replay.value< GLenum >();
+		GLboolean *data = (GLboolean *)replay.scratch(0);
+		glGetBooleanv(pname, data);
+		break;
+	}
+	case 35: { //glGetDoublev
+		GLenum pname = replay.value< GLenum >();
+		GLdouble *data = (GLdouble *)replay.scratch(0);
+		glGetDoublev(pname, data);
+		break;
+	}
+	case 36: { //glGetError
+		glGetError();
+		break;
+	}
+	case 37: { //glGetFloatv
+		GLenum pname = replay.value< GLenum >();
+		GLfloat *data = (GLfloat *)replay.scratch(0);
+		glGetFloatv(pname, data);
+		break;
+	}
+	case 38: { //glGetIntegerv
+		GLenum pname = replay.value< GLenum >();
+		GLint *data = (GLint *)replay.scratch(0);
+		glGetIntegerv(pname, data);
+		break;
+	}
+	case 39: { //glGetString
+		GLenum name = replay.value< GLenum >();
+		glGetString(name);
+		break;
+	}
+	case 40: { //glGetTexImage
+		replay.unsupported(call);
+		break;
+	}
+	case 41: { //glGetTexParameterfv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLfloat *params = (GLfloat *)replay.scratch(0);
+		glGetTexParameterfv(target, pname, params);
+		break;
+	}
+	case 42: { //glGetTexParameteriv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetTexParameteriv(target, pname, params);
+		break;
+	}
+	case 43: { //glGetTexLevelParameterfv
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLenum pname = replay.value< GLenum >();
+		GLfloat *params = (GLfloat *)replay.scratch(0);
+		glGetTexLevelParameterfv(target, level, pname, params);
+		break;
+	}
+	case 44: { //glGetTexLevelParameteriv
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetTexLevelParameteriv(target, level, pname, params);
+		break;
+	}
+	case 45: { //glIsEnabled
+		GLenum cap = replay.value< GLenum >();
+		glIsEnabled(cap);
+		break;
+	}
+	case 46: { //glDepthRange
+		GLdouble near = replay.value< GLdouble >();
+		GLdouble far = replay.value< GLdouble >();
+		glDepthRange(near, far);
+		break;
+	}
+	case 47: { //glViewport
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		glViewport(x, y, width, height);
+		break;
+	}
+	case 48: { //glDrawArrays
+		GLenum mode = replay.value< GLenum >();
+		GLint first = replay.value< GLint >();
+		GLsizei count = replay.value< GLsizei >();
+		glDrawArrays(mode, first, count);
+		break;
+	}
+	case 49: { //glDrawElements
+		GLenum mode = replay.value< GLenum >();
+		GLsizei count = replay.value< GLsizei >();
+		GLenum type = replay.value< GLenum >();
+		const void *indices = (const void *)uintptr_t(replay.value< uint64_t >());
+		glDrawElements(mode, count, type, indices);
+		break;
+	}
+	case 50: { //glGetPointerv
+		GLenum pname = replay.value< GLenum >();
+		void **params = (void **)replay.scratch(0);
+		glGetPointerv(pname, params);
+		break;
+	}
+	case 51: { //glPolygonOffset
+		GLfloat factor = replay.value< GLfloat >();
+		GLfloat units = replay.value< GLfloat >();
+		glPolygonOffset(factor, units);
+		break;
+	}
+	case 52: { //glCopyTexImage1D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLint border = replay.value< GLint >();
+		glCopyTexImage1D(target, level, internalformat, x, y, width, border);
+		break;
+	}
+	case 53: { //glCopyTexImage2D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLint border = replay.value< GLint >();
+		glCopyTexImage2D(target, level, internalformat, x, y, width, height, border);
+		break;
+	}
+	case 54: { //glCopyTexSubImage1D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		glCopyTexSubImage1D(target, level, xoffset, x, y, width);
+		break;
+	}
+	case 55: { //glCopyTexSubImage2D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLint yoffset = replay.value< GLint >();
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		glCopyTexSubImage2D(target, level, xoffset, yoffset, x, y, width, height);
+		break;
+	}
+	case 56: { //glTexSubImage1D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLenum format = replay.value< GLenum >();
+		GLenum type = replay.value< GLenum >();
+		const void *pixels = replay.pixels();
+		glTexSubImage1D(target, level, xoffset, width, format, type, pixels);
+		break;
+	}
+	case 57: { //glTexSubImage2D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLint yoffset = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLenum format = replay.value< GLenum >();
+		GLenum type = replay.value< GLenum >();
+		const void *pixels = replay.pixels();
+		glTexSubImage2D(target, level, xoffset, yoffset, width, height, format, type, pixels);
+		break;
+	}
+	case 58: { //glBindTexture
+		GLenum target = replay.value< GLenum >();
+		GLuint texture_recorded = replay.value< GLuint >();
+		GLuint texture = replay.name(GLReplay::Texture, texture_recorded);
+		glBindTexture(target, texture);
+		break;
+	}
+	case 59: { //glDeleteTextures
+		GLsizei n = replay.value< GLsizei >();
+		const GLuint *textures = replay.names(GLReplay::Texture);
+		glDeleteTextures(n, textures);
+		break;
+	}
+	case 60: { //glGenTextures
+		GLsizei n = replay.value< GLsizei >();
+		GLuint const *textures_recorded = (GLuint const *)replay.data();
+		GLuint *textures = (GLuint *)replay.scratch(replay.count(n) * sizeof(GLuint));
+		glGenTextures(n, textures);
+		replay.bind_names(GLReplay::Texture, n, textures_recorded, textures);
+		break;
+	}
+	case 61: { //glIsTexture
+		GLuint texture_recorded = replay.value< GLuint >();
+		GLuint texture = replay.name(GLReplay::Texture, texture_recorded);
+		glIsTexture(texture);
+		break;
+	}
+	case 62: { //glDrawRangeElements
+		GLenum mode = replay.value< GLenum >();
+		GLuint start = replay.value< GLuint >();
+		GLuint end = replay.value< GLuint >();
+		GLsizei count = replay.value< GLsizei >();
+		GLenum type = replay.value< GLenum >();
+		const void *indices = (const void *)uintptr_t(replay.value< uint64_t >());
+		glDrawRangeElements(mode, start, end, count, type, indices);
+		break;
+	}
+	case 63: { //glTexImage3D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint internalformat = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLsizei depth = replay.value< GLsizei >();
+		GLint border = replay.value< GLint >();
+		GLenum format = replay.value< GLenum >();
+		GLenum type = replay.value< GLenum >();
+		const void *pixels = replay.pixels();
+		glTexImage3D(target, level, internalformat, width, height, depth, border, format, type, pixels);
+		break;
+	}
+	case 64: { //glTexSubImage3D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLint yoffset = replay.value< GLint >();
+		GLint zoffset = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLsizei depth = replay.value< GLsizei >();
+		GLenum format = replay.value< GLenum >();
+		GLenum type = replay.value< GLenum >();
+		const void *pixels = replay.pixels();
+		glTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, type, pixels);
+		break;
+	}
+	case 65: { //glCopyTexSubImage3D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLint yoffset = replay.value< GLint >();
+		GLint zoffset = replay.value< GLint >();
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		glCopyTexSubImage3D(target, level, xoffset, yoffset, zoffset, x, y, width, height);
+		break;
+	}
+	case 66: { //glActiveTexture
+		GLenum texture = replay.value< GLenum >();
+		glActiveTexture(texture);
+		break;
+	}
+	case 67: { //glSampleCoverage
+		GLfloat value = replay.value< GLfloat >();
+		GLboolean invert = replay.value< GLboolean >();
+		glSampleCoverage(value, invert);
+		break;
+	}
+	case 68: { //glCompressedTexImage3D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLsizei depth = replay.value< GLsizei >();
+		GLint border = replay.value< GLint >();
+		GLsizei imageSize = replay.value< GLsizei >();
+		const void *data = replay.pixels();
+		glCompressedTexImage3D(target, level, internalformat, width, height, depth, border, imageSize, data);
+		break;
+	}
+	case 69: { //glCompressedTexImage2D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLint border = replay.value< GLint >();
+		GLsizei imageSize = replay.value< GLsizei >();
+		const void *data = replay.pixels();
+		glCompressedTexImage2D(target, level, internalformat, width, height, border, imageSize, data);
+		break;
+	}
+	case 70: { //glCompressedTexImage1D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLsizei width = replay.value< GLsizei >();
+		GLint border = replay.value< GLint >();
+		GLsizei imageSize = replay.value< GLsizei >();
+		const void *data = replay.pixels();
+		glCompressedTexImage1D(target, level, internalformat, width, border, imageSize, data);
+		break;
+	}
+	case 71: { //glCompressedTexSubImage3D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLint yoffset = replay.value< GLint >();
+		GLint zoffset = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLsizei depth = replay.value< GLsizei >();
+		GLenum format = replay.value< GLenum >();
+		GLsizei imageSize = replay.value< GLsizei >();
+		const void *data = replay.pixels();
+		glCompressedTexSubImage3D(target, level, xoffset, yoffset, zoffset, width, height, depth, format, imageSize, data);
+		break;
+	}
+	case 72: { //glCompressedTexSubImage2D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLint yoffset = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLenum format = replay.value< GLenum >();
+		GLsizei imageSize = replay.value< GLsizei >();
+		const void *data = replay.pixels();
+		glCompressedTexSubImage2D(target, level, xoffset, yoffset, width, height, format, imageSize, data);
+		break;
+	}
+	case 73: { //glCompressedTexSubImage1D
+		GLenum target = replay.value< GLenum >();
+		GLint level = replay.value< GLint >();
+		GLint xoffset = replay.value< GLint >();
+		GLsizei width = replay.value< GLsizei >();
+		GLenum format = replay.value< GLenum >();
+		GLsizei imageSize = replay.value< GLsizei >();
+		const void *data = replay.pixels();
+		glCompressedTexSubImage1D(target, level, xoffset, width, format, imageSize, data);
+		break;
+	}
+	case 74: { //glGetCompressedTexImage
+		replay.unsupported(call);
+		break;
+	}
+	case 75: { //glBlendFuncSeparate
+		GLenum sfactorRGB = replay.value< GLenum >();
+		GLenum dfactorRGB = replay.value< GLenum >();
+		GLenum sfactorAlpha = replay.value< GLenum >();
+		GLenum dfactorAlpha = replay.value< GLenum >();
+		glBlendFuncSeparate(sfactorRGB, dfactorRGB, sfactorAlpha, dfactorAlpha);
+		break;
+	}
+	case 76: { //glMultiDrawArrays
+		GLenum mode = replay.value< GLenum >();
+		const GLint *first = (const GLint *)replay.data();
+		const GLsizei *count = (const GLsizei *)replay.data();
+		GLsizei drawcount = replay.value< GLsizei >();
+		glMultiDrawArrays(mode, first, count, drawcount);
+		break;
+	}
+	case 77: { //glMultiDrawElements
+		GLenum mode = replay.value< GLenum >();
+		const GLsizei *count = (const GLsizei *)replay.data();
+		GLenum type = replay.value< GLenum >();
+		const void *const*indices = replay.offsets();
+		GLsizei drawcount = replay.value< GLsizei >();
+		glMultiDrawElements(mode, count, type, indices, drawcount);
+		break;
+	}
+	case 78: { //glPointParameterf
+		GLenum pname = replay.value< GLenum >();
+		GLfloat param = replay.value< GLfloat >();
+		glPointParameterf(pname, param);
+		break;
+	}
+	case 79: { //glPointParameterfv
+		GLenum pname = replay.value< GLenum >();
+		const GLfloat *params = (const GLfloat *)replay.data();
+		glPointParameterfv(pname, params);
+		break;
+	}
+	case 80: { //glPointParameteri
+		GLenum pname = replay.value< GLenum >();
+		GLint param = replay.value< GLint >();
+		glPointParameteri(pname, param);
+		break;
+	}
+	case 81: { //glPointParameteriv
+		GLenum pname = replay.value< GLenum >();
+		const GLint *params = (const GLint *)replay.data();
+		glPointParameteriv(pname, params);
+		break;
+	}
+	case 82: { //glBlendColor
+		GLfloat red = replay.value< GLfloat >();
+		GLfloat green = replay.value< GLfloat >();
+		GLfloat blue = replay.value< GLfloat >();
+		GLfloat alpha = replay.value< GLfloat >();
+		glBlendColor(red, green, blue, alpha);
+		break;
+	}
+	case 83: { //glBlendEquation
+		GLenum mode = replay.value< GLenum >();
+		glBlendEquation(mode);
+		break;
+	}
+	case 84: { //glGenQueries
+		GLsizei n = replay.value< GLsizei >();
+		GLuint const *ids_recorded = (GLuint const *)replay.data();
+		GLuint *ids = (GLuint *)replay.scratch(replay.count(n) * sizeof(GLuint));
+		glGenQueries(n, ids);
+		replay.bind_names(GLReplay::Query, n, ids_recorded, ids);
+		break;
+	}
+	case 85: { //glDeleteQueries
+		GLsizei n = replay.value< GLsizei >();
+		const GLuint *ids = replay.names(GLReplay::Query);
+		glDeleteQueries(n, ids);
+		break;
+	}
+	case 86: { //glIsQuery
+		GLuint id_recorded = replay.value< GLuint >();
+		GLuint id = replay.name(GLReplay::Query, id_recorded);
+		glIsQuery(id);
+		break;
+	}
+	case 87: { //glBeginQuery
+		GLenum target = replay.value< GLenum >();
+		GLuint id_recorded = replay.value< GLuint >();
+		GLuint id = replay.name(GLReplay::Query, id_recorded);
+		glBeginQuery(target, id);
+		break;
+	}
+	case 88: { //glEndQuery
+		GLenum target = replay.value< GLenum >();
+		glEndQuery(target);
+		break;
+	}
+	case 89: { //glGetQueryiv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetQueryiv(target, pname, params);
+		break;
+	}
+	case 90: { //glGetQueryObjectiv
+		GLuint id_recorded = replay.value< GLuint >();
+		GLuint id = replay.name(GLReplay::Query, id_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetQueryObjectiv(id, pname, params);
+		break;
+	}
+	case 91: { //glGetQueryObjectuiv
+		GLuint id_recorded = replay.value< GLuint >();
+		GLuint id = replay.name(GLReplay::Query, id_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLuint *params = (GLuint *)replay.scratch(0);
+		glGetQueryObjectuiv(id, pname, params);
+		break;
+	}
+	case 92: { //glBindBuffer
+		GLenum target = replay.value< GLenum >();
+		GLuint buffer_recorded = replay.value< GLuint >();
+		GLuint buffer = replay.name(GLReplay::Buffer, buffer_recorded);
+		glBindBuffer(target, buffer);
+		break;
+	}
+	case 93: { //glDeleteBuffers
+		GLsizei n = replay.value< GLsizei >();
+		const GLuint *buffers = replay.names(GLReplay::Buffer);
+		glDeleteBuffers(n, buffers);
+		break;
+	}
+	case 94: { //glGenBuffers
+		GLsizei n = replay.value< GLsizei >();
+		GLuint const *buffers_recorded = (GLuint const *)replay.data();
+		GLuint *buffers = (GLuint *)replay.scratch(replay.count(n) * sizeof(GLuint));
+		glGenBuffers(n, buffers);
+		replay.bind_names(GLReplay::Buffer, n, buffers_recorded, buffers);
+		break;
+	}
+	case 95: { //glIsBuffer
+		GLuint buffer_recorded = replay.value< GLuint >();
+		GLuint buffer = replay.name(GLReplay::Buffer, buffer_recorded);
+		glIsBuffer(buffer);
+		break;
+	}
+	case 96: { //glBufferData
+		GLenum target = replay.value< GLenum >();
+		GLsizeiptr size = GLsizeiptr(replay.value< int64_t >());
+		const void *data = (const void *)replay.data();
+		GLenum usage = replay.value< GLenum >();
+		glBufferData(target, size, data, usage);
+		break;
+	}
+	case 97: { //glBufferSubData
+		GLenum target = replay.value< GLenum >();
+		GLintptr offset = GLintptr(replay.value< int64_t >());
+		GLsizeiptr size = GLsizeiptr(replay.value< int64_t >());
+		const void *data = (const void *)replay.data();
+		glBufferSubData(target, offset, size, data);
+		break;
+	}
+	case 98: { //glGetBufferSubData
+		GLenum target = replay.value< GLenum >();
+		GLintptr offset = GLintptr(replay.value< int64_t >());
+		GLsizeiptr size = GLsizeiptr(replay.value< int64_t >());
+		void *data = (void *)replay.scratch(size);
+		glGetBufferSubData(target, offset, size, data);
+		break;
+	}
+	case 99: { //glMapBuffer
+		GLenum target = replay.value< GLenum >();
+		GLenum access = replay.value< GLenum >();
+		void * ret = glMapBuffer(target, access);
+		replay.mapped(target, ret);
+		break;
+	}
+	case 100: { //glUnmapBuffer
+		GLenum target = replay.value< GLenum >();
+		glUnmapBuffer(target);
+		replay.mapped(target, nullptr);
+		break;
+	}
+	case 101: { //glGetBufferParameteriv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetBufferParameteriv(target, pname, params);
+		break;
+	}
+	case 102: { //glGetBufferPointerv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		void **params = (void **)replay.scratch(0);
+		glGetBufferPointerv(target, pname, params);
+		break;
+	}
+	case 103: { //glBlendEquationSeparate
+		GLenum modeRGB = replay.value< GLenum >();
+		GLenum modeAlpha = replay.value< GLenum >();
+		glBlendEquationSeparate(modeRGB, modeAlpha);
+		break;
+	}
+	case 104: { //glDrawBuffers
+		GLsizei n = replay.value< GLsizei >();
+		const GLenum *bufs = (const GLenum *)replay.data();
+		glDrawBuffers(n, bufs);
+		break;
+	}
+	case 105: { //glStencilOpSeparate
+		GLenum face = replay.value< GLenum >();
+		GLenum sfail = replay.value< GLenum >();
+		GLenum dpfail = replay.value< GLenum >();
+		GLenum dppass = replay.value< GLenum >();
+		glStencilOpSeparate(face, sfail, dpfail, dppass);
+		break;
+	}
+	case 106: { //glStencilFuncSeparate
+		GLenum face = replay.value< GLenum >();
+		GLenum func = replay.value< GLenum >();
+		GLint ref = replay.value< GLint >();
+		GLuint mask = replay.value< GLuint >();
+		glStencilFuncSeparate(face, func, ref, mask);
+		break;
+	}
+	case 107: { //glStencilMaskSeparate
+		GLenum face = replay.value< GLenum >();
+		GLuint mask = replay.value< GLuint >();
+		glStencilMaskSeparate(face, mask);
+		break;
+	}
+	case 108: { //glAttachShader
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		glAttachShader(program, shader);
+		break;
+	}
+	case 109: { //glBindAttribLocation
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint index = replay.value< GLuint >();
+		const GLchar *name = replay.string();
+		glBindAttribLocation(program, index, name);
+		break;
+	}
+	case 110: { //glCompileShader
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		glCompileShader(shader);
+		break;
+	}
+	case 111: { //glCreateProgram
+		GLuint ret = glCreateProgram();
+		replay.bind_name(GLReplay::Program, replay.value< GLuint >(), ret);
+		break;
+	}
+	case 112: { //glCreateShader
+		GLenum type = replay.value< GLenum >();
+		GLuint ret = glCreateShader(type);
+		replay.bind_name(GLReplay::Shader, replay.value< GLuint >(), ret);
+		break;
+	}
+	case 113: { //glDeleteProgram
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		glDeleteProgram(program);
+		break;
+	}
+	case 114: { //glDeleteShader
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		glDeleteShader(shader);
+		break;
+	}
+	case 115: { //glDetachShader
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		glDetachShader(program, shader);
+		break;
+	}
+	case 116: { //glDisableVertexAttribArray
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		glDisableVertexAttribArray(index);
+		break;
+	}
+	case 117: { //glEnableVertexAttribArray
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		glEnableVertexAttribArray(index);
+		break;
+	}
+	case 118: { //glGetActiveAttrib
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint index = replay.value< GLuint >();
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLint *size = (GLint *)replay.scratch(0);
+		GLenum *type = (GLenum *)replay.scratch(0);
+		GLchar *name = (GLchar *)replay.scratch(0);
+		glGetActiveAttrib(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 119: { //glGetActiveUniform
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint index = replay.value< GLuint >();
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLint *size = (GLint *)replay.scratch(0);
+		GLenum *type = (GLenum *)replay.scratch(0);
+		GLchar *name = (GLchar *)replay.scratch(0);
+		glGetActiveUniform(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 120: { //glGetAttachedShaders
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLsizei maxCount = replay.value< GLsizei >();
+		GLsizei *count = (GLsizei *)replay.scratch(0);
+		GLuint *shaders = (GLuint *)replay.scratch(0);
+		glGetAttachedShaders(program, maxCount, count, shaders);
+		break;
+	}
+	case 121: { //glGetAttribLocation
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		const GLchar *name = replay.string();
+		GLint ret = glGetAttribLocation(program, name);
+		replay.bind_attrib(replay.value< GLint >(), ret);
+		break;
+	}
+	case 122: { //glGetProgramiv
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetProgramiv(program, pname, params);
+		break;
+	}
+	case 123: { //glGetProgramInfoLog
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLchar *infoLog = (GLchar *)replay.scratch(0);
+		glGetProgramInfoLog(program, bufSize, length, infoLog);
+		break;
+	}
+	case 124: { //glGetShaderiv
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetShaderiv(shader, pname, params);
+		break;
+	}
+	case 125: { //glGetShaderInfoLog
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLchar *infoLog = (GLchar *)replay.scratch(0);
+		glGetShaderInfoLog(shader, bufSize, length, infoLog);
+		break;
+	}
+	case 126: { //glGetShaderSource
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLchar *source = (GLchar *)replay.scratch(0);
+		glGetShaderSource(shader, bufSize, length, source);
+		break;
+	}
+	case 127: { //glGetUniformLocation
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		const GLchar *name = replay.string();
+		GLint ret = glGetUniformLocation(program, name);
+		replay.bind_location(program_recorded, replay.value< GLint >(), ret);
+		break;
+	}
+	case 128: { //glGetUniformfv
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLint location = replay.value< GLint >();
+		GLfloat *params = (GLfloat *)replay.scratch(0);
+		glGetUniformfv(program, location, params);
+		break;
+	}
+	case 129: { //glGetUniformiv
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLint location = replay.value< GLint >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetUniformiv(program, location, params);
+		break;
+	}
+	case 130: { //glGetVertexAttribdv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum pname = replay.value< GLenum >();
+		GLdouble *params = (GLdouble *)replay.scratch(0);
+		glGetVertexAttribdv(index, pname, params);
+		break;
+	}
+	case 131: { //glGetVertexAttribfv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum pname = replay.value< GLenum >();
+		GLfloat *params = (GLfloat *)replay.scratch(0);
+		glGetVertexAttribfv(index, pname, params);
+		break;
+	}
+	case 132: { //glGetVertexAttribiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetVertexAttribiv(index, pname, params);
+		break;
+	}
+	case 133: { //glGetVertexAttribPointerv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum pname = replay.value< GLenum >();
+		void **pointer = (void **)replay.scratch(0);
+		glGetVertexAttribPointerv(index, pname, pointer);
+		break;
+	}
+	case 134: { //glIsProgram
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		glIsProgram(program);
+		break;
+	}
+	case 135: { //glIsShader
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		glIsShader(shader);
+		break;
+	}
+	case 136: { //glLinkProgram
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		glLinkProgram(program);
+		break;
+	}
+	case 137: { //glShaderSource
+		GLuint shader_recorded = replay.value< GLuint >();
+		GLuint shader = replay.name(GLReplay::Shader, shader_recorded);
+		GLsizei count = replay.value< GLsizei >();
+		const GLchar *const*string = replay.strings();
+		const GLint *length = nullptr;
+		glShaderSource(shader, count, string, length);
+		break;
+	}
+	case 138: { //glUseProgram
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		glUseProgram(program);
+		replay.current_program = program_recorded;
+		break;
+	}
+	case 139: { //glUniform1f
+		GLint location = replay.location(replay.value< GLint >());
+		GLfloat v0 = replay.value< GLfloat >();
+		glUniform1f(location, v0);
+		break;
+	}
+	case 140: { //glUniform2f
+		GLint location = replay.location(replay.value< GLint >());
+		GLfloat v0 = replay.value< GLfloat >();
+		GLfloat v1 = replay.value< GLfloat >();
+		glUniform2f(location, v0, v1);
+		break;
+	}
+	case 141: { //glUniform3f
+		GLint location = replay.location(replay.value< GLint >());
+		GLfloat v0 = replay.value< GLfloat >();
+		GLfloat v1 = replay.value< GLfloat >();
+		GLfloat v2 = replay.value< GLfloat >();
+		glUniform3f(location, v0, v1, v2);
+		break;
+	}
+	case 142: { //glUniform4f
+		GLint location = replay.location(replay.value< GLint >());
+		GLfloat v0 = replay.value< GLfloat >();
+		GLfloat v1 = replay.value< GLfloat >();
+		GLfloat v2 = replay.value< GLfloat >();
+		GLfloat v3 = replay.value< GLfloat >();
+		glUniform4f(location, v0, v1, v2, v3);
+		break;
+	}
+	case 143: { //glUniform1i
+		GLint location = replay.location(replay.value< GLint >());
+		GLint v0 = replay.value< GLint >();
+		glUniform1i(location, v0);
+		break;
+	}
+	case 144: { //glUniform2i
+		GLint location = replay.location(replay.value< GLint >());
+		GLint v0 = replay.value< GLint >();
+		GLint v1 = replay.value< GLint >();
+		glUniform2i(location, v0, v1);
+		break;
+	}
+	case 145: { //glUniform3i
+		GLint location = replay.location(replay.value< GLint >());
+		GLint v0 = replay.value< GLint >();
+		GLint v1 = replay.value< GLint >();
+		GLint v2 = replay.value< GLint >();
+		glUniform3i(location, v0, v1, v2);
+		break;
+	}
+	case 146: { //glUniform4i
+		GLint location = replay.location(replay.value< GLint >());
+		GLint v0 = replay.value< GLint >();
+		GLint v1 = replay.value< GLint >();
+		GLint v2 = replay.value< GLint >();
+		GLint v3 = replay.value< GLint >();
+		glUniform4i(location, v0, v1, v2, v3);
+		break;
+	}
+	case 147: { //glUniform1fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniform1fv(location, count, value);
+		break;
+	}
+	case 148: { //glUniform2fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniform2fv(location, count, value);
+		break;
+	}
+	case 149: { //glUniform3fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniform3fv(location, count, value);
+		break;
+	}
+	case 150: { //glUniform4fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniform4fv(location, count, value);
+		break;
+	}
+	case 151: { //glUniform1iv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLint *value = (const GLint *)replay.data();
+		glUniform1iv(location, count, value);
+		break;
+	}
+	case 152: { //glUniform2iv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLint *value = (const GLint *)replay.data();
+		glUniform2iv(location, count, value);
+		break;
+	}
+	case 153: { //glUniform3iv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLint *value = (const GLint *)replay.data();
+		glUniform3iv(location, count, value);
+		break;
+	}
+	case 154: { //glUniform4iv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLint *value = (const GLint *)replay.data();
+		glUniform4iv(location, count, value);
+		break;
+	}
+	case 155: { //glUniformMatrix2fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix2fv(location, count, transpose, value);
+		break;
+	}
+	case 156: { //glUniformMatrix3fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix3fv(location, count, transpose, value);
+		break;
+	}
+	case 157: { //glUniformMatrix4fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix4fv(location, count, transpose, value);
+		break;
+	}
+	case 158: { //glValidateProgram
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		glValidateProgram(program);
+		break;
+	}
+	case 159: { //glVertexAttrib1d
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLdouble x = replay.value< GLdouble >();
+		glVertexAttrib1d(index, x);
+		break;
+	}
+	case 160: { //glVertexAttrib1dv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLdouble *v = (const GLdouble *)replay.data();
+		glVertexAttrib1dv(index, v);
+		break;
+	}
+	case 161: { //glVertexAttrib1f
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLfloat x = replay.value< GLfloat >();
+		glVertexAttrib1f(index, x);
+		break;
+	}
+	case 162: { //glVertexAttrib1fv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLfloat *v = (const GLfloat *)replay.data();
+		glVertexAttrib1fv(index, v);
+		break;
+	}
+	case 163: { //glVertexAttrib1s
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLshort x = replay.value< GLshort >();
+		glVertexAttrib1s(index, x);
+		break;
+	}
+	case 164: { //glVertexAttrib1sv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLshort *v = (const GLshort *)replay.data();
+		glVertexAttrib1sv(index, v);
+		break;
+	}
+	case 165: { //glVertexAttrib2d
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLdouble x = replay.value< GLdouble >();
+		GLdouble y = replay.value< GLdouble >();
+		glVertexAttrib2d(index, x, y);
+		break;
+	}
+	case 166: { //glVertexAttrib2dv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLdouble *v = (const GLdouble *)replay.data();
+		glVertexAttrib2dv(index, v);
+		break;
+	}
+	case 167: { //glVertexAttrib2f
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLfloat x = replay.value< GLfloat >();
+		GLfloat y = replay.value< GLfloat >();
+		glVertexAttrib2f(index, x, y);
+		break;
+	}
+	case 168: { //glVertexAttrib2fv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLfloat *v = (const GLfloat *)replay.data();
+		glVertexAttrib2fv(index, v);
+		break;
+	}
+	case 169: { //glVertexAttrib2s
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLshort x = replay.value< GLshort >();
+		GLshort y = replay.value< GLshort >();
+		glVertexAttrib2s(index, x, y);
+		break;
+	}
+	case 170: { //glVertexAttrib2sv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLshort *v = (const GLshort *)replay.data();
+		glVertexAttrib2sv(index, v);
+		break;
+	}
+	case 171: { //glVertexAttrib3d
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLdouble x = replay.value< GLdouble >();
+		GLdouble y = replay.value< GLdouble >();
+		GLdouble z = replay.value< GLdouble >();
+		glVertexAttrib3d(index, x, y, z);
+		break;
+	}
+	case 172: { //glVertexAttrib3dv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLdouble *v = (const GLdouble *)replay.data();
+		glVertexAttrib3dv(index, v);
+		break;
+	}
+	case 173: { //glVertexAttrib3f
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLfloat x = replay.value< GLfloat >();
+		GLfloat y = replay.value< GLfloat >();
+		GLfloat z = replay.value< GLfloat >();
+		glVertexAttrib3f(index, x, y, z);
+		break;
+	}
+	case 174: { //glVertexAttrib3fv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLfloat *v = (const GLfloat *)replay.data();
+		glVertexAttrib3fv(index, v);
+		break;
+	}
+	case 175: { //glVertexAttrib3s
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLshort x = replay.value< GLshort >();
+		GLshort y = replay.value< GLshort >();
+		GLshort z = replay.value< GLshort >();
+		glVertexAttrib3s(index, x, y, z);
+		break;
+	}
+	case 176: { //glVertexAttrib3sv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLshort *v = (const GLshort *)replay.data();
+		glVertexAttrib3sv(index, v);
+		break;
+	}
+	case 177: { //glVertexAttrib4Nbv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLbyte *v = (const GLbyte *)replay.data();
+		glVertexAttrib4Nbv(index, v);
+		break;
+	}
+	case 178: { //glVertexAttrib4Niv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLint *v = (const GLint *)replay.data();
+		glVertexAttrib4Niv(index, v);
+		break;
+	}
+	case 179: { //glVertexAttrib4Nsv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLshort *v = (const GLshort *)replay.data();
+		glVertexAttrib4Nsv(index, v);
+		break;
+	}
+	case 180: { //glVertexAttrib4Nub
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLubyte x = replay.value< GLubyte >();
+		GLubyte y = replay.value< GLubyte >();
+		GLubyte z = replay.value< GLubyte >();
+		GLubyte w = replay.value< GLubyte >();
+		glVertexAttrib4Nub(index, x, y, z, w);
+		break;
+	}
+	case 181: { //glVertexAttrib4Nubv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLubyte *v = (const GLubyte *)replay.data();
+		glVertexAttrib4Nubv(index, v);
+		break;
+	}
+	case 182: { //glVertexAttrib4Nuiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLuint *v = (const GLuint *)replay.data();
+		glVertexAttrib4Nuiv(index, v);
+		break;
+	}
+	case 183: { //glVertexAttrib4Nusv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLushort *v = (const GLushort *)replay.data();
+		glVertexAttrib4Nusv(index, v);
+		break;
+	}
+	case 184: { //glVertexAttrib4bv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLbyte *v = (const GLbyte *)replay.data();
+		glVertexAttrib4bv(index, v);
+		break;
+	}
+	case 185: { //glVertexAttrib4d
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLdouble x = replay.value< GLdouble >();
+		GLdouble y = replay.value< GLdouble >();
+		GLdouble z = replay.value< GLdouble >();
+		GLdouble w = replay.value< GLdouble >();
+		glVertexAttrib4d(index, x, y, z, w);
+		break;
+	}
+	case 186: { //glVertexAttrib4dv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLdouble *v = (const GLdouble *)replay.data();
+		glVertexAttrib4dv(index, v);
+		break;
+	}
+	case 187: { //glVertexAttrib4f
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLfloat x = replay.value< GLfloat >();
+		GLfloat y = replay.value< GLfloat >();
+		GLfloat z = replay.value< GLfloat >();
+		GLfloat w = replay.value< GLfloat >();
+		glVertexAttrib4f(index, x, y, z, w);
+		break;
+	}
+	case 188: { //glVertexAttrib4fv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLfloat *v = (const GLfloat *)replay.data();
+		glVertexAttrib4fv(index, v);
+		break;
+	}
+	case 189: { //glVertexAttrib4iv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLint *v = (const GLint *)replay.data();
+		glVertexAttrib4iv(index, v);
+		break;
+	}
+	case 190: { //glVertexAttrib4s
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLshort x = replay.value< GLshort >();
+		GLshort y = replay.value< GLshort >();
+		GLshort z = replay.value< GLshort >();
+		GLshort w = replay.value< GLshort >();
+		glVertexAttrib4s(index, x, y, z, w);
+		break;
+	}
+	case 191: { //glVertexAttrib4sv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLshort *v = (const GLshort *)replay.data();
+		glVertexAttrib4sv(index, v);
+		break;
+	}
+	case 192: { //glVertexAttrib4ubv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLubyte *v = (const GLubyte *)replay.data();
+		glVertexAttrib4ubv(index, v);
+		break;
+	}
+	case 193: { //glVertexAttrib4uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLuint *v = (const GLuint *)replay.data();
+		glVertexAttrib4uiv(index, v);
+		break;
+	}
+	case 194: { //glVertexAttrib4usv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLushort *v = (const GLushort *)replay.data();
+		glVertexAttrib4usv(index, v);
+		break;
+	}
+	case 195: { //glVertexAttribPointer
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLint size = replay.value< GLint >();
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		GLsizei stride = replay.value< GLsizei >();
+		const void *pointer = (const void *)uintptr_t(replay.value< uint64_t >());
+		glVertexAttribPointer(index, size, type, normalized, stride, pointer);
+		break;
+	}
+	case 196: { //glUniformMatrix2x3fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix2x3fv(location, count, transpose, value);
+		break;
+	}
+	case 197: { //glUniformMatrix3x2fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix3x2fv(location, count, transpose, value);
+		break;
+	}
+	case 198: { //glUniformMatrix2x4fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix2x4fv(location, count, transpose, value);
+		break;
+	}
+	case 199: { //glUniformMatrix4x2fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix4x2fv(location, count, transpose, value);
+		break;
+	}
+	case 200: { //glUniformMatrix3x4fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix3x4fv(location, count, transpose, value);
+		break;
+	}
+	case 201: { //glUniformMatrix4x3fv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		GLboolean transpose = replay.value< GLboolean >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glUniformMatrix4x3fv(location, count, transpose, value);
+		break;
+	}
+	case 202: { //glColorMaski
+		GLuint index = replay.value< GLuint >();
+		GLboolean r = replay.value< GLboolean >();
+		GLboolean g = replay.value< GLboolean >();
+		GLboolean b = replay.value< GLboolean >();
+		GLboolean a = replay.value< GLboolean >();
+		glColorMaski(index, r, g, b, a);
+		break;
+	}
+	case 203: { //glGetBooleani_v
+		GLenum target = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		GLboolean *data = (GLboolean *)replay.scratch(0);
+		glGetBooleani_v(target, index, data);
+		break;
+	}
+	case 204: { //glGetIntegeri_v
+		GLenum target = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		GLint *data = (GLint *)replay.scratch(0);
+		glGetIntegeri_v(target, index, data);
+		break;
+	}
+	case 205: { //glEnablei
+		GLenum target = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		glEnablei(target, index);
+		break;
+	}
+	case 206: { //glDisablei
+		GLenum target = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		glDisablei(target, index);
+		break;
+	}
+	case 207: { //glIsEnabledi
+		GLenum target = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		glIsEnabledi(target, index);
+		break;
+	}
+	case 208: { //glBeginTransformFeedback
+		GLenum primitiveMode = replay.value< GLenum >();
+		glBeginTransformFeedback(primitiveMode);
+		break;
+	}
+	case 209: { //glEndTransformFeedback
+		glEndTransformFeedback();
+		break;
+	}
+	case 210: { //glBindBufferRange
+		GLenum target = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		GLuint buffer_recorded = replay.value< GLuint >();
+		GLuint buffer = replay.name(GLReplay::Buffer, buffer_recorded);
+		GLintptr offset = GLintptr(replay.value< int64_t >());
+		GLsizeiptr size = GLsizeiptr(replay.value< int64_t >());
+		glBindBufferRange(target, index, buffer, offset, size);
+		break;
+	}
+	case 211: { //glBindBufferBase
+		GLenum target = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		GLuint buffer = replay.value< GLuint >();
+		glBindBufferBase(target, index, buffer);
+		break;
+	}
+	case 212: { //glTransformFeedbackVaryings
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLsizei count = replay.value< GLsizei >();
+		const GLchar *const*varyings = replay.strings();
+		GLenum bufferMode = replay.value< GLenum >();
+		glTransformFeedbackVaryings(program, count, varyings, bufferMode);
+		break;
+	}
+	case 213: { //glGetTransformFeedbackVarying
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint index = replay.value< GLuint >();
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLsizei *size = (GLsizei *)replay.scratch(0);
+		GLenum *type = (GLenum *)replay.scratch(0);
+		GLchar *name = (GLchar *)replay.scratch(0);
+		glGetTransformFeedbackVarying(program, index, bufSize, length, size, type, name);
+		break;
+	}
+	case 214: { //glClampColor
+		GLenum target = replay.value< GLenum >();
+		GLenum clamp = replay.value< GLenum >();
+		glClampColor(target, clamp);
+		break;
+	}
+	case 215: { //glBeginConditionalRender
+		GLuint id_recorded = replay.value< GLuint >();
+		GLuint id = replay.name(GLReplay::Query, id_recorded);
+		GLenum mode = replay.value< GLenum >();
+		glBeginConditionalRender(id, mode);
+		break;
+	}
+	case 216: { //glEndConditionalRender
+		glEndConditionalRender();
+		break;
+	}
+	case 217: { //glVertexAttribIPointer
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLint size = replay.value< GLint >();
+		GLenum type = replay.value< GLenum >();
+		GLsizei stride = replay.value< GLsizei >();
+		const void *pointer = (const void *)uintptr_t(replay.value< uint64_t >());
+		glVertexAttribIPointer(index, size, type, stride, pointer);
+		break;
+	}
+	case 218: { //glGetVertexAttribIiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetVertexAttribIiv(index, pname, params);
+		break;
+	}
+	case 219: { //glGetVertexAttribIuiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum pname = replay.value< GLenum >();
+		GLuint *params = (GLuint *)replay.scratch(0);
+		glGetVertexAttribIuiv(index, pname, params);
+		break;
+	}
+	case 220: { //glVertexAttribI1i
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLint x = replay.value< GLint >();
+		glVertexAttribI1i(index, x);
+		break;
+	}
+	case 221: { //glVertexAttribI2i
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		glVertexAttribI2i(index, x, y);
+		break;
+	}
+	case 222: { //glVertexAttribI3i
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLint z = replay.value< GLint >();
+		glVertexAttribI3i(index, x, y, z);
+		break;
+	}
+	case 223: { //glVertexAttribI4i
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLint x = replay.value< GLint >();
+		GLint y = replay.value< GLint >();
+		GLint z = replay.value< GLint >();
+		GLint w = replay.value< GLint >();
+		glVertexAttribI4i(index, x, y, z, w);
+		break;
+	}
+	case 224: { //glVertexAttribI1ui
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLuint x = replay.value< GLuint >();
+		glVertexAttribI1ui(index, x);
+		break;
+	}
+	case 225: { //glVertexAttribI2ui
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLuint x = replay.value< GLuint >();
+		GLuint y = replay.value< GLuint >();
+		glVertexAttribI2ui(index, x, y);
+		break;
+	}
+	case 226: { //glVertexAttribI3ui
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLuint x = replay.value< GLuint >();
+		GLuint y = replay.value< GLuint >();
+		GLuint z = replay.value< GLuint >();
+		glVertexAttribI3ui(index, x, y, z);
+		break;
+	}
+	case 227: { //glVertexAttribI4ui
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLuint x = replay.value< GLuint >();
+		GLuint y = replay.value< GLuint >();
+		GLuint z = replay.value< GLuint >();
+		GLuint w = replay.value< GLuint >();
+		glVertexAttribI4ui(index, x, y, z, w);
+		break;
+	}
+	case 228: { //glVertexAttribI1iv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLint *v = (const GLint *)replay.data();
+		glVertexAttribI1iv(index, v);
+		break;
+	}
+	case 229: { //glVertexAttribI2iv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLint *v = (const GLint *)replay.data();
+		glVertexAttribI2iv(index, v);
+		break;
+	}
+	case 230: { //glVertexAttribI3iv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLint *v = (const GLint *)replay.data();
+		glVertexAttribI3iv(index, v);
+		break;
+	}
+	case 231: { //glVertexAttribI4iv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLint *v = (const GLint *)replay.data();
+		glVertexAttribI4iv(index, v);
+		break;
+	}
+	case 232: { //glVertexAttribI1uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLuint *v = (const GLuint *)replay.data();
+		glVertexAttribI1uiv(index, v);
+		break;
+	}
+	case 233: { //glVertexAttribI2uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLuint *v = (const GLuint *)replay.data();
+		glVertexAttribI2uiv(index, v);
+		break;
+	}
+	case 234: { //glVertexAttribI3uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLuint *v = (const GLuint *)replay.data();
+		glVertexAttribI3uiv(index, v);
+		break;
+	}
+	case 235: { //glVertexAttribI4uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLuint *v = (const GLuint *)replay.data();
+		glVertexAttribI4uiv(index, v);
+		break;
+	}
+	case 236: { //glVertexAttribI4bv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLbyte *v = (const GLbyte *)replay.data();
+		glVertexAttribI4bv(index, v);
+		break;
+	}
+	case 237: { //glVertexAttribI4sv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLshort *v = (const GLshort *)replay.data();
+		glVertexAttribI4sv(index, v);
+		break;
+	}
+	case 238: { //glVertexAttribI4ubv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLubyte *v = (const GLubyte *)replay.data();
+		glVertexAttribI4ubv(index, v);
+		break;
+	}
+	case 239: { //glVertexAttribI4usv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		const GLushort *v = (const GLushort *)replay.data();
+		glVertexAttribI4usv(index, v);
+		break;
+	}
+	case 240: { //glGetUniformuiv
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLint location = replay.value< GLint >();
+		GLuint *params = (GLuint *)replay.scratch(0);
+		glGetUniformuiv(program, location, params);
+		break;
+	}
+	case 241: { //glBindFragDataLocation
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint color = replay.value< GLuint >();
+		const GLchar *name = replay.string();
+		glBindFragDataLocation(program, color, name);
+		break;
+	}
+	case 242: { //glGetFragDataLocation
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		const GLchar *name = replay.string();
+		glGetFragDataLocation(program, name);
+		break;
+	}
+	case 243: { //glUniform1ui
+		GLint location = replay.location(replay.value< GLint >());
+		GLuint v0 = replay.value< GLuint >();
+		glUniform1ui(location, v0);
+		break;
+	}
+	case 244: { //glUniform2ui
+		GLint location = replay.location(replay.value< GLint >());
+		GLuint v0 = replay.value< GLuint >();
+		GLuint v1 = replay.value< GLuint >();
+		glUniform2ui(location, v0, v1);
+		break;
+	}
+	case 245: { //glUniform3ui
+		GLint location = replay.location(replay.value< GLint >());
+		GLuint v0 = replay.value< GLuint >();
+		GLuint v1 = replay.value< GLuint >();
+		GLuint v2 = replay.value< GLuint >();
+		glUniform3ui(location, v0, v1, v2);
+		break;
+	}
+	case 246: { //glUniform4ui
+		GLint location = replay.location(replay.value< GLint >());
+		GLuint v0 = replay.value< GLuint >();
+		GLuint v1 = replay.value< GLuint >();
+		GLuint v2 = replay.value< GLuint >();
+		GLuint v3 = replay.value< GLuint >();
+		glUniform4ui(location, v0, v1, v2, v3);
+		break;
+	}
+	case 247: { //glUniform1uiv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glUniform1uiv(location, count, value);
+		break;
+	}
+	case 248: { //glUniform2uiv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glUniform2uiv(location, count, value);
+		break;
+	}
+	case 249: { //glUniform3uiv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glUniform3uiv(location, count, value);
+		break;
+	}
+	case 250: { //glUniform4uiv
+		GLint location = replay.location(replay.value< GLint >());
+		GLsizei count = replay.value< GLsizei >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glUniform4uiv(location, count, value);
+		break;
+	}
+	case 251: { //glTexParameterIiv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		const GLint *params = (const GLint *)replay.data();
+		glTexParameterIiv(target, pname, params);
+		break;
+	}
+	case 252: { //glTexParameterIuiv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		const GLuint *params = (const GLuint *)replay.data();
+		glTexParameterIuiv(target, pname, params);
+		break;
+	}
+	case 253: { //glGetTexParameterIiv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetTexParameterIiv(target, pname, params);
+		break;
+	}
+	case 254: { //glGetTexParameterIuiv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLuint *params = (GLuint *)replay.scratch(0);
+		glGetTexParameterIuiv(target, pname, params);
+		break;
+	}
+	case 255: { //glClearBufferiv
+		GLenum buffer = replay.value< GLenum >();
+		GLint drawbuffer = replay.value< GLint >();
+		const GLint *value = (const GLint *)replay.data();
+		glClearBufferiv(buffer, drawbuffer, value);
+		break;
+	}
+	case 256: { //glClearBufferuiv
+		GLenum buffer = replay.value< GLenum >();
+		GLint drawbuffer = replay.value< GLint >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glClearBufferuiv(buffer, drawbuffer, value);
+		break;
+	}
+	case 257: { //glClearBufferfv
+		GLenum buffer = replay.value< GLenum >();
+		GLint drawbuffer = replay.value< GLint >();
+		const GLfloat *value = (const GLfloat *)replay.data();
+		glClearBufferfv(buffer, drawbuffer, value);
+		break;
+	}
+	case 258: { //glClearBufferfi
+		GLenum buffer = replay.value< GLenum >();
+		GLint drawbuffer = replay.value< GLint >();
+		GLfloat depth = replay.value< GLfloat >();
+		GLint stencil = replay.value< GLint >();
+		glClearBufferfi(buffer, drawbuffer, depth, stencil);
+		break;
+	}
+	case 259: { //glGetStringi
+		GLenum name = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		glGetStringi(name, index);
+		break;
+	}
+	case 260: { //glIsRenderbuffer
+		GLuint renderbuffer_recorded = replay.value< GLuint >();
+		GLuint renderbuffer = replay.name(GLReplay::Renderbuffer, renderbuffer_recorded);
+		glIsRenderbuffer(renderbuffer);
+		break;
+	}
+	case 261: { //glBindRenderbuffer
+		GLenum target = replay.value< GLenum >();
+		GLuint renderbuffer_recorded = replay.value< GLuint >();
+		GLuint renderbuffer = replay.name(GLReplay::Renderbuffer, renderbuffer_recorded);
+		glBindRenderbuffer(target, renderbuffer);
+		break;
+	}
+	case 262: { //glDeleteRenderbuffers
+		GLsizei n = replay.value< GLsizei >();
+		const GLuint *renderbuffers = replay.names(GLReplay::Renderbuffer);
+		glDeleteRenderbuffers(n, renderbuffers);
+		break;
+	}
+	case 263: { //glGenRenderbuffers
+		GLsizei n = replay.value< GLsizei >();
+		GLuint const *renderbuffers_recorded = (GLuint const *)replay.data();
+		GLuint *renderbuffers = (GLuint *)replay.scratch(replay.count(n) * sizeof(GLuint));
+		glGenRenderbuffers(n, renderbuffers);
+		replay.bind_names(GLReplay::Renderbuffer, n, renderbuffers_recorded, renderbuffers);
+		break;
+	}
+	case 264: { //glRenderbufferStorage
+		GLenum target = replay.value< GLenum >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		glRenderbufferStorage(target, internalformat, width, height);
+		break;
+	}
+	case 265: { //glGetRenderbufferParameteriv
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetRenderbufferParameteriv(target, pname, params);
+		break;
+	}
+	case 266: { //glIsFramebuffer
+		GLuint framebuffer_recorded = replay.value< GLuint >();
+		GLuint framebuffer = replay.name(GLReplay::Framebuffer, framebuffer_recorded);
+		glIsFramebuffer(framebuffer);
+		break;
+	}
+	case 267: { //glBindFramebuffer
+		GLenum target = replay.value< GLenum >();
+		GLuint framebuffer_recorded = replay.value< GLuint >();
+		GLuint framebuffer = replay.name(GLReplay::Framebuffer, framebuffer_recorded);
+		glBindFramebuffer(target, framebuffer);
+		break;
+	}
+	case 268: { //glDeleteFramebuffers
+		GLsizei n = replay.value< GLsizei >();
+		const GLuint *framebuffers = replay.names(GLReplay::Framebuffer);
+		glDeleteFramebuffers(n, framebuffers);
+		break;
+	}
+	case 269: { //glGenFramebuffers
+		GLsizei n = replay.value< GLsizei >();
+		GLuint const *framebuffers_recorded = (GLuint const *)replay.data();
+		GLuint *framebuffers = (GLuint *)replay.scratch(replay.count(n) * sizeof(GLuint));
+		glGenFramebuffers(n, framebuffers);
+		replay.bind_names(GLReplay::Framebuffer, n, framebuffers_recorded, framebuffers);
+		break;
+	}
+	case 270: { //glCheckFramebufferStatus
+		GLenum target = replay.value< GLenum >();
+		glCheckFramebufferStatus(target);
+		break;
+	}
+	case 271: { //glFramebufferTexture1D
+		GLenum target = replay.value< GLenum >();
+		GLenum attachment = replay.value< GLenum >();
+		GLenum textarget = replay.value< GLenum >();
+		GLuint texture_recorded = replay.value< GLuint >();
+		GLuint texture = replay.name(GLReplay::Texture, texture_recorded);
+		GLint level = replay.value< GLint >();
+		glFramebufferTexture1D(target, attachment, textarget, texture, level);
+		break;
+	}
+	case 272: { //glFramebufferTexture2D
+		GLenum target = replay.value< GLenum >();
+		GLenum attachment = replay.value< GLenum >();
+		GLenum textarget = replay.value< GLenum >();
+		GLuint texture_recorded = replay.value< GLuint >();
+		GLuint texture = replay.name(GLReplay::Texture, texture_recorded);
+		GLint level = replay.value< GLint >();
+		glFramebufferTexture2D(target, attachment, textarget, texture, level);
+		break;
+	}
+	case 273: { //glFramebufferTexture3D
+		GLenum target = replay.value< GLenum >();
+		GLenum attachment = replay.value< GLenum >();
+		GLenum textarget = replay.value< GLenum >();
+		GLuint texture_recorded = replay.value< GLuint >();
+		GLuint texture = replay.name(GLReplay::Texture, texture_recorded);
+		GLint level = replay.value< GLint >();
+		GLint zoffset = replay.value< GLint >();
+		glFramebufferTexture3D(target, attachment, textarget, texture, level, zoffset);
+		break;
+	}
+	case 274: { //glFramebufferRenderbuffer
+		GLenum target = replay.value< GLenum >();
+		GLenum attachment = replay.value< GLenum >();
+		GLenum renderbuffertarget = replay.value< GLenum >();
+		GLuint renderbuffer_recorded = replay.value< GLuint >();
+		GLuint renderbuffer = replay.name(GLReplay::Renderbuffer, renderbuffer_recorded);
+		glFramebufferRenderbuffer(target, attachment, renderbuffertarget, renderbuffer);
+		break;
+	}
+	case 275: { //glGetFramebufferAttachmentParameteriv
+		GLenum target = replay.value< GLenum >();
+		GLenum attachment = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetFramebufferAttachmentParameteriv(target, attachment, pname, params);
+		break;
+	}
+	case 276: { //glGenerateMipmap
+		GLenum target = replay.value< GLenum >();
+		glGenerateMipmap(target);
+		break;
+	}
+	case 277: { //glBlitFramebuffer
+		GLint srcX0 = replay.value< GLint >();
+		GLint srcY0 = replay.value< GLint >();
+		GLint srcX1 = replay.value< GLint >();
+		GLint srcY1 = replay.value< GLint >();
+		GLint dstX0 = replay.value< GLint >();
+		GLint dstY0 = replay.value< GLint >();
+		GLint dstX1 = replay.value< GLint >();
+		GLint dstY1 = replay.value< GLint >();
+		GLbitfield mask = replay.value< GLbitfield >();
+		GLenum filter = replay.value< GLenum >();
+		glBlitFramebuffer(srcX0, srcY0, srcX1, srcY1, dstX0, dstY0, dstX1, dstY1, mask, filter);
+		break;
+	}
+	case 278: { //glRenderbufferStorageMultisample
+		GLenum target = replay.value< GLenum >();
+		GLsizei samples = replay.value< GLsizei >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		glRenderbufferStorageMultisample(target, samples, internalformat, width, height);
+		break;
+	}
+	case 279: { //glFramebufferTextureLayer
+		GLenum target = replay.value< GLenum >();
+		GLenum attachment = replay.value< GLenum >();
+		GLuint texture_recorded = replay.value< GLuint >();
+		GLuint texture = replay.name(GLReplay::Texture, texture_recorded);
+		GLint level = replay.value< GLint >();
+		GLint layer = replay.value< GLint >();
+		glFramebufferTextureLayer(target, attachment, texture, level, layer);
+		break;
+	}
+	case 280: { //glMapBufferRange
+		GLenum target = replay.value< GLenum >();
+		GLintptr offset = GLintptr(replay.value< int64_t >());
+		GLsizeiptr length = GLsizeiptr(replay.value< int64_t >());
+		GLbitfield access = replay.value< GLbitfield >();
+		void * ret = glMapBufferRange(target, offset, length, access);
+		replay.mapped(target, ret);
+		break;
+	}
+	case 281: { //glFlushMappedBufferRange
+		GLenum target = replay.value< GLenum >();
+		GLintptr offset = GLintptr(replay.value< int64_t >());
+		GLsizeiptr length = GLsizeiptr(replay.value< int64_t >());
+		glFlushMappedBufferRange(target, offset, length);
+		break;
+	}
+	case 282: { //glBindVertexArray
+		GLuint array_recorded = replay.value< GLuint >();
+		GLuint array = replay.name(GLReplay::VertexArray, array_recorded);
+		glBindVertexArray(array);
+		break;
+	}
+	case 283: { //glDeleteVertexArrays
+		GLsizei n = replay.value< GLsizei >();
+		const GLuint *arrays = replay.names(GLReplay::VertexArray);
+		glDeleteVertexArrays(n, arrays);
+		break;
+	}
+	case 284: { //glGenVertexArrays
+		GLsizei n = replay.value< GLsizei >();
+		GLuint const *arrays_recorded = (GLuint const *)replay.data();
+		GLuint *arrays = (GLuint *)replay.scratch(replay.count(n) * sizeof(GLuint));
+		glGenVertexArrays(n, arrays);
+		replay.bind_names(GLReplay::VertexArray, n, arrays_recorded, arrays);
+		break;
+	}
+	case 285: { //glIsVertexArray
+		GLuint array_recorded = replay.value< GLuint >();
+		GLuint array = replay.name(GLReplay::VertexArray, array_recorded);
+		glIsVertexArray(array);
+		break;
+	}
+	case 286: { //glDrawArraysInstanced
+		GLenum mode = replay.value< GLenum >();
+		GLint first = replay.value< GLint >();
+		GLsizei count = replay.value< GLsizei >();
+		GLsizei instancecount = replay.value< GLsizei >();
+		glDrawArraysInstanced(mode, first, count, instancecount);
+		break;
+	}
+	case 287: { //glDrawElementsInstanced
+		GLenum mode = replay.value< GLenum >();
+		GLsizei count = replay.value< GLsizei >();
+		GLenum type = replay.value< GLenum >();
+		const void *indices = (const void *)uintptr_t(replay.value< uint64_t >());
+		GLsizei instancecount = replay.value< GLsizei >();
+		glDrawElementsInstanced(mode, count, type, indices, instancecount);
+		break;
+	}
+	case 288: { //glTexBuffer
+		GLenum target = replay.value< GLenum >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLuint buffer_recorded = replay.value< GLuint >();
+		GLuint buffer = replay.name(GLReplay::Buffer, buffer_recorded);
+		glTexBuffer(target, internalformat, buffer);
+		break;
+	}
+	case 289: { //glPrimitiveRestartIndex
+		GLuint index = replay.value< GLuint >();
+		glPrimitiveRestartIndex(index);
+		break;
+	}
+	case 290: { //glCopyBufferSubData
+		GLenum readTarget = replay.value< GLenum >();
+		GLenum writeTarget = replay.value< GLenum >();
+		GLintptr readOffset = GLintptr(replay.value< int64_t >());
+		GLintptr writeOffset = GLintptr(replay.value< int64_t >());
+		GLsizeiptr size = GLsizeiptr(replay.value< int64_t >());
+		glCopyBufferSubData(readTarget, writeTarget, readOffset, writeOffset, size);
+		break;
+	}
+	case 291: { //glGetUniformIndices
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLsizei uniformCount = replay.value< GLsizei >();
+		const GLchar *const*uniformNames = replay.strings();
+		GLuint *uniformIndices = (GLuint *)replay.scratch(uniformCount * 4);
+		glGetUniformIndices(program, uniformCount, uniformNames, uniformIndices);
+		break;
+	}
+	case 292: { //glGetActiveUniformsiv
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLsizei uniformCount = replay.value< GLsizei >();
+		const GLuint *uniformIndices = (const GLuint *)replay.data();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(uniformCount * 4);
+		glGetActiveUniformsiv(program, uniformCount, uniformIndices, pname, params);
+		break;
+	}
+	case 293: { //glGetActiveUniformName
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint uniformIndex = replay.value< GLuint >();
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLchar *uniformName = (GLchar *)replay.scratch(0);
+		glGetActiveUniformName(program, uniformIndex, bufSize, length, uniformName);
+		break;
+	}
+	case 294: { //glGetUniformBlockIndex
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		const GLchar *uniformBlockName = replay.string();
+		glGetUniformBlockIndex(program, uniformBlockName);
+		break;
+	}
+	case 295: { //glGetActiveUniformBlockiv
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint uniformBlockIndex = replay.value< GLuint >();
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetActiveUniformBlockiv(program, uniformBlockIndex, pname, params);
+		break;
+	}
+	case 296: { //glGetActiveUniformBlockName
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint uniformBlockIndex = replay.value< GLuint >();
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLchar *uniformBlockName = (GLchar *)replay.scratch(0);
+		glGetActiveUniformBlockName(program, uniformBlockIndex, bufSize, length, uniformBlockName);
+		break;
+	}
+	case 297: { //glUniformBlockBinding
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint uniformBlockIndex = replay.value< GLuint >();
+		GLuint uniformBlockBinding = replay.value< GLuint >();
+		glUniformBlockBinding(program, uniformBlockIndex, uniformBlockBinding);
+		break;
+	}
+	case 298: { //glDrawElementsBaseVertex
+		GLenum mode = replay.value< GLenum >();
+		GLsizei count = replay.value< GLsizei >();
+		GLenum type = replay.value< GLenum >();
+		const void *indices = (const void *)uintptr_t(replay.value< uint64_t >());
+		GLint basevertex = replay.value< GLint >();
+		glDrawElementsBaseVertex(mode, count, type, indices, basevertex);
+		break;
+	}
+	case 299: { //glDrawRangeElementsBaseVertex
+		GLenum mode = replay.value< GLenum >();
+		GLuint start = replay.value< GLuint >();
+		GLuint end = replay.value< GLuint >();
+		GLsizei count = replay.value< GLsizei >();
+		GLenum type = replay.value< GLenum >();
+		const void *indices = (const void *)uintptr_t(replay.value< uint64_t >());
+		GLint basevertex = replay.value< GLint >();
+		glDrawRangeElementsBaseVertex(mode, start, end, count, type, indices, basevertex);
+		break;
+	}
+	case 300: { //glDrawElementsInstancedBaseVertex
+		GLenum mode = replay.value< GLenum >();
+		GLsizei count = replay.value< GLsizei >();
+		GLenum type = replay.value< GLenum >();
+		const void *indices = (const void *)uintptr_t(replay.value< uint64_t >());
+		GLsizei instancecount = replay.value< GLsizei >();
+		GLint basevertex = replay.value< GLint >();
+		glDrawElementsInstancedBaseVertex(mode, count, type, indices, instancecount, basevertex);
+		break;
+	}
+	case 301: { //glMultiDrawElementsBaseVertex
+		GLenum mode = replay.value< GLenum >();
+		const GLsizei *count = (const GLsizei *)replay.data();
+		GLenum type = replay.value< GLenum >();
+		const void *const*indices = replay.offsets();
+		GLsizei drawcount = replay.value< GLsizei >();
+		const GLint *basevertex = (const GLint *)replay.data();
+		glMultiDrawElementsBaseVertex(mode, count, type, indices, drawcount, basevertex);
+		break;
+	}
+	case 302: { //glProvokingVertex
+		GLenum mode = replay.value< GLenum >();
+		glProvokingVertex(mode);
+		break;
+	}
+	case 303: { //glFenceSync
+		GLenum condition = replay.value< GLenum >();
+		GLbitfield flags = replay.value< GLbitfield >();
+		GLsync ret = glFenceSync(condition, flags);
+		replay.bind_sync(replay.value< uint64_t >(), ret);
+		break;
+	}
+	case 304: { //glIsSync
+		GLsync sync = replay.sync(replay.value< uint64_t >());
+		glIsSync(sync);
+		break;
+	}
+	case 305: { //glDeleteSync
+		GLsync sync = replay.sync(replay.value< uint64_t >());
+		glDeleteSync(sync);
+		break;
+	}
+	case 306: { //glClientWaitSync
+		GLsync sync = replay.sync(replay.value< uint64_t >());
+		GLbitfield flags = replay.value< GLbitfield >();
+		GLuint64 timeout = replay.value< GLuint64 >();
+		glClientWaitSync(sync, flags, timeout);
+		break;
+	}
+	case 307: { //glWaitSync
+		GLsync sync = replay.sync(replay.value< uint64_t >());
+		GLbitfield flags = replay.value< GLbitfield >();
+		GLuint64 timeout = replay.value< GLuint64 >();
+		glWaitSync(sync, flags, timeout);
+		break;
+	}
+	case 308: { //glGetInteger64v
+		GLenum pname = replay.value< GLenum >();
+		GLint64 *data = (GLint64 *)replay.scratch(0);
+		glGetInteger64v(pname, data);
+		break;
+	}
+	case 309: { //glGetSynciv
+		GLsync sync = replay.sync(replay.value< uint64_t >());
+		GLenum pname = replay.value< GLenum >();
+		GLsizei bufSize = replay.value< GLsizei >();
+		GLsizei *length = (GLsizei *)replay.scratch(0);
+		GLint *values = (GLint *)replay.scratch(0);
+		glGetSynciv(sync, pname, bufSize, length, values);
+		break;
+	}
+	case 310: { //glGetInteger64i_v
+		GLenum target = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		GLint64 *data = (GLint64 *)replay.scratch(0);
+		glGetInteger64i_v(target, index, data);
+		break;
+	}
+	case 311: { //glGetBufferParameteri64v
+		GLenum target = replay.value< GLenum >();
+		GLenum pname = replay.value< GLenum >();
+		GLint64 *params = (GLint64 *)replay.scratch(0);
+		glGetBufferParameteri64v(target, pname, params);
+		break;
+	}
+	case 312: { //glFramebufferTexture
+		GLenum target = replay.value< GLenum >();
+		GLenum attachment = replay.value< GLenum >();
+		GLuint texture_recorded = replay.value< GLuint >();
+		GLuint texture = replay.name(GLReplay::Texture, texture_recorded);
+		GLint level = replay.value< GLint >();
+		glFramebufferTexture(target, attachment, texture, level);
+		break;
+	}
+	case 313: { //glTexImage2DMultisample
+		GLenum target = replay.value< GLenum >();
+		GLsizei samples = replay.value< GLsizei >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLboolean fixedsamplelocations = replay.value< GLboolean >();
+		glTexImage2DMultisample(target, samples, internalformat, width, height, fixedsamplelocations);
+		break;
+	}
+	case 314: { //glTexImage3DMultisample
+		GLenum target = replay.value< GLenum >();
+		GLsizei samples = replay.value< GLsizei >();
+		GLenum internalformat = replay.value< GLenum >();
+		GLsizei width = replay.value< GLsizei >();
+		GLsizei height = replay.value< GLsizei >();
+		GLsizei depth = replay.value< GLsizei >();
+		GLboolean fixedsamplelocations = replay.value< GLboolean >();
+		glTexImage3DMultisample(target, samples, internalformat, width, height, depth, fixedsamplelocations);
+		break;
+	}
+	case 315: { //glGetMultisamplefv
+		GLenum pname = replay.value< GLenum >();
+		GLuint index = replay.value< GLuint >();
+		GLfloat *val = (GLfloat *)replay.scratch(0);
+		glGetMultisamplefv(pname, index, val);
+		break;
+	}
+	case 316: { //glSampleMaski
+		GLuint maskNumber = replay.value< GLuint >();
+		GLbitfield mask = replay.value< GLbitfield >();
+		glSampleMaski(maskNumber, mask);
+		break;
+	}
+	case 317: { //glBindFragDataLocationIndexed
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		GLuint colorNumber = replay.value< GLuint >();
+		GLuint index = replay.value< GLuint >();
+		const GLchar *name = replay.string();
+		glBindFragDataLocationIndexed(program, colorNumber, index, name);
+		break;
+	}
+	case 318: { //glGetFragDataIndex
+		GLuint program_recorded = replay.value< GLuint >();
+		GLuint program = replay.name(GLReplay::Program, program_recorded);
+		const GLchar *name = replay.string();
+		glGetFragDataIndex(program, name);
+		break;
+	}
+	case 319: { //glGenSamplers
+		GLsizei count = replay.value< GLsizei >();
+		GLuint const *samplers_recorded = (GLuint const *)replay.data();
+		GLuint *samplers = (GLuint *)replay.scratch(replay.count(count) * sizeof(GLuint));
+		glGenSamplers(count, samplers);
+		replay.bind_names(GLReplay::Sampler, count, samplers_recorded, samplers);
+		break;
+	}
+	case 320: { //glDeleteSamplers
+		GLsizei count = replay.value< GLsizei >();
+		const GLuint *samplers = replay.names(GLReplay::Sampler);
+		glDeleteSamplers(count, samplers);
+		break;
+	}
+	case 321: { //glIsSampler
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		glIsSampler(sampler);
+		break;
+	}
+	case 322: { //glBindSampler
+		GLuint unit = replay.value< GLuint >();
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		glBindSampler(unit, sampler);
+		break;
+	}
+	case 323: { //glSamplerParameteri
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLint param = replay.value< GLint >();
+		glSamplerParameteri(sampler, pname, param);
+		break;
+	}
+	case 324: { //glSamplerParameteriv
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		const GLint *param = (const GLint *)replay.data();
+		glSamplerParameteriv(sampler, pname, param);
+		break;
+	}
+	case 325: { //glSamplerParameterf
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLfloat param = replay.value< GLfloat >();
+		glSamplerParameterf(sampler, pname, param);
+		break;
+	}
+	case 326: { //glSamplerParameterfv
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		const GLfloat *param = (const GLfloat *)replay.data();
+		glSamplerParameterfv(sampler, pname, param);
+		break;
+	}
+	case 327: { //glSamplerParameterIiv
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		const GLint *param = (const GLint *)replay.data();
+		glSamplerParameterIiv(sampler, pname, param);
+		break;
+	}
+	case 328: { //glSamplerParameterIuiv
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		const GLuint *param = (const GLuint *)replay.data();
+		glSamplerParameterIuiv(sampler, pname, param);
+		break;
+	}
+	case 329: { //glGetSamplerParameteriv
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetSamplerParameteriv(sampler, pname, params);
+		break;
+	}
+	case 330: { //glGetSamplerParameterIiv
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLint *params = (GLint *)replay.scratch(0);
+		glGetSamplerParameterIiv(sampler, pname, params);
+		break;
+	}
+	case 331: { //glGetSamplerParameterfv
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLfloat *params = (GLfloat *)replay.scratch(0);
+		glGetSamplerParameterfv(sampler, pname, params);
+		break;
+	}
+	case 332: { //glGetSamplerParameterIuiv
+		GLuint sampler_recorded = replay.value< GLuint >();
+		GLuint sampler = replay.name(GLReplay::Sampler, sampler_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLuint *params = (GLuint *)replay.scratch(0);
+		glGetSamplerParameterIuiv(sampler, pname, params);
+		break;
+	}
+	case 333: { //glQueryCounter
+		GLuint id_recorded = replay.value< GLuint >();
+		GLuint id = replay.name(GLReplay::Query, id_recorded);
+		GLenum target = replay.value< GLenum >();
+		glQueryCounter(id, target);
+		break;
+	}
+	case 334: { //glGetQueryObjecti64v
+		GLuint id_recorded = replay.value< GLuint >();
+		GLuint id = replay.name(GLReplay::Query, id_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLint64 *params = (GLint64 *)replay.scratch(0);
+		glGetQueryObjecti64v(id, pname, params);
+		break;
+	}
+	case 335: { //glGetQueryObjectui64v
+		GLuint id_recorded = replay.value< GLuint >();
+		GLuint id = replay.name(GLReplay::Query, id_recorded);
+		GLenum pname = replay.value< GLenum >();
+		GLuint64 *params = (GLuint64 *)replay.scratch(0);
+		glGetQueryObjectui64v(id, pname, params);
+		break;
+	}
+	case 336: { //glVertexAttribDivisor
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLuint divisor = replay.value< GLuint >();
+		glVertexAttribDivisor(index, divisor);
+		break;
+	}
+	case 337: { //glVertexAttribP1ui
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		GLuint value = replay.value< GLuint >();
+		glVertexAttribP1ui(index, type, normalized, value);
+		break;
+	}
+	case 338: { //glVertexAttribP1uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glVertexAttribP1uiv(index, type, normalized, value);
+		break;
+	}
+	case 339: { //glVertexAttribP2ui
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		GLuint value = replay.value< GLuint >();
+		glVertexAttribP2ui(index, type, normalized, value);
+		break;
+	}
+	case 340: { //glVertexAttribP2uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glVertexAttribP2uiv(index, type, normalized, value);
+		break;
+	}
+	case 341: { //glVertexAttribP3ui
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		GLuint value = replay.value< GLuint >();
+		glVertexAttribP3ui(index, type, normalized, value);
+		break;
+	}
+	case 342: { //glVertexAttribP3uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glVertexAttribP3uiv(index, type, normalized, value);
+		break;
+	}
+	case 343: { //glVertexAttribP4ui
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		GLuint value = replay.value< GLuint >();
+		glVertexAttribP4ui(index, type, normalized, value);
+		break;
+	}
+	case 344: { //glVertexAttribP4uiv
+		GLuint index = replay.attrib(replay.value< GLuint >());
+		GLenum type = replay.value< GLenum >();
+		GLboolean normalized = replay.value< GLboolean >();
+		const GLuint *value = (const GLuint *)replay.data();
+		glVertexAttribP4uiv(index, type, normalized, value);
+		break;
+	}
+	default: {
+		replay.unknown(call);
+		break;
+	}
+	}
+}
@@ -0,0 +1,109 @@
+#include "gl_state.hpp"
+
+#include <algorithm>
+#include <cstring>
+
+GLState gl_state;
+
+char const *GLState::kind_name(Kind kind) {
+	switch (kind) {
+		case Program: return "program";
+		case VertexArray: return "vertex array";
+		case Buffer: return "buffer";
+		case Capability: return "enable";
+		case BlendFunc: return "blend func";
+		case Uniform: return "uniform";
+		default: return "?";
+	}
+}
+
+uint64_t GLState::Stats::total_calls() const {
+	uint64_t total = 0;
+	for (uint32_t k = 0; k < KindCount; ++k) total += calls[k];
+	return total;
+}
+
+uint64_t GLState::Stats::total_elided() const {
+	uint64_t total = 0;
+	for (uint32_t k = 0; k < KindCount; ++k) total += elided[k];
+	return total;
+}
+
+void GLState::invalidate() {
+	program = -1U;
+	vertex_array = -1U;
+	buffers.clear();
+	capabilities.clear();
+	blend_sfactor = -1U;
+	blend_dfactor = -1U;
+	//(whatever changed state behind the cache's back may have set uniforms, too)
+	uniforms.clear();
+	program_uniforms = nullptr;
+}
+
+void GLState::forget_buffers(GLsizei count, GLuint const *buffers_) {
+	for (GLsizei i = 0; i < count; ++i) {
+		for (auto b = buffers.begin(); b != buffers.end(); /* later */) {
+			if (b->second == buffers_[i]) b = buffers.erase(b);
+			else ++b;
+		}
+	}
+}
+
+void GLState::forget_vertex_arrays(GLsizei count, GLuint const *arrays) {
+	for (GLsizei i = 0; i < count; ++i) {
+		if (arrays[i] == vertex_array) {
+			vertex_array = -1U;
+			buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+		}
+	}
+}
+
+void GLState::forget_program(GLuint program_) {
+	if (program_ == program) {
+		program = -1U;
+		program_uniforms = nullptr;
+	}
+	uniforms.erase(program_);
+}
+
+bool GLState::uniform_unchanged(GLint location, uint32_t tag, GLsizei count, void const *value, size_t bytes) {
+	++stats.calls[Uniform];
+	if (location < 0) {
+		//(GL ignores sets of unused uniforms anyway)
+		++stats.elided[Uniform];
+		return true;
+	}
+	if (!program_uniforms) return false; //(current program unknown)
+
+	if (count != 1) {
+		//(array sets cover 'count' locations; just forget them all)
+		for (size_t l = location; l < size_t(location) + size_t(std::max(count, 0)) && l < program_uniforms->size(); ++l) {
+			(*program_uniforms)[l].tag = -1U;
+		}
+		return false;
+	}
+	if (program_uniforms->size() <= size_t(location)) {
+		program_uniforms->resize(location + 1);
+	}
+	CachedUniform &cached = (*program_uniforms)[location];
+	if (cached.tag == tag && cached.value.size() == bytes && std::memcmp(cached.value.data(), value, bytes) == 0) {
+		++stats.elided[Uniform];
+		return true;
+	}
+	cached.tag = tag;
+	cached.value.assign(reinterpret_cast< uint8_t const * >(value), reinterpret_cast< uint8_t const * >(value) + bytes);
+	return false;
+}
+
+void GLState::report(std::ostream &out) const {
+	out << "GL state cache: skipped " << stats.total_elided() << " of " << stats.total_calls() << " state changes as redundant";
+	char const *sep = " (";
+	for (uint32_t k = 0; k < KindCount; ++k) {
+		if (stats.calls[k] == 0) continue;
+		out << sep << kind_name(Kind(k)) << ' ' << stats.elided[k] << '/' << stats.calls[k];
+		sep = ", ";
+	}
+	if (sep[0] == ',') out << ')';
+	out << "." << std::endl;
+}
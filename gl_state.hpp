@@ -0,0 +1,140 @@
+#pragma once
+
+//gl_state.hpp is a thin cache of OpenGL binding state -- the bound program, vertex array,
+// and buffers, enabled capabilities, the blend function, and (per program) uniform values --
+// so setting state that is already set doesn't reach the driver at all.
+//Draw code sets state with the gl_state_* functions below (named after the GL functions they
+// stand in for) and doesn't need to unbind things when it is done. Every call site in the
+// tree goes through the cache; code that changes this state directly must call
+// gl_state.invalidate() afterward.
+//(the gl_state_Uniform* functions are generated by 'make-gl-shims.py --state'; see gl_state_uniforms.hpp)
+
+#include "GL.hpp"
+
+#include <cstdint>
+#include <iostream>
+#include <unordered_map>
+#include <vector>
+
+struct GLState {
+	//kinds of state, for statistics:
+	enum Kind : uint32_t {
+		Program,
+		VertexArray,
+		Buffer,
+		Capability,
+		BlendFunc,
+		Uniform,
+		KindCount
+	};
+	static char const *kind_name(Kind kind);
+
+	//calls made through the cache, and how many of them were skipped as redundant:
+	struct Stats {
+		uint64_t calls[KindCount] = { 0 };
+		uint64_t elided[KindCount] = { 0 };
+		uint64_t total_calls() const;
+		uint64_t total_elided() const;
+	} stats;
+
+	//forget everything (the next call of each kind goes through to GL):
+	void invalidate();
+
+	//forget about objects being deleted (GL unbinds them, and may reuse their names):
+	void forget_buffers(GLsizei count, GLuint const *buffers);
+	void forget_vertex_arrays(GLsizei count, GLuint const *arrays);
+	void forget_program(GLuint program);
+
+	//uniforms: returns true if 'location' of the current program already holds 'bytes' of 'value'
+	// (set through the same function, per 'tag'); otherwise remembers the new value and returns false.
+	//Only single-element (count == 1) sets are cached; other sets go through and are forgotten.
+	bool uniform_unchanged(GLint location, uint32_t tag, GLsizei count, void const *value, size_t bytes);
+
+	void report(std::ostream &out) const;
+
+	//------- internals -------
+	//(-1U / -1 mean "unknown": whatever is there, the next call goes through)
+	GLuint program = -1U;
+	GLuint vertex_array = -1U;
+	std::unordered_map< GLenum, GLuint > buffers; //by target; missing means unknown
+	std::unordered_map< GLenum, bool > capabilities; //enabled or not; missing means unknown
+	GLenum blend_sfactor = -1U;
+	GLenum blend_dfactor = -1U;
+
+	struct CachedUniform {
+		uint32_t tag = -1U; //which function set it (-1U if unknown)
+		std::vector< uint8_t > value;
+	};
+	std::unordered_map< GLuint, std::vector< CachedUniform > > uniforms; //by program, then by location
+	std::vector< CachedUniform > *program_uniforms = nullptr; //the current program's (if known)
+
+	//counts a call of 'kind', returning true if it can be skipped:
+	bool elide(Kind kind, bool same) {
+		++stats.calls[kind];
+		if (same) ++stats.elided[kind];
+		return same;
+	}
+};
+
+extern GLState gl_state;
+
+inline void gl_state_UseProgram(GLuint program) {
+	if (gl_state.elide(GLState::Program, program == gl_state.program)) return;
+	glUseProgram(program);
+	gl_state.program = program;
+	gl_state.program_uniforms = (program != 0 ? &gl_state.uniforms[program] : nullptr);
+}
+
+inline void gl_state_BindVertexArray(GLuint array) {
+	if (gl_state.elide(GLState::VertexArray, array == gl_state.vertex_array)) return;
+	glBindVertexArray(array);
+	gl_state.vertex_array = array;
+	//(the element array binding belongs to the vertex array)
+	gl_state.buffers.erase(GL_ELEMENT_ARRAY_BUFFER);
+}
+
+inline void gl_state_BindBuffer(GLenum target, GLuint buffer) {
+	auto f = gl_state.buffers.find(target);
+	if (gl_state.elide(GLState::Buffer, f != gl_state.buffers.end() && f->second == buffer)) return;
+	glBindBuffer(target, buffer);
+	gl_state.buffers[target] = buffer;
+}
+
+inline void gl_state_Enable(GLenum cap) {
+	auto f = gl_state.capabilities.find(cap);
+	if (gl_state.elide(GLState::Capability, f != gl_state.capabilities.end() && f->second)) return;
+	glEnable(cap);
+	gl_state.capabilities[cap] = true;
+}
+
+inline void gl_state_Disable(GLenum cap) {
+	auto f = gl_state.capabilities.find(cap);
+	if (gl_state.elide(GLState::Capability, f != gl_state.capabilities.end() && !f->second)) return;
+	glDisable(cap);
+	gl_state.capabilities[cap] = false;
+}
+
+inline void gl_state_BlendFunc(GLenum sfactor, GLenum dfactor) {
+	if (gl_state.elide(GLState::BlendFunc, sfactor == gl_state.blend_sfactor && dfactor == gl_state.blend_dfactor)) return;
+	glBlendFunc(sfactor, dfactor);
+	gl_state.blend_sfactor = sfactor;
+	gl_state.blend_dfactor = dfactor;
+}
+
+//deleting objects through these keeps the cache from mistaking a reused name for a bound object:
+inline void gl_state_DeleteBuffers(GLsizei count, GLuint const *buffers) {
+	gl_state.forget_buffers(count, buffers);
+	glDeleteBuffers(count, buffers);
+}
+
+inline void gl_state_DeleteVertexArrays(GLsizei count, GLuint const *arrays) {
+	gl_state.forget_vertex_arrays(count, arrays);
+	glDeleteVertexArrays(count, arrays);
+}
+
+inline void gl_state_DeleteProgram(GLuint program) {
+	gl_state.forget_program(program);
+	glDeleteProgram(program);
+}
+
+#include "gl_state_uniforms.hpp"
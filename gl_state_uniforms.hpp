@@ -0,0 +1,151 @@
+#pragma once
+//NOTE: generated by 'make-gl-shims.py --state'; don't edit by hand.
+
+//gl_state_uniforms.hpp has a gl_state_Uniform* version of each glUniform* function (through 3.3)
+// that only calls through to GL when the value differs from what the current program's uniform
+// already holds (see gl_state.hpp, which includes this file).
+
+inline void gl_state_Uniform1f(GLint location, GLfloat v0) {
+	GLfloat const value[1] = { v0 };
+	if (gl_state.uniform_unchanged(location, 0, 1, value, sizeof(value))) return;
+	glUniform1f(location, v0);
+}
+inline void gl_state_Uniform2f(GLint location, GLfloat v0, GLfloat v1) {
+	GLfloat const value[2] = { v0, v1 };
+	if (gl_state.uniform_unchanged(location, 1, 1, value, sizeof(value))) return;
+	glUniform2f(location, v0, v1);
+}
+inline void gl_state_Uniform3f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2) {
+	GLfloat const value[3] = { v0, v1, v2 };
+	if (gl_state.uniform_unchanged(location, 2, 1, value, sizeof(value))) return;
+	glUniform3f(location, v0, v1, v2);
+}
+inline void gl_state_Uniform4f(GLint location, GLfloat v0, GLfloat v1, GLfloat v2, GLfloat v3) {
+	GLfloat const value[4] = { v0, v1, v2, v3 };
+	if (gl_state.uniform_unchanged(location, 3, 1, value, sizeof(value))) return;
+	glUniform4f(location, v0, v1, v2, v3);
+}
+inline void gl_state_Uniform1i(GLint location, GLint v0) {
+	GLint const value[1] = { v0 };
+	if (gl_state.uniform_unchanged(location, 4, 1, value, sizeof(value))) return;
+	glUniform1i(location, v0);
+}
+inline void gl_state_Uniform2i(GLint location, GLint v0, GLint v1) {
+	GLint const value[2] = { v0, v1 };
+	if (gl_state.uniform_unchanged(location, 5, 1, value, sizeof(value))) return;
+	glUniform2i(location, v0, v1);
+}
+inline void gl_state_Uniform3i(GLint location, GLint v0, GLint v1, GLint v2) {
+	GLint const value[3] = { v0, v1, v2 };
+	if (gl_state.uniform_unchanged(location, 6, 1, value, sizeof(value))) return;
+	glUniform3i(location, v0, v1, v2);
+}
+inline void gl_state_Uniform4i(GLint location, GLint v0, GLint v1, GLint v2, GLint v3) {
+	GLint const value[4] = { v0, v1, v2, v3 };
+	if (gl_state.uniform_unchanged(location, 7, 1, value, sizeof(value))) return;
+	glUniform4i(location, v0, v1, v2, v3);
+}
+inline void gl_state_Uniform1fv(GLint location, GLsizei count, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 8, count, value, 1 * sizeof(GLfloat))) return;
+	glUniform1fv(location, count, value);
+}
+inline void gl_state_Uniform2fv(GLint location, GLsizei count, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 9, count, value, 2 * sizeof(GLfloat))) return;
+	glUniform2fv(location, count, value);
+}
+inline void gl_state_Uniform3fv(GLint location, GLsizei count, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 10, count, value, 3 * sizeof(GLfloat))) return;
+	glUniform3fv(location, count, value);
+}
+inline void gl_state_Uniform4fv(GLint location, GLsizei count, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 11, count, value, 4 * sizeof(GLfloat))) return;
+	glUniform4fv(location, count, value);
+}
+inline void gl_state_Uniform1iv(GLint location, GLsizei count, const GLint *value) {
+	if (gl_state.uniform_unchanged(location, 12, count, value, 1 * sizeof(GLint))) return;
+	glUniform1iv(location, count, value);
+}
+inline void gl_state_Uniform2iv(GLint location, GLsizei count, const GLint *value) {
+	if (gl_state.uniform_unchanged(location, 13, count, value, 2 * sizeof(GLint))) return;
+	glUniform2iv(location, count, value);
+}
+inline void gl_state_Uniform3iv(GLint location, GLsizei count, const GLint *value) {
+	if (gl_state.uniform_unchanged(location, 14, count, value, 3 * sizeof(GLint))) return;
+	glUniform3iv(location, count, value);
+}
+inline void gl_state_Uniform4iv(GLint location, GLsizei count, const GLint *value) {
+	if (gl_state.uniform_unchanged(location, 15, count, value, 4 * sizeof(GLint))) return;
+	glUniform4iv(location, count, value);
+}
+inline void gl_state_UniformMatrix2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 16 + (transpose ? 1 : 0), count, value, 4 * sizeof(GLfloat))) return;
+	glUniformMatrix2fv(location, count, transpose, value);
+}
+inline void gl_state_UniformMatrix3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 18 + (transpose ? 1 : 0), count, value, 9 * sizeof(GLfloat))) return;
+	glUniformMatrix3fv(location, count, transpose, value);
+}
+inline void gl_state_UniformMatrix4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 20 + (transpose ? 1 : 0), count, value, 16 * sizeof(GLfloat))) return;
+	glUniformMatrix4fv(location, count, transpose, value);
+}
+inline void gl_state_UniformMatrix2x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 22 + (transpose ? 1 : 0), count, value, 6 * sizeof(GLfloat))) return;
+	glUniformMatrix2x3fv(location, count, transpose, value);
+}
+inline void gl_state_UniformMatrix3x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 24 + (transpose ? 1 : 0), count, value, 6 * sizeof(GLfloat))) return;
+	glUniformMatrix3x2fv(location, count, transpose, value);
+}
+inline void gl_state_UniformMatrix2x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 26 + (transpose ? 1 : 0), count, value, 8 * sizeof(GLfloat))) return;
+	glUniformMatrix2x4fv(location, count, transpose, value);
+}
+inline void gl_state_UniformMatrix4x2fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 28 + (transpose ? 1 : 0), count, value, 8 * sizeof(GLfloat))) return;
+	glUniformMatrix4x2fv(location, count, transpose, value);
+}
+inline void gl_state_UniformMatrix3x4fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 30 + (transpose ? 1 : 0), count, value, 12 * sizeof(GLfloat))) return;
+	glUniformMatrix3x4fv(location, count, transpose, value);
+}
+inline void gl_state_UniformMatrix4x3fv(GLint location, GLsizei count, GLboolean transpose, const GLfloat *value) {
+	if (gl_state.uniform_unchanged(location, 32 + (transpose ? 1 : 0), count, value, 12 * sizeof(GLfloat))) return;
+	glUniformMatrix4x3fv(location, count, transpose, value);
+}
+inline void gl_state_Uniform1ui(GLint location, GLuint v0) {
+	GLuint const value[1] = { v0 };
+	if (gl_state.uniform_unchanged(location, 34, 1, value, sizeof(value))) return;
+	glUniform1ui(location, v0);
+}
+inline void gl_state_Uniform2ui(GLint location, GLuint v0, GLuint v1) {
+	GLuint const value[2] = { v0, v1 };
+	if (gl_state.uniform_unchanged(location, 35, 1, value, sizeof(value))) return;
+	glUniform2ui(location, v0, v1);
+}
+inline void gl_state_Uniform3ui(GLint location, GLuint v0, GLuint v1, GLuint v2) {
+	GLuint const value[3] = { v0, v1, v2 };
+	if (gl_state.uniform_unchanged(location, 36, 1, value, sizeof(value))) return;
+	glUniform3ui(location, v0, v1, v2);
+}
+inline void gl_state_Uniform4ui(GLint location, GLuint v0, GLuint v1, GLuint v2, GLuint v3) {
+	GLuint const value[4] = { v0, v1, v2, v3 };
+	if (gl_state.uniform_unchanged(location, 37, 1, value, sizeof(value))) return;
+	glUniform4ui(location, v0, v1, v2, v3);
+}
+inline void gl_state_Uniform1uiv(GLint location, GLsizei count, const GLuint *value) {
+	if (gl_state.uniform_unchanged(location, 38, count, value, 1 * sizeof(GLuint))) return;
+	glUniform1uiv(location, count, value);
+}
+inline void gl_state_Uniform2uiv(GLint location, GLsizei count, const GLuint *value) {
+	if (gl_state.uniform_unchanged(location, 39, count, value, 2 * sizeof(GLuint))) return;
+	glUniform2uiv(location, count, value);
+}
+inline void gl_state_Uniform3uiv(GLint location, GLsizei count, const GLuint *value) {
+	if (gl_state.uniform_unchanged(location, 40, count, value, 3 * sizeof(GLuint))) return;
+	glUniform3uiv(location, count, value);
+}
+inline void gl_state_Uniform4uiv(GLint location, GLsizei count, const GLuint *value) {
+	if (gl_state.uniform_unchanged(location, 41, count, value, 4 * sizeof(GLuint))) return;
+	glUniform4uiv(location, count, value);
+}
@@ -0,0 +1,79 @@
+#include "headless_context.hpp"
+
+#include <EGL/egl.h>
+#include <EGL/eglext.h>
+
+#include <iostream>
+#include <stdexcept>
+#include <string>
+
+HeadlessContext::HeadlessContext() {
+	//Prefer Mesa's surfaceless platform (needs no display server), but fall back to the default display:
+	EGLDisplay egl_display = EGL_NO_DISPLAY;
+	auto eglGetPlatformDisplayEXT = (PFNEGLGETPLATFORMDISPLAYEXTPROC)eglGetProcAddress("eglGetPlatformDisplayEXT");
+	if (eglGetPlatformDisplayEXT) {
+		egl_display = eglGetPlatformDisplayEXT(EGL_PLATFORM_SURFACELESS_MESA, EGL_DEFAULT_DISPLAY, nullptr);
+	}
+	if (egl_display == EGL_NO_DISPLAY) {
+		egl_display = eglGetDisplay(EGL_DEFAULT_DISPLAY);
+	}
+	if (egl_display == EGL_NO_DISPLAY) {
+		throw std::runtime_error("Failed to get an EGL display.");
+	}
+
+	EGLint major = 0, minor = 0;
+	if (!eglInitialize(egl_display, &major, &minor)) {
+		throw std::runtime_error("Failed to initialize EGL (error " + std::to_string(eglGetError()) + ").");
+	}
+
+	char const *extensions = eglQueryString(egl_display, EGL_EXTENSIONS);
+	if (!extensions || std::string(extensions).find("EGL_KHR_surfaceless_context") == std::string::npos) {
+		std::cerr << "NOTE: EGL_KHR_surfaceless_context not advertised; context creation may fail." << std::endl;
+	}
+
+	if (!eglBindAPI(EGL_OPENGL_API)) {
+		eglTerminate(egl_display);
+		throw std::runtime_error("Failed to bind the desktop OpenGL API in EGL.");
+	}
+
+	//Ask for an OpenGL context version 4.5, falling back to 3.3, core profile (matching main.cpp):
+	EGLContext egl_context = EGL_NO_CONTEXT;
+	for (EGLint minor_version : { 5, 3 }) {
+		EGLint const context_attribs[] = {
+			EGL_CONTEXT_MAJOR_VERSION, (minor_version == 5 ? 4 : 3),
+			EGL_CONTEXT_MINOR_VERSION, minor_version,
+			EGL_CONTEXT_OPENGL_PROFILE_MASK, EGL_CONTEXT_OPENGL_CORE_PROFILE_BIT,
+			EGL_NONE
+		};
+		egl_context = eglCreateContext(egl_display, EGL_NO_CONFIG_KHR, EGL_NO_CONTEXT, context_attribs);
+		if (egl_context != EGL_NO_CONTEXT) break;
+	}
+	if (egl_context == EGL_NO_CONTEXT) {
+		EGLint err = eglGetError();
+		eglTerminate(egl_display);
+		throw std::runtime_error("Failed to create a headless OpenGL context (error " + std::to_string(err) + ").");
+	}
+
+	//no surface at all -- everything will be drawn into framebuffer objects:
+	if (!eglMakeCurrent(egl_display, EGL_NO_SURFACE, EGL_NO_SURFACE, egl_context)) {
+		EGLint err = eglGetError();
+		eglDestroyContext(egl_display, egl_context);
+		eglTerminate(egl_display);
+		throw std::runtime_error("Failed to make headless OpenGL context current (error " + std::to_string(err) + ").");
+	}
+
+	display = egl_display;
+	context = egl_context;
+}
+
+HeadlessContext::~HeadlessContext() {
+	eglMakeCurrent(display, EGL_NO_SURFACE, EGL_NO_SURFACE, EGL_NO_CONTEXT);
+	eglDestroyContext(display, context);
+	context = nullptr;
+	eglTerminate(display);
+	display = nullptr;
+}
+
+void *HeadlessContext::get_proc_address(char const *name) {
+	return (void *)eglGetProcAddress(name);
+}
@@ -0,0 +1,18 @@
+#pragma once
+
+//HeadlessContext creates an OpenGL 3.3 core context that isn't attached to any window.
+// (useful for tools that render to framebuffer objects and read the results back)
+//Uses EGL with a surfaceless (Mesa) display, so it works without an X server or a GPU.
+
+struct HeadlessContext {
+	//constructor makes the new context current on the calling thread; throws on failure:
+	HeadlessContext();
+	~HeadlessContext();
+
+	//look up an OpenGL (or EGL) entry point by name:
+	static void *get_proc_address(char const *name);
+
+	//EGLDisplay / EGLContext, stored as void * to keep EGL headers out of this one:
+	void *display = nullptr;
+	void *context = nullptr;
+};
@@ -1,9 +1,30 @@
 //Game.hpp declares the "game" object, which handles game-specific stuff:
 #include "Game.hpp"
 
+//FrameCapture.hpp declares a helper that records frames to disk without stalling the main loop:
+#include "FrameCapture.hpp"
+
+//FramePacing.hpp declares a helper that measures input-to-display latency and can schedule frames just before vsync:
+#include "FramePacing.hpp"
+
+//Profiler.hpp declares a CPU phase + GPU timer profiler with an on-screen overlay:
+#include "Profiler.hpp"
+
 //GL.hpp will include a non-namespace-polluting set of opengl prototypes:
 #include "GL.hpp"
 
+//RenderScale.hpp declares a helper that draws at a reduced resolution (and upscales) to keep GPU time on target:
+#include "RenderScale.hpp"
+
+//gl_debug.hpp declares a helper that reports OpenGL errors through a debug callback (instead of glGetError polling):
+#include "gl_debug.hpp"
+
+//gl_record.hpp declares a recorder that writes every OpenGL call to a file, for replaying with 'gl_replay':
+#include "gl_record.hpp"
+
+//gl_state.hpp declares a cache that skips redundant OpenGL state changes (and counts how many it skipped):
+#include "gl_state.hpp"
+
 //Includes for libSDL:
 #include <SDL.h>
 
@@ -19,20 +40,86 @@
 #include <fstream>
 #include <memory>
 #include <algorithm>
+#include <cstdlib>
 
 int main(int argc, char **argv) {
 	struct {
 		//TODO: this is where you set the title and size of your game window
 		std::string title = "TODO: Game Title";
 		glm::uvec2 size = glm::uvec2(640, 400);
+		//frame capture ("--capture png:<dir>" or "--capture y4m:<file>"; F12 toggles capture on/off):
+		FrameCapture::Format capture_format = FrameCapture::PNGSequence;
+		std::string capture_path = "captures";
+		bool capture_at_start = false;
+		//when nothing is animating, wait for input instead of redrawing every frame ("--no-idle" disables):
+		bool idle = true;
+		//frame pacing ("--pace" samples input just in time for vsync, "--latency" measures input-to-display latency):
+		bool pace = false;
+		bool latency = false;
+		//profiling ("--profile <file.csv>" profiles from the start and logs every frame; F3 toggles the overlay):
+		std::string profile_path = "";
+		bool profile_at_start = false;
+		//OpenGL call recording ("--record <file> <frames>"; needs a 'jam -sGL_RECORD=1' build):
+		std::string record_path = "";
+		uint32_t record_frames = 0;
+		//dynamic resolution ("--render-scale <floor>" draws at between floor and 1 times the drawable size,
+		// adjusted to keep GPU time per frame near "--render-target <ms>", by default 90% of the vsync interval):
+		float render_scale_floor = 0.0f; //(0 means off)
+		float render_target_ms = 0.0f;
+		//stick to the GL 3.3 drawing paths even when GL 4.5 is available ("--gl33"):
+		bool gl33 = false;
 	} config;
 
+	//------------  command line ------------
+
+	for (int argi = 1; argi < argc; ++argi) {
+		std::string arg = argv[argi];
+		if (arg == "--capture" && argi + 1 < argc) {
+			std::string spec = argv[++argi];
+			if (spec.substr(0, 4) == "png:") {
+				config.capture_format = FrameCapture::PNGSequence;
+			} else if (spec.substr(0, 4) == "y4m:") {
+				config.capture_format = FrameCapture::Y4M;
+			} else {
+				std::cerr << "Capture should be specified as 'png:<directory>' or 'y4m:<file>'." << std::endl;
+				return 1;
+			}
+			config.capture_path = spec.substr(4);
+			config.capture_at_start = true;
+		} else if (arg == "--no-idle") {
+			config.idle = false;
+		} else if (arg == "--pace") {
+			config.pace = true;
+		} else if (arg == "--latency") {
+			config.latency = true;
+		} else if (arg == "--profile" && argi + 1 < argc) {
+			config.profile_path = argv[++argi];
+			config.profile_at_start = true;
+		} else if (arg == "--record" && argi + 2 < argc) {
+			config.record_path = argv[++argi];
+			config.record_frames = uint32_t(std::max(1, std::atoi(argv[++argi])));
+		} else if (arg == "--render-scale" && argi + 1 < argc) {
+			config.render_scale_floor = float(std::atof(argv[++argi]));
+			if (!(config.render_scale_floor > 0.0f && config.render_scale_floor <= 1.0f)) {
+				std::cerr << "Render scale floor should be in (0,1]." << std::endl;
+				return 1;
+			}
+		} else if (arg == "--render-target" && argi + 1 < argc) {
+			config.render_target_ms = float(std::atof(argv[++argi]));
+		} else if (arg == "--gl33") {
+			config.gl33 = true;
+		} else {
+			std::cerr << "Usage:\n\t" << argv[0] << " [--capture png:<directory>|y4m:<file>] [--no-idle] [--pace] [--latency] [--profile <file.csv>] [--record <file> <frames>] [--render-scale <floor>] [--render-target <ms>] [--gl33]" << std::endl;
+			return 1;
+		}
+	}
+
 	//------------  initialization ------------
 
 	//Initialize SDL library:
 	SDL_Init(SDL_INIT_VIDEO);
 
-	//Ask for an OpenGL context version 3.3, core profile, enable debug:
+	//Ask for an OpenGL context version 4.5 (falling back to 3.3 below), core profile, enable debug:
 	SDL_GL_ResetAttributes();
 	SDL_GL_SetAttribute(SDL_GL_RED_SIZE, 8);
 	SDL_GL_SetAttribute(SDL_GL_GREEN_SIZE, 8);
@@ -42,9 +129,11 @@ int main(int argc, char **argv) {
 	SDL_GL_SetAttribute(SDL_GL_STENCIL_SIZE, 8);
 	SDL_GL_SetAttribute(SDL_GL_DOUBLEBUFFER, 1);
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_PROFILE_MASK, SDL_GL_CONTEXT_PROFILE_CORE);
+	#ifndef NDEBUG
 	SDL_GL_SetAttribute(SDL_GL_CONTEXT_FLAGS, SDL_GL_CONTEXT_DEBUG_FLAG);
-	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
-	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+	#endif
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, config.gl33 ? 3 : 4);
+	SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, config.gl33 ? 3 : 5);
 
 	//create window:
 	SDL_Window *window = SDL_CreateWindow(
@@ -65,6 +154,14 @@ int main(int argc, char **argv) {
 	//Create OpenGL context:
 	SDL_GLContext context = SDL_GL_CreateContext(window);
 
+	if (!context && !config.gl33) {
+		//(everything but InstancedShading's faster path only needs 3.3)
+		std::cerr << "NOTE: couldn't create an OpenGL 4.5 context (" << SDL_GetError() << "); trying 3.3." << std::endl;
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MAJOR_VERSION, 3);
+		SDL_GL_SetAttribute(SDL_GL_CONTEXT_MINOR_VERSION, 3);
+		context = SDL_GL_CreateContext(window);
+	}
+
 	if (!context) {
 		SDL_DestroyWindow(window);
 		std::cerr << "Error creating OpenGL context: " << SDL_GetError() << std::endl;
@@ -76,6 +173,11 @@ int main(int argc, char **argv) {
 	init_gl_shims();
 	#endif
 
+	//Report OpenGL errors as they happen, if the context can (otherwise GL_ERRORS() polls with glGetError):
+	if (!gl_debug_init()) {
+		std::cerr << "NOTE: no OpenGL debug output; checking for errors with glGetError." << std::endl;
+	}
+
 	//Set VSYNC + Late Swap (prevents crazy FPS):
 	if (SDL_GL_SetSwapInterval(-1) != 0) {
 		std::cerr << "NOTE: couldn't set vsync + late swap tearing (" << SDL_GetError() << ")." << std::endl;
@@ -84,14 +186,104 @@ int main(int argc, char **argv) {
 		}
 	}
 
+	//Frame pacing and idle stats need the display's refresh rate:
+	float refresh_rate = 60.0f;
+	{
+		SDL_DisplayMode display_mode;
+		if (SDL_GetWindowDisplayMode(window, &display_mode) == 0 && display_mode.refresh_rate > 0) {
+			refresh_rate = float(display_mode.refresh_rate);
+		}
+	}
+
+	//Record OpenGL calls from the start, so the recording creates every object its frames use:
+	if (config.record_path != "") {
+		int w, h;
+		SDL_GL_GetDrawableSize(window, &w, &h);
+		try {
+			gl_record_begin(config.record_path, config.record_frames, glm::uvec2(w, h));
+		} catch (std::exception &e) {
+			std::cerr << "Failed to start recording: " << e.what() << std::endl;
+			SDL_GL_DeleteContext(context);
+			SDL_DestroyWindow(window);
+			return 1;
+		}
+	}
+
 	//Hide mouse cursor (note: showing can be useful for debugging):
 	//SDL_ShowCursor(SDL_DISABLE);
 
 
 	//------------ create game object (loads assets) --------------
 
+	if (config.gl33) {
+		InstancedShading::allow_tier45 = false;
+		StreamBuffer::allow_persistent = false;
+	}
 	std::shared_ptr< Game > game = std::make_shared< Game >();
 
+	//------------ frame capture --------------
+
+	std::unique_ptr< FrameCapture > capture;
+	uint32_t capture_session = 0;
+	auto toggle_capture = [&]() {
+		if (capture) {
+			capture.reset();
+			return;
+		}
+		//every capture session after the first gets its own output name:
+		std::string path = config.capture_path;
+		if (capture_session > 0) {
+			std::string suffix = "-" + std::to_string(capture_session);
+			size_t dot = path.rfind('.');
+			if (config.capture_format == FrameCapture::Y4M && dot != std::string::npos) {
+				path = path.substr(0, dot) + suffix + path.substr(dot);
+			} else {
+				path += suffix;
+			}
+		}
+		++capture_session;
+		try {
+			capture.reset(new FrameCapture(config.capture_format, path));
+			std::cout << "Capturing frames to '" << path << "'." << std::endl;
+		} catch (std::exception &e) {
+			std::cerr << "Failed to start capture: " << e.what() << std::endl;
+		}
+	};
+	if (config.capture_at_start) toggle_capture();
+
+	//------------ frame pacing --------------
+
+	std::unique_ptr< FramePacing > pacing;
+	if (config.pace || config.latency) {
+		pacing.reset(new FramePacing(config.pace, config.latency, refresh_rate));
+	}
+
+	//------------ profiler --------------
+
+	std::unique_ptr< Profiler > profiler;
+	//F3 starts the profiler (which then runs until exit) and shows or hides its overlay:
+	auto toggle_profiler = [&]() {
+		if (profiler) {
+			profiler->show_overlay = !profiler->show_overlay;
+			return;
+		}
+		try {
+			profiler.reset(new Profiler(config.profile_path));
+			profiler->budget_ms = 1000.0f / refresh_rate;
+		} catch (std::exception &e) {
+			std::cerr << "Failed to start profiler: " << e.what() << std::endl;
+		}
+	};
+	if (config.profile_at_start) toggle_profiler();
+
+	//------------ dynamic resolution --------------
+
+	std::unique_ptr< RenderScale > render_scale;
+	if (config.render_scale_floor > 0.0f) {
+		float target_ms = (config.render_target_ms > 0.0f ? config.render_target_ms : 0.9f * 1000.0f / refresh_rate);
+		render_scale.reset(new RenderScale(config.render_scale_floor, target_ms));
+	}
+
 	//------------ main loop ------------
 
 	//the window created above is resizable; this inline function will be
@@ -110,32 +302,84 @@ int main(int argc, char **argv) {
 	};
 	on_resize();
 
+	//when idle, frames are only drawn if something has changed:
+	bool redraw = true; //set when an event changes the game or the window needs repainting
+	//idle stats, reported at exit:
+	uint32_t frames_drawn = 0;
+	float idle_seconds = 0.0f; //time spent waiting for events (converted to skipped frames with the refresh rate)
+
+	auto previous_time = std::chrono::high_resolution_clock::now();
+
 	//This will loop until the game object is set to null:
 	while (game) {
 		//every pass through the game loop creates one frame of output
 		//  by performing three steps:
 
+		if (profiler) profiler->begin_frame(); //(starts in the Wait phase)
+
 		{ //(1) process any events that are pending
 			static SDL_Event evt;
-			while (SDL_PollEvent(&evt) == 1) {
-				//handle resizing:
+			auto handle = [&]() {
+				//handle resizing + repainting:
 				if (evt.type == SDL_WINDOWEVENT && evt.window.event == SDL_WINDOWEVENT_SIZE_CHANGED) {
 					on_resize();
+					redraw = true;
+				}
+				if (evt.type == SDL_WINDOWEVENT && (evt.window.event == SDL_WINDOWEVENT_EXPOSED || evt.window.event == SDL_WINDOWEVENT_SHOWN || evt.window.event == SDL_WINDOWEVENT_RESTORED)) {
+					redraw = true;
+				}
+				//handle capture + profiler toggles:
+				if (evt.type == SDL_KEYDOWN && evt.key.repeat == 0 && evt.key.keysym.scancode == SDL_SCANCODE_F12) {
+					toggle_capture();
+					redraw = true;
+					return;
+				}
+				if (evt.type == SDL_KEYDOWN && evt.key.repeat == 0 && evt.key.keysym.scancode == SDL_SCANCODE_F3) {
+					toggle_profiler();
+					redraw = true;
+					return;
 				}
 				//handle input:
 				if (game && game->handle_event(evt, window_size)) {
 					// mode handled it; great
+					redraw = true;
+					if (pacing) pacing->input(evt.common.timestamp);
 				} else if (evt.type == SDL_QUIT) {
 					game.reset(); //done: deallocate game
-					break;
 				}
+			};
+
+			//if nothing is moving (and nothing is being recorded), sleep until something happens:
+			bool waited = false;
+			bool woken = false;
+			if (config.idle && !redraw && !capture && !game->animating()) {
+				auto before = std::chrono::high_resolution_clock::now();
+				//(the timeout is a safety net, and how often edited shader files are noticed; nothing in the game changes on its own when idle)
+				woken = (SDL_WaitEventTimeout(&evt, 500) == 1);
+				auto after = std::chrono::high_resolution_clock::now();
+				idle_seconds += std::chrono::duration< float >(after - before).count();
+				//the time spent waiting doesn't need to be simulated:
+				previous_time = after;
+				waited = true;
+			}
+			//when pacing, this sleeps until just enough time is left to update and draw before vsync:
+			if (pacing) pacing->wait_for_input();
+			Profiler::mark(Profiler::Events);
+			if (woken) handle();
+			while (game && SDL_PollEvent(&evt) == 1) {
+				handle();
 			}
 			if (!game) break;
+
+			//swap in shader programs recompiled from edited files:
+			if (game->shaders.update()) redraw = true;
+
+			//woke up, but nothing needs drawing:
+			if (waited && !redraw) continue;
 		}
 
 		{ //(2) call the game's "update" function to deal with elapsed time:
 			auto current_time = std::chrono::high_resolution_clock::now();
-			static auto previous_time = current_time;
 			float elapsed = std::chrono::duration< float >(current_time - previous_time).count();
 			previous_time = current_time;
 
@@ -143,28 +387,85 @@ int main(int argc, char **argv) {
 			//lag to avoid spiral of death:
 			elapsed = std::min(0.1f, elapsed);
 
+			Profiler::mark(Profiler::Update);
 			game->update(elapsed);
 			if (!game) break;
 		}
 
 		{ //(3) call the game's "draw" function to produce output:
+			//(the game marks the switch from building to submitting; the GPU is timed from the clear to the end of the game's draw)
+			Profiler::mark(Profiler::Build);
+			if (profiler) profiler->begin_gpu();
+
+			//draw into the (possibly reduced-size) framebuffer from the render scale, if there is one:
+			glm::uvec2 render_size = drawable_size;
+			if (render_scale) {
+				render_size = render_scale->begin(drawable_size);
+				if (profiler) profiler->set_render_scale(render_scale->scale);
+			}
+
 			//clear the depth+color buffers and set some default state:
 			glClearColor(0.5, 0.5, 0.5, 0.0);
 			glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
-			glEnable(GL_DEPTH_TEST);
-			glEnable(GL_BLEND);
-			glBlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+			gl_state_Enable(GL_DEPTH_TEST);
+			gl_state_Enable(GL_BLEND);
+			gl_state_BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+			game->draw(render_size);
+
+			if (render_scale) render_scale->end(drawable_size);
+
+			if (profiler) profiler->end_gpu();
 
-			game->draw(drawable_size);
+			//queue up a read of the frame, if capturing:
+			if (capture) capture->capture(drawable_size);
+
+			//(drawn after the capture, so recordings don't include it)
+			Profiler::mark(Profiler::Submit);
+			if (profiler) profiler->draw_overlay(drawable_size);
+
+			redraw = false;
+			++frames_drawn;
+
+			Profiler::mark(Profiler::Swap);
+			if (pacing) pacing->drawn();
 		}
 
 		//Finally, wait until the recently-drawn frame is shown before doing it all again:
 		SDL_GL_SwapWindow(window);
+		if (pacing) pacing->swapped();
+		gl_record_frame();
 	}
 
+	if (pacing) {
+		pacing->report(std::cout);
+	}
+
+	if (render_scale) {
+		render_scale->report(std::cout);
+	}
+
+	if (config.idle) {
+		//count every refresh spent waiting as a skipped frame:
+		float frames_skipped = idle_seconds * refresh_rate;
+		float total = frames_drawn + frames_skipped;
+		std::cout << "Idle rendering: drew " << frames_drawn << " frames, skipped about " << uint32_t(frames_skipped)
+			<< " (" << (total > 0.0f ? 100.0f * frames_skipped / total : 0.0f) << "%)." << std::endl;
+	}
+
+	gl_state.report(std::cout);
+
 
 	//------------  teardown ------------
 
+	capture.reset(); //(finishes writing any captured frames)
+	pacing.reset();
+	render_scale.reset();
+	profiler.reset(); //(finishes the log and prints a summary)
+	gl_record_end(); //(if stopped before recording every frame)
+
+	gl_debug_report();
+
 	SDL_GL_DeleteContext(context);
 	context = 0;
 
@@ -1,11 +1,16 @@
 #!/usr/bin/env python3
 
 #create gl_shims.hpp by parsing everything from glcorearb.h (why not the regsistry xml, hmmmm?) and selecting only things that are core through version 3_3.
+#with --counters, instead create gl_counters.hpp: wrappers for the same functions that count calls, bytes uploaded, and draws.
+#with --state, instead create gl_state_uniforms.hpp: gl_state_Uniform* versions of the glUniform* functions that skip sets of values a uniform already has.
+#with --record, instead create gl_record_calls.hpp: wrappers that write each call (and the data it points to) to a recording; with --replay, create gl_replay_calls.hpp, which reads the calls back and re-issues them.
 
 import re
+import sys
 
 protos = []
 extensions = []
+functions = [] #(return type, name without 'gl', parameter list) for every function through 3_3
 
 with open('glcorearb.h', 'r') as f:
 	in_version = None
@@ -20,7 +25,7 @@ with open('glcorearb.h', 'r') as f:
 				protos.append("\n// " + in_version + " prototypes:\n")
 				do_proto = True
 				do_extension = False
-			elif (major,minor) < (3,3):
+			elif (major,minor) <= (3,3):
 				extensions.append("\n// " + in_version + " extensions:\n")
 				do_proto = False
 				do_extension = True
@@ -28,6 +33,10 @@ with open('glcorearb.h', 'r') as f:
 				do_proto = False
 				do_extension = False
 		if in_version:
+			if do_proto or do_extension:
+				m = re.match(r"^GLAPI (.+?) ?APIENTRY gl([^ ]+) \((.*)\);$", line)
+				if m != None:
+					functions.append((m.group(1), m.group(2), m.group(3)))
 			if do_proto:
 				m = re.match(r"^GLAPI ", line)
 				if m != None:
@@ -45,6 +54,374 @@ with open('glcorearb.h', 'r') as f:
 			if m != None:
 				in_version = None
 
+#name of each parameter (the last identifier in its declaration):
+def param_names(params):
+	if params.strip() == "void": return []
+	return [re.findall(r"[A-Za-z_][A-Za-z_0-9]*", p)[-1] for p in params.split(",")]
+
+#--record / --replay: how each parameter is written to (and read back from) a recording.
+#each parameter gets a (kind, ...) tuple; functions with any parameter that can't be recorded are 'unsupported'.
+Namespaces = { "program": "Program", "shader": "Shader", "buffer": "Buffer", "array": "VertexArray", "framebuffer": "Framebuffer", "renderbuffer": "Renderbuffer", "texture": "Texture", "sampler": "Sampler", "id": "Query" }
+GenNamespaces = { "Buffers": "Buffer", "VertexArrays": "VertexArray", "Textures": "Texture", "Queries": "Query", "Renderbuffers": "Renderbuffer", "Framebuffers": "Framebuffer", "Samplers": "Sampler" }
+ElementTypes = { "b": "GLbyte", "s": "GLshort", "i": "GLint", "f": "GLfloat", "d": "GLdouble", "ub": "GLubyte", "us": "GLushort", "ui": "GLuint" }
+
+def split_param(p):
+	name = re.findall(r"[A-Za-z_][A-Za-z_0-9]*", p)[-1]
+	ctype = p[:p.rfind(name)].strip()
+	return (ctype, name)
+
+def classify(name, params):
+	ps = [split_param(p) for p in params.split(",")] if params.strip() != "void" else []
+	names = [n for (t, n) in ps]
+	kinds = []
+	for (ctype, pname) in ps:
+		pointer = "*" in ctype
+		const = ctype.startswith("const")
+		elem = ctype.replace("const", "").replace("*", "").strip()
+		k = None
+		if not pointer:
+			if ctype == "GLsync": k = ("sync",)
+			elif ctype == "GLuint" and pname in Namespaces and name != "BindBufferBase": k = ("name", Namespaces[pname])
+			elif ctype == "GLuint" and pname == "index" and "VertexAttrib" in name: k = ("attrib",)
+			elif ctype == "GLint" and pname == "location" and name.startswith("Uniform"): k = ("location",)
+			elif ctype in ["GLintptr", "GLsizeiptr"]: k = ("value", ctype, "int64_t")
+			else: k = ("value", ctype, ctype)
+		elif not const:
+			if name in ["ReadPixels"]: k = ("pixels_out", "gl_pixels_size(width, height, 1, format, type)")
+			elif name in ["GetTexImage", "GetCompressedTexImage"]: k = None
+			elif name.startswith("Gen") and name[3:] in GenNamespaces: k = ("names_out", GenNamespaces[name[3:]], names[0])
+			elif name == "GetBufferSubData": k = ("out", "size")
+			elif name in ["GetActiveUniformsiv", "GetUniformIndices"]: k = ("out", "uniformCount * 4")
+			else: k = ("out", "0")
+		elif ctype == "const GLchar *const*":
+			k = ("strings", names[names.index(pname) - 1])
+		elif ctype == "const void *const*":
+			k = ("offsets",)
+		elif elem == "GLchar":
+			k = ("string",)
+		elif name == "ShaderSource" and pname == "length":
+			k = ("skip",)
+		elif name.startswith("Delete") and name[6:] in GenNamespaces:
+			k = ("names_in", GenNamespaces[name[6:]], names[0])
+		elif elem == "void" and pname in ["pointer", "indices"]:
+			k = ("offset",)
+		elif name in ["BufferData", "BufferSubData"]:
+			k = ("data", "gl_record_count(size)")
+		elif re.match(r"^(TexImage|TexSubImage)[123]D$", name):
+			k = ("pixels_in", "gl_pixels_size(width, " + ("height" if "height" in names else "1") + ", " + ("depth" if "depth" in names else "1") + ", format, type)")
+		elif re.match(r"^Compressed", name):
+			k = ("pixels_in", "imageSize")
+		else:
+			count = None
+			m = re.match(r"^Uniform(\d)(f|i|ui)v$", name)
+			if m: count = "count * " + m.group(1)
+			m = re.match(r"^UniformMatrix(\d)(?:x(\d))?fv$", name)
+			if m: count = "count * " + str(int(m.group(1)) * int(m.group(2) or m.group(1)))
+			m = re.match(r"^VertexAttribI?(\d)N?(b|s|i|f|d|ub|us|ui)v$", name)
+			if m: count = m.group(1)
+			if re.match(r"^VertexAttribP\duiv$", name): count = "1"
+			if re.match(r"^(Tex|Sampler)Parameter", name): count = "(pname == GL_TEXTURE_BORDER_COLOR || pname == GL_TEXTURE_SWIZZLE_RGBA ? 4 : 1)"
+			if re.match(r"^PointParameter", name): count = "1"
+			if re.match(r"^ClearBuffer", name): count = "(buffer == GL_COLOR ? 4 : 1)"
+			if name == "DrawBuffers": count = "n"
+			if name.startswith("MultiDraw"): count = "drawcount"
+			if name == "GetActiveUniformsiv": count = "uniformCount"
+			if count != None: k = ("data", "gl_record_count(" + count + ") * sizeof(" + elem + ")")
+		if k == None: return None
+		kinds.append((ctype, pname, k))
+	return kinds
+
+def return_kind(ret, name):
+	if name in ["CreateProgram", "CreateShader"]: return ("name", name[6:])
+	if name == "FenceSync": return ("sync",)
+	if name == "GetUniformLocation": return ("location",)
+	if name == "GetAttribLocation": return ("attrib",)
+	if name in ["MapBuffer", "MapBufferRange"]: return ("map",)
+	return None
+
+def print_record():
+	print("""#pragma once
+//NOTE: generated by 'make-gl-shims.py --record'; don't edit by hand.
+
+//gl_record_calls.hpp wraps every core OpenGL (through 3.3) entry point with a version that, while
+// recording (see gl_record.hpp), writes the call and its parameters -- including the data behind
+// pointers, like buffer contents and shader source -- to the recording. It is only used when
+// GL_RECORD is defined (see GL.hpp); gl_replay_calls.hpp reads the calls back.
+
+#include <cstddef>
+#include <cstdint>
+
+extern bool gl_recording; //(set by gl_record_begin, cleared by gl_record_end)
+
+//writers used by the wrappers (gl_record.cpp):
+void gl_record_call(uint16_t call);
+void gl_record_bytes(void const *bytes, size_t size);
+template< typename T >
+inline void gl_record_value(T const &value) { gl_record_bytes(&value, sizeof(value)); }
+inline size_t gl_record_count(int64_t count) { return count > 0 ? size_t(count) : 0; }
+size_t gl_pixels_size(GLsizei width, GLsizei height, GLsizei depth, GLenum format, GLenum type); //(see gl_record.hpp)
+void gl_record_data(void const *data, size_t size); //(data may be null)
+void gl_record_string(char const *str);
+void gl_record_strings(GLsizei count, GLchar const *const *strs, GLint const *lengths);
+void gl_record_offsets(void const *const *offsets, GLsizei count);
+void gl_record_pixels(void const *pixels, size_t size); //(an offset, if a GL_PIXEL_UNPACK_BUFFER is bound)
+void gl_record_pixels_out(void *pixels); //(an offset, if a GL_PIXEL_PACK_BUFFER is bound)
+void gl_record_unsupported(uint16_t call);
+void gl_record_mapped(GLenum target, void *pointer, GLintptr offset, GLsizeiptr length, GLbitfield access);
+void gl_record_unmapping(GLenum target);
+void gl_record_flushing(GLenum target, GLintptr offset, GLsizeiptr length);
+
+enum GLRecordCall : uint16_t {""")
+	for (ret, name, params) in functions:
+		print("\tGLRecordCall_" + name + ",")
+	print("""\tGLRecordCallCount
+};
+extern char const *const GLRecordCallNames[GLRecordCallCount];
+
+//wrappers call the real entry points (so must be declared before the names are redirected):""")
+	for (ret, name, params) in functions:
+		args = ", ".join(param_names(params))
+		kinds = classify(name, params)
+		rk = return_kind(ret, name)
+		lines = []
+		if name == "UnmapBuffer": lines.append("\tif (gl_recording) gl_record_unmapping(target);")
+		if name == "FlushMappedBufferRange": lines.append("\tif (gl_recording) gl_record_flushing(target, offset, length);")
+		call = "gl" + name + "(" + args + ");"
+		lines.append("\t" + ("" if ret == "void" else ret + " ret = ") + call)
+		done = "return" + ("" if ret == "void" else " ret") + ";"
+		lines.append("\tif (!gl_recording) " + done)
+		if kinds == None:
+			lines.append("\tgl_record_unsupported(GLRecordCall_" + name + ");")
+		else:
+			lines.append("\tgl_record_call(GLRecordCall_" + name + ");")
+			for (ctype, pname, k) in kinds:
+				if k[0] == "value" and k[2] != ctype: lines.append("\tgl_record_value(" + k[2] + "(" + pname + "));")
+				elif k[0] in ["value", "name", "attrib", "location"]: lines.append("\tgl_record_value(" + pname + ");")
+				elif k[0] == "sync": lines.append("\tgl_record_value(uint64_t(uintptr_t(" + pname + ")));")
+				elif k[0] == "data": lines.append("\tgl_record_data(" + pname + ", " + k[1] + ");")
+				elif k[0] in ["names_in", "names_out"]: lines.append("\tgl_record_data(" + pname + ", gl_record_count(" + k[2] + ") * sizeof(GLuint));")
+				elif k[0] == "offset": lines.append("\tgl_record_value(uint64_t(uintptr_t(" + pname + ")));")
+				elif k[0] == "offsets": lines.append("\tgl_record_offsets(" + pname + ", drawcount);")
+				elif k[0] == "string": lines.append("\tgl_record_string(" + pname + ");")
+				elif k[0] == "strings": lines.append("\tgl_record_strings(" + k[1] + ", " + pname + ", " + ("length" if name == "ShaderSource" else "nullptr") + ");")
+				elif k[0] == "pixels_in": lines.append("\tgl_record_pixels(" + pname + ", " + k[1] + ");")
+				elif k[0] == "pixels_out": lines.append("\tgl_record_pixels_out(" + pname + ");")
+				elif k[0] in ["out", "skip"]: pass
+				else: assert False, k
+			if rk != None and rk[0] == "sync": lines.append("\tgl_record_value(uint64_t(uintptr_t(ret)));")
+			elif rk != None and rk[0] != "map": lines.append("\tgl_record_value(ret);")
+		if name == "MapBuffer": lines.append("\tgl_record_mapped(target, ret, 0, -1, access);")
+		if name == "MapBufferRange": lines.append("\tgl_record_mapped(target, ret, offset, length, access);")
+		if ret != "void": lines.append("\treturn ret;")
+		print("inline " + ret + " APIENTRY gl_recorded_" + name + "(" + params + ") {")
+		print("\n".join(lines))
+		print("}")
+	print("""
+//every use of a GL function now goes through its wrapper (except in gl_record.cpp, which needs the real ones):
+#ifndef GL_RECORD_IMPLEMENTATION""")
+	for (ret, name, params) in functions:
+		print("#define gl" + name + " gl_recorded_" + name)
+	print("""#endif
+
+#ifdef GL_RECORD_IMPLEMENTATION
+char const *const GLRecordCallNames[GLRecordCallCount] = {""")
+	for (ret, name, params) in functions:
+		print("\t\"gl" + name + "\",")
+	print("};")
+	print("#endif //GL_RECORD_IMPLEMENTATION")
+
+def print_replay():
+	print("""#pragma once
+//NOTE: generated by 'make-gl-shims.py --replay'; don't edit by hand.
+
+//gl_replay_calls.hpp reads back calls written by gl_record_calls.hpp's wrappers and re-issues them.
+//It must be included after the GLReplay type (see gl_replay.cpp) that reads parameters from the
+// recording and maps recorded object names, uniform locations, and syncs to the ones created while replaying.
+
+#include <cstdint>
+
+//names of the calls, by id (a recording lists the names it was made with, so they can be checked):
+static char const *const GLReplayCallNames[] = {""")
+	for (ret, name, params) in functions:
+		print("\t\"gl" + name + "\",")
+	print("""};
+
+//read the parameters of 'call' and issue it:
+inline void gl_replay_call(GLReplay &replay, uint16_t call) {
+	switch (call) {""")
+	for (i, (ret, name, params)) in enumerate(functions):
+		kinds = classify(name, params)
+		rk = return_kind(ret, name)
+		print("\tcase " + str(i) + ": { //gl" + name)
+		if kinds == None:
+			print("\t\treplay.unsupported(call);")
+			print("\t\tbreak;")
+			print("\t}")
+			continue
+		after = []
+		for (ctype, pname, k) in kinds:
+			if k[0] == "value" and k[2] == ctype: print("\t\t" + ctype + " " + pname + " = replay.value< " + ctype + " >();")
+			elif k[0] == "value": print("\t\t" + ctype + " " + pname + " = " + ctype + "(replay.value< " + k[2] + " >());")
+			elif k[0] == "name":
+				print("\t\tGLuint " + pname + "_recorded = replay.value< GLuint >();")
+				print("\t\tGLuint " + pname + " = replay.name(GLReplay::" + k[1] + ", " + pname + "_recorded);")
+			elif k[0] == "attrib": print("\t\tGLuint " + pname + " = replay.attrib(replay.value< GLuint >());")
+			elif k[0] == "location": print("\t\tGLint " + pname + " = replay.location(replay.value< GLint >());")
+			elif k[0] == "sync": print("\t\tGLsync " + pname + " = replay.sync(replay.value< uint64_t >());")
+			elif k[0] == "data": print("\t\t" + ctype + pname + " = (" + ctype + ")replay.data();")
+			elif k[0] == "names_in": print("\t\t" + ctype + pname + " = replay.names(GLReplay::" + k[1] + ");")
+			elif k[0] == "names_out":
+				print("\t\tGLuint const *" + pname + "_recorded = (GLuint const *)replay.data();")
+				print("\t\t" + ctype + pname + " = (" + ctype + ")replay.scratch(replay.count(" + k[2] + ") * sizeof(GLuint));")
+				after.append("\t\treplay.bind_names(GLReplay::" + k[1] + ", " + k[2] + ", " + pname + "_recorded, " + pname + ");")
+			elif k[0] == "offset": print("\t\t" + ctype + pname + " = (" + ctype + ")uintptr_t(replay.value< uint64_t >());")
+			elif k[0] == "offsets": print("\t\t" + ctype + pname + " = replay.offsets();")
+			elif k[0] == "string": print("\t\t" + ctype + pname + " = replay.string();")
+			elif k[0] == "strings": print("\t\t" + ctype + pname + " = replay.strings();")
+			elif k[0] == "skip": print("\t\t" + ctype + pname + " = nullptr;")
+			elif k[0] == "pixels_in": print("\t\t" + ctype + pname + " = replay.pixels();")
+			elif k[0] == "pixels_out": print("\t\t" + ctype + pname + " = replay.pixels_out(" + k[1] + ");")
+			elif k[0] == "out": print("\t\t" + ctype + pname + " = (" + ctype + ")replay.scratch(" + k[1] + ");")
+			else: assert False, k
+		args = ", ".join(param_names(params))
+		call = "gl" + name + "(" + args + ");"
+		if ret == "void" or rk == None:
+			print("\t\t" + call)
+		else:
+			print("\t\t" + ret + " ret = " + call)
+			if rk[0] == "name": print("\t\treplay.bind_name(GLReplay::" + rk[1] + ", replay.value< GLuint >(), ret);")
+			elif rk[0] == "sync": print("\t\treplay.bind_sync(replay.value< uint64_t >(), ret);")
+			elif rk[0] == "location": print("\t\treplay.bind_location(program_recorded, replay.value< GLint >(), ret);")
+			elif rk[0] == "attrib": print("\t\treplay.bind_attrib(replay.value< GLint >(), ret);")
+			elif rk[0] == "map": print("\t\treplay.mapped(target, ret);")
+		if name == "UseProgram": after.append("\t\treplay.current_program = program_recorded;")
+		if name == "UnmapBuffer": after.append("\t\treplay.mapped(target, nullptr);")
+		for a in after: print(a)
+		print("\t\tbreak;")
+		print("\t}")
+	print("""	default: {
+		replay.unknown(call);
+		break;
+	}
+	}
+}""")
+
+if "--record" in sys.argv:
+	print_record()
+	sys.exit(0)
+
+if "--replay" in sys.argv:
+	print_replay()
+	sys.exit(0)
+
+if "--state" in sys.argv:
+	print("""#pragma once
+//NOTE: generated by 'make-gl-shims.py --state'; don't edit by hand.
+
+//gl_state_uniforms.hpp has a gl_state_Uniform* version of each glUniform* function (through 3.3)
+// that only calls through to GL when the value differs from what the current program's uniform
+// already holds (see gl_state.hpp, which includes this file).
+""")
+	types = { "f": "GLfloat", "i": "GLint", "ui": "GLuint" }
+	tag = 0
+	for (ret, name, params) in functions:
+		names = param_names(params)
+		args = ", ".join(names)
+		m = re.match(r"^Uniform(\d)(f|i|ui)(v?)$", name)
+		mat = re.match(r"^UniformMatrix(\d)(?:x(\d))?fv$", name)
+		if m != None:
+			n = int(m.group(1))
+			t = types[m.group(2)]
+			print("inline void gl_state_" + name + "(" + params + ") {")
+			if m.group(3) == "v":
+				print("\tif (gl_state.uniform_unchanged(location, " + str(tag) + ", count, value, " + str(n) + " * sizeof(" + t + "))) return;")
+			else:
+				print("\t" + t + " const value[" + str(n) + "] = { " + ", ".join(names[1:]) + " };")
+				print("\tif (gl_state.uniform_unchanged(location, " + str(tag) + ", 1, value, sizeof(value))) return;")
+			print("\tgl" + name + "(" + args + ");")
+			print("}")
+			tag += 1
+		elif mat != None:
+			n = int(mat.group(1)) * int(mat.group(2) or mat.group(1))
+			#(transposed and untransposed sets of the same bytes are different values, so they get different tags)
+			print("inline void gl_state_" + name + "(" + params + ") {")
+			print("\tif (gl_state.uniform_unchanged(location, " + str(tag) + " + (transpose ? 1 : 0), count, value, " + str(n) + " * sizeof(GLfloat))) return;")
+			print("\tgl" + name + "(" + args + ");")
+			print("}")
+			tag += 2
+	sys.exit(0)
+
+if "--counters" in sys.argv:
+
+	#extra accounting for functions that upload data or draw:
+	def extra(name, params):
+		names = param_names(params)
+		m = re.match(r"^Uniform(\d)(f|i|ui)(v?)$", name)
+		if m != None:
+			n = int(m.group(1)) * 4
+			if m.group(3) == "v": return "gl_counters.uniform_bytes += uint64_t(count) * " + str(n) + ";"
+			return "gl_counters.uniform_bytes += " + str(n) + ";"
+		m = re.match(r"^UniformMatrix(\d)(?:x(\d))?fv$", name)
+		if m != None:
+			n = int(m.group(1)) * int(m.group(2) or m.group(1)) * 4
+			return "gl_counters.uniform_bytes += uint64_t(count) * " + str(n) + ";"
+		#(glBufferData with no data only allocates or orphans storage, so it uploads nothing)
+		if name == "BufferData":
+			return "if (data) gl_counters.buffer_bytes += uint64_t(size);"
+		if name == "BufferSubData":
+			return "gl_counters.buffer_bytes += uint64_t(size);"
+		if name.startswith("MultiDraw"):
+			return "gl_counters.draws += uint64_t(drawcount); for (GLsizei i = 0; i < drawcount; ++i) gl_counters.vertices += uint64_t(count[i]);"
+		if re.match(r"^Draw(Arrays|Elements|RangeElements)", name) and "count" in names:
+			if "instancecount" in names:
+				return "gl_counters.draws += 1; gl_counters.vertices += uint64_t(count) * uint64_t(instancecount);"
+			return "gl_counters.draws += 1; gl_counters.vertices += uint64_t(count);"
+		return ""
+
+	print("""#pragma once
+//NOTE: generated by 'make-gl-shims.py --counters'; don't edit by hand.
+
+//gl_counters.hpp wraps every core OpenGL (through 3.3) entry point with a version that counts
+// calls (per entry point), bytes uploaded through glBuffer*Data and glUniform*, and draw calls
+// and vertices. It is only used when GL_COUNTERS is defined (see GL.hpp); the Profiler reads
+// and resets the counts once per frame.
+
+#include <cstdint>
+
+enum GLCounter : uint32_t {""")
+	for (ret, name, params) in functions:
+		print("\tGLCounter_" + name + ",")
+	print("""\tGLCounterCount
+};
+
+struct GLCounters {
+	uint64_t calls[GLCounterCount]; //calls to each entry point
+	uint64_t buffer_bytes; //bytes uploaded through glBufferData/glBufferSubData (not counting allocations without data)
+	uint64_t uniform_bytes; //bytes passed to glUniform*
+	uint64_t draws; //draw calls (each draw in a multi-draw counts)
+	uint64_t vertices; //vertices drawn (times instances)
+};
+extern GLCounters gl_counters;
+extern char const *const GLCounterNames[GLCounterCount]; //(entry point names, including 'gl')
+
+//wrappers call the real entry points (so must be declared before the names are redirected):""")
+	for (ret, name, params) in functions:
+		args = ", ".join(param_names(params))
+		print("inline " + ret + " APIENTRY gl_counted_" + name + "(" + params + ") { ++gl_counters.calls[GLCounter_" + name + "]; " + (extra(name, params) + " " if extra(name, params) else "") + "return gl" + name + "(" + args + "); }")
+	print("")
+	print("//every use of a GL function now goes through its wrapper:")
+	for (ret, name, params) in functions:
+		print("#define gl" + name + " gl_counted_" + name)
+	print("""
+#ifdef GL_COUNTERS_IMPLEMENTATION
+GLCounters gl_counters;
+char const *const GLCounterNames[GLCounterCount] = {""")
+	for (ret, name, params) in functions:
+		print("\t\"gl" + name + "\",")
+	print("};")
+	print("#endif //GL_COUNTERS_IMPLEMENTATION")
+	sys.exit(0)
+
 print("""#ifndef GL_SHIMS_HPP
 #define GL_SHIMS_HPP 1
 
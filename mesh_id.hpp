@@ -0,0 +1,17 @@
+#pragma once
+
+#include <cstdint>
+
+//mesh_id turns a mesh name into the 32-bit id that mesh tables (see MeshBlob) are keyed on.
+//It is constexpr, so names written in code are hashed at compile time:
+//   constexpr uint32_t Wall = mesh_id("Wall");
+//It is 32-bit FNV-1a, the same hash export-meshes.py uses to build the blob's "ids0" table.
+//Since the hash runs front-to-back, passing one id as 'hash' continues it with more characters:
+//   mesh_id(".lod", mesh_id("Wall")) == mesh_id("Wall.lod")
+constexpr uint32_t mesh_id(char const *name, uint32_t hash = 2166136261U) {
+	return *name ? mesh_id(name + 1, (hash ^ uint8_t(*name)) * 16777619U) : hash;
+}
+//same, for names that aren't zero-terminated:
+constexpr uint32_t mesh_id(char const *begin, char const *end, uint32_t hash = 2166136261U) {
+	return begin != end ? mesh_id(begin + 1, end, (hash ^ uint8_t(*begin)) * 16777619U) : hash;
+}
@@ -21,6 +21,7 @@ outfile = args[1]
 
 import bpy, mathutils
 import struct
+import zlib
 
 import argparse
 
@@ -34,14 +35,16 @@ for obj in bpy.data.objects:
 	if obj.type == 'MESH':
 		to_write.append(obj.name)
 
+#(bytearrays, so appending to them doesn't copy everything written so far)
+
 #data contains vertex and normal data from the meshes:
-data = b''
+data = bytearray()
 
 #strings contains the mesh names:
-strings = b''
+strings = bytearray()
 
 #index gives offsets into the data (and names) for each mesh:
-index = b''
+index = bytearray()
 
 vertex_count = 0
 for name in to_write:
@@ -121,21 +124,62 @@ for name in to_write:
 #check that we wrote as much data as anticipated:
 assert(vertex_count * (4*3+4*3+4*1) == len(data))
 
-#write the data chunk and index chunk to an output blob:
+#perfect hash table from mesh name ids to vertex ranges, so the game can find meshes without comparing names:
+# (same id and table layout as mesh_id.hpp and MeshBlob::build_table)
+def mesh_id(name):
+	h = 2166136261
+	for b in name:
+		h = ((h ^ b) * 16777619) & 0xffffffff
+	return h
+
+def mesh_table(entries):
+	#entries is a list of (id, vertex_begin, vertex_end):
+	ids = [e[0] for e in entries]
+	assert len(set(ids)) == len(ids), "two meshes have the same name (or id)"
+	bits = 1
+	while (1 << bits) < 2 * len(entries): bits += 1
+	while bits <= 24:
+		for attempt in range(0, 1000):
+			multiplier = (0x9e3779b1 + 2 * attempt) & 0xffffffff
+			slots = [None] * (1 << bits)
+			for e in entries:
+				slot = ((e[0] * multiplier) & 0xffffffff) >> (32 - bits)
+				if slots[slot] != None: break
+				slots[slot] = e
+			else:
+				table = struct.pack('<II', bits, multiplier)
+				for e in slots:
+					table += struct.pack('<IIII', e[0], 1, e[1], e[2] - e[1]) if e != None else struct.pack('<IIII', 0, 0, 0, 0)
+				return table
+		bits += 1
+	assert False, "couldn't build a mesh id table"
+
+ids = mesh_table([
+	(mesh_id(strings[b:e]), vb, ve) for (b, e, vb, ve) in struct.iter_unpack('IIII', index)
+])
+
+#write the data, strings, index, and id table chunks to an output blob:
+# "toc0", chunk count, then a table of contents entry (type, CRC-32, offset, size) per chunk,
+# then the chunks' data, each starting at a multiple of 16 bytes (so it can be used in place; see BlobFile.hpp)
+chunks = [
+	(b'dat0', data),
+	(b'str0', strings),
+	(b'idx0', index),
+	(b'ids0', ids),
+]
+def align16(x):
+	return (x + 15) // 16 * 16
+
+toc = struct.pack('<4sI', b'toc0', len(chunks))
+body = b''
+offset = align16(len(toc) + 24 * len(chunks))
+for (type, chunk) in chunks:
+	toc += struct.pack('<4sIQQ', type, zlib.crc32(chunk) & 0xffffffff, offset + len(body), len(chunk))
+	body += chunk + b'\0' * (align16(len(chunk)) - len(chunk))
+
 blob = open(outfile, 'wb')
-#first chunk: the data
-blob.write(struct.pack('4s',b'dat0')) #type
-blob.write(struct.pack('I', len(data))) #length
-blob.write(data)
-#second chunk: the strings
-blob.write(struct.pack('4s',b'str0')) #type
-blob.write(struct.pack('I', len(strings))) #length
-blob.write(strings)
-#third chunk: the index
-blob.write(struct.pack('4s',b'idx0')) #type
-blob.write(struct.pack('I', len(index))) #length
-blob.write(index)
-
-print("Wrote " + str(blob.tell()) + " bytes [== " + str(len(data)+8) + " bytes of data + " + str(len(strings)+8) + " bytes of strings + " + str(len(index)+8) + " bytes of index] to '" + outfile + "'")
-
-blob.close()
+blob.write(toc)
+blob.write(b'\0' * (offset - len(toc)))
+blob.write(body)
+
+print("Wrote " + str(blob.tell()) + " bytes [== " + str(len(data)) + " bytes of data + " + str(len(strings)) + " bytes of strings + " + str(len(index)) + " bytes of index + " + str(len(ids)) + " bytes of id table, plus table of contents and padding] to '" + outfile + "'")
@@ -0,0 +1,307 @@
+//optimize_meshes rewrites a meshes blob into the form the game draws fastest, so that work happens once,
+// when the blob is built, instead of every time the game starts:
+// usage: optimize_meshes [--compress] <in.blob> <out.blob>
+//
+//For each mesh (including the low-detail versions MeshBlob::add_low_detail_meshes makes, which are baked in):
+// - vertices are converted to MeshBlob::Vertex (normals quantized to 10 bits per axis),
+// - identical vertices are welded, and an index buffer built (degenerate triangles are dropped),
+// - triangles are reordered so the GPU's post-transform vertex cache gets more hits,
+// - vertices are reordered into the order the triangles first use them (so fetches walk forward),
+// - bounds are computed.
+//The output has the names, index ("idx1"), and id table up front, with the vertex ("vtx1") and
+// index ("ind1") data after them, each starting on its own page (or, with --compress, deflated; see
+// BlobFile.hpp); see MeshBlob.hpp for the layout.
+
+#include "MeshBlob.hpp"
+#include "BlobFile.hpp"
+
+#include <glm/glm.hpp>
+
+#include <algorithm>
+#include <cmath>
+#include <cstring>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <unordered_map>
+#include <vector>
+
+//average vertex shader runs per triangle with a first-in-first-out post-transform cache of 'size' vertices
+// (1.0 would mean every vertex is shaded exactly once; triangle soup is 3.0):
+static float acmr(std::vector< uint32_t > const &triangles, uint32_t size) {
+	if (triangles.empty()) return 0.0f;
+	std::vector< uint32_t > cache;
+	uint32_t misses = 0;
+	for (uint32_t v : triangles) {
+		if (std::find(cache.begin(), cache.end(), v) != cache.end()) continue;
+		++misses;
+		cache.emplace_back(v);
+		if (cache.size() > size) cache.erase(cache.begin());
+	}
+	return float(misses) / float(triangles.size() / 3);
+}
+
+//Tom Forsyth's "Linear-Speed Vertex Cache Optimisation": greedily emit the triangle whose vertices score best,
+// where vertices score for being near the front of a (simulated, least-recently-used) cache and for having
+// few triangles left (so stragglers get finished off rather than left for a cache miss later):
+static std::vector< uint32_t > optimize_triangle_order(std::vector< uint32_t > const &triangles, uint32_t vertex_count) {
+	constexpr int32_t CacheSize = 32;
+	auto vertex_score = [](int32_t position, uint32_t remaining) {
+		if (remaining == 0) return -1.0f; //(no triangles left to use it)
+		float score = 0.0f;
+		if (position >= 0) {
+			//(the last triangle's vertices get a fixed score, so the next triangle doesn't just reuse one edge forever)
+			if (position < 3) score = 0.75f;
+			else score = std::pow(1.0f - float(position - 3) / float(CacheSize - 3), 1.5f);
+		}
+		return score + 2.0f * std::pow(float(remaining), -0.5f);
+	};
+
+	uint32_t triangle_count = uint32_t(triangles.size() / 3);
+
+	//triangles using each vertex (vertex v's are [first[v], first[v] + remaining[v]); used ones get swapped to the end):
+	std::vector< uint32_t > first(vertex_count + 1, 0);
+	for (uint32_t v : triangles) ++first[v + 1];
+	for (uint32_t v = 0; v < vertex_count; ++v) first[v + 1] += first[v];
+	std::vector< uint32_t > remaining(vertex_count, 0);
+	std::vector< uint32_t > uses(triangles.size());
+	for (uint32_t t = 0; t < triangle_count; ++t) {
+		for (uint32_t k = 0; k < 3; ++k) {
+			uint32_t v = triangles[3 * t + k];
+			uses[first[v] + remaining[v]] = t;
+			++remaining[v];
+		}
+	}
+
+	std::vector< int32_t > position(vertex_count, -1);
+	std::vector< float > score(vertex_count);
+	for (uint32_t v = 0; v < vertex_count; ++v) score[v] = vertex_score(-1, remaining[v]);
+	std::vector< float > triangle_score(triangle_count);
+	std::vector< bool > emitted(triangle_count, false);
+	for (uint32_t t = 0; t < triangle_count; ++t) {
+		triangle_score[t] = score[triangles[3 * t]] + score[triangles[3 * t + 1]] + score[triangles[3 * t + 2]];
+	}
+
+	std::vector< uint32_t > order;
+	order.reserve(triangles.size());
+	std::vector< uint32_t > cache, next_cache;
+	uint32_t best = -1U;
+	uint32_t scan_from = 0; //(triangles before this have all been emitted)
+	while (order.size() < triangles.size()) {
+		if (best == -1U) {
+			//nothing in the cache has triangles left, so start somewhere new with the best triangle anywhere:
+			while (emitted[scan_from]) ++scan_from;
+			best = scan_from;
+			for (uint32_t t = scan_from; t < triangle_count; ++t) {
+				if (!emitted[t] && triangle_score[t] > triangle_score[best]) best = t;
+			}
+		}
+
+		//emit it:
+		emitted[best] = true;
+		for (uint32_t k = 0; k < 3; ++k) {
+			uint32_t v = triangles[3 * best + k];
+			order.emplace_back(v);
+			uint32_t *used = &uses[first[v]];
+			uint32_t at = uint32_t(std::find(used, used + remaining[v], best) - used);
+			std::swap(used[at], used[remaining[v] - 1]);
+			--remaining[v];
+		}
+
+		//its vertices go to the front of the cache:
+		next_cache.assign(triangles.begin() + 3 * best, triangles.begin() + 3 * best + 3);
+		for (uint32_t v : cache) {
+			if (std::find(next_cache.begin(), next_cache.begin() + 3, v) == next_cache.begin() + 3) next_cache.emplace_back(v);
+		}
+		//(vertices pushed out of the cache lose their cache score)
+		for (uint32_t i = CacheSize; i < next_cache.size(); ++i) {
+			position[next_cache[i]] = -1;
+			score[next_cache[i]] = vertex_score(-1, remaining[next_cache[i]]);
+		}
+		if (next_cache.size() > uint32_t(CacheSize)) next_cache.resize(CacheSize);
+		std::swap(cache, next_cache);
+		for (uint32_t i = 0; i < cache.size(); ++i) {
+			position[cache[i]] = int32_t(i);
+			score[cache[i]] = vertex_score(int32_t(i), remaining[cache[i]]);
+		}
+
+		//rescore triangles using cached vertices, and pick the best of them next:
+		best = -1U;
+		for (uint32_t v : cache) {
+			for (uint32_t u = first[v]; u < first[v] + remaining[v]; ++u) {
+				uint32_t t = uses[u];
+				triangle_score[t] = score[triangles[3 * t]] + score[triangles[3 * t + 1]] + score[triangles[3 * t + 2]];
+				if (best == -1U || triangle_score[t] > triangle_score[best]) best = t;
+			}
+		}
+	}
+	return order;
+}
+
+int main(int argc, char **argv) {
+	bool compress = (argc == 4 && std::string(argv[1]) == "--compress");
+	if (argc != 3 && !compress) {
+		std::cerr << "Usage:\n\t" << argv[0] << " [--compress] <in.blob> <out.blob>\n"
+			"Welds, indexes, reorders, and quantizes the meshes in <in.blob> (e.g., as written by export-meshes.py) and writes them to <out.blob>,\n"
+			"with the vertex and index data deflated if --compress is given." << std::endl;
+		return 1;
+	}
+	std::string in_file = argv[argc - 2];
+	std::string out_file = argv[argc - 1];
+
+	try {
+		std::vector< MeshBlob::Vertex > vertices;
+		std::vector< MeshBlob::Index > indices;
+		std::string names;
+		std::vector< MeshBlob::OptimizedEntry > index;
+		std::vector< uint32_t > ids;
+
+		{ //(the input is unmapped before the output is written, in case they're the same file)
+			MeshBlob blob(in_file);
+			blob.decompress();
+			blob.add_low_detail_meshes();
+
+			uint64_t in_bytes = blob.file.file.size;
+			uint32_t in_vertices = 0;
+			float acmr_before = 0.0f, acmr_after = 0.0f;
+
+			//vertices are welded if they're the same bit-for-bit:
+			struct VertexHash {
+				size_t operator()(MeshBlob::Vertex const &v) const {
+					uint32_t words[sizeof(MeshBlob::Vertex) / 4];
+					std::memcpy(words, &v, sizeof(words));
+					size_t hash = 0;
+					for (uint32_t w : words) hash = hash * 0x9e3779b1U + w;
+					return hash;
+				}
+			};
+			struct VertexEqual {
+				bool operator()(MeshBlob::Vertex const &a, MeshBlob::Vertex const &b) const {
+					return std::memcmp(&a, &b, sizeof(MeshBlob::Vertex)) == 0;
+				}
+			};
+
+			for (MeshBlob::Entry const &entry : blob.entries) {
+				//weld:
+				std::unordered_map< MeshBlob::Vertex, uint32_t, VertexHash, VertexEqual > welded;
+				std::vector< MeshBlob::Vertex > mesh_vertices;
+				std::vector< uint32_t > triangles;
+				uint32_t dropped = 0;
+				for (uint32_t i = 0; i + 2 < uint32_t(entry.mesh.count); i += 3) {
+					uint32_t tri[3];
+					for (uint32_t k = 0; k < 3; ++k) {
+						MeshBlob::Vertex v = blob.vertex(entry.mesh, i + k);
+						v.Position += glm::vec3(0.0f); //(so -0.0 and 0.0 weld)
+						auto ret = welded.emplace(v, uint32_t(mesh_vertices.size()));
+						if (ret.second) mesh_vertices.emplace_back(v);
+						tri[k] = ret.first->second;
+					}
+					if (tri[0] == tri[1] || tri[1] == tri[2] || tri[2] == tri[0]) {
+						++dropped;
+						continue;
+					}
+					triangles.insert(triangles.end(), tri, tri + 3);
+				}
+				in_vertices += uint32_t(entry.mesh.count);
+
+				//reorder triangles, then vertices by first use (dropping any only degenerate triangles used):
+				std::vector< uint32_t > order = optimize_triangle_order(triangles, uint32_t(mesh_vertices.size()));
+				acmr_before += acmr(triangles, 16) * float(triangles.size() / 3);
+				acmr_after += acmr(order, 16) * float(order.size() / 3);
+				std::vector< uint32_t > renumber(mesh_vertices.size(), -1U);
+				uint32_t used = 0;
+				for (uint32_t &v : order) {
+					if (renumber[v] == -1U) renumber[v] = used++;
+					v = renumber[v];
+				}
+				if (used > 65536) {
+					throw std::runtime_error("mesh '" + entry.name + "' has " + std::to_string(used) + " vertices after welding, which is too many for 16-bit indices.");
+				}
+
+				MeshBlob::OptimizedEntry out;
+				out.name_begin = uint32_t(names.size());
+				names += entry.name;
+				out.name_end = uint32_t(names.size());
+				out.index_begin = uint32_t(indices.size());
+				out.vertex_begin = uint32_t(vertices.size());
+				vertices.resize(vertices.size() + used);
+				for (uint32_t v = 0; v < renumber.size(); ++v) {
+					if (renumber[v] != -1U) vertices[out.vertex_begin + renumber[v]] = mesh_vertices[v];
+				}
+				for (uint32_t v : order) {
+					indices.emplace_back(MeshBlob::Index(v));
+				}
+				out.index_end = uint32_t(indices.size());
+				out.vertex_end = uint32_t(vertices.size());
+
+				out.min = glm::vec3(0.0f);
+				out.max = glm::vec3(0.0f);
+				for (uint32_t v = out.vertex_begin; v < out.vertex_end; ++v) {
+					out.min = (v == out.vertex_begin ? vertices[v].Position : glm::min(out.min, vertices[v].Position));
+					out.max = (v == out.vertex_begin ? vertices[v].Position : glm::max(out.max, vertices[v].Position));
+				}
+				index.emplace_back(out);
+
+				std::cout << "  '" << entry.name << "': " << order.size() / 3 << " triangles";
+				if (dropped) std::cout << " (dropped " << dropped << " degenerate)";
+				std::cout << ", " << entry.mesh.count << " -> " << used << " vertices";
+				if (!order.empty()) std::cout << ", " << acmr(triangles, 16) << " -> " << acmr(order, 16) << " vertices shaded per triangle";
+				std::cout << "." << std::endl;
+			}
+
+			//id table, with the same bits and multiplier as the blob's (which only depend on the ids):
+			ids.emplace_back(blob.table_bits);
+			ids.emplace_back(blob.table_multiplier);
+			for (MeshBlob::Slot const &slot : blob.table) {
+				if (slot.entry == -1U) {
+					ids.insert(ids.end(), { 0, 0, 0, 0 });
+				} else {
+					MeshBlob::OptimizedEntry const &e = index[slot.entry];
+					ids.insert(ids.end(), { slot.id, 1, e.index_begin, e.index_end - e.index_begin });
+				}
+			}
+
+			uint32_t triangle_count = uint32_t(indices.size() / 3);
+			std::cout << "Read '" << in_file << "' (" << in_bytes << " bytes): " << blob.entries.size() << " meshes (including low-detail versions), "
+				<< in_vertices << " -> " << vertices.size() << " vertices";
+			if (triangle_count) std::cout << ", " << acmr_before / triangle_count << " -> " << acmr_after / triangle_count << " vertices shaded per triangle (16-entry FIFO cache, after welding)";
+			std::cout << "." << std::endl;
+		}
+
+		auto bytes = [](void const *data, size_t size) {
+			uint8_t const *begin = reinterpret_cast< uint8_t const * >(data);
+			return std::vector< uint8_t >(begin, begin + size);
+		};
+		std::vector< BlobFile::Output > chunks(5);
+		chunks[0].type = "str0";
+		chunks[0].data = bytes(names.data(), names.size());
+		chunks[1].type = "idx1";
+		chunks[1].data = bytes(index.data(), index.size() * sizeof(MeshBlob::OptimizedEntry));
+		chunks[2].type = "ids0";
+		chunks[2].data = bytes(ids.data(), ids.size() * sizeof(uint32_t));
+		//(the bulk data starts on fresh pages, so reading the metadata above doesn't fault any of it in;
+		// compressed, it's streamed rather than used in place, so that doesn't matter)
+		chunks[3].type = "vtx1";
+		chunks[3].data = bytes(vertices.data(), vertices.size() * sizeof(MeshBlob::Vertex));
+		chunks[4].type = "ind1";
+		chunks[4].data = bytes(indices.data(), indices.size() * sizeof(MeshBlob::Index));
+		for (uint32_t i = 3; i < 5; ++i) {
+			chunks[i].alignment = (compress ? 16 : 4096);
+			chunks[i].compress = compress;
+		}
+		BlobFile::write(out_file, chunks);
+
+		uint64_t data_bytes = chunks[3].data.size() + chunks[4].data.size();
+		std::cout << "Wrote '" << out_file << "': " << vertices.size() << " vertices and " << indices.size() << " indices (" << data_bytes << " bytes";
+		if (compress) {
+			BlobFile written(out_file);
+			std::cout << ", deflated to " << written.find("vtx1")->size + written.find("ind1")->size << " bytes";
+		}
+		std::cout << ")." << std::endl;
+	} catch (std::exception &e) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
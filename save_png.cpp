@@ -0,0 +1,55 @@
+#include "save_png.hpp"
+
+#include <png.h>
+
+#include <cstdio>
+#include <stdexcept>
+#include <vector>
+
+void save_png(std::string const &filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin) {
+	if (size.x == 0 || size.y == 0) {
+		throw std::runtime_error("Refusing to write empty image to '" + filename + "'.");
+	}
+
+	//libpng wants the rows top-to-bottom:
+	std::vector< png_bytep > rows(size.y, nullptr);
+	for (uint32_t r = 0; r < size.y; ++r) {
+		uint32_t row = (origin == LowerLeftOrigin ? size.y - 1 - r : r);
+		rows[r] = (png_bytep)(data + row * size.x);
+	}
+
+	FILE *fp = fopen(filename.c_str(), "wb");
+	if (!fp) {
+		throw std::runtime_error("Failed to open '" + filename + "' for writing.");
+	}
+
+	png_structp png = png_create_write_struct(PNG_LIBPNG_VER_STRING, NULL, NULL, NULL);
+	png_infop info = png ? png_create_info_struct(png) : NULL;
+	if (!png || !info) {
+		png_destroy_write_struct(&png, &info);
+		fclose(fp);
+		throw std::runtime_error("Failed to create png write structures.");
+	}
+
+	//libpng reports errors by longjmp'ing back here (so nothing with a destructor gets created below):
+	if (setjmp(png_jmpbuf(png))) {
+		png_destroy_write_struct(&png, &info);
+		fclose(fp);
+		throw std::runtime_error("Error while writing '" + filename + "'.");
+	}
+
+	png_init_io(png, fp);
+
+	png_set_IHDR(png, info, size.x, size.y, 8, PNG_COLOR_TYPE_RGBA, PNG_INTERLACE_NONE, PNG_COMPRESSION_TYPE_DEFAULT, PNG_FILTER_TYPE_DEFAULT);
+
+	//these files get written in bulk (thumbnails, captured frames), so favor speed over size:
+	png_set_compression_level(png, 1);
+	png_set_filter(png, PNG_FILTER_TYPE_BASE, PNG_FILTER_SUB);
+
+	png_set_rows(png, info, &rows[0]);
+
+	png_write_png(png, info, PNG_TRANSFORM_IDENTITY, NULL);
+
+	png_destroy_write_struct(&png, &info);
+	fclose(fp);
+}
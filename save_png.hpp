@@ -0,0 +1,13 @@
+#pragma once
+
+#include <glm/glm.hpp>
+
+#include <string>
+
+//save_png writes RGBA8 pixel data to a .png file; throws on failure.
+// glReadPixels-style data has its first row at the bottom, so pass LowerLeftOrigin for that.
+enum OriginLocation {
+	LowerLeftOrigin,
+	UpperLeftOrigin,
+};
+void save_png(std::string const &filename, glm::uvec2 size, glm::u8vec4 const *data, OriginLocation origin);
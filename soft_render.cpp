@@ -0,0 +1,105 @@
+//soft_render renders generated boards to .png files entirely on the CPU (no OpenGL needed).
+// usage: soft_render <count> <output-dir> [width height [threads]]
+//Output names match 'thumbnails', so the two can be compared image-by-image.
+
+#include "SoftRaster.hpp" //CPU rasterizer
+#include "save_png.hpp" //helper for writing .png files
+#include "data_path.hpp" //helper to get paths relative to executable
+#include "MeshBlob.hpp"
+#include "Board.hpp"
+
+#include <glm/glm.hpp>
+
+#if defined(_WIN32)
+#include <direct.h>
+#else
+#include <sys/stat.h>
+#endif
+#include <cerrno>
+#include <cstdio>
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+	struct {
+		uint32_t count = 100;
+		std::string output_dir = "thumbnails";
+		glm::uvec2 size = glm::uvec2(256, 160);
+		uint32_t threads = 0;
+	} config;
+
+	if (argc != 3 && argc != 5 && argc != 6) {
+		std::cerr << "Usage:\n\t" << argv[0] << " <count> <output-dir> [width height [threads]]\n"
+			"Renders the first <count> generated boards to <output-dir>/board-NNNNN.png without OpenGL" << std::endl;
+		return 1;
+	}
+	config.count = std::stoul(argv[1]);
+	config.output_dir = argv[2];
+	if (argc >= 5) {
+		config.size = glm::uvec2(std::stoul(argv[3]), std::stoul(argv[4]));
+	}
+	if (argc >= 6) {
+		config.threads = std::stoul(argv[5]);
+	}
+	if (config.size.x == 0 || config.size.y == 0) {
+		std::cerr << "Image size must be non-zero." << std::endl;
+		return 1;
+	}
+
+	#if defined(_WIN32)
+	int made = _mkdir(config.output_dir.c_str());
+	#else
+	int made = mkdir(config.output_dir.c_str(), 0755);
+	#endif
+	if (made != 0 && errno != EEXIST) {
+		std::cerr << "Failed to create output directory '" << config.output_dir << "'." << std::endl;
+		return 1;
+	}
+
+	try {
+		//load the same meshes the game uses:
+		MeshBlob blob(data_path("meshes.blob"));
+		blob.decompress(); //(the rasterizer reads vertices on the CPU)
+		BoardMeshes meshes;
+		meshes.lookup(blob);
+
+		//same board sequence as the game (and 'thumbnails'):
+		Board board(&meshes);
+		board.create_board();
+
+		SoftRaster raster(config.size, config.threads);
+		std::cout << "Rendering on " << raster.threads << " threads." << std::endl;
+
+		std::vector< MeshInstance > instances;
+
+		auto before = std::chrono::high_resolution_clock::now();
+
+		for (uint32_t i = 0; i < config.count; ++i) {
+			if (i > 0) board.create_board();
+
+			//same clear color as the main loop in main.cpp:
+			raster.clear(glm::vec4(0.5f, 0.5f, 0.5f, 0.0f));
+
+			instances.clear();
+			board.get_instances(&instances);
+			raster.draw(blob, instances, board.world_to_clip(config.size), BoardLighting());
+
+			char name[32];
+			snprintf(name, sizeof(name), "board-%05u.png", i);
+			save_png(config.output_dir + "/" + name, config.size, raster.color.data(), LowerLeftOrigin);
+		}
+
+		auto after = std::chrono::high_resolution_clock::now();
+		float seconds = std::chrono::duration< float >(after - before).count();
+		std::cout << "Wrote " << config.count << " images in " << seconds << "s." << std::endl;
+	} catch (std::exception &e) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}
@@ -0,0 +1,158 @@
+//thumbnails renders a whole run of generated boards to .png files without opening a window.
+// usage: thumbnails <count> <output-dir> [width height]
+
+#include "headless_context.hpp" //window-less OpenGL context
+#include "save_png.hpp" //helper for writing .png files
+#include "gl_errors.hpp" //helper for dumpping OpenGL error messages
+#include "gl_state.hpp" //cache that skips redundant OpenGL state changes
+#include "Game.hpp"
+
+#include "GL.hpp"
+
+#include <glm/glm.hpp>
+
+#include <sys/stat.h>
+#include <cerrno>
+#include <cstdio>
+
+#include <chrono>
+#include <iostream>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+int main(int argc, char **argv) {
+	struct {
+		uint32_t count = 100;
+		std::string output_dir = "thumbnails";
+		glm::uvec2 size = glm::uvec2(256, 160);
+	} config;
+
+	if (argc != 3 && argc != 5) {
+		std::cerr << "Usage:\n\t" << argv[0] << " <count> <output-dir> [width height]\n"
+			"Renders the first <count> generated boards to <output-dir>/board-NNNNN.png" << std::endl;
+		return 1;
+	}
+	config.count = std::stoul(argv[1]);
+	config.output_dir = argv[2];
+	if (argc == 5) {
+		config.size = glm::uvec2(std::stoul(argv[3]), std::stoul(argv[4]));
+	}
+	if (config.size.x == 0 || config.size.y == 0) {
+		std::cerr << "Thumbnail size must be non-zero." << std::endl;
+		return 1;
+	}
+
+	if (mkdir(config.output_dir.c_str(), 0755) != 0 && errno != EEXIST) {
+		std::cerr << "Failed to create output directory '" << config.output_dir << "'." << std::endl;
+		return 1;
+	}
+
+	try {
+		//------------  initialization ------------
+
+		HeadlessContext headless;
+
+		std::cout << "Rendering with " << glGetString(GL_RENDERER) << " (" << glGetString(GL_VERSION) << ")" << std::endl;
+
+		//framebuffer to draw thumbnails into (there is no window to draw to):
+		GLuint color_rb = 0, depth_rb = 0, fb = 0;
+		glGenRenderbuffers(1, &color_rb);
+		glBindRenderbuffer(GL_RENDERBUFFER, color_rb);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_RGBA8, config.size.x, config.size.y);
+		glGenRenderbuffers(1, &depth_rb);
+		glBindRenderbuffer(GL_RENDERBUFFER, depth_rb);
+		glRenderbufferStorage(GL_RENDERBUFFER, GL_DEPTH24_STENCIL8, config.size.x, config.size.y);
+		glBindRenderbuffer(GL_RENDERBUFFER, 0);
+
+		glGenFramebuffers(1, &fb);
+		glBindFramebuffer(GL_FRAMEBUFFER, fb);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_COLOR_ATTACHMENT0, GL_RENDERBUFFER, color_rb);
+		glFramebufferRenderbuffer(GL_FRAMEBUFFER, GL_DEPTH_STENCIL_ATTACHMENT, GL_RENDERBUFFER, depth_rb);
+		if (glCheckFramebufferStatus(GL_FRAMEBUFFER) != GL_FRAMEBUFFER_COMPLETE) {
+			throw std::runtime_error("Thumbnail framebuffer is incomplete.");
+		}
+
+		//two pixel pack buffers, so board N+1 can be drawn and read back while board N is being written out:
+		GLsizeiptr const frame_bytes = config.size.x * config.size.y * sizeof(glm::u8vec4);
+		GLuint pbos[2] = {0, 0};
+		glGenBuffers(2, pbos);
+		for (GLuint pbo : pbos) {
+			gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, pbo);
+			glBufferData(GL_PIXEL_PACK_BUFFER, frame_bytes, NULL, GL_STREAM_READ);
+		}
+		gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+
+		GL_ERRORS();
+
+		//------------ create game object (loads assets) --------------
+
+		Game game;
+
+		//------------ render loop ------------
+
+		auto before = std::chrono::high_resolution_clock::now();
+
+		//each pass draws board 'i' and writes out board 'i-1':
+		for (uint32_t i = 0; i <= config.count; ++i) {
+			if (i < config.count) {
+				//the game constructor already made the first board:
+				if (i > 0) game.board.create_board();
+
+				//same default state as the main loop in main.cpp:
+				glBindFramebuffer(GL_FRAMEBUFFER, fb);
+				glViewport(0, 0, config.size.x, config.size.y);
+				glClearColor(0.5, 0.5, 0.5, 0.0);
+				glClear(GL_COLOR_BUFFER_BIT | GL_DEPTH_BUFFER_BIT);
+				gl_state_Enable(GL_DEPTH_TEST);
+				gl_state_Enable(GL_BLEND);
+				gl_state_BlendFunc(GL_SRC_ALPHA, GL_ONE_MINUS_SRC_ALPHA);
+
+				game.draw(config.size);
+
+				//start an asynchronous read of the pixels into this board's buffer:
+				glReadBuffer(GL_COLOR_ATTACHMENT0);
+				gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, pbos[i % 2]);
+				glReadPixels(0, 0, config.size.x, config.size.y, GL_RGBA, GL_UNSIGNED_BYTE, 0);
+				gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			}
+
+			if (i > 0) {
+				//the previous board's read has had a whole board's worth of time to finish:
+				gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, pbos[(i - 1) % 2]);
+				glm::u8vec4 const *pixels = (glm::u8vec4 const *)glMapBufferRange(GL_PIXEL_PACK_BUFFER, 0, frame_bytes, GL_MAP_READ_BIT);
+				if (!pixels) {
+					throw std::runtime_error("Failed to map pixel pack buffer.");
+				}
+
+				char name[32];
+				snprintf(name, sizeof(name), "board-%05u.png", i - 1);
+				save_png(config.output_dir + "/" + name, config.size, pixels, LowerLeftOrigin);
+
+				glUnmapBuffer(GL_PIXEL_PACK_BUFFER);
+				gl_state_BindBuffer(GL_PIXEL_PACK_BUFFER, 0);
+			}
+		}
+
+		GL_ERRORS();
+
+		auto after = std::chrono::high_resolution_clock::now();
+		float seconds = std::chrono::duration< float >(after - before).count();
+		std::cout << "Wrote " << config.count << " thumbnails in " << seconds << "s";
+		if (seconds > 0.0f) std::cout << " (" << (config.count / seconds) * 60.0f << " per minute)";
+		std::cout << "." << std::endl;
+
+		//------------  teardown ------------
+
+		gl_state_DeleteBuffers(2, pbos);
+		glBindFramebuffer(GL_FRAMEBUFFER, 0);
+		glDeleteFramebuffers(1, &fb);
+		glDeleteRenderbuffers(1, &depth_rb);
+		glDeleteRenderbuffers(1, &color_rb);
+	} catch (std::exception &e) {
+		std::cerr << "Error: " << e.what() << std::endl;
+		return 1;
+	}
+
+	return 0;
+}